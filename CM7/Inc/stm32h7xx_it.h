@@ -42,6 +42,7 @@ void SysTick_Handler(void);
 void LTDC_IRQHandler(void);
 void LTDC_ER_IRQHandler(void);
 void DSI_IRQHandler(void);
+void DMA2D_IRQHandler(void);
 
 #ifdef __cplusplus
 }
@@ -35,6 +35,7 @@
 /* Private variables ---------------------------------------------------------*/
 extern LTDC_HandleTypeDef hlcd_ltdc;   
 extern DSI_HandleTypeDef hlcd_dsi;
+extern void DMA2D_Driver_IRQHandler(void);
 /* Private function prototypes -----------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
 
@@ -180,6 +181,16 @@ void DSI_IRQHandler(void)
   HAL_DSI_IRQHandler(&hlcd_dsi);
 }
 
+/**
+  * @brief  This function handles DMA2D interrupt request.
+  * @param  None
+  * @retval None
+  */
+void DMA2D_IRQHandler(void)
+{
+  DMA2D_Driver_IRQHandler();
+}
+
 /******************************************************************************/
 /*                 STM32H7xx Peripherals Interrupt Handlers                   */
 /*  Add here the Interrupt Handler for the used peripheral(s) (PPP), for the  */
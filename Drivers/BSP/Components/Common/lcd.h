@@ -75,6 +75,7 @@ typedef struct
   int32_t ( *GetYSize        ) (uint32_t, uint32_t *);
   int32_t ( *SetLayer        ) (uint32_t, uint32_t);
   int32_t ( *GetFormat       ) (uint32_t, uint32_t *);
+  int32_t ( *GetFrameBuffer  ) (uint32_t, uint32_t *);
 } LCD_UTILS_Drv_t;
 
 typedef struct
@@ -58,6 +58,9 @@
      o Draw an horizontal line using the BSP_LCD_DrawHLine() function.
      o Draw a vertical line using the BSP_LCD_DrawVLine() function.
      o Draw a bitmap image using the BSP_LCD_DrawBitmap() function.
+     o In an L8 layer, set up by the display wrapper, colors are palette indices:
+       the low byte of each color or of each ARGB8888 word of the RGB data is
+       written. Bitmaps cannot be drawn in L8.
 
    + Options
      o Configure the LTDC reload mode by calling BSP_LCD_Relaod(). By default, the
@@ -129,7 +132,8 @@ const LCD_UTILS_Drv_t LCD_Driver =
   BSP_LCD_GetXSize,
   BSP_LCD_GetYSize,
   BSP_LCD_SetActiveLayer,
-  BSP_LCD_GetPixelFormat
+  BSP_LCD_GetPixelFormat,
+  BSP_LCD_GetFrameBuffer
 };
 
 typedef struct
@@ -160,7 +164,6 @@ typedef struct
   */
 void                *Lcd_CompObj = NULL;
 DSI_HandleTypeDef   hlcd_dsi;
-DMA2D_HandleTypeDef hlcd_dma2d;
 LTDC_HandleTypeDef  hlcd_ltdc;
 BSP_LCD_Ctx_t       Lcd_Ctx[LCD_INSTANCES_NBR];
 /**
@@ -187,12 +190,20 @@ static void LTDC_HDMI_Init(LCD_HDMI_Timing_t *Timing);
 
 static void LTDC_MspInit(LTDC_HandleTypeDef *hltdc);
 static void LTDC_MspDeInit(LTDC_HandleTypeDef *hltdc);
-static void DMA2D_MspInit(DMA2D_HandleTypeDef *hdma2d);
-static void DMA2D_MspDeInit(DMA2D_HandleTypeDef *hdma2d);
+static void DMA2D_MspInit(void);
+static void DMA2D_MspDeInit(void);
 static void LL_FillBuffer(uint32_t Instance, uint32_t *pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t Color);
 static void LL_ConvertLineToRGB(uint32_t Instance, uint32_t *pSrc, uint32_t *pDst, uint32_t xSize, uint32_t ColorMode);
+static void LL_FillIndexedRect(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint8_t *pData, uint32_t Width, uint32_t Height);
 static void LCD_InitSequence(void);
 static void LCD_DeInitSequence(void);
+
+/* DMA2D driver and CPU/DMA2D dispatch shared with the display wrapper
+   (dma2d_driver.cpp, draw_dispatcher.cpp) */
+extern void DRAW_Dispatch_Fill(uint32_t *pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint32_t ColorMode, uint32_t Color);
+extern void DRAW_Dispatch_FillIndexed(uint8_t *pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint8_t Index);
+extern void DRAW_Dispatch_ConvertLine(uint32_t *pSrc, uint32_t *pDst, uint32_t xSize, uint32_t InputColorMode, uint32_t OutputColorMode);
+extern void DMA2D_Driver_Invalidate(void);
 /**
   * @}
   */
@@ -271,7 +282,6 @@ int32_t BSP_LCD_InitEx(uint32_t Instance, uint32_t Orientation, uint32_t PixelFo
 
     /* Initializes peripherals instance value */
     hlcd_ltdc.Instance = LTDC;
-    hlcd_dma2d.Instance = DMA2D;
     hlcd_dsi.Instance = DSI;
 
     /* MSP initialization */
@@ -288,7 +298,7 @@ int32_t BSP_LCD_InitEx(uint32_t Instance, uint32_t Orientation, uint32_t PixelFo
     LTDC_MspInit(&hlcd_ltdc);
 #endif
 
-    DMA2D_MspInit(&hlcd_dma2d);
+    DMA2D_MspInit();
 
 #if (USE_HAL_DSI_REGISTER_CALLBACKS == 1)
     /* Register the DSI MSP Callbacks */
@@ -391,7 +401,7 @@ int32_t BSP_LCD_DeInit(uint32_t Instance)
     LTDC_MspDeInit(&hlcd_ltdc);
 #endif /* (USE_HAL_LTDC_REGISTER_CALLBACKS == 0) */
 
-    DMA2D_MspDeInit(&hlcd_dma2d);
+    DMA2D_MspDeInit();
 
 #if (USE_HAL_DSI_REGISTER_CALLBACKS == 0)
     DSI_MspDeInit(&hlcd_dsi);
@@ -403,14 +413,7 @@ int32_t BSP_LCD_DeInit(uint32_t Instance)
     else
     {
       (void)HAL_LTDC_DeInit(&hlcd_ltdc);
-      if(HAL_DMA2D_DeInit(&hlcd_dma2d) != HAL_OK)
-      {
-        ret = BSP_ERROR_PERIPH_FAILURE;
-      }
-      else
-      {
-        Lcd_Ctx[Instance].IsMspCallbacksValid = 0;
-      }
+      Lcd_Ctx[Instance].IsMspCallbacksValid = 0;
     }
   }
 
@@ -450,7 +453,6 @@ int32_t BSP_LCD_InitHDMI(uint32_t Instance, uint32_t Format)
 
     /* Initializes peripherals instance value */
     hlcd_ltdc.Instance = LTDC;
-    hlcd_dma2d.Instance = DMA2D;
     hlcd_dsi.Instance = DSI;
 
     if(ADV7533_Probe() != BSP_ERROR_NONE)
@@ -482,7 +484,7 @@ int32_t BSP_LCD_InitHDMI(uint32_t Instance, uint32_t Format)
       LTDC_MspInit(&hlcd_ltdc);
 #endif
 
-      DMA2D_MspInit(&hlcd_dma2d);
+      DMA2D_MspInit();
 
 #if (USE_HAL_DSI_REGISTER_CALLBACKS == 1)
       /* Register the DSI MSP Callbacks */
@@ -1057,6 +1059,28 @@ int32_t BSP_LCD_GetPixelFormat(uint32_t Instance, uint32_t *PixelFormat)
 
   return ret;
 }
+
+/**
+  * @brief  Gets the frame buffer address of the active layer, for direct pixel access.
+  * @param  Instance LCD Instance
+  * @param  Address  Address of the first pixel, rows are XSize pixels apart
+  * @retval BSP status
+  */
+int32_t BSP_LCD_GetFrameBuffer(uint32_t Instance, uint32_t *Address)
+{
+  int32_t ret = BSP_ERROR_NONE;
+
+  if(Instance >= LCD_INSTANCES_NBR)
+  {
+    ret = BSP_ERROR_WRONG_PARAM;
+  }
+  else
+  {
+    *Address = hlcd_ltdc.LayerCfg[Lcd_Ctx[Instance].ActiveLayer].FBStartAdress;
+  }
+
+  return ret;
+}
 /**
   * @brief  Control the LTDC reload
   * @param  Instance    LCD Instance
@@ -1449,7 +1473,7 @@ int32_t BSP_LCD_GetBrightness(uint32_t Instance, uint32_t *Brightness)
   * @param  Xpos Bmp X position in the LCD
   * @param  Ypos Bmp Y position in the LCD
   * @param  pBmp Pointer to Bmp picture address in the internal Flash.
-  * @retval BSP status
+  * @retval BSP status, BSP_ERROR_FEATURE_NOT_SUPPORTED in L8
   */
 int32_t BSP_LCD_DrawBitmap(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint8_t *pBmp)
 {
@@ -1459,6 +1483,12 @@ int32_t BSP_LCD_DrawBitmap(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint
   uint32_t input_color_mode;
   uint8_t *pbmp;
 
+  /* The DMA2D cannot convert to palette indices */
+  if(Lcd_Ctx[Instance].PixelFormat == LCD_PIXEL_FORMAT_L8)
+  {
+    return BSP_ERROR_FEATURE_NOT_SUPPORTED;
+  }
+
   /* Get bitmap data address offset */
   index = (uint32_t)pBmp[10] + ((uint32_t)pBmp[11] << 8) + ((uint32_t)pBmp[12] << 16)  + ((uint32_t)pBmp[13] << 24);
 
@@ -1509,7 +1539,8 @@ int32_t BSP_LCD_DrawBitmap(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint
   * @param  Instance LCD Instance.
   * @param  Xpos X position.
   * @param  Ypos Y position.
-  * @param  pData Pointer to RGB line data
+  * @param  pData Pointer to RGB line data, ARGB8888 words whose low byte is the
+  *         palette index in L8
   * @param  Width Rectangle width.
   * @param  Height Rectangle Height.
   * @retval BSP status.
@@ -1518,6 +1549,12 @@ int32_t BSP_LCD_FillRGBRect(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uin
 {
     uint32_t i;
 
+  if(Lcd_Ctx[Instance].PixelFormat == LCD_PIXEL_FORMAT_L8)
+  {
+    LL_FillIndexedRect(Instance, Xpos, Ypos, pData, Width, Height);
+    return BSP_ERROR_NONE;
+  }
+
 #if (USE_DMA2D_TO_FILL_RGB_RECT == 1)
   uint32_t  Xaddress;
   for(i = 0; i < Height; i++)
@@ -1645,6 +1682,11 @@ int32_t BSP_LCD_ReadPixel(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint3
     /* Read data value from SDRAM memory */
     *Color = *(__IO uint32_t*) (hlcd_ltdc.LayerCfg[Lcd_Ctx[Instance].ActiveLayer].FBStartAdress + (4U*(Ypos*Lcd_Ctx[Instance].XSize + Xpos)));
   }
+  else if(hlcd_ltdc.LayerCfg[Lcd_Ctx[Instance].ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_L8)
+  {
+    /* Read palette index from SDRAM memory */
+    *Color = *(__IO uint8_t*) (hlcd_ltdc.LayerCfg[Lcd_Ctx[Instance].ActiveLayer].FBStartAdress + (Ypos*Lcd_Ctx[Instance].XSize + Xpos));
+  }
   else /* if((hlcd_ltdc.LayerCfg[layer].PixelFormat == LTDC_PIXEL_FORMAT_RGB565) */
   {
     /* Read data value from SDRAM memory */
@@ -1669,6 +1711,11 @@ int32_t BSP_LCD_WritePixel(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint
     /* Write data value to SDRAM memory */
     *(__IO uint32_t*) (hlcd_ltdc.LayerCfg[Lcd_Ctx[Instance].ActiveLayer].FBStartAdress + (4U*(Ypos*Lcd_Ctx[Instance].XSize + Xpos))) = Color;
   }
+  else if(hlcd_ltdc.LayerCfg[Lcd_Ctx[Instance].ActiveLayer].PixelFormat == LTDC_PIXEL_FORMAT_L8)
+  {
+    /* Write palette index to SDRAM memory */
+    *(__IO uint8_t*) (hlcd_ltdc.LayerCfg[Lcd_Ctx[Instance].ActiveLayer].FBStartAdress + (Ypos*Lcd_Ctx[Instance].XSize + Xpos)) = (uint8_t)Color;
+  }
   else
   {
     /* Write data value to SDRAM memory */
@@ -1700,6 +1747,10 @@ static void LL_FillBuffer(uint32_t Instance, uint32_t *pDst, uint32_t xSize, uin
 
   switch(Lcd_Ctx[Instance].PixelFormat)
   {
+  case LCD_PIXEL_FORMAT_L8:
+    /* The DMA2D has no L8 output, the indices are written by words or by the CPU */
+    DRAW_Dispatch_FillIndexed((uint8_t *)pDst, xSize, ySize, OffLine, (uint8_t)Color);
+    return;
   case LCD_PIXEL_FORMAT_RGB565:
     output_color_mode = DMA2D_OUTPUT_RGB565; /* RGB565 */
     input_color = CONVERTRGB5652ARGB8888(Color);
@@ -1710,24 +1761,33 @@ static void LL_FillBuffer(uint32_t Instance, uint32_t *pDst, uint32_t xSize, uin
     break;
   }
 
-  /* Register to memory mode with ARGB8888 as color Mode */
-  hlcd_dma2d.Init.Mode         = DMA2D_R2M;
-  hlcd_dma2d.Init.ColorMode    = output_color_mode;
-  hlcd_dma2d.Init.OutputOffset = OffLine;
+  /* Small fills are done by the CPU, others by a register to memory transfer */
+  DRAW_Dispatch_Fill(pDst, xSize, ySize, OffLine, output_color_mode, input_color);
+}
 
-  hlcd_dma2d.Instance = DMA2D;
+/**
+  * @brief  Writes the palette indices of a rectangle of an L8 layer, taken from
+  *         the low byte of ARGB8888 words.
+  * @param  Instance LCD Instance
+  * @param  Xpos X position
+  * @param  Ypos Y position
+  * @param  pData Pointer to the ARGB8888 words
+  * @param  Width Rectangle width
+  * @param  Height Rectangle height
+  */
+static void LL_FillIndexedRect(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint8_t *pData, uint32_t Width, uint32_t Height)
+{
+  uint32_t i, j;
+  uint8_t *p_dst;
 
-  /* DMA2D Initialization */
-  if(HAL_DMA2D_Init(&hlcd_dma2d) == HAL_OK)
+  for(i = 0; i < Height; i++)
   {
-    if(HAL_DMA2D_ConfigLayer(&hlcd_dma2d, 1) == HAL_OK)
+    p_dst = (uint8_t *)(hlcd_ltdc.LayerCfg[Lcd_Ctx[Instance].ActiveLayer].FBStartAdress + (Lcd_Ctx[Instance].XSize*(Ypos + i)) + Xpos);
+    for(j = 0; j < Width; j++)
     {
-      if (HAL_DMA2D_Start(&hlcd_dma2d, input_color, (uint32_t)pDst, xSize, ySize) == HAL_OK)
-      {
-        /* Polling For DMA transfer */
-        (void)HAL_DMA2D_PollForTransfer(&hlcd_dma2d, 25);
-      }
+      p_dst[j] = pData[4U*j];
     }
+    pData += 4U*Width;
   }
 }
 
@@ -1754,31 +1814,9 @@ static void LL_ConvertLineToRGB(uint32_t Instance, uint32_t *pSrc, uint32_t *pDs
     break;
   }
 
-  /* Configure the DMA2D Mode, Color Mode and output offset */
-  hlcd_dma2d.Init.Mode         = DMA2D_M2M_PFC;
-  hlcd_dma2d.Init.ColorMode    = output_color_mode;
-  hlcd_dma2d.Init.OutputOffset = 0;
-
-  /* Foreground Configuration */
-  hlcd_dma2d.LayerCfg[1].AlphaMode = DMA2D_NO_MODIF_ALPHA;
-  hlcd_dma2d.LayerCfg[1].InputAlpha = 0xFF;
-  hlcd_dma2d.LayerCfg[1].InputColorMode = ColorMode;
-  hlcd_dma2d.LayerCfg[1].InputOffset = 0;
-
-  hlcd_dma2d.Instance = DMA2D;
-
-  /* DMA2D Initialization */
-  if(HAL_DMA2D_Init(&hlcd_dma2d) == HAL_OK)
-  {
-    if(HAL_DMA2D_ConfigLayer(&hlcd_dma2d, 1) == HAL_OK)
-    {
-      if (HAL_DMA2D_Start(&hlcd_dma2d, (uint32_t)pSrc, (uint32_t)pDst, xSize, 1) == HAL_OK)
-      {
-        /* Polling For DMA transfer */
-        (void)HAL_DMA2D_PollForTransfer(&hlcd_dma2d, 50);
-      }
-    }
-  }
+  /* Memory to memory with pixel format conversion, or a CPU copy of a short line
+     already in the output format */
+  DRAW_Dispatch_ConvertLine(pSrc, pDst, xSize, ColorMode, output_color_mode);
 }
 
 /*******************************************************************************
@@ -1825,40 +1863,37 @@ static void LTDC_MspDeInit(LTDC_HandleTypeDef *hltdc)
 
 /**
   * @brief  Initialize the BSP DMA2D Msp.
-  * @param  hdma2d  DMA2D handle
   * @retval None
   */
-static void DMA2D_MspInit(DMA2D_HandleTypeDef *hdma2d)
+static void DMA2D_MspInit(void)
 {
-  if(hdma2d->Instance == DMA2D)
-  {
-    /** Enable the DMA2D clock */
-    __HAL_RCC_DMA2D_CLK_ENABLE();
+  /** Enable the DMA2D clock */
+  __HAL_RCC_DMA2D_CLK_ENABLE();
 
-    /** Toggle Sw reset of DMA2D IP */
-    __HAL_RCC_DMA2D_FORCE_RESET();
-    __HAL_RCC_DMA2D_RELEASE_RESET();
-  }
+  /** Toggle Sw reset of DMA2D IP */
+  __HAL_RCC_DMA2D_FORCE_RESET();
+  __HAL_RCC_DMA2D_RELEASE_RESET();
+
+  /** The registers are back to their reset values */
+  DMA2D_Driver_Invalidate();
 }
 
 /**
   * @brief  De-Initializes the BSP DMA2D Msp
-  * @param  hdma2d  DMA2D handle
   * @retval None
   */
-static void DMA2D_MspDeInit(DMA2D_HandleTypeDef *hdma2d)
+static void DMA2D_MspDeInit(void)
 {
-  if(hdma2d->Instance == DMA2D)
-  {
-    /** Disable IRQ of DMA2D IP */
-    HAL_NVIC_DisableIRQ(DMA2D_IRQn);
+  /** Disable IRQ of DMA2D IP */
+  HAL_NVIC_DisableIRQ(DMA2D_IRQn);
 
-    /** Force and let in reset state DMA2D */
-    __HAL_RCC_DMA2D_FORCE_RESET();
+  /** Force and let in reset state DMA2D */
+  __HAL_RCC_DMA2D_FORCE_RESET();
 
-    /** Disable the DMA2D */
-    __HAL_RCC_DMA2D_CLK_DISABLE();
-  }
+  /** Disable the DMA2D */
+  __HAL_RCC_DMA2D_CLK_DISABLE();
+
+  DMA2D_Driver_Invalidate();
 }
 
 /**
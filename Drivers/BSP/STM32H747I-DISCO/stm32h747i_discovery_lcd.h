@@ -236,7 +236,6 @@ typedef struct
   * @{
   */
 extern DSI_HandleTypeDef   hlcd_dsi;
-extern DMA2D_HandleTypeDef hlcd_dma2d;
 extern LTDC_HandleTypeDef  hlcd_ltdc;
 extern BSP_LCD_Ctx_t       Lcd_Ctx[];
 extern void               *Lcd_CompObj;
@@ -297,6 +296,7 @@ HAL_StatusTypeDef MX_LTDC_ClockConfig2(LTDC_HandleTypeDef *hltdc);
 HAL_StatusTypeDef MX_DSIHOST_DSI_Init(DSI_HandleTypeDef *hdsi, uint32_t Width, uint32_t Height, uint32_t PixelFormat);
 int32_t BSP_LCD_FillRGBRect(uint32_t Instance, uint32_t Xpos, uint32_t Ypos, uint8_t *pData, uint32_t Width, uint32_t Height);
 int32_t BSP_LCD_GetPixelFormat(uint32_t Instance, uint32_t *PixelFormat);
+int32_t BSP_LCD_GetFrameBuffer(uint32_t Instance, uint32_t *Address);
 /**
   * @}
   */
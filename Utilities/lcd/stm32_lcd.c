@@ -33,11 +33,17 @@
          BSP_LCD_GetXSize
          BSP_LCD_GetYSize
          BSP_LCD_SetActiveLayer
+         BSP_LCD_GetFrameBuffer (optional, lines are drawn pixel by pixel without it)
+
+   - With an L8 frame buffer, the colors given to the services are palette indices
+     (their low byte is written), bitmaps cannot be drawn and lines are not
+     anti-aliased.
 
    - At application level, once the LCD is initialized, user should call UTIL_LCD_SetFuncDriver()
      API to link board LCD drivers to BASIC GUI LCD drivers.
      User can then call the BASIC GUI services:
          UTIL_LCD_SetFuncDriver()
+         UTIL_LCD_SetDrawHook()
          UTIL_LCD_SetLayer()
          UTIL_LCD_SetDevice()
          UTIL_LCD_SetTextColor()
@@ -59,6 +65,8 @@
          UTIL_LCD_DrawBitmap()
          UTIL_LCD_FillRect()
          UTIL_LCD_DrawLine()
+         UTIL_LCD_DrawLineAA()
+         UTIL_LCD_DrawThickLine()
          UTIL_LCD_DrawRect()
          UTIL_LCD_DrawCircle()
          UTIL_LCD_DrawPolygon()
@@ -70,6 +78,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "stm32_lcd.h"
+#include <math.h>
 
 /** @addtogroup Utilities
   * @{
@@ -91,6 +100,34 @@
   #define UTIL_LCD_MAX_LAYERS_NBR    2U
 #endif
 
+/* Edges kept on the stack by UTIL_LCD_FillPolygon(), 24 bytes each. Polygons with
+   more points are filled more slowly */
+#ifndef UTIL_LCD_MAX_POLY_POINTS
+  #define UTIL_LCD_MAX_POLY_POINTS   64U
+#endif
+
+/** @defgroup UTIL_LCD_Private_Types STM32 LCD Utility Private Types
+  * @{
+  */
+
+/**
+  * @brief  Polygon edge stepped from row to row by UTIL_LCD_FillPolygon()
+  */
+typedef struct
+{
+  int32_t Xpos;      /*!< Column where the edge crosses the current row */
+  int32_t Error;     /*!< Fraction of a column past Xpos, in 1 / ErrorMax */
+  int32_t Step;      /*!< Whole columns moved from one row to the next */
+  int32_t ErrorStep; /*!< Fraction of a column moved from one row to the next */
+  int32_t ErrorMax;  /*!< Twice the height of the edge */
+  int16_t YTop;      /*!< First row crossed on the display */
+  int16_t YLast;     /*!< Last row crossed on the display */
+} PolyEdge_t;
+
+/**
+  * @}
+  */
+
 /** @defgroup UTIL_LCD_Private_Macros STM32 LCD Utility Private Macros
   * @{
   */
@@ -106,23 +143,6 @@
                                      ((((((Color >> 5) & 0x3FU) * 259) + 33) >> 6) << 8) |\
                                      ((((Color & 0x1FU) * 527) + 23) >> 6) | 0xFF000000)
 
-/**
-  * @}
-  */
-
-/** @defgroup UTIL_LCD_Private_Types STM32 LCD Utility Private Types
-  * @{
-  */
-typedef struct
-{
-  uint32_t x1;
-  uint32_t y1;
-  uint32_t x2;
-  uint32_t y2;
-  uint32_t x3;
-  uint32_t y3;
-}Triangle_Positions_t;
-
 /**
   * @}
   */
@@ -137,6 +157,12 @@ typedef struct
 static UTIL_LCD_Ctx_t DrawProp[UTIL_LCD_MAX_LAYERS_NBR];
 static LCD_UTILS_Drv_t FuncDriver;
 
+/**
+  * @brief  Function called before drawing, and its context
+  */
+static UTIL_LCD_DrawHook_t DrawHook;
+static void *DrawHookContext;
+
 /**
   * @}
   */
@@ -145,7 +171,26 @@ static LCD_UTILS_Drv_t FuncDriver;
   * @{
   */
 static void DrawChar(uint32_t Xpos, uint32_t Ypos, const uint8_t *pData);
-static void FillTriangle(Triangle_Positions_t *Positions, uint32_t Color);
+static void FillSpan(int32_t Xpos1, int32_t Xpos2, int32_t Ypos, uint32_t Color);
+static uint32_t GetFrameBuffer(uint8_t **pBuffer);
+static uint32_t BlendColor(uint32_t Color, uint32_t BackColor, uint32_t Alpha);
+static void BlendPixel(int32_t Xpos, int32_t Ypos, uint8_t *pPixel, uint32_t Bpp, uint32_t Color, uint32_t Alpha);
+static void NotifyDraw(int32_t Xpos1, int32_t Ypos1, int32_t Xpos2, int32_t Ypos2);
+static void NotifyDrawLine(uint32_t Xpos1, uint32_t Ypos1, uint32_t Xpos2, uint32_t Ypos2, uint32_t Margin);
+static void NotifyDrawPolygon(pPoint Points, uint32_t PointCount);
+static void NotifyDrawEllipse(int Xpos, int Ypos, int XRadius, int YRadius);
+static void SetPixel(uint16_t Xpos, uint16_t Ypos, uint32_t Color);
+static void DrawHLine(uint32_t Xpos, uint32_t Ypos, uint32_t Length, uint32_t Color);
+static void DrawVLine(uint32_t Xpos, uint32_t Ypos, uint32_t Length, uint32_t Color);
+static void DrawLine(uint32_t Xpos1, uint32_t Ypos1, uint32_t Xpos2, uint32_t Ypos2, uint32_t Color);
+static void DrawCircle(uint32_t Xpos, uint32_t Ypos, uint32_t Radius, uint32_t Color);
+static void FillCircle(uint32_t Xpos, uint32_t Ypos, uint32_t Radius, uint32_t Color);
+static void FillPolygon(pPoint Points, uint32_t PointCount, uint32_t Color);
+static uint32_t GetPolygonEdge(pPoint Points, uint32_t PointCount, uint32_t Edge, int32_t YFirst, int32_t YLast,
+                               int32_t YBottom, PolyEdge_t *pEdge);
+static uint32_t GetPolygonCrossing(pPoint Points, uint32_t PointCount, uint32_t Edge, int32_t Ypos, int32_t YBottom,
+                                   int32_t *pCrossing);
+static void FillPolygonRow(pPoint Points, uint32_t PointCount, int32_t Ypos, int32_t YBottom, uint32_t Color);
 /**
   * @}
   */
@@ -171,6 +216,7 @@ void UTIL_LCD_SetFuncDriver(const LCD_UTILS_Drv_t *pDrv)
   FuncDriver.GetYSize       = pDrv->GetYSize;
   FuncDriver.SetLayer       = pDrv->SetLayer;
   FuncDriver.GetFormat      = pDrv->GetFormat;
+  FuncDriver.GetFrameBuffer = pDrv->GetFrameBuffer;
 
   DrawProp->LcdLayer = 0;
   DrawProp->LcdDevice = 0;
@@ -179,6 +225,20 @@ void UTIL_LCD_SetFuncDriver(const LCD_UTILS_Drv_t *pDrv)
   FuncDriver.GetFormat(0, &DrawProp->LcdPixelFormat);
 }
 
+/**
+  * @brief  Registers a function called before each drawing, with the area about to
+  *         be drawn, e.g. to wait for pending transfers or to record the area for
+  *         the next refresh.
+  * @param  pHook    Function to call, NULL to remove it
+  * @param  pContext Pointer passed to the function
+  * @note   Drawing functions built on other ones report their whole area once.
+  */
+void UTIL_LCD_SetDrawHook(UTIL_LCD_DrawHook_t pHook, void *pContext)
+{
+  DrawHook = pHook;
+  DrawHookContext = pContext;
+}
+
 /**
   * @brief  Set the LCD layer.
   * @param  Layer  LCD layer
@@ -268,6 +328,8 @@ sFONT *UTIL_LCD_GetFont(void)
   */
 void UTIL_LCD_FillRGBRect(uint32_t Xpos, uint32_t Ypos, uint8_t *pData, uint32_t Width, uint32_t Height)
 {
+  NotifyDraw((int32_t)Xpos, (int32_t)Ypos, (int32_t)(Xpos + Width) - 1, (int32_t)(Ypos + Height) - 1);
+
   /* Write RGB rectangle data */
   FuncDriver.FillRGBRect(DrawProp->LcdDevice, Xpos, Ypos, pData, Width, Height);
 }
@@ -281,15 +343,8 @@ void UTIL_LCD_FillRGBRect(uint32_t Xpos, uint32_t Ypos, uint8_t *pData, uint32_t
   */
 void UTIL_LCD_DrawHLine(uint32_t Xpos, uint32_t Ypos, uint32_t Length, uint32_t Color)
 {
-  /* Write line */
-  if(DrawProp->LcdPixelFormat == LCD_PIXEL_FORMAT_RGB565)
-  {
-    FuncDriver.DrawHLine(DrawProp->LcdDevice, Xpos, Ypos, Length, CONVERTARGB88882RGB565(Color));
-  }
-  else
-  {
-    FuncDriver.DrawHLine(DrawProp->LcdDevice, Xpos, Ypos, Length, Color);
-  }
+  NotifyDraw((int32_t)Xpos, (int32_t)Ypos, (int32_t)(Xpos + Length) - 1, (int32_t)Ypos);
+  DrawHLine(Xpos, Ypos, Length, Color);
 }
 
 /**
@@ -301,15 +356,8 @@ void UTIL_LCD_DrawHLine(uint32_t Xpos, uint32_t Ypos, uint32_t Length, uint32_t
   */
 void UTIL_LCD_DrawVLine(uint32_t Xpos, uint32_t Ypos, uint32_t Length, uint32_t Color)
 {
-  /* Write line */
-  if(DrawProp->LcdPixelFormat == LCD_PIXEL_FORMAT_RGB565)
-  {
-    FuncDriver.DrawVLine(DrawProp->LcdDevice, Xpos, Ypos, Length, CONVERTARGB88882RGB565(Color));
-  }
-  else
-  {
-    FuncDriver.DrawVLine(DrawProp->LcdDevice, Xpos, Ypos, Length, Color);
-  }
+  NotifyDraw((int32_t)Xpos, (int32_t)Ypos, (int32_t)Xpos, (int32_t)(Ypos + Length) - 1);
+  DrawVLine(Xpos, Ypos, Length, Color);
 }
 
 /**
@@ -336,15 +384,8 @@ void UTIL_LCD_GetPixel(uint16_t Xpos, uint16_t Ypos, uint32_t *Color)
   */
 void UTIL_LCD_SetPixel(uint16_t Xpos, uint16_t Ypos, uint32_t Color)
 {
-  /* Set Pixel */
-  if(DrawProp->LcdPixelFormat == LCD_PIXEL_FORMAT_RGB565)
-  {
-    FuncDriver.SetPixel(DrawProp->LcdDevice, Xpos, Ypos, CONVERTARGB88882RGB565(Color));
-  }
-  else
-  {
-    FuncDriver.SetPixel(DrawProp->LcdDevice, Xpos, Ypos, Color);
-  }
+  NotifyDraw(Xpos, Ypos, Xpos, Ypos);
+  SetPixel(Xpos, Ypos, Color);
 }
 
 /**
@@ -376,6 +417,9 @@ void UTIL_LCD_ClearStringLine(uint32_t Line)
   */
 void UTIL_LCD_DisplayChar(uint32_t Xpos, uint32_t Ypos, uint8_t Ascii)
 {
+  NotifyDraw((int32_t)Xpos, (int32_t)Ypos,
+             (int32_t)(Xpos + DrawProp[DrawProp->LcdLayer].pFont->Width) - 1,
+             (int32_t)(Ypos + DrawProp[DrawProp->LcdLayer].pFont->Height) - 1);
   DrawChar(Xpos, Ypos, &DrawProp[DrawProp->LcdLayer].pFont->table[(Ascii-' ') *\
   DrawProp[DrawProp->LcdLayer].pFont->Height * ((DrawProp[DrawProp->LcdLayer].pFont->Width + 7) / 8)]);
 }
@@ -464,75 +508,174 @@ void UTIL_LCD_DisplayStringAtLine(uint32_t Line, uint8_t *ptr)
   * @param  Xpos2 Point 2 X position
   * @param  Ypos2 Point 2 Y position
   * @param  Color Draw color
+  * @note   Horizontal and vertical lines are drawn as one span. Other lines are
+  *         written directly to the frame buffer, from an address computed once per
+  *         line, when the driver gives access to it and the line is on the display.
   */
 void UTIL_LCD_DrawLine(uint32_t Xpos1, uint32_t Ypos1, uint32_t Xpos2, uint32_t Ypos2, uint32_t Color)
 {
-  int16_t deltax = 0, deltay = 0, x = 0, y = 0, xinc1 = 0, xinc2 = 0,
-  yinc1 = 0, yinc2 = 0, den = 0, num = 0, numadd = 0, numpixels = 0,
-  curpixel = 0;
-  int32_t x_diff, y_diff;
+  NotifyDrawLine(Xpos1, Ypos1, Xpos2, Ypos2, 0);
+  DrawLine(Xpos1, Ypos1, Xpos2, Ypos2, Color);
+}
 
-  x_diff = Xpos2 - Xpos1;
-  y_diff = Ypos2 - Ypos1;
+/**
+  * @brief  Draws an anti-aliased uni-line (between two points) in currently active layer.
+  * @param  Xpos1 Point 1 X position
+  * @param  Ypos1 Point 1 Y position
+  * @param  Xpos2 Point 2 X position
+  * @param  Ypos2 Point 2 Y position
+  * @param  Color Draw color
+  * @note   Xiaolin Wu's algorithm: each step along the line blends the two pixels
+  *         across it with the color, weighted by their distance to the line.
+  *         In L8, the line is drawn without anti-aliasing.
+  */
+void UTIL_LCD_DrawLineAA(uint32_t Xpos1, uint32_t Ypos1, uint32_t Xpos2, uint32_t Ypos2, uint32_t Color)
+{
+  int32_t x = (int32_t)Xpos1, y = (int32_t)Ypos1, delta_x, delta_y, step_x, step_y;
+  int32_t major_x, major_y, minor_x, minor_y, major_step, minor_step, offset = 0;
+  int32_t length, counter, end_offset = 0;
+  uint32_t bpp, err = 0, err_prev, err_adj, weight;
+  uint8_t *p_buffer;
+
+  NotifyDrawLine(Xpos1, Ypos1, Xpos2, Ypos2, 0);
+
+  delta_x = (int32_t)(Xpos2 - Xpos1);
+  delta_y = (int32_t)(Ypos2 - Ypos1);
+  if((delta_x == 0) || (delta_y == 0) || (ABS(delta_x) == ABS(delta_y)) ||
+     (DrawProp->LcdPixelFormat == LCD_PIXEL_FORMAT_L8))
+  {
+    /* No pixel is partly covered by these lines, and palette indices cannot be
+       blended */
+    DrawLine(Xpos1, Ypos1, Xpos2, Ypos2, Color);
+    return;
+  }
 
-  deltax = ABS(x_diff);         /* The absolute difference between the x's */
-  deltay = ABS(y_diff);         /* The absolute difference between the y's */
-  x = Xpos1;                       /* Start x off at the first pixel */
-  y = Ypos1;                       /* Start y off at the first pixel */
+  bpp = GetFrameBuffer(&p_buffer);
+  if((Xpos1 >= DrawProp->LcdXsize) || (Xpos2 >= DrawProp->LcdXsize) ||
+     (Ypos1 >= DrawProp->LcdYsize) || (Ypos2 >= DrawProp->LcdYsize))
+  {
+    bpp = 0;
+  }
 
-  if (Xpos2 >= Xpos1)                 /* The x-values are increasing */
+  step_x = (delta_x < 0) ? -1 : 1;
+  step_y = (delta_y < 0) ? -1 : 1;
+  delta_x = ABS(delta_x);
+  delta_y = ABS(delta_y);
+  if(delta_x > delta_y)
+  {
+    major_x = step_x;
+    major_y = 0;
+    minor_x = 0;
+    minor_y = step_y;
+    length = delta_x;
+    err_adj = ((uint32_t)delta_y << 16) / (uint32_t)delta_x;
+  }
+  else
+  {
+    major_x = 0;
+    major_y = step_y;
+    minor_x = step_x;
+    minor_y = 0;
+    length = delta_y;
+    err_adj = ((uint32_t)delta_x << 16) / (uint32_t)delta_y;
+  }
+  major_step = (int32_t)bpp * (major_x + (major_y * (int32_t)DrawProp->LcdXsize));
+  minor_step = (int32_t)bpp * (minor_x + (minor_y * (int32_t)DrawProp->LcdXsize));
+  if(bpp != 0U)
   {
-    xinc1 = 1;
-    xinc2 = 1;
+    offset = (int32_t)bpp * ((y * (int32_t)DrawProp->LcdXsize) + x);
   }
-  else                          /* The x-values are decreasing */
+
+  /* The end points are on the line */
+  BlendPixel(x, y, p_buffer + offset, bpp, Color, 255U);
+  if(bpp != 0U)
   {
-    xinc1 = -1;
-    xinc2 = -1;
+    end_offset = (int32_t)bpp * (((int32_t)Ypos2 * (int32_t)DrawProp->LcdXsize) + (int32_t)Xpos2);
   }
+  BlendPixel((int32_t)Xpos2, (int32_t)Ypos2, p_buffer + end_offset, bpp, Color, 255U);
 
-  if (Ypos2 >= Ypos1)                 /* The y-values are increasing */
+  /* The 16 bit error accumulator gives the distance to the line of the pixel
+     after the current one across the line, it wraps when the line crosses it */
+  for(counter = 1; counter < length; counter++)
   {
-    yinc1 = 1;
-    yinc2 = 1;
+    err_prev = err;
+    err = (err + err_adj) & 0xFFFFU;
+    if(err <= err_prev)
+    {
+      x += minor_x;
+      y += minor_y;
+      offset += minor_step;
+    }
+    x += major_x;
+    y += major_y;
+    offset += major_step;
+
+    weight = err >> 8;
+    BlendPixel(x, y, p_buffer + offset, bpp, Color, 255U - weight);
+    BlendPixel(x + minor_x, y + minor_y, p_buffer + offset + minor_step, bpp, Color, weight);
   }
-  else                          /* The y-values are decreasing */
+}
+
+/**
+  * @brief  Draws a thick uni-line (between two points) in currently active layer.
+  * @param  Xpos1 Point 1 X position
+  * @param  Ypos1 Point 1 Y position
+  * @param  Xpos2 Point 2 X position
+  * @param  Ypos2 Point 2 Y position
+  * @param  Width Line width in pixels
+  * @param  Cap   Shape of the line ends: BUTT_CAP, SQUARE_CAP or ROUND_CAP
+  * @param  Color Draw color
+  * @note   The line is filled as a polygon, one span per row.
+  */
+void UTIL_LCD_DrawThickLine(uint32_t Xpos1, uint32_t Ypos1, uint32_t Xpos2, uint32_t Ypos2, uint32_t Width,
+                            Line_CapModeTypdef Cap, uint32_t Color)
+{
+  Point corners[4];
+  float delta_x, delta_y, length, half_width, normal_x, normal_y, end_x = 0, end_y = 0;
+
+  /* The caps and the corners of the line are at most Width pixels away from the end points */
+  NotifyDrawLine(Xpos1, Ypos1, Xpos2, Ypos2, Width);
+
+  if(Width <= 1U)
   {
-    yinc1 = -1;
-    yinc2 = -1;
+    DrawLine(Xpos1, Ypos1, Xpos2, Ypos2, Color);
+    return;
   }
 
-  if (deltax >= deltay)         /* There is at least one x-value for every y-value */
+  delta_x = (float)((int32_t)(Xpos2 - Xpos1));
+  delta_y = (float)((int32_t)(Ypos2 - Ypos1));
+  length = sqrtf((delta_x * delta_x) + (delta_y * delta_y));
+  if(length == 0.0f)
   {
-    xinc1 = 0;                  /* Don't change the x when numerator >= denominator */
-    yinc2 = 0;                  /* Don't change the y for every iteration */
-    den = deltax;
-    num = deltax / 2;
-    numadd = deltay;
-    numpixels = deltax;         /* There are more x-values than y-values */
+    /* A point, drawn as a horizontal line of no length */
+    delta_x = 1.0f;
+    length = 1.0f;
   }
-  else                          /* There is at least one y-value for every x-value */
+
+  /* The spans hold both crossings, so the polygon is one pixel narrower than the line */
+  half_width = ((float)Width - 1.0f) / 2.0f;
+  normal_x = -delta_y * half_width / length;
+  normal_y = delta_x * half_width / length;
+  if(Cap == SQUARE_CAP)
   {
-    xinc2 = 0;                  /* Don't change the x for every iteration */
-    yinc1 = 0;                  /* Don't change the y when numerator >= denominator */
-    den = deltay;
-    num = deltay / 2;
-    numadd = deltax;
-    numpixels = deltay;         /* There are more y-values than x-values */
+    end_x = delta_x * half_width / length;
+    end_y = delta_y * half_width / length;
   }
 
-  for (curpixel = 0; curpixel <= numpixels; curpixel++)
+  corners[0].X = (int16_t)floorf((float)Xpos1 - end_x + normal_x + 0.5f);
+  corners[0].Y = (int16_t)floorf((float)Ypos1 - end_y + normal_y + 0.5f);
+  corners[1].X = (int16_t)floorf((float)Xpos2 + end_x + normal_x + 0.5f);
+  corners[1].Y = (int16_t)floorf((float)Ypos2 + end_y + normal_y + 0.5f);
+  corners[2].X = (int16_t)floorf((float)Xpos2 + end_x - normal_x + 0.5f);
+  corners[2].Y = (int16_t)floorf((float)Ypos2 + end_y - normal_y + 0.5f);
+  corners[3].X = (int16_t)floorf((float)Xpos1 - end_x - normal_x + 0.5f);
+  corners[3].Y = (int16_t)floorf((float)Ypos1 - end_y - normal_y + 0.5f);
+  FillPolygon(corners, 4, Color);
+
+  if(Cap == ROUND_CAP)
   {
-    UTIL_LCD_SetPixel(x, y, Color);   /* Draw the current pixel */
-    num += numadd;                            /* Increase the numerator by the top of the fraction */
-    if (num >= den)                           /* Check if numerator >= denominator */
-    {
-      num -= den;                             /* Calculate the new numerator value */
-      x += xinc1;                             /* Change the x as appropriate */
-      y += yinc1;                             /* Change the y as appropriate */
-    }
-    x += xinc2;                               /* Change the x as appropriate */
-    y += yinc2;                               /* Change the y as appropriate */
+    FillCircle(Xpos1, Ypos1, (Width - 1U) / 2U, Color);
+    FillCircle(Xpos2, Ypos2, (Width - 1U) / 2U, Color);
   }
 }
 
@@ -546,13 +689,15 @@ void UTIL_LCD_DrawLine(uint32_t Xpos1, uint32_t Ypos1, uint32_t Xpos2, uint32_t
   */
 void UTIL_LCD_DrawRect(uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height, uint32_t Color)
 {
+  NotifyDraw((int32_t)Xpos, (int32_t)Ypos, (int32_t)(Xpos + Width) - 1, (int32_t)(Ypos + Height) - 1);
+
   /* Draw horizontal lines */
-  UTIL_LCD_DrawHLine(Xpos, Ypos, Width, Color);
-  UTIL_LCD_DrawHLine(Xpos, (Ypos+ Height - 1U), Width, Color);
+  DrawHLine(Xpos, Ypos, Width, Color);
+  DrawHLine(Xpos, (Ypos+ Height - 1U), Width, Color);
 
   /* Draw vertical lines */
-  UTIL_LCD_DrawVLine(Xpos, Ypos, Height, Color);
-  UTIL_LCD_DrawVLine((Xpos + Width - 1U), Ypos, Height, Color);
+  DrawVLine(Xpos, Ypos, Height, Color);
+  DrawVLine((Xpos + Width - 1U), Ypos, Height, Color);
 }
 
 /**
@@ -564,75 +709,8 @@ void UTIL_LCD_DrawRect(uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t He
   */
 void UTIL_LCD_DrawCircle(uint32_t Xpos, uint32_t Ypos, uint32_t Radius, uint32_t Color)
 {
-  int32_t   decision;  /* Decision Variable */
-  uint32_t  current_x; /* Current X Value */
-  uint32_t  current_y; /* Current Y Value */
-
-  decision = 3 - (Radius << 1);
-  current_x = 0;
-  current_y = Radius;
-
-  while (current_x <= current_y)
-  {
-    if((Ypos - current_y) < DrawProp->LcdYsize)
-    {
-      if((Xpos + current_x) < DrawProp->LcdXsize)
-      {
-        UTIL_LCD_SetPixel((Xpos + current_x), (Ypos - current_y), Color);
-      }
-      if((Xpos - current_x) < DrawProp->LcdXsize)
-      {
-        UTIL_LCD_SetPixel((Xpos - current_x), (Ypos - current_y), Color);
-      }
-    }
-
-    if((Ypos - current_x) < DrawProp->LcdYsize)
-    {
-      if((Xpos + current_y) < DrawProp->LcdXsize)
-      {
-        UTIL_LCD_SetPixel((Xpos + current_y), (Ypos - current_x), Color);
-      }
-      if((Xpos - current_y) < DrawProp->LcdXsize)
-      {
-        UTIL_LCD_SetPixel((Xpos - current_y), (Ypos - current_x), Color);
-      }
-    }
-
-    if((Ypos + current_y) < DrawProp->LcdYsize)
-    {
-      if((Xpos + current_x) < DrawProp->LcdXsize)
-      {
-        UTIL_LCD_SetPixel((Xpos + current_x), (Ypos + current_y), Color);
-      }
-      if((Xpos - current_x) < DrawProp->LcdXsize)
-      {
-        UTIL_LCD_SetPixel((Xpos - current_x), (Ypos + current_y), Color);
-      }
-    }
-
-    if((Ypos + current_x) < DrawProp->LcdYsize)
-    {
-      if((Xpos + current_y) < DrawProp->LcdXsize)
-      {
-        UTIL_LCD_SetPixel((Xpos + current_y), (Ypos + current_x), Color);
-      }
-      if((Xpos - current_y) < DrawProp->LcdXsize)
-      {
-        UTIL_LCD_SetPixel((Xpos - current_y), (Ypos + current_x), Color);
-      }
-    }
-
-    if (decision < 0)
-    {
-      decision += (current_x << 2) + 6;
-    }
-    else
-    {
-      decision += ((current_x - current_y) << 2) + 10;
-      current_y--;
-    }
-    current_x++;
-  }
+  NotifyDrawLine(Xpos, Ypos, Xpos, Ypos, Radius);
+  DrawCircle(Xpos, Ypos, Radius, Color);
 }
 
 /**
@@ -645,19 +723,21 @@ void UTIL_LCD_DrawPolygon(pPoint Points, uint32_t PointCount, uint32_t Color)
 {
   int16_t x_pos = 0, y_pos = 0;
 
+  NotifyDrawPolygon(Points, PointCount);
+
   if(PointCount < 2)
   {
     return;
   }
 
-  UTIL_LCD_DrawLine(Points->X, Points->Y, (Points+PointCount-1)->X, (Points+PointCount-1)->Y, Color);
+  DrawLine(Points->X, Points->Y, (Points+PointCount-1)->X, (Points+PointCount-1)->Y, Color);
 
   while(--PointCount)
   {
     x_pos = Points->X;
     y_pos = Points->Y;
     Points++;
-    UTIL_LCD_DrawLine(x_pos, y_pos, Points->X, Points->Y, Color);
+    DrawLine(x_pos, y_pos, Points->X, Points->Y, Color);
   }
 }
 
@@ -674,6 +754,8 @@ void UTIL_LCD_DrawEllipse(int Xpos, int Ypos, int XRadius, int YRadius, uint32_t
   int x_pos = 0, y_pos = -YRadius, err = 2-2*XRadius, e2;
   float k = 0, rad1 = 0, rad2 = 0;
 
+  NotifyDrawEllipse(Xpos, Ypos, XRadius, YRadius);
+
   rad1 = XRadius;
   rad2 = YRadius;
 
@@ -681,10 +763,10 @@ void UTIL_LCD_DrawEllipse(int Xpos, int Ypos, int XRadius, int YRadius, uint32_t
 
   do
   {
-    UTIL_LCD_SetPixel((Xpos-(uint32_t)(x_pos/k)), (Ypos + y_pos), Color);
-    UTIL_LCD_SetPixel((Xpos+(uint32_t)(x_pos/k)), (Ypos + y_pos), Color);
-    UTIL_LCD_SetPixel((Xpos+(uint32_t)(x_pos/k)), (Ypos - y_pos), Color);
-    UTIL_LCD_SetPixel((Xpos-(uint32_t)(x_pos/k)), (Ypos - y_pos), Color);
+    SetPixel((Xpos-(uint32_t)(x_pos/k)), (Ypos + y_pos), Color);
+    SetPixel((Xpos+(uint32_t)(x_pos/k)), (Ypos + y_pos), Color);
+    SetPixel((Xpos+(uint32_t)(x_pos/k)), (Ypos - y_pos), Color);
+    SetPixel((Xpos-(uint32_t)(x_pos/k)), (Ypos - y_pos), Color);
 
     e2 = err;
     if (e2 <= x_pos)
@@ -707,6 +789,11 @@ void UTIL_LCD_DrawEllipse(int Xpos, int Ypos, int XRadius, int YRadius, uint32_t
   */
 void UTIL_LCD_DrawBitmap(uint32_t Xpos, uint32_t Ypos, uint8_t *pData)
 {
+  /* Size of the picture, from the header of the bitmap file */
+  uint32_t width = pData[18] + ((uint32_t)pData[19] << 8) + ((uint32_t)pData[20] << 16) + ((uint32_t)pData[21] << 24);
+  uint32_t height = pData[22] + ((uint32_t)pData[23] << 8) + ((uint32_t)pData[24] << 16) + ((uint32_t)pData[25] << 24);
+
+  NotifyDraw((int32_t)Xpos, (int32_t)Ypos, (int32_t)(Xpos + width) - 1, (int32_t)(Ypos + height) - 1);
   FuncDriver.DrawBitmap(DrawProp->LcdDevice, Xpos, Ypos, pData);
 }
 
@@ -720,6 +807,8 @@ void UTIL_LCD_DrawBitmap(uint32_t Xpos, uint32_t Ypos, uint8_t *pData)
   */
 void UTIL_LCD_FillRect(uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height, uint32_t Color)
 {
+  NotifyDraw((int32_t)Xpos, (int32_t)Ypos, (int32_t)(Xpos + Width) - 1, (int32_t)(Ypos + Height) - 1);
+
   /* Fill the rectangle */
   if(DrawProp->LcdPixelFormat == LCD_PIXEL_FORMAT_RGB565)
   {
@@ -740,159 +829,25 @@ void UTIL_LCD_FillRect(uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t He
   */
 void UTIL_LCD_FillCircle(uint32_t Xpos, uint32_t Ypos, uint32_t Radius, uint32_t Color)
 {
-  int32_t   decision;  /* Decision Variable */
-  uint32_t  current_x; /* Current X Value */
-  uint32_t  current_y; /* Current Y Value */
-
-  decision = 3 - (Radius << 1);
-
-  current_x = 0;
-  current_y = Radius;
-
-  while (current_x <= current_y)
-  {
-    if(current_y > 0)
-    {
-      if(current_y >= Xpos)
-      {
-        UTIL_LCD_DrawHLine(0, Ypos + current_x, 2*current_y - (current_y - Xpos), Color);
-        UTIL_LCD_DrawHLine(0, Ypos - current_x, 2*current_y - (current_y - Xpos), Color);
-      }
-      else
-      {
-        UTIL_LCD_DrawHLine(Xpos - current_y, Ypos + current_x, 2*current_y, Color);
-        UTIL_LCD_DrawHLine(Xpos - current_y, Ypos - current_x, 2*current_y, Color);
-      }
-    }
-
-    if(current_x > 0)
-    {
-      if(current_x >= Xpos)
-      {
-        UTIL_LCD_DrawHLine(0, Ypos - current_y, 2*current_x - (current_x - Xpos), Color);
-        UTIL_LCD_DrawHLine(0, Ypos + current_y, 2*current_x - (current_x - Xpos), Color);
-      }
-      else
-      {
-        UTIL_LCD_DrawHLine(Xpos - current_x, Ypos - current_y, 2*current_x, Color);
-        UTIL_LCD_DrawHLine(Xpos - current_x, Ypos + current_y, 2*current_x, Color);
-      }
-    }
-    if (decision < 0)
-    {
-      decision += (current_x << 2) + 6;
-    }
-    else
-    {
-      decision += ((current_x - current_y) << 2) + 10;
-      current_y--;
-    }
-    current_x++;
-  }
-
-  UTIL_LCD_DrawCircle(Xpos, Ypos, Radius, Color);
+  NotifyDrawLine(Xpos, Ypos, Xpos, Ypos, Radius);
+  FillCircle(Xpos, Ypos, Radius, Color);
 }
 
 /**
   * @brief  Draws a full poly-line (between many points) in currently active layer.
+  *         Convex, concave and self-intersecting polygons are filled (even-odd rule).
   * @param  Points     Pointer to the points array
   * @param  PointCount Number of points
   * @param  Color      Draw color
+  * @note   The polygon is filled row by row: the crossings of a row with the edges
+  *         are sorted and each pair of crossings is drawn as one horizontal line.
+  *         Polygons with more than UTIL_LCD_MAX_POLY_POINTS points are filled by
+  *         searching the crossings of each row in order, which is slower.
   */
 void UTIL_LCD_FillPolygon(pPoint Points, uint32_t PointCount, uint32_t Color)
 {
-  int16_t X = 0, Y = 0, X2 = 0, Y2 = 0, x_center = 0, y_center = 0, x_first = 0, y_first = 0;
-  uint32_t  pixel_x = 0, pixel_y = 0, image_left = 0, image_right = 0, image_top = 0, image_bottom = 0;
-  Triangle_Positions_t positions;
-
-  image_left = image_right = Points->X;
-  image_top= image_bottom = Points->Y;
-
-  for(uint32_t counter = 1; counter < PointCount; counter++)
-  {
-    pixel_x = POLY_X(counter);
-    if(pixel_x < image_left)
-    {
-      image_left = pixel_x;
-    }
-    if(pixel_x > image_right)
-    {
-      image_right = pixel_x;
-    }
-
-    pixel_y = POLY_Y(counter);
-    if(pixel_y < image_top)
-    {
-      image_top = pixel_y;
-    }
-    if(pixel_y > image_bottom)
-    {
-      image_bottom = pixel_y;
-    }
-  }
-
-  if(PointCount < 2)
-  {
-    return;
-  }
-
-  x_center = (image_left + image_right)/2;
-  y_center = (image_bottom + image_top)/2;
-
-  x_first = Points->X;
-  y_first = Points->Y;
-
-  while(--PointCount)
-  {
-    X = Points->X;
-    Y = Points->Y;
-    Points++;
-    X2 = Points->X;
-    Y2 = Points->Y;
-    positions.x1 = X;
-    positions.y1 = Y;
-    positions.x2 = X2;
-    positions.y2 = Y2;
-    positions.x3 = x_center;
-    positions.y3 = y_center;
-    FillTriangle(&positions, Color);
-
-    positions.x2 = x_center;
-    positions.y2 = y_center;
-    positions.x3 = X2;
-    positions.y3 = Y2;
-    FillTriangle(&positions, Color);
-
-    positions.x1 = x_center;
-    positions.y1 = y_center;
-    positions.x2 = X2;
-    positions.y2 = Y2;
-    positions.x3 = X;
-    positions.y3 = Y;
-    FillTriangle(&positions, Color);
-  }
-
-    positions.x1 = x_first;
-    positions.y1 = y_first;
-    positions.x2 = X2;
-    positions.y2 = Y2;
-    positions.x3 = x_center;
-    positions.y3 = y_center;
-    FillTriangle(&positions, Color);
-
-    positions.x2 = x_center;
-    positions.y2 = y_center;
-    positions.x3 = X2;
-    positions.y3 = Y2;
-    FillTriangle(&positions, Color);
-
-    positions.x1 = x_center;
-    positions.y1 = y_center;
-    positions.x2 = X2;
-    positions.y2 = Y2;
-    positions.x3 = x_first;
-    positions.y3 = y_first;
-    FillTriangle(&positions, Color);
+  NotifyDrawPolygon(Points, PointCount);
+  FillPolygon(Points, PointCount, Color);
 }
 
 /**
@@ -908,6 +863,8 @@ void UTIL_LCD_FillEllipse(int Xpos, int Ypos, int XRadius, int YRadius, uint32_t
   int x_pos = 0, y_pos = -YRadius, err = 2-2*XRadius, e2;
   float k = 0, rad1 = 0, rad2 = 0;
 
+  NotifyDrawEllipse(Xpos, Ypos, XRadius, YRadius);
+
   rad1 = XRadius;
   rad2 = YRadius;
 
@@ -915,8 +872,8 @@ void UTIL_LCD_FillEllipse(int Xpos, int Ypos, int XRadius, int YRadius, uint32_t
 
   do
   {
-    UTIL_LCD_DrawHLine((Xpos-(uint32_t)(x_pos/k)), (Ypos + y_pos), (2*(uint32_t)(x_pos/k) + 1), Color);
-    UTIL_LCD_DrawHLine((Xpos-(uint32_t)(x_pos/k)), (Ypos - y_pos), (2*(uint32_t)(x_pos/k) + 1), Color);
+    DrawHLine((Xpos-(uint32_t)(x_pos/k)), (Ypos + y_pos), (2*(uint32_t)(x_pos/k) + 1), Color);
+    DrawHLine((Xpos-(uint32_t)(x_pos/k)), (Ypos - y_pos), (2*(uint32_t)(x_pos/k) + 1), Color);
 
     e2 = err;
     if (e2 <= x_pos)
@@ -983,7 +940,7 @@ static void DrawChar(uint32_t Xpos, uint32_t Ypos, const uint8_t *pData)
           rgb565[j] = CONVERTARGB88882RGB565(DrawProp[DrawProp->LcdLayer].BackColor);
         }
       }
-      UTIL_LCD_FillRGBRect(Xpos,  Ypos++, (uint8_t*)&rgb565[0], width, 1);
+      FuncDriver.FillRGBRect(DrawProp->LcdDevice, Xpos, Ypos++, (uint8_t*)&rgb565[0], width, 1);
     }
     else
     {
@@ -998,86 +955,856 @@ static void DrawChar(uint32_t Xpos, uint32_t Ypos, const uint8_t *pData)
           argb8888[j] = DrawProp[DrawProp->LcdLayer].BackColor;
         }
       }
-      UTIL_LCD_FillRGBRect(Xpos,  Ypos++, (uint8_t*)&argb8888[0], width, 1);
+      FuncDriver.FillRGBRect(DrawProp->LcdDevice, Xpos, Ypos++, (uint8_t*)&argb8888[0], width, 1);
     }
   }
 }
 
 /**
-  * @brief  Fills a triangle (between 3 points).
-  * @param  Positions  pointer to riangle coordinates
-  * @param  Color      Draw color
+  * @brief  Draws a horizontal line between two columns, clipped to the display.
+  * @param  Xpos1 First column
+  * @param  Xpos2 Last column, may be left of Xpos1
+  * @param  Ypos  Row
+  * @param  Color Draw color
+  * @note   The line is a single fill, done by the CPU or the DMA2D depending on its
+  *         length.
   */
-static void FillTriangle(Triangle_Positions_t *Positions, uint32_t Color)
+static void FillSpan(int32_t Xpos1, int32_t Xpos2, int32_t Ypos, uint32_t Color)
 {
-  int16_t deltax = 0, deltay = 0, x = 0, y = 0, xinc1 = 0, xinc2 = 0,
-  yinc1 = 0, yinc2 = 0, den = 0, num = 0, numadd = 0, numpixels = 0,
-  curpixel = 0;
-  int32_t x_diff, y_diff;
+  int32_t x_left  = (Xpos1 < Xpos2) ? Xpos1 : Xpos2;
+  int32_t x_right = (Xpos1 < Xpos2) ? Xpos2 : Xpos1;
 
-  x_diff = Positions->x2 - Positions->x1;
-  y_diff = Positions->y2 - Positions->y1;
-
-  deltax = ABS(x_diff);         /* The absolute difference between the x's */
-  deltay = ABS(y_diff);         /* The absolute difference between the y's */
-  x = Positions->x1;                       /* Start x off at the first pixel */
-  y = Positions->y1;                       /* Start y off at the first pixel */
-
-  if (Positions->x2 >= Positions->x1)                 /* The x-values are increasing */
+  if((Ypos < 0) || (Ypos >= (int32_t)DrawProp->LcdYsize))
   {
-    xinc1 = 1;
-    xinc2 = 1;
+    return;
   }
-  else                          /* The x-values are decreasing */
+  if(x_left < 0)
   {
-    xinc1 = -1;
-    xinc2 = -1;
+    x_left = 0;
   }
-
-  if (Positions->y2 >= Positions->y1)                 /* The y-values are increasing */
+  if(x_right >= (int32_t)DrawProp->LcdXsize)
   {
-    yinc1 = 1;
-    yinc2 = 1;
+    x_right = (int32_t)DrawProp->LcdXsize - 1;
   }
-  else                          /* The y-values are decreasing */
+  if(x_left <= x_right)
   {
-    yinc1 = -1;
-    yinc2 = -1;
+    DrawHLine((uint32_t)x_left, (uint32_t)Ypos, (uint32_t)(x_right - x_left + 1), Color);
   }
+}
 
-  if (deltax >= deltay)         /* There is at least one x-value for every y-value */
-  {
-    xinc1 = 0;                  /* Don't change the x when numerator >= denominator */
-    yinc2 = 0;                  /* Don't change the y for every iteration */
-    den = deltax;
-    num = deltax / 2;
-    numadd = deltay;
-    numpixels = deltax;         /* There are more x-values than y-values */
-  }
-  else                          /* There is at least one y-value for every x-value */
-  {
-    xinc2 = 0;                  /* Don't change the x for every iteration */
-    yinc1 = 0;                  /* Don't change the y when numerator >= denominator */
-    den = deltay;
-    num = deltay / 2;
-    numadd = deltax;
-    numpixels = deltay;         /* There are more y-values than x-values */
-  }
+/**
+  * @brief  Gets the frame buffer of the active layer, when its pixels can be written
+  *         directly.
+  * @param  pBuffer Address of the first pixel
+  * @retval Bytes per pixel, 0 if the pixels must be drawn through the driver
+  */
+static uint32_t GetFrameBuffer(uint8_t **pBuffer)
+{
+  uint32_t address = 0, bpp = 0;
 
-  for (curpixel = 0; curpixel <= numpixels; curpixel++)
+  if((FuncDriver.GetFrameBuffer != NULL) && (FuncDriver.GetFrameBuffer(DrawProp->LcdDevice, &address) == 0))
   {
-    UTIL_LCD_DrawLine(x, y, Positions->x3, Positions->y3, Color);
-
-    num += numadd;              /* Increase the numerator by the top of the fraction */
-    if (num >= den)             /* Check if numerator >= denominator */
+    if(DrawProp->LcdPixelFormat == LCD_PIXEL_FORMAT_ARGB8888)
+    {
+      bpp = 4U;
+    }
+    else if(DrawProp->LcdPixelFormat == LCD_PIXEL_FORMAT_RGB565)
+    {
+      bpp = 2U;
+    }
+    else
     {
-      num -= den;               /* Calculate the new numerator value */
-      x += xinc1;               /* Change the x as appropriate */
-      y += yinc1;               /* Change the y as appropriate */
+      /* Drawn through the driver */
     }
-    x += xinc2;                 /* Change the x as appropriate */
-    y += yinc2;                 /* Change the y as appropriate */
   }
+  *pBuffer = (uint8_t *)address;
+
+  return bpp;
+}
+
+/**
+  * @brief  Blends a color over another one.
+  * @param  Color     Drawn color (ARGB8888)
+  * @param  BackColor Color below it (ARGB8888)
+  * @param  Alpha     Coverage of the drawn color, 0 to 255
+  * @retval Blended color (ARGB8888)
+  */
+static uint32_t BlendColor(uint32_t Color, uint32_t BackColor, uint32_t Alpha)
+{
+  uint32_t alpha = Alpha + (Alpha >> 7);   /* 0 to 256 */
+  uint32_t red_blue, alpha_green;
+
+  /* Two channels at once, 8 bits apart */
+  red_blue = ((((Color & 0x00FF00FFU) * alpha) + ((BackColor & 0x00FF00FFU) * (256U - alpha))) >> 8) & 0x00FF00FFU;
+  alpha_green = ((((Color >> 8) & 0x00FF00FFU) * alpha) + (((BackColor >> 8) & 0x00FF00FFU) * (256U - alpha))) & 0xFF00FF00U;
+
+  return alpha_green | red_blue;
+}
+
+/**
+  * @brief  Blends a color over a pixel.
+  * @param  Xpos   X position
+  * @param  Ypos   Y position
+  * @param  pPixel Address of the pixel in the frame buffer, used if Bpp is not 0
+  * @param  Bpp    Bytes per pixel of the frame buffer, 0 to go through the driver
+  * @param  Color  Draw color
+  * @param  Alpha  Coverage of the pixel, 0 to 255
+  */
+static void BlendPixel(int32_t Xpos, int32_t Ypos, uint8_t *pPixel, uint32_t Bpp, uint32_t Color, uint32_t Alpha)
+{
+  uint32_t back_color;
+
+  if(Bpp == 4U)
+  {
+    *(uint32_t *)pPixel = BlendColor(Color, *(uint32_t *)pPixel, Alpha);
+  }
+  else if(Bpp == 2U)
+  {
+    back_color = *(uint16_t *)pPixel;
+    back_color = BlendColor(Color, CONVERTRGB5652ARGB8888(back_color), Alpha);
+    *(uint16_t *)pPixel = (uint16_t)CONVERTARGB88882RGB565(back_color);
+  }
+  else if((Xpos >= 0) && (Ypos >= 0) && (Xpos < (int32_t)DrawProp->LcdXsize) && (Ypos < (int32_t)DrawProp->LcdYsize))
+  {
+    UTIL_LCD_GetPixel((uint16_t)Xpos, (uint16_t)Ypos, &back_color);
+    SetPixel((uint16_t)Xpos, (uint16_t)Ypos, BlendColor(Color, back_color, Alpha));
+  }
+  else
+  {
+    /* Off the display */
+  }
+}
+
+/**
+  * @brief  Reports an area about to be drawn to the draw hook, if any.
+  * @param  Xpos1 Left column, may be outside of the display
+  * @param  Ypos1 Top row, may be outside of the display
+  * @param  Xpos2 Right column (included)
+  * @param  Ypos2 Bottom row (included)
+  * @note   The area is clipped to the display, nothing is reported if it is empty.
+  */
+static void NotifyDraw(int32_t Xpos1, int32_t Ypos1, int32_t Xpos2, int32_t Ypos2)
+{
+  if(DrawHook == NULL)
+  {
+    return;
+  }
+  if(Xpos1 < 0)
+  {
+    Xpos1 = 0;
+  }
+  if(Ypos1 < 0)
+  {
+    Ypos1 = 0;
+  }
+  if(Xpos2 >= (int32_t)DrawProp->LcdXsize)
+  {
+    Xpos2 = (int32_t)DrawProp->LcdXsize - 1;
+  }
+  if(Ypos2 >= (int32_t)DrawProp->LcdYsize)
+  {
+    Ypos2 = (int32_t)DrawProp->LcdYsize - 1;
+  }
+  if((Xpos1 <= Xpos2) && (Ypos1 <= Ypos2))
+  {
+    DrawHook(DrawHookContext, (uint32_t)Xpos1, (uint32_t)Ypos1, (uint32_t)(Xpos2 - Xpos1 + 1),
+             (uint32_t)(Ypos2 - Ypos1 + 1));
+  }
+}
+
+/**
+  * @brief  Reports the bounding box of a line, widened by a margin, to the draw hook.
+  * @param  Xpos1  Point 1 X position
+  * @param  Ypos1  Point 1 Y position
+  * @param  Xpos2  Point 2 X position
+  * @param  Ypos2  Point 2 Y position
+  * @param  Margin Pixels drawn around the line (radius of circles, width of thick lines)
+  */
+static void NotifyDrawLine(uint32_t Xpos1, uint32_t Ypos1, uint32_t Xpos2, uint32_t Ypos2, uint32_t Margin)
+{
+  int32_t x_left   = ((int32_t)Xpos1 < (int32_t)Xpos2) ? (int32_t)Xpos1 : (int32_t)Xpos2;
+  int32_t x_right  = ((int32_t)Xpos1 < (int32_t)Xpos2) ? (int32_t)Xpos2 : (int32_t)Xpos1;
+  int32_t y_top    = ((int32_t)Ypos1 < (int32_t)Ypos2) ? (int32_t)Ypos1 : (int32_t)Ypos2;
+  int32_t y_bottom = ((int32_t)Ypos1 < (int32_t)Ypos2) ? (int32_t)Ypos2 : (int32_t)Ypos1;
+
+  NotifyDraw(x_left - (int32_t)Margin, y_top - (int32_t)Margin, x_right + (int32_t)Margin,
+             y_bottom + (int32_t)Margin);
+}
+
+/**
+  * @brief  Reports the bounding box of a polygon to the draw hook.
+  * @param  Points     Pointer to the points array
+  * @param  PointCount Number of points
+  */
+static void NotifyDrawPolygon(pPoint Points, uint32_t PointCount)
+{
+  int32_t x_left, x_right, y_top, y_bottom;
+  uint32_t counter;
+
+  if(PointCount < 2U)
+  {
+    return;
+  }
+  x_left = x_right = POLY_X(0);
+  y_top = y_bottom = POLY_Y(0);
+  for(counter = 1; counter < PointCount; counter++)
+  {
+    if(POLY_X(counter) < x_left)
+    {
+      x_left = POLY_X(counter);
+    }
+    if(POLY_X(counter) > x_right)
+    {
+      x_right = POLY_X(counter);
+    }
+    if(POLY_Y(counter) < y_top)
+    {
+      y_top = POLY_Y(counter);
+    }
+    if(POLY_Y(counter) > y_bottom)
+    {
+      y_bottom = POLY_Y(counter);
+    }
+  }
+  NotifyDraw(x_left, y_top, x_right, y_bottom);
+}
+
+/**
+  * @brief  Reports the bounding box of an ellipse to the draw hook.
+  * @param  Xpos    X position
+  * @param  Ypos    Y position
+  * @param  XRadius Ellipse X radius
+  * @param  YRadius Ellipse Y radius
+  * @note   The ellipses are traced along a circle of radius XRadius whose columns
+  *         are scaled by XRadius / YRadius, which may take them past XRadius.
+  */
+static void NotifyDrawEllipse(int Xpos, int Ypos, int XRadius, int YRadius)
+{
+  int x_extent = XRadius;
+
+  if(YRadius > 0)
+  {
+    x_extent = ((XRadius * XRadius) / YRadius) + 1;
+    if(x_extent < XRadius)
+    {
+      x_extent = XRadius;
+    }
+  }
+  NotifyDraw(Xpos - x_extent, Ypos - YRadius, Xpos + x_extent, Ypos + YRadius);
+}
+
+/**
+  * @brief  Draws a pixel on LCD.
+  * @param  Xpos     X position
+  * @param  Ypos     Y position
+  * @param  Color    Pixel color
+  */
+static void SetPixel(uint16_t Xpos, uint16_t Ypos, uint32_t Color)
+{
+  /* Set Pixel */
+  if(DrawProp->LcdPixelFormat == LCD_PIXEL_FORMAT_RGB565)
+  {
+    FuncDriver.SetPixel(DrawProp->LcdDevice, Xpos, Ypos, CONVERTARGB88882RGB565(Color));
+  }
+  else
+  {
+    FuncDriver.SetPixel(DrawProp->LcdDevice, Xpos, Ypos, Color);
+  }
+}
+
+/**
+  * @brief  Draws an horizontal line in currently active layer.
+  * @param  Xpos    X position
+  * @param  Ypos    Y position
+  * @param  Length  Line length
+  * @param  Color   Draw color
+  */
+static void DrawHLine(uint32_t Xpos, uint32_t Ypos, uint32_t Length, uint32_t Color)
+{
+  /* Write line */
+  if(DrawProp->LcdPixelFormat == LCD_PIXEL_FORMAT_RGB565)
+  {
+    FuncDriver.DrawHLine(DrawProp->LcdDevice, Xpos, Ypos, Length, CONVERTARGB88882RGB565(Color));
+  }
+  else
+  {
+    FuncDriver.DrawHLine(DrawProp->LcdDevice, Xpos, Ypos, Length, Color);
+  }
+}
+
+/**
+  * @brief  Draws a vertical line in currently active layer.
+  * @param  Xpos    X position
+  * @param  Ypos    Y position
+  * @param  Length  Line length
+  * @param  Color   Draw color
+  */
+static void DrawVLine(uint32_t Xpos, uint32_t Ypos, uint32_t Length, uint32_t Color)
+{
+  /* Write line */
+  if(DrawProp->LcdPixelFormat == LCD_PIXEL_FORMAT_RGB565)
+  {
+    FuncDriver.DrawVLine(DrawProp->LcdDevice, Xpos, Ypos, Length, CONVERTARGB88882RGB565(Color));
+  }
+  else
+  {
+    FuncDriver.DrawVLine(DrawProp->LcdDevice, Xpos, Ypos, Length, Color);
+  }
+}
+
+/**
+  * @brief  Draws an uni-line (between two points) in currently active layer.
+  * @param  Xpos1 Point 1 X position
+  * @param  Ypos1 Point 1 Y position
+  * @param  Xpos2 Point 2 X position
+  * @param  Ypos2 Point 2 Y position
+  * @param  Color Draw color
+  * @note   Horizontal and vertical lines are drawn as one span. Other lines are
+  *         written directly to the frame buffer, from an address computed once per
+  *         line, when the driver gives access to it and the line is on the display.
+  */
+static void DrawLine(uint32_t Xpos1, uint32_t Ypos1, uint32_t Xpos2, uint32_t Ypos2, uint32_t Color)
+{
+  int32_t x = (int32_t)Xpos1, y = (int32_t)Ypos1, delta_x, delta_y, step_x, step_y;
+  int32_t major_x, major_y, minor_x, minor_y, major_step, minor_step, offset = 0;
+  int32_t length, delta, err, counter;
+  uint32_t bpp, color = Color, y_top, y_bottom;
+  uint8_t *p_buffer;
+
+  if(Ypos1 == Ypos2)
+  {
+    FillSpan((int32_t)Xpos1, (int32_t)Xpos2, (int32_t)Ypos1, Color);
+    return;
+  }
+  if(Xpos1 == Xpos2)
+  {
+    y_top = (Ypos1 < Ypos2) ? Ypos1 : Ypos2;
+    y_bottom = (Ypos1 < Ypos2) ? Ypos2 : Ypos1;
+    if(y_bottom >= DrawProp->LcdYsize)
+    {
+      y_bottom = DrawProp->LcdYsize - 1U;
+    }
+    if((Xpos1 < DrawProp->LcdXsize) && (y_top <= y_bottom))
+    {
+      DrawVLine(Xpos1, y_top, y_bottom - y_top + 1U, Color);
+    }
+    return;
+  }
+
+  bpp = GetFrameBuffer(&p_buffer);
+  if((Xpos1 >= DrawProp->LcdXsize) || (Xpos2 >= DrawProp->LcdXsize) ||
+     (Ypos1 >= DrawProp->LcdYsize) || (Ypos2 >= DrawProp->LcdYsize))
+  {
+    /* Clipped pixel by pixel */
+    bpp = 0;
+  }
+  if(bpp == 2U)
+  {
+    color = CONVERTARGB88882RGB565(Color);
+  }
+
+  step_x = 1;
+  delta_x = (int32_t)(Xpos2 - Xpos1);
+  if(delta_x < 0)
+  {
+    delta_x = -delta_x;
+    step_x = -1;
+  }
+  step_y = 1;
+  delta_y = (int32_t)(Ypos2 - Ypos1);
+  if(delta_y < 0)
+  {
+    delta_y = -delta_y;
+    step_y = -1;
+  }
+
+  if(delta_x >= delta_y)
+  {
+    major_x = step_x;
+    major_y = 0;
+    minor_x = 0;
+    minor_y = step_y;
+    length = delta_x;
+    delta = delta_y;
+  }
+  else
+  {
+    major_x = 0;
+    major_y = step_y;
+    minor_x = step_x;
+    minor_y = 0;
+    length = delta_y;
+    delta = delta_x;
+  }
+  major_step = (int32_t)bpp * (major_x + (major_y * (int32_t)DrawProp->LcdXsize));
+  minor_step = (int32_t)bpp * (minor_x + (minor_y * (int32_t)DrawProp->LcdXsize));
+  if(bpp != 0U)
+  {
+    offset = (int32_t)bpp * ((y * (int32_t)DrawProp->LcdXsize) + x);
+  }
+
+  err = length / 2;
+  for(counter = 0; counter <= length; counter++)
+  {
+    if(bpp == 4U)
+    {
+      *(uint32_t *)(p_buffer + offset) = color;
+    }
+    else if(bpp == 2U)
+    {
+      *(uint16_t *)(p_buffer + offset) = (uint16_t)color;
+    }
+    else if((x >= 0) && (y >= 0) && (x < (int32_t)DrawProp->LcdXsize) && (y < (int32_t)DrawProp->LcdYsize))
+    {
+      SetPixel((uint16_t)x, (uint16_t)y, Color);
+    }
+
+    x += major_x;
+    y += major_y;
+    offset += major_step;
+    err -= delta;
+    if(err < 0)
+    {
+      err += length;
+      x += minor_x;
+      y += minor_y;
+      offset += minor_step;
+    }
+  }
+}
+
+/**
+  * @brief  Draws a circle in currently active layer.
+  * @param  Xpos    X position
+  * @param  Ypos    Y position
+  * @param  Radius  Circle radius
+  * @param  Color   Draw color
+  */
+static void DrawCircle(uint32_t Xpos, uint32_t Ypos, uint32_t Radius, uint32_t Color)
+{
+  int32_t   decision;  /* Decision Variable */
+  uint32_t  current_x; /* Current X Value */
+  uint32_t  current_y; /* Current Y Value */
+
+  decision = 3 - (Radius << 1);
+  current_x = 0;
+  current_y = Radius;
+
+  while (current_x <= current_y)
+  {
+    if((Ypos - current_y) < DrawProp->LcdYsize)
+    {
+      if((Xpos + current_x) < DrawProp->LcdXsize)
+      {
+        SetPixel((Xpos + current_x), (Ypos - current_y), Color);
+      }
+      if((Xpos - current_x) < DrawProp->LcdXsize)
+      {
+        SetPixel((Xpos - current_x), (Ypos - current_y), Color);
+      }
+    }
+
+    if((Ypos - current_x) < DrawProp->LcdYsize)
+    {
+      if((Xpos + current_y) < DrawProp->LcdXsize)
+      {
+        SetPixel((Xpos + current_y), (Ypos - current_x), Color);
+      }
+      if((Xpos - current_y) < DrawProp->LcdXsize)
+      {
+        SetPixel((Xpos - current_y), (Ypos - current_x), Color);
+      }
+    }
+
+    if((Ypos + current_y) < DrawProp->LcdYsize)
+    {
+      if((Xpos + current_x) < DrawProp->LcdXsize)
+      {
+        SetPixel((Xpos + current_x), (Ypos + current_y), Color);
+      }
+      if((Xpos - current_x) < DrawProp->LcdXsize)
+      {
+        SetPixel((Xpos - current_x), (Ypos + current_y), Color);
+      }
+    }
+
+    if((Ypos + current_x) < DrawProp->LcdYsize)
+    {
+      if((Xpos + current_y) < DrawProp->LcdXsize)
+      {
+        SetPixel((Xpos + current_y), (Ypos + current_x), Color);
+      }
+      if((Xpos - current_y) < DrawProp->LcdXsize)
+      {
+        SetPixel((Xpos - current_y), (Ypos + current_x), Color);
+      }
+    }
+
+    if (decision < 0)
+    {
+      decision += (current_x << 2) + 6;
+    }
+    else
+    {
+      decision += ((current_x - current_y) << 2) + 10;
+      current_y--;
+    }
+    current_x++;
+  }
+}
+
+/**
+  * @brief  Draws a full circle in currently active layer.
+  * @param  Xpos   X position
+  * @param  Ypos   Y position
+  * @param  Radius Circle radius
+  * @param  Color  Draw color
+  */
+static void FillCircle(uint32_t Xpos, uint32_t Ypos, uint32_t Radius, uint32_t Color)
+{
+  int32_t   decision;  /* Decision Variable */
+  uint32_t  current_x; /* Current X Value */
+  uint32_t  current_y; /* Current Y Value */
+
+  decision = 3 - (Radius << 1);
+
+  current_x = 0;
+  current_y = Radius;
+
+  while (current_x <= current_y)
+  {
+    if(current_y > 0)
+    {
+      if(current_y >= Xpos)
+      {
+        DrawHLine(0, Ypos + current_x, 2*current_y - (current_y - Xpos), Color);
+        DrawHLine(0, Ypos - current_x, 2*current_y - (current_y - Xpos), Color);
+      }
+      else
+      {
+        DrawHLine(Xpos - current_y, Ypos + current_x, 2*current_y, Color);
+        DrawHLine(Xpos - current_y, Ypos - current_x, 2*current_y, Color);
+      }
+    }
+
+    if(current_x > 0)
+    {
+      if(current_x >= Xpos)
+      {
+        DrawHLine(0, Ypos - current_y, 2*current_x - (current_x - Xpos), Color);
+        DrawHLine(0, Ypos + current_y, 2*current_x - (current_x - Xpos), Color);
+      }
+      else
+      {
+        DrawHLine(Xpos - current_x, Ypos - current_y, 2*current_x, Color);
+        DrawHLine(Xpos - current_x, Ypos + current_y, 2*current_x, Color);
+      }
+    }
+    if (decision < 0)
+    {
+      decision += (current_x << 2) + 6;
+    }
+    else
+    {
+      decision += ((current_x - current_y) << 2) + 10;
+      current_y--;
+    }
+    current_x++;
+  }
+
+  DrawCircle(Xpos, Ypos, Radius, Color);
+}
+
+/**
+  * @brief  Draws a full poly-line (between many points) in currently active layer.
+  *         Convex, concave and self-intersecting polygons are filled (even-odd rule).
+  * @param  Points     Pointer to the points array
+  * @param  PointCount Number of points
+  * @param  Color      Draw color
+  * @note   The edges crossing the display are sorted by first row in a table on
+  *         the stack, so that nothing is kept between calls. Each row, the edges
+  *         starting on it join the active edges, which are kept sorted by column,
+  *         and the crossings of the active edges are stepped to the next row
+  *         without division.
+  */
+static void FillPolygon(pPoint Points, uint32_t PointCount, uint32_t Color)
+{
+  PolyEdge_t edges[UTIL_LCD_MAX_POLY_POINTS];
+  PolyEdge_t edge;
+  uint32_t counter, nbr_edges = 0, nbr_active = 0, next = 0, i;
+  int32_t y, y_top, y_bottom, y_last;
+
+  if(PointCount < 2U)
+  {
+    return;
+  }
+
+  /* Horizontal edges are drawn at once */
+  y_top = y_bottom = POLY_Y(0);
+  for(counter = 0; counter < PointCount; counter++)
+  {
+    if(POLY_Y(counter) < y_top)
+    {
+      y_top = POLY_Y(counter);
+    }
+    if(POLY_Y(counter) > y_bottom)
+    {
+      y_bottom = POLY_Y(counter);
+    }
+    if(POLY_Y(counter) == POLY_Y((counter + 1U) % PointCount))
+    {
+      FillSpan(POLY_X(counter), POLY_X((counter + 1U) % PointCount), POLY_Y(counter), Color);
+    }
+  }
+
+  y = (y_top < 0) ? 0 : y_top;
+  y_last = (y_bottom < (int32_t)DrawProp->LcdYsize) ? y_bottom : ((int32_t)DrawProp->LcdYsize - 1);
+  if(PointCount > UTIL_LCD_MAX_POLY_POINTS)
+  {
+    for(; y <= y_last; y++)
+    {
+      FillPolygonRow(Points, PointCount, y, y_bottom, Color);
+    }
+    return;
+  }
+
+  /* Edge table, insertion sort by first row */
+  for(counter = 0; counter < PointCount; counter++)
+  {
+    if(GetPolygonEdge(Points, PointCount, counter, y, y_last, y_bottom, &edge) == 0U)
+    {
+      continue;
+    }
+    i = nbr_edges++;
+    while((i > 0U) && (edges[i - 1U].YTop > edge.YTop))
+    {
+      edges[i] = edges[i - 1U];
+      i--;
+    }
+    edges[i] = edge;
+  }
+
+  /* The active edges are moved to the front of the table, over the edges that
+     already ended */
+  for(; (y <= y_last) && ((next < nbr_edges) || (nbr_active > 0U)); y++)
+  {
+    while((next < nbr_edges) && (edges[next].YTop == y))
+    {
+      edges[nbr_active++] = edges[next++];
+    }
+
+    /* Insertion sort by column, the order of the edges rarely changes between rows */
+    for(counter = 1; counter < nbr_active; counter++)
+    {
+      edge = edges[counter];
+      i = counter;
+      while((i > 0U) && (edges[i - 1U].Xpos > edge.Xpos))
+      {
+        edges[i] = edges[i - 1U];
+        i--;
+      }
+      edges[i] = edge;
+    }
+
+    for(i = 0; (i + 1U) < nbr_active; i += 2U)
+    {
+      FillSpan(edges[i].Xpos, edges[i + 1U].Xpos, y, Color);
+    }
+
+    /* Edges ending on the row are dropped, the others move to the next row */
+    counter = 0;
+    for(i = 0; i < nbr_active; i++)
+    {
+      if(edges[i].YLast == y)
+      {
+        continue;
+      }
+      edge = edges[i];
+      edge.Xpos += edge.Step;
+      edge.Error += edge.ErrorStep;
+      if(edge.Error >= edge.ErrorMax)
+      {
+        edge.Error -= edge.ErrorMax;
+        edge.Xpos++;
+      }
+      edges[counter++] = edge;
+    }
+    nbr_active = counter;
+  }
+}
+
+/**
+  * @brief  Gets the rows of the display crossed by a polygon edge and its crossing
+  *         with the first one.
+  * @param  Points     Pointer to the points array
+  * @param  PointCount Number of points
+  * @param  Edge       Edge from point Edge to the next one
+  * @param  YFirst     First row drawn
+  * @param  YLast      Last row drawn
+  * @param  YBottom    Last row of the polygon
+  * @param  pEdge      Rows and crossings of the edge, as GetPolygonCrossing() computes
+  *                    them
+  * @retval 1 if the edge crosses a drawn row, 0 otherwise
+  */
+static uint32_t GetPolygonEdge(pPoint Points, uint32_t PointCount, uint32_t Edge, int32_t YFirst, int32_t YLast,
+                               int32_t YBottom, PolyEdge_t *pEdge)
+{
+  uint32_t next = (Edge + 1U) % PointCount;
+  int32_t x1 = POLY_X(Edge), y1 = POLY_Y(Edge), x2 = POLY_X(next), y2 = POLY_Y(next);
+  int32_t y_top, y_last, dx;
+  int64_t numerator, quotient;
+
+  if(y1 > y2)
+  {
+    x1 = POLY_X(next);
+    y1 = POLY_Y(next);
+    x2 = POLY_X(Edge);
+    y2 = POLY_Y(Edge);
+  }
+
+  /* Same rows as GetPolygonCrossing(): the top row, not the bottom one unless it
+     closes the polygon. Horizontal edges are not crossed */
+  if(y1 == y2)
+  {
+    return 0U;
+  }
+  y_top = (y1 > YFirst) ? y1 : YFirst;
+  y_last = (y2 == YBottom) ? y2 : (y2 - 1);
+  if(y_last > YLast)
+  {
+    y_last = YLast;
+  }
+  if(y_top > y_last)
+  {
+    return 0U;
+  }
+
+  /* x1 + (x2 - x1) * (y - y1) / (y2 - y1) + 1/2, rounded down, is kept as a column
+     and a remainder over 2 * (y2 - y1). The product does not fit 32 bits for the
+     whole range of the points */
+  dx = x2 - x1;
+  pEdge->ErrorMax = 2 * (y2 - y1);
+  numerator = (2 * (int64_t)dx * (y_top - y1)) + (y2 - y1);
+  quotient = numerator / pEdge->ErrorMax;
+  if(((numerator % pEdge->ErrorMax) != 0) && (numerator < 0))
+  {
+    quotient--;
+  }
+  pEdge->Xpos = x1 + (int32_t)quotient;
+  pEdge->Error = (int32_t)(numerator - (quotient * pEdge->ErrorMax));
+
+  /* Each row adds 2 * (x2 - x1) to the numerator */
+  pEdge->Step = dx / (y2 - y1);
+  if(((dx % (y2 - y1)) != 0) && (dx < 0))
+  {
+    pEdge->Step--;
+  }
+  pEdge->ErrorStep = (2 * dx) - (pEdge->Step * pEdge->ErrorMax);
+  pEdge->YTop = (int16_t)y_top;
+  pEdge->YLast = (int16_t)y_last;
+
+  return 1U;
+}
+
+/**
+  * @brief  Gets the column where a polygon edge crosses a row.
+  * @param  Points     Pointer to the points array
+  * @param  PointCount Number of points
+  * @param  Edge       Edge from point Edge to the next one
+  * @param  Ypos       Row
+  * @param  YBottom    Last row of the polygon
+  * @param  pCrossing  Column of the crossing, rounded to the nearest pixel
+  * @retval 1 if the edge crosses the row, 0 otherwise
+  */
+static uint32_t GetPolygonCrossing(pPoint Points, uint32_t PointCount, uint32_t Edge, int32_t Ypos, int32_t YBottom,
+                                   int32_t *pCrossing)
+{
+  uint32_t next = (Edge + 1U) % PointCount;
+  int32_t x1 = POLY_X(Edge), y1 = POLY_Y(Edge), x2 = POLY_X(next), y2 = POLY_Y(next);
+  int64_t numerator, denominator, quotient;
+
+  if(y1 > y2)
+  {
+    x1 = POLY_X(next);
+    y1 = POLY_Y(next);
+    x2 = POLY_X(Edge);
+    y2 = POLY_Y(Edge);
+  }
+
+  /* An edge holds its top row but not its bottom one, which belongs to the next
+     edge, so that each vertex is crossed once. The last row closes the polygon.
+     Horizontal edges are not crossed */
+  if(!(((Ypos >= y1) && (Ypos < y2)) || ((Ypos == YBottom) && (y2 == YBottom) && (y1 != y2))))
+  {
+    return 0U;
+  }
+
+  /* x1 + (x2 - x1) * (Ypos - y1) / (y2 - y1) + 1/2, rounded down. The product
+     does not fit 32 bits for the whole range of the points */
+  numerator = (2 * (int64_t)(x2 - x1) * (Ypos - y1)) + (y2 - y1);
+  denominator = 2 * (int64_t)(y2 - y1);
+  quotient = numerator / denominator;
+  if(((numerator % denominator) != 0) && (numerator < 0))
+  {
+    quotient--;
+  }
+  *pCrossing = x1 + (int32_t)quotient;
+
+  return 1U;
+}
+
+/**
+  * @brief  Fills a row of a polygon with more points than the edge table: the
+  *         crossings are searched in (column, edge) order, one pass over the edges
+  *         each.
+  * @param  Points     Pointer to the points array
+  * @param  PointCount Number of points
+  * @param  Ypos       Row
+  * @param  YBottom    Last row of the polygon
+  * @param  Color      Draw color
+  */
+static void FillPolygonRow(pPoint Points, uint32_t PointCount, int32_t Ypos, int32_t YBottom, uint32_t Color)
+{
+  uint32_t counter, nbr_crossings = 0, edge = 0, best_edge = 0, is_found;
+  int32_t crossing, column = 0, best_column = 0, span_start = 0;
+
+  do
+  {
+    is_found = 0U;
+    for(counter = 0; counter < PointCount; counter++)
+    {
+      if(GetPolygonCrossing(Points, PointCount, counter, Ypos, YBottom, &crossing) == 0U)
+      {
+        continue;
+      }
+      /* Skip the crossings already drawn */
+      if((nbr_crossings > 0U) && ((crossing < column) || ((crossing == column) && (counter <= edge))))
+      {
+        continue;
+      }
+      if((is_found == 0U) || (crossing < best_column) || ((crossing == best_column) && (counter < best_edge)))
+      {
+        best_column = crossing;
+        best_edge = counter;
+        is_found = 1U;
+      }
+    }
+
+    if(is_found != 0U)
+    {
+      if((nbr_crossings % 2U) == 0U)
+      {
+        span_start = best_column;
+      }
+      else
+      {
+        FillSpan(span_start, best_column, Ypos, Color);
+      }
+      nbr_crossings++;
+      column = best_column;
+      edge = best_edge;
+    }
+  } while(is_found != 0U);
 }
 
 /**
@@ -162,6 +162,21 @@ typedef enum
   LEFT_MODE               = 0x03     /*!< Left mode   */
 } Text_AlignModeTypdef;
 
+/**
+  * @brief  LCD Utility thick line cap mode definitions
+  */
+typedef enum
+{
+  BUTT_CAP                = 0x01,    /*!< Line stops at its end points        */
+  SQUARE_CAP              = 0x02,    /*!< Line extended by half its width     */
+  ROUND_CAP               = 0x03     /*!< Disc drawn around each end point    */
+} Line_CapModeTypdef;
+
+/**
+  * @brief  LCD Utility draw hook, called before an area of the active layer is drawn
+  */
+typedef void (*UTIL_LCD_DrawHook_t)(void *pContext, uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height);
+
 /**
   * @}
   */
@@ -170,6 +185,7 @@ typedef enum
   * @{
   */
 void     UTIL_LCD_SetFuncDriver(const LCD_UTILS_Drv_t *pDrv);
+void     UTIL_LCD_SetDrawHook(UTIL_LCD_DrawHook_t pHook, void *pContext);
 
 void     UTIL_LCD_SetLayer(uint32_t Layer);
 void     UTIL_LCD_SetDevice(uint32_t Device);
@@ -194,6 +210,9 @@ void     UTIL_LCD_DrawVLine(uint32_t Xpos, uint32_t Ypos, uint32_t Length, uint3
 void     UTIL_LCD_DrawBitmap(uint32_t Xpos, uint32_t Ypos, uint8_t *pData);
 void     UTIL_LCD_FillRect(uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height, uint32_t Color);
 void     UTIL_LCD_DrawLine(uint32_t Xpos1, uint32_t Ypos1, uint32_t Xpos2, uint32_t Ypos2, uint32_t Color);
+void     UTIL_LCD_DrawLineAA(uint32_t Xpos1, uint32_t Ypos1, uint32_t Xpos2, uint32_t Ypos2, uint32_t Color);
+void     UTIL_LCD_DrawThickLine(uint32_t Xpos1, uint32_t Ypos1, uint32_t Xpos2, uint32_t Ypos2, uint32_t Width,
+                                Line_CapModeTypdef Cap, uint32_t Color);
 void     UTIL_LCD_DrawRect(uint32_t Xpos, uint32_t Ypos, uint32_t Width, uint32_t Height, uint32_t Color);
 void     UTIL_LCD_DrawCircle(uint32_t Xpos, uint32_t Ypos, uint32_t Radius, uint32_t Color);
 void     UTIL_LCD_DrawPolygon(pPoint Points, uint32_t PointCount, uint32_t Color);
@@ -0,0 +1,35 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file color.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Color conversion helpers shared by the display wrappers
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#pragma once
+
+#define CONVERTARGB88882RGB565(Color)                   \
+    ((((Color & 0xFFU) >> 3) & 0x1FU) |                 \
+     (((((Color & 0xFF00U) >> 8) >> 2) & 0x3FU) << 5) | \
+     (((((Color & 0xFF0000U) >> 16) >> 3) & 0x1FU) << 11))
+
+#define CONVERTRGB5652ARGB8888(Color)                        \
+    (((((((Color >> 11) & 0x1FU) * 527) + 23) >> 6) << 16) | \
+     ((((((Color >> 5) & 0x3FU) * 259) + 33) >> 6) << 8) |   \
+     ((((Color & 0x1FU) * 527) + 23) >> 6) | 0xFF000000)
@@ -0,0 +1,109 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/****************************************************************************
+ * @file dirty_region.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Display areas drawn since the last refresh, kept as a few rectangles
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#include "dirty_region.hpp"
+
+namespace disco {
+
+/**
+ * @brief  Adds a drawn area. Rectangles that can be merged with it without
+ *         refreshing more pixels (overlapping or touching ones) are merged. When
+ *         all rectangles are used, the area is merged with the rectangle whose
+ *         bounding box grows the least.
+ * @param  area  Drawn area
+ */
+void DirtyRegion::add(const Rect& area) {
+    if (isEmpty(area)) {
+        return;
+    }
+
+    Rect merged = area;
+    for (;;) {
+        int32_t index = findFreeMerge(merged);
+        if (index < 0) {
+            if (nbrOfRects_ < kMaxNbrOfRects) {
+                break;
+            }
+            index = static_cast<int32_t>(findCheapestMerge(merged));
+        }
+        // the bounding box may now reach other rectangles, look again
+        merged        = getBoundingRect(rects_[index], merged);
+        rects_[index] = rects_[--nbrOfRects_];
+    }
+    rects_[nbrOfRects_++] = merged;
+}
+
+/**
+ * @brief  Drops all rectangles, e.g. once they were refreshed.
+ */
+void DirtyRegion::clear() { nbrOfRects_ = 0; }
+
+/**
+ * @brief  Gets the number of rectangles of the region.
+ * @retval Number of rectangles, 0 if nothing was drawn
+ */
+uint32_t DirtyRegion::getNbrOfRects() const { return nbrOfRects_; }
+
+/**
+ * @brief  Gets one rectangle of the region. Rectangles may overlap.
+ * @param  index  Rectangle number, below getNbrOfRects()
+ * @retval Rectangle
+ */
+const Rect& DirtyRegion::getRect(uint32_t index) const { return rects_[index]; }
+
+/**
+ * @brief  Finds a rectangle whose bounding box with the area is not larger than
+ *         both of them.
+ * @retval Rectangle index, -1 if there is none
+ */
+int32_t DirtyRegion::findFreeMerge(const Rect& area) const {
+    for (uint32_t i = 0; i < nbrOfRects_; i++) {
+        if (getArea(getBoundingRect(rects_[i], area)) <=
+            getArea(rects_[i]) + getArea(area)) {
+            return static_cast<int32_t>(i);
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief  Finds the rectangle whose bounding box with the area adds the fewest
+ *         pixels.
+ * @retval Rectangle index
+ */
+uint32_t DirtyRegion::findCheapestMerge(const Rect& area) const {
+    uint32_t cheapest = 0;
+    uint32_t minCost  = UINT32_MAX;
+    for (uint32_t i = 0; i < nbrOfRects_; i++) {
+        uint32_t cost = getArea(getBoundingRect(rects_[i], area)) - getArea(rects_[i]);
+        if (cost < minCost) {
+            cheapest = i;
+            minCost  = cost;
+        }
+    }
+    return cheapest;
+}
+
+}  // namespace disco
@@ -0,0 +1,54 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/****************************************************************************
+ * @file dirty_region.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Display areas drawn since the last refresh, kept as a few rectangles
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+#include "rect.hpp"
+
+namespace disco {
+
+class DirtyRegion {
+   public:
+    DirtyRegion() = default;
+
+    void add(const Rect& area);
+    void clear();
+    uint32_t getNbrOfRects() const;
+    const Rect& getRect(uint32_t index) const;
+
+    // each rectangle costs one refresh, more damage is merged
+    static constexpr uint32_t kMaxNbrOfRects = 4;
+
+   private:
+    int32_t findFreeMerge(const Rect& area) const;
+    uint32_t findCheapestMerge(const Rect& area) const;
+
+    Rect rects_[kMaxNbrOfRects] = {};
+    uint32_t nbrOfRects_        = 0;
+};
+
+}  // namespace disco
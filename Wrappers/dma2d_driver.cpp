@@ -0,0 +1,356 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file dma2d_driver.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Single owner of the DMA2D, programming only the registers whose value
+ *        changed since the previous transfer
+ *
+ * The HAL rewrites the mode, the color modes and the offsets of every transfer
+ * (HAL_DMA2D_Init and HAL_DMA2D_ConfigLayer), which costs more than the transfer
+ * of a small glyph. The driver keeps a copy of the registers it wrote and only
+ * writes those whose value differs. The copy is dropped with invalidate() when
+ * the peripheral is reset.
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#include "dma2d_driver.hpp"
+
+// from mbed-os
+#include "mbed.h"
+
+namespace disco {
+
+// flags of an ended transfer: complete, transfer error, configuration error
+static constexpr uint32_t kEndFlags = DMA2D_ISR_TCIF | DMA2D_ISR_TEIF | DMA2D_ISR_CEIF;
+static constexpr uint32_t kClearFlags =
+    DMA2D_IFCR_CTCIF | DMA2D_IFCR_CTEIF | DMA2D_IFCR_CCEIF;
+
+/**
+ * @brief  Gets the driver of the DMA2D, shared by the drawing queue and the BSP.
+ * @retval Driver instance
+ */
+Dma2dDriver& Dma2dDriver::getInstance() {
+    static Dma2dDriver driver;
+    return driver;
+}
+
+/**
+ * @brief  Enables the cycle counter that measures the setup of each transfer. The
+ *         DWT of the Cortex-M7 ignores writes until it is unlocked.
+ */
+Dma2dDriver::Dma2dDriver() {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR          = 0xC5ACCE55U;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+ * @brief  Programs and starts a transfer with the transfer complete, transfer error
+ *         and configuration error interrupts enabled. If the DMA2D is busy, e.g.
+ *         with a polled transfer of another thread, the transfer is started when
+ *         the running one ended.
+ * @param  transfer     Transfer to run
+ * @param  pOnComplete  Called from the DMA2D interrupt when the transfer ended, may
+ *                      be null
+ * @param  pContext     Argument of pOnComplete
+ * @retval false if another transfer is already waiting, the transfer is dropped
+ */
+bool Dma2dDriver::start(const Dma2dTransfer& transfer,
+                        void (*pOnComplete)(void* pContext),
+                        void* pContext) {
+    core_util_critical_section_enter();
+    if (isBusy_) {
+        bool isDeferred = !hasDeferred_;
+        if (isDeferred) {
+            deferred_ = {
+                .transfer = transfer, .pOnComplete = pOnComplete, .pContext = pContext};
+            hasDeferred_ = true;
+        }
+        core_util_critical_section_exit();
+        if (!isDeferred) {
+            stats_.nbrOfErrors++;
+        }
+        return isDeferred;
+    }
+    isBusy_ = true;
+    core_util_critical_section_exit();
+
+    launch(transfer, pOnComplete, pContext);
+    return true;
+}
+
+/**
+ * @brief  Runs a transfer and polls until it ended. A started transfer is waited
+ *         for first, the DMA2D interrupt being served meanwhile.
+ * @param  transfer  Transfer to run
+ * @retval true if the transfer completed, false on an error or a timeout
+ */
+bool Dma2dDriver::run(const Dma2dTransfer& transfer) {
+    // claim the DMA2D with its interrupt masked, so that no completion starts
+    // another transfer until this one ended
+    HAL_NVIC_DisableIRQ(DMA2D_IRQn);
+    while (!claim()) {
+        HAL_NVIC_EnableIRQ(DMA2D_IRQn);
+        HAL_NVIC_DisableIRQ(DMA2D_IRQn);
+    }
+
+    uint32_t setupStart = DWT->CYCCNT;
+    configure(transfer);
+    addSetup(transfer.mode, DWT->CYCCNT - setupStart);
+
+    DMA2D->CR          = transfer.mode | DMA2D_CR_START;
+    uint32_t tickStart = HAL_GetTick();
+    uint32_t flags     = DMA2D->ISR & kEndFlags;
+    while (flags == 0 && (HAL_GetTick() - tickStart) <= kTimeout) {
+        flags = DMA2D->ISR & kEndFlags;
+    }
+    if (flags == 0) {
+        // the transfer is still running and must not be reprogrammed
+        abort();
+    }
+    DMA2D->IFCR = kClearFlags;
+
+    bool isDone = (flags == DMA2D_ISR_TCIF);
+    if (!isDone) {
+        stats_.nbrOfErrors++;
+    }
+    release();
+    HAL_NVIC_EnableIRQ(DMA2D_IRQn);
+    return isDone;
+}
+
+/**
+ * @brief  Tells whether a transfer is running.
+ * @retval true until the end of the transfer was handled
+ */
+bool Dma2dDriver::isBusy() const { return isBusy_; }
+
+/**
+ * @brief  Handles the DMA2D interrupt: clears the flags of the ended transfer and
+ *         calls its completion callback, which may start the next transfer.
+ */
+void Dma2dDriver::onInterrupt() {
+    uint32_t flags = DMA2D->ISR & kEndFlags;
+    DMA2D->IFCR    = kClearFlags;
+    if (flags == 0) {
+        return;
+    }
+    if (flags != DMA2D_ISR_TCIF) {
+        stats_.nbrOfErrors++;
+    }
+
+    void (*pOnComplete)(void*) = pOnComplete_;
+    void* pContext             = pContext_;
+    pOnComplete_               = nullptr;
+    release();
+    if (pOnComplete != nullptr) {
+        pOnComplete(pContext);
+    }
+}
+
+/**
+ * @brief  Forgets the register values, all of them are written by the next
+ *         transfer. To be called when the DMA2D was reset.
+ */
+void Dma2dDriver::invalidate() { validRegisters_ = 0; }
+
+/**
+ * @brief  Gets the register write and setup time counters.
+ * @retval Driver statistics
+ */
+const Dma2dDriver::Stats& Dma2dDriver::getStats() const { return stats_; }
+
+/**
+ * @brief  Resets the register write and setup time counters.
+ */
+void Dma2dDriver::resetStats() { stats_ = {}; }
+
+/**
+ * @brief  Marks the DMA2D busy for a polled transfer.
+ * @retval false if a transfer is running
+ */
+bool Dma2dDriver::claim() {
+    core_util_critical_section_enter();
+    bool isClaimed = !isBusy_;
+    isBusy_        = true;
+    core_util_critical_section_exit();
+    return isClaimed;
+}
+
+/**
+ * @brief  Ends the running transfer, starting the deferred one if any.
+ */
+void Dma2dDriver::release() {
+    core_util_critical_section_enter();
+    bool hasDeferred          = hasDeferred_;
+    DeferredTransfer deferred = deferred_;
+    hasDeferred_              = false;
+    isBusy_                   = hasDeferred;
+    core_util_critical_section_exit();
+
+    if (hasDeferred) {
+        launch(deferred.transfer, deferred.pOnComplete, deferred.pContext);
+    }
+}
+
+/**
+ * @brief  Programs and starts a transfer on the claimed DMA2D, with interrupts.
+ */
+void Dma2dDriver::launch(const Dma2dTransfer& transfer,
+                         void (*pOnComplete)(void* pContext),
+                         void* pContext) {
+    pOnComplete_ = pOnComplete;
+    pContext_    = pContext;
+
+    uint32_t setupStart = DWT->CYCCNT;
+    configure(transfer);
+    addSetup(transfer.mode, DWT->CYCCNT - setupStart);
+
+    DMA2D->CR = transfer.mode | DMA2D_CR_TCIE | DMA2D_CR_TEIE | DMA2D_CR_CEIE |
+                DMA2D_CR_START;
+}
+
+/**
+ * @brief  Stops a transfer that did not end in time. The DMA2D is reset if the
+ *         abort does not complete, the registers are then written again.
+ */
+void Dma2dDriver::abort() {
+    DMA2D->CR |= DMA2D_CR_ABORT;
+    uint32_t tickStart = HAL_GetTick();
+    while ((DMA2D->CR & DMA2D_CR_START) != 0 && (HAL_GetTick() - tickStart) <= kTimeout) {
+    }
+    if ((DMA2D->CR & DMA2D_CR_START) != 0) {
+        __HAL_RCC_DMA2D_FORCE_RESET();
+        __HAL_RCC_DMA2D_RELEASE_RESET();
+        invalidate();
+    }
+}
+
+/**
+ * @brief  Writes the registers of a transfer. The address and size registers
+ *         change with every transfer and are always written.
+ */
+void Dma2dDriver::configure(const Dma2dTransfer& transfer) {
+    if (transfer.mode == DMA2D_R2M) {
+        write(SHADOW_OCOLR,
+              DMA2D->OCOLR,
+              getOutputColor(transfer.color, transfer.outputColorMode));
+    } else {
+        // the foreground alpha is the one of the pixels, A8/A4 sources get the
+        // RGB of the color
+        uint32_t fgpfccr =
+            transfer.foregroundColorMode | (DMA2D_NO_MODIF_ALPHA << DMA2D_FGPFCCR_AM_Pos);
+        if (transfer.foregroundColorMode == DMA2D_INPUT_A8 ||
+            transfer.foregroundColorMode == DMA2D_INPUT_A4) {
+            fgpfccr |= transfer.color & 0xFF000000U;
+            write(SHADOW_FGCOLR, DMA2D->FGCOLR, transfer.color & 0x00FFFFFFU);
+        } else {
+            fgpfccr |= 0xFFU << DMA2D_FGPFCCR_ALPHA_Pos;
+        }
+        write(SHADOW_FGPFCCR, DMA2D->FGPFCCR, fgpfccr);
+        write(SHADOW_FGOR, DMA2D->FGOR, transfer.foregroundOffset);
+        DMA2D->FGMAR = static_cast<uint32_t>(transfer.source);
+
+        if (transfer.mode == DMA2D_M2M_BLEND) {
+            write(SHADOW_BGPFCCR,
+                  DMA2D->BGPFCCR,
+                  transfer.backgroundColorMode | (0xFFU << DMA2D_BGPFCCR_ALPHA_Pos));
+            write(SHADOW_BGOR, DMA2D->BGOR, transfer.backgroundOffset);
+            DMA2D->BGMAR = static_cast<uint32_t>(transfer.background);
+        }
+    }
+
+    write(SHADOW_OPFCCR, DMA2D->OPFCCR, transfer.outputColorMode);
+    write(SHADOW_OOR, DMA2D->OOR, transfer.outputOffset);
+    DMA2D->OMAR = static_cast<uint32_t>(transfer.destination);
+    DMA2D->NLR  = (static_cast<uint32_t>(transfer.width) << DMA2D_NLR_PL_Pos) |
+                 transfer.height;
+}
+
+/**
+ * @brief  Writes a register unless it already holds the value.
+ */
+void Dma2dDriver::write(ShadowRegister index, volatile uint32_t& reg, uint32_t value) {
+    uint32_t mask = 1U << index;
+    if ((validRegisters_ & mask) != 0 && shadow_[index] == value) {
+        stats_.nbrOfSkippedWrites++;
+        return;
+    }
+    reg              = value;
+    shadow_[index]   = value;
+    validRegisters_ |= mask;
+    stats_.nbrOfWrites++;
+}
+
+/**
+ * @brief  Counts a transfer and the cycles spent programming it.
+ */
+void Dma2dDriver::addSetup(uint32_t mode, uint32_t nbrOfCycles) {
+    uint32_t index = mode >> DMA2D_CR_MODE_Pos;
+    if (index >= kNbrOfModes) {
+        return;
+    }
+    ModeStats& stats        = stats_.modes[index];
+    stats.nbrOfTransfers   += 1;
+    stats.totalSetupCycles += nbrOfCycles;
+    if (nbrOfCycles > stats.maxSetupCycles) {
+        stats.maxSetupCycles = nbrOfCycles;
+    }
+}
+
+/**
+ * @brief  Converts an ARGB8888 color to the output format, as expected in OCOLR.
+ * @param  color      ARGB8888 color
+ * @param  colorMode  DMA2D_OUTPUT_xxx
+ * @retval Output color register value
+ */
+uint32_t Dma2dDriver::getOutputColor(uint32_t color, uint32_t colorMode) {
+    switch (colorMode) {
+        case DMA2D_OUTPUT_RGB888:
+            return color & 0x00FFFFFFU;
+        case DMA2D_OUTPUT_RGB565:
+            return ((color >> 8) & 0xF800U) | ((color >> 5) & 0x07E0U) |
+                   ((color >> 3) & 0x001FU);
+        case DMA2D_OUTPUT_ARGB1555:
+            return ((color >> 16) & 0x8000U) | ((color >> 9) & 0x7C00U) |
+                   ((color >> 6) & 0x03E0U) | ((color >> 3) & 0x001FU);
+        case DMA2D_OUTPUT_ARGB4444:
+            return ((color >> 16) & 0xF000U) | ((color >> 12) & 0x0F00U) |
+                   ((color >> 8) & 0x00F0U) | ((color >> 4) & 0x000FU);
+        case DMA2D_OUTPUT_ARGB8888:
+        default:
+            return color;
+    }
+}
+
+}  // namespace disco
+
+/**
+ * @brief  Tells the driver that the DMA2D was reset (BSP MSP initialization).
+ */
+extern "C" void DMA2D_Driver_Invalidate(void) {
+    disco::Dma2dDriver::getInstance().invalidate();
+}
+
+/**
+ * @brief  DMA2D interrupt handler.
+ */
+extern "C" void DMA2D_Driver_IRQHandler(void) {
+    disco::Dma2dDriver::getInstance().onInterrupt();
+}
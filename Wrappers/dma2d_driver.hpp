@@ -0,0 +1,163 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file dma2d_driver.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Single owner of the DMA2D, programming only the registers whose value
+ *        changed since the previous transfer
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+// from mbed-os
+#include "stm32h7xx_hal.h"
+
+namespace disco {
+
+struct Dma2dTransfer {
+    // DMA2D_R2M, DMA2D_M2M, DMA2D_M2M_PFC or DMA2D_M2M_BLEND
+    // cppcheck-suppress unusedStructMember
+    uint32_t mode;
+    // DMA2D_OUTPUT_xxx
+    // cppcheck-suppress unusedStructMember
+    uint32_t outputColorMode;
+    // DMA2D_INPUT_xxx of the foreground (source) and of the background
+    // cppcheck-suppress unusedStructMember
+    uint32_t foregroundColorMode;
+    // cppcheck-suppress unusedStructMember
+    uint32_t backgroundColorMode;
+    // cppcheck-suppress unusedStructMember
+    uintptr_t source;
+    // cppcheck-suppress unusedStructMember
+    uintptr_t background;
+    // cppcheck-suppress unusedStructMember
+    uintptr_t destination;
+    // cppcheck-suppress unusedStructMember
+    uint16_t width;
+    // cppcheck-suppress unusedStructMember
+    uint16_t height;
+    // pixels skipped after each row
+    // cppcheck-suppress unusedStructMember
+    uint16_t foregroundOffset;
+    // cppcheck-suppress unusedStructMember
+    uint16_t backgroundOffset;
+    // cppcheck-suppress unusedStructMember
+    uint16_t outputOffset;
+    // fill color, or color of A8/A4 foregrounds (ARGB8888)
+    // cppcheck-suppress unusedStructMember
+    uint32_t color;
+};
+
+class Dma2dDriver {
+   public:
+    static Dma2dDriver& getInstance();
+
+    Dma2dDriver(const Dma2dDriver&)            = delete;
+    Dma2dDriver& operator=(const Dma2dDriver&) = delete;
+
+    // number of modes with statistics: M2M, M2M_PFC, M2M_BLEND and R2M
+    static constexpr uint32_t kNbrOfModes = 4;
+
+    struct ModeStats {
+        // cppcheck-suppress unusedStructMember
+        uint32_t nbrOfTransfers;
+        // CPU cycles spent programming the registers, before the start
+        // cppcheck-suppress unusedStructMember
+        uint32_t totalSetupCycles;
+        // cppcheck-suppress unusedStructMember
+        uint32_t maxSetupCycles;
+    };
+
+    struct Stats {
+        // indexed by the DMA2D mode value (DMA2D_R2M >> DMA2D_CR_MODE_Pos, ...)
+        // cppcheck-suppress unusedStructMember
+        ModeStats modes[kNbrOfModes];
+        // cppcheck-suppress unusedStructMember
+        uint32_t nbrOfWrites;
+        // cppcheck-suppress unusedStructMember
+        uint32_t nbrOfSkippedWrites;
+        // cppcheck-suppress unusedStructMember
+        uint32_t nbrOfErrors;
+    };
+
+    bool start(const Dma2dTransfer& transfer,
+               void (*pOnComplete)(void* pContext),
+               void* pContext);
+    bool run(const Dma2dTransfer& transfer);
+    bool isBusy() const;
+    void onInterrupt();
+    void invalidate();
+    const Stats& getStats() const;
+    void resetStats();
+
+    static uint32_t getOutputColor(uint32_t color, uint32_t colorMode);
+
+    // longest polled transfer, in ms
+    static constexpr uint32_t kTimeout = 50;
+
+   private:
+    Dma2dDriver();
+
+    // registers kept unchanged between transfers
+    enum ShadowRegister : uint8_t {
+        SHADOW_FGPFCCR = 0, /*!< Foreground color mode and alpha */
+        SHADOW_FGCOLR,      /*!< Foreground color of A8/A4 sources */
+        SHADOW_FGOR,        /*!< Foreground line offset */
+        SHADOW_BGPFCCR,     /*!< Background color mode and alpha */
+        SHADOW_BGOR,        /*!< Background line offset */
+        SHADOW_OPFCCR,      /*!< Output color mode */
+        SHADOW_OCOLR,       /*!< Output color of register to memory transfers */
+        SHADOW_OOR,         /*!< Output line offset */
+        NBR_OF_SHADOW_REGISTERS
+    };
+
+    bool claim();
+    void release();
+    void launch(const Dma2dTransfer& transfer,
+                void (*pOnComplete)(void* pContext),
+                void* pContext);
+    void abort();
+    void configure(const Dma2dTransfer& transfer);
+    void write(ShadowRegister index, volatile uint32_t& reg, uint32_t value);
+    void addSetup(uint32_t mode, uint32_t nbrOfCycles);
+
+    // values last written, bit n of validRegisters_ set if shadow_[n] is known
+    uint32_t shadow_[NBR_OF_SHADOW_REGISTERS] = {0};
+    uint32_t validRegisters_                  = 0;
+    volatile bool isBusy_                     = false;
+    void (*pOnComplete_)(void*)               = nullptr;
+    void* pContext_                           = nullptr;
+    Stats stats_                              = {};
+
+    // transfer given to start() while the DMA2D was busy, started when it is idle
+    struct DeferredTransfer {
+        // cppcheck-suppress unusedStructMember
+        Dma2dTransfer transfer;
+        // cppcheck-suppress unusedStructMember
+        void (*pOnComplete)(void*);
+        // cppcheck-suppress unusedStructMember
+        void* pContext;
+    };
+    DeferredTransfer deferred_ = {};
+    bool hasDeferred_          = false;
+};
+
+}  // namespace disco
@@ -0,0 +1,121 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/****************************************************************************
+ * @file dma2d_hal_backend.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief DMA2D backend running queued jobs on the DMA2D driver, with interrupts
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#include "dma2d_hal_backend.hpp"
+
+// from mbed-os
+#include "mbed.h"
+
+namespace disco {
+
+/**
+ * @brief  Starts a job on the DMA2D with the transfer complete and error interrupts
+ *         enabled. Only the registers that differ from the previous job are written.
+ * @param  job  Job to run
+ */
+void Dma2dHalBackend::start(const Dma2dJob& job) {
+    Dma2dTransfer transfer       = {};
+    transfer.outputColorMode     = getOutputMode(job.destinationMode);
+    transfer.foregroundColorMode = getInputMode(job.sourceMode);
+    transfer.backgroundColorMode = getInputMode(job.destinationMode);
+    transfer.source              = job.source;
+    transfer.background          = job.background;
+    transfer.destination         = job.destination;
+    transfer.width               = job.width;
+    transfer.height              = job.height;
+    transfer.foregroundOffset    = job.sourceOffset;
+    transfer.backgroundOffset    = job.backgroundOffset;
+    transfer.outputOffset        = job.destinationOffset;
+    transfer.color               = job.color;
+    switch (job.operation) {
+        case Dma2dOperation::Fill:
+            transfer.mode = DMA2D_R2M;
+            break;
+        case Dma2dOperation::Copy:
+            transfer.mode = DMA2D_M2M;
+            break;
+        case Dma2dOperation::Convert:
+            transfer.mode = DMA2D_M2M_PFC;
+            break;
+        case Dma2dOperation::Blend:
+        default:
+            transfer.mode = DMA2D_M2M_BLEND;
+            break;
+    }
+
+    // a busy driver starts the job when its polled transfer ended: no job is dropped
+    // since the queue starts one job at a time
+    if (!Dma2dDriver::getInstance().start(transfer, onTransferComplete, this)) {
+        MBED_ASSERT(false);
+    }
+}
+
+/**
+ * @brief  Masks the DMA2D interrupt while the queue is updated.
+ * @param  isMasked  true to mask the interrupt, false to unmask it
+ */
+void Dma2dHalBackend::maskCompletion(bool isMasked) {
+    if (isMasked) {
+        HAL_NVIC_DisableIRQ(DMA2D_IRQn);
+    } else {
+        HAL_NVIC_EnableIRQ(DMA2D_IRQn);
+    }
+}
+
+/**
+ * @brief  Transfer complete and transfer error callback of the driver.
+ * @param  pContext  Backend that started the transfer
+ */
+void Dma2dHalBackend::onTransferComplete(void* pContext) {
+    static_cast<Dma2dHalBackend*>(pContext)->complete();
+}
+
+/**
+ * @brief  Gets the DMA2D input color mode of a job color mode.
+ * @retval DMA2D_INPUT_xxx value
+ */
+uint32_t Dma2dHalBackend::getInputMode(Dma2dColorMode mode) {
+    switch (mode) {
+        case Dma2dColorMode::RGB565:
+            return DMA2D_INPUT_RGB565;
+        case Dma2dColorMode::A8:
+            return DMA2D_INPUT_A8;
+        case Dma2dColorMode::A4:
+            return DMA2D_INPUT_A4;
+        case Dma2dColorMode::ARGB8888:
+        default:
+            return DMA2D_INPUT_ARGB8888;
+    }
+}
+
+/**
+ * @brief  Gets the DMA2D output color mode of a job color mode.
+ * @retval DMA2D_OUTPUT_xxx value
+ */
+uint32_t Dma2dHalBackend::getOutputMode(Dma2dColorMode mode) {
+    return (mode == Dma2dColorMode::RGB565) ? DMA2D_OUTPUT_RGB565 : DMA2D_OUTPUT_ARGB8888;
+}
+
+}  // namespace disco
@@ -0,0 +1,46 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/****************************************************************************
+ * @file dma2d_hal_backend.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief DMA2D backend running queued jobs on the DMA2D driver, with interrupts
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#pragma once
+
+#include "dma2d_driver.hpp"
+#include "dma2d_queue.hpp"
+
+namespace disco {
+
+class Dma2dHalBackend : public Dma2dBackend {
+   public:
+    Dma2dHalBackend() = default;
+
+    void start(const Dma2dJob& job) override;
+    void maskCompletion(bool isMasked) override;
+
+   private:
+    static void onTransferComplete(void* pContext);
+    static uint32_t getInputMode(Dma2dColorMode mode);
+    static uint32_t getOutputMode(Dma2dColorMode mode);
+};
+
+}  // namespace disco
@@ -0,0 +1,136 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file dma2d_queue.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Queue of DMA2D jobs, each started by the completion of the previous one
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#include "dma2d_queue.hpp"
+
+namespace disco {
+
+/**
+ * @brief  Sets the queue notified when a job is done.
+ * @param  pQueue  Queue whose jobs run on this backend
+ */
+void Dma2dBackend::attach(Dma2dQueue* pQueue) { pQueue_ = pQueue; }
+
+/**
+ * @brief  Reports the end of the running job to the queue.
+ */
+void Dma2dBackend::complete() {
+    if (pQueue_ != nullptr) {
+        pQueue_->onTransferComplete();
+    }
+}
+
+/**
+ * @brief  Creates a queue running its jobs on a backend.
+ * @param  backend     DMA2D the jobs run on
+ * @param  firstJobId  Identifier returned by the first submit()
+ */
+Dma2dQueue::Dma2dQueue(Dma2dBackend& backend, uint32_t firstJobId)
+    : backend_(backend),
+      nbrOfSubmitted_(firstJobId - 1),
+      nbrOfCompleted_(firstJobId - 1) {
+    backend_.attach(this);
+}
+
+/**
+ * @brief  Queues a job, started at once if the DMA2D is idle. Waits for a free
+ *         entry if the queue is full.
+ * @note   The buffers of the job must not be changed until it is done.
+ * @param  job  Job to run
+ * @retval Job identifier, for isDone() and wait()
+ */
+uint32_t Dma2dQueue::submit(const Dma2dJob& job) {
+    while (nbrOfSubmitted_ - nbrOfCompleted_ >= kQueueSize) {
+        backend_.poll();
+    }
+    // the entry is not visible to the completion handler before it is counted
+    jobs_[nbrOfSubmitted_ % kQueueSize] = job;
+
+    backend_.maskCompletion(true);
+    nbrOfSubmitted_ = nbrOfSubmitted_ + 1;
+    uint32_t jobId  = nbrOfSubmitted_;
+    if (!isRunning_) {
+        isRunning_ = true;
+        backend_.start(jobs_[nbrOfCompleted_ % kQueueSize]);
+    }
+    backend_.maskCompletion(false);
+    return jobId;
+}
+
+/**
+ * @brief  Tells whether a job is done.
+ * @param  jobId  Identifier returned by submit()
+ * @retval true if the job and all jobs queued before it are done
+ */
+bool Dma2dQueue::isDone(uint32_t jobId) const {
+    // identifiers wrap around, compare their distance
+    return static_cast<int32_t>(nbrOfCompleted_ - jobId) >= 0;
+}
+
+/**
+ * @brief  Waits until a job is done.
+ * @param  jobId  Identifier returned by submit()
+ */
+void Dma2dQueue::wait(uint32_t jobId) {
+    while (!isDone(jobId)) {
+        backend_.poll();
+    }
+}
+
+/**
+ * @brief  Waits until all queued jobs are done.
+ */
+void Dma2dQueue::waitAll() { wait(nbrOfSubmitted_); }
+
+/**
+ * @brief  Gets the number of jobs queued or running.
+ * @retval Number of jobs not done
+ */
+uint32_t Dma2dQueue::getNbrOfPendingJobs() const {
+    return nbrOfSubmitted_ - nbrOfCompleted_;
+}
+
+/**
+ * @brief  Ends the running job and starts the next one. Called by the backend,
+ *         from the DMA2D interrupt on the target.
+ */
+void Dma2dQueue::onTransferComplete() {
+    // the entry may be reused as soon as the job is counted as done
+    const Dma2dJob& job      = jobs_[nbrOfCompleted_ % kQueueSize];
+    void (*pCallback)(void*) = job.pCallback;
+    void* pContext           = job.pContext;
+
+    nbrOfCompleted_ = nbrOfCompleted_ + 1;
+    if (nbrOfCompleted_ != nbrOfSubmitted_) {
+        backend_.start(jobs_[nbrOfCompleted_ % kQueueSize]);
+    } else {
+        isRunning_ = false;
+    }
+
+    if (pCallback != nullptr) {
+        pCallback(pContext);
+    }
+}
+
+}  // namespace disco
@@ -0,0 +1,120 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file dma2d_queue.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Queue of DMA2D jobs, each started by the completion of the previous one
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+namespace disco {
+
+enum class Dma2dOperation : uint8_t {
+    Fill,     /*!< Fills the destination with a color (register to memory) */
+    Copy,     /*!< Copies pixels of the destination format (memory to memory) */
+    Convert,  /*!< Copies pixels, converting them to the destination format */
+    Blend     /*!< Blends the source over the background into the destination */
+};
+
+enum class Dma2dColorMode : uint8_t { ARGB8888, RGB565, A8, A4 };
+
+struct Dma2dJob {
+    // cppcheck-suppress unusedStructMember
+    Dma2dOperation operation;
+    // cppcheck-suppress unusedStructMember
+    Dma2dColorMode sourceMode;
+    // cppcheck-suppress unusedStructMember
+    Dma2dColorMode destinationMode;
+    // cppcheck-suppress unusedStructMember
+    uintptr_t source;
+    // cppcheck-suppress unusedStructMember
+    uintptr_t background;
+    // cppcheck-suppress unusedStructMember
+    uintptr_t destination;
+    // cppcheck-suppress unusedStructMember
+    uint16_t width;
+    // cppcheck-suppress unusedStructMember
+    uint16_t height;
+    // pixels skipped after each row
+    // cppcheck-suppress unusedStructMember
+    uint16_t sourceOffset;
+    // cppcheck-suppress unusedStructMember
+    uint16_t backgroundOffset;
+    // cppcheck-suppress unusedStructMember
+    uint16_t destinationOffset;
+    // fill color, or color of A8/A4 sources (ARGB8888)
+    // cppcheck-suppress unusedStructMember
+    uint32_t color;
+    // called from the completion interrupt, may be null
+    // cppcheck-suppress unusedStructMember
+    void (*pCallback)(void* pContext);
+    // cppcheck-suppress unusedStructMember
+    void* pContext;
+};
+
+class Dma2dQueue;
+
+// DMA2D the jobs run on: the hardware, or a simulation on the host
+class Dma2dBackend {
+   public:
+    void attach(Dma2dQueue* pQueue);
+    // starts a job, calling complete() when it is done
+    virtual void start(const Dma2dJob& job) = 0;
+    // prevents complete() from being called while the queue is updated
+    virtual void maskCompletion(bool isMasked) = 0;
+    // called while waiting for a job
+    virtual void poll() {}
+
+   protected:
+    ~Dma2dBackend() = default;
+    void complete();
+
+   private:
+    Dma2dQueue* pQueue_ = nullptr;
+};
+
+class Dma2dQueue {
+   public:
+    // the first identifier is only changed to test the wraparound of identifiers
+    explicit Dma2dQueue(Dma2dBackend& backend, uint32_t firstJobId = 1);
+
+    Dma2dQueue(const Dma2dQueue&)            = delete;
+    Dma2dQueue& operator=(const Dma2dQueue&) = delete;
+
+    uint32_t submit(const Dma2dJob& job);
+    bool isDone(uint32_t jobId) const;
+    void wait(uint32_t jobId);
+    void waitAll();
+    uint32_t getNbrOfPendingJobs() const;
+    void onTransferComplete();
+
+    static constexpr uint32_t kQueueSize = 16;
+
+   private:
+    Dma2dBackend& backend_;
+    Dma2dJob jobs_[kQueueSize]        = {};
+    volatile uint32_t nbrOfSubmitted_ = 0;
+    volatile uint32_t nbrOfCompleted_ = 0;
+    volatile bool isRunning_          = false;
+};
+
+}  // namespace disco
@@ -0,0 +1,198 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file dma2d_sim_backend.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief DMA2D backend simulating queued jobs in software, to run the queue on
+ *        the host
+ *
+ * A started job runs when the queue polls the backend, after the configured
+ * number of polls, as if the DMA2D was working meanwhile. Blending follows the
+ * DMA2D formula for an opaque background, with an 8-bit division by 255, and
+ * is not bit-exact with the hardware.
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#include "dma2d_sim_backend.hpp"
+
+#include "color.hpp"
+
+namespace disco {
+
+/**
+ * @brief  Reads a pixel as ARGB8888. A8/A4 pixels get the job color.
+ */
+static uint32_t readPixel(uintptr_t base,
+                          uint32_t index,
+                          Dma2dColorMode mode,
+                          uint32_t color) {
+    switch (mode) {
+        case Dma2dColorMode::RGB565: {
+            uint32_t pixel = reinterpret_cast<const uint16_t*>(base)[index];  // NOLINT
+            return CONVERTRGB5652ARGB8888(pixel);
+        }
+        case Dma2dColorMode::A8: {
+            uint32_t alpha = reinterpret_cast<const uint8_t*>(base)[index];  // NOLINT
+            return (alpha << 24) | (color & 0x00FFFFFFU);
+        }
+        case Dma2dColorMode::A4: {
+            // first pixel of each pair in the low nibble
+            uint8_t pair   = reinterpret_cast<const uint8_t*>(base)[index / 2];  // NOLINT
+            uint32_t alpha = ((index % 2 == 0) ? (pair & 0x0FU) : (pair >> 4)) * 17;
+            return (alpha << 24) | (color & 0x00FFFFFFU);
+        }
+        case Dma2dColorMode::ARGB8888:
+        default:
+            return reinterpret_cast<const uint32_t*>(base)[index];  // NOLINT
+    }
+}
+
+/**
+ * @brief  Writes an ARGB8888 color as a pixel of the destination format.
+ */
+static void writePixel(uintptr_t base,
+                       uint32_t index,
+                       Dma2dColorMode mode,
+                       uint32_t color) {
+    if (mode == Dma2dColorMode::RGB565) {
+        reinterpret_cast<uint16_t*>(base)[index] =  // NOLINT
+            static_cast<uint16_t>(CONVERTARGB88882RGB565(color));
+    } else {
+        reinterpret_cast<uint32_t*>(base)[index] = color;  // NOLINT
+    }
+}
+
+/**
+ * @brief  Gets the address of the first pixel of a row.
+ */
+static uintptr_t getRow(uintptr_t base,
+                        uint32_t row,
+                        uint32_t width,
+                        uint32_t offset,
+                        Dma2dColorMode mode) {
+    uint32_t nbrOfPixels = row * (width + offset);
+    switch (mode) {
+        case Dma2dColorMode::ARGB8888:
+            return base + nbrOfPixels * 4;
+        case Dma2dColorMode::RGB565:
+            return base + nbrOfPixels * 2;
+        case Dma2dColorMode::A4:
+            return base + nbrOfPixels / 2;
+        case Dma2dColorMode::A8:
+        default:
+            return base + nbrOfPixels;
+    }
+}
+
+/**
+ * @brief  Blends one channel: foreground * alpha + background * (255 - alpha).
+ */
+static uint32_t blendChannel(uint32_t fg, uint32_t bg, uint32_t alpha, uint32_t shift) {
+    uint32_t fgValue = (fg >> shift) & 0xFFU;
+    uint32_t bgValue = (bg >> shift) & 0xFFU;
+    return ((fgValue * alpha + bgValue * (255 - alpha)) / 255) << shift;
+}
+
+/**
+ * @brief  Accepts a job, run by a later poll().
+ * @param  job  Job to run
+ */
+void Dma2dSimBackend::start(const Dma2dJob& job) {
+    job_            = job;
+    isBusy_         = true;
+    remainingPolls_ = latency_;
+}
+
+/**
+ * @brief  Nothing to mask: completions only happen in poll().
+ */
+void Dma2dSimBackend::maskCompletion(bool /*isMasked*/) {}
+
+/**
+ * @brief  Runs the started job once its latency has elapsed and reports its
+ *         completion, which starts the next queued job.
+ */
+void Dma2dSimBackend::poll() {
+    if (!isBusy_) {
+        return;
+    }
+    if (remainingPolls_ > 0) {
+        remainingPolls_--;
+        return;
+    }
+    run(job_);
+    isBusy_ = false;
+    complete();
+}
+
+/**
+ * @brief  Sets how many polls a job takes, to let work overlap the transfers.
+ * @param  nbrOfPolls  Polls before a started job completes
+ */
+void Dma2dSimBackend::setLatency(uint32_t nbrOfPolls) { latency_ = nbrOfPolls; }
+
+/**
+ * @brief  Tells whether a job is running.
+ * @retval true if a started job did not complete yet
+ */
+bool Dma2dSimBackend::isBusy() const { return isBusy_; }
+
+/**
+ * @brief  Gets the number of jobs and pixels processed.
+ * @retval Backend statistics
+ */
+const Dma2dSimBackend::Stats& Dma2dSimBackend::getStats() const { return stats_; }
+
+/**
+ * @brief  Resets the job and pixel counters.
+ */
+void Dma2dSimBackend::resetStats() { stats_ = {.nbrOfJobs = 0, .nbrOfPixels = 0}; }
+
+/**
+ * @brief  Processes a job in software.
+ */
+void Dma2dSimBackend::run(const Dma2dJob& job) {
+    for (uint32_t y = 0; y < job.height; y++) {
+        uintptr_t pSource =
+            getRow(job.source, y, job.width, job.sourceOffset, job.sourceMode);
+        uintptr_t pBackground = getRow(
+            job.background, y, job.width, job.backgroundOffset, job.destinationMode);
+        uintptr_t pDestination = getRow(
+            job.destination, y, job.width, job.destinationOffset, job.destinationMode);
+
+        for (uint32_t x = 0; x < job.width; x++) {
+            uint32_t color = job.color;
+            if (job.operation == Dma2dOperation::Copy ||
+                job.operation == Dma2dOperation::Convert) {
+                color = readPixel(pSource, x, job.sourceMode, job.color);
+            } else if (job.operation == Dma2dOperation::Blend) {
+                uint32_t fg    = readPixel(pSource, x, job.sourceMode, job.color);
+                uint32_t bg    = readPixel(pBackground, x, job.destinationMode, 0);
+                uint32_t alpha = fg >> 24;
+                color          = 0xFF000000U | blendChannel(fg, bg, alpha, 16) |
+                        blendChannel(fg, bg, alpha, 8) | blendChannel(fg, bg, alpha, 0);
+            }
+            writePixel(pDestination, x, job.destinationMode, color);
+        }
+    }
+
+    stats_.nbrOfJobs++;
+    stats_.nbrOfPixels += job.width * job.height;
+}
+
+}  // namespace disco
@@ -0,0 +1,64 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file dma2d_sim_backend.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief DMA2D backend simulating queued jobs in software, to run the queue on
+ *        the host
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+#include "dma2d_queue.hpp"
+
+namespace disco {
+
+class Dma2dSimBackend : public Dma2dBackend {
+   public:
+    Dma2dSimBackend() = default;
+
+    struct Stats {
+        // cppcheck-suppress unusedStructMember
+        uint32_t nbrOfJobs;
+        // cppcheck-suppress unusedStructMember
+        uint32_t nbrOfPixels;
+    };
+
+    void start(const Dma2dJob& job) override;
+    void maskCompletion(bool isMasked) override;
+    void poll() override;
+
+    void setLatency(uint32_t nbrOfPolls);
+    bool isBusy() const;
+    const Stats& getStats() const;
+    void resetStats();
+
+   private:
+    void run(const Dma2dJob& job);
+
+    Dma2dJob job_            = {};
+    bool isBusy_             = false;
+    uint32_t latency_        = 0;
+    uint32_t remainingPolls_ = 0;
+    Stats stats_             = {.nbrOfJobs = 0, .nbrOfPixels = 0};
+};
+
+}  // namespace disco
@@ -0,0 +1,395 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file draw_dispatcher.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Choice between the CPU and the DMA2D for fills and copies, from the
+ *        number of bytes written and a threshold calibrated at startup
+ *
+ * A DMA2D transfer has a fixed cost (programming, start, end of transfer) that
+ * a CPU store loop does not have, but writes each byte faster. Both costs are
+ * measured on a small and a large fill at startup; operations writing fewer
+ * bytes than the point where the two lines cross are done by the CPU. The CPU
+ * is only used when the DMA2D is idle, so that it does not race queued jobs.
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#include "draw_dispatcher.hpp"
+
+#include <string.h>
+
+#include "dma2d_driver.hpp"
+#include "pixel_kernels.hpp"
+
+namespace disco {
+
+// calibration fills, in ARGB8888 pixels: a few pixels and kCalibrationSize bytes
+static constexpr uint32_t kSmallFillWidth = 4;
+static constexpr uint32_t kLargeFillWidth = 64;
+static constexpr uint32_t kLargeFillHeight =
+    DrawDispatcher::kCalibrationSize / (4 * kLargeFillWidth);
+// each cost is the best of a few runs, to leave out interrupts
+static constexpr uint32_t kNbrOfRuns = 4;
+
+/**
+ * @brief  Measures the cycles of a CPU fill of the scratch memory.
+ */
+static uint32_t measureCpuFill(uintptr_t scratch, uint32_t width, uint32_t height) {
+    uint32_t best = UINT32_MAX;
+    for (uint32_t i = 0; i < kNbrOfRuns; i++) {
+        uint32_t start = DWT->CYCCNT;
+        DrawDispatcher::fillByCpu(scratch, width, height, 0, 4, 0);
+        uint32_t cycles = DWT->CYCCNT - start;
+        if (cycles < best) {
+            best = cycles;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief  Measures the cycles of a polled DMA2D fill of the scratch memory.
+ */
+static uint32_t measureDma2dFill(uintptr_t scratch, uint32_t width, uint32_t height) {
+    Dma2dTransfer transfer   = {};
+    transfer.mode            = DMA2D_R2M;
+    transfer.outputColorMode = DMA2D_OUTPUT_ARGB8888;
+    transfer.destination     = scratch;
+    transfer.width           = static_cast<uint16_t>(width);
+    transfer.height          = static_cast<uint16_t>(height);
+
+    uint32_t best = UINT32_MAX;
+    for (uint32_t i = 0; i < kNbrOfRuns; i++) {
+        uint32_t start = DWT->CYCCNT;
+        if (!Dma2dDriver::getInstance().run(transfer)) {
+            continue;
+        }
+        uint32_t cycles = DWT->CYCCNT - start;
+        if (cycles < best) {
+            best = cycles;
+        }
+    }
+    return best;
+}
+
+/**
+ * @brief  Tells whether a measure is usable: 0 if the cycle counter does not run,
+ *         UINT32_MAX if no DMA2D transfer ended.
+ */
+static bool isMeasured(uint32_t cycles) { return cycles != 0 && cycles != UINT32_MAX; }
+
+/**
+ * @brief  Gets the dispatcher shared by the display and the BSP drawing functions.
+ * @retval Dispatcher instance
+ */
+DrawDispatcher& DrawDispatcher::getInstance() {
+    static DrawDispatcher dispatcher;
+    return dispatcher;
+}
+
+/**
+ * @brief  Chooses how to do an operation and counts the decision.
+ * @param  nbrOfBytes   Number of bytes written by the operation
+ * @param  isDma2dIdle  false if DMA2D transfers are running or queued, the CPU
+ *                      must then not write the framebuffer
+ * @retval Path to use
+ */
+DrawPath DrawDispatcher::choose(uint32_t nbrOfBytes, bool isDma2dIdle) {
+    if (nbrOfBytes < threshold_) {
+        if (isDma2dIdle) {
+            stats_.nbrOfCpuOperations++;
+            stats_.nbrOfCpuBytes += nbrOfBytes;
+            return DrawPath::CPU;
+        }
+        stats_.nbrOfBusyFallbacks++;
+    }
+    stats_.nbrOfDma2dOperations++;
+    stats_.nbrOfDma2dBytes += nbrOfBytes;
+    return DrawPath::DMA2D;
+}
+
+/**
+ * @brief  Sets the threshold where the CPU and DMA2D costs cross, from fills of a
+ *         few pixels and of kCalibrationSize bytes done both ways. The costs are
+ *         modelled as a fixed part plus a part per byte (Q8 cycles). The
+ *         default threshold is kept if a measure failed or a cost does not grow
+ *         with the number of bytes.
+ * @param  scratch  Address of kCalibrationSize bytes of uncached or write-through
+ *                  memory that can be overwritten, e.g. a framebuffer not shown yet
+ */
+void DrawDispatcher::calibrate(uintptr_t scratch) {
+    static constexpr int32_t kSmallBytes = 4 * kSmallFillWidth;
+    static constexpr int32_t kLargeBytes = kCalibrationSize;
+
+    uint32_t cycles[] = {
+        measureCpuFill(scratch, kSmallFillWidth, 1),
+        measureCpuFill(scratch, kLargeFillWidth, kLargeFillHeight),
+        measureDma2dFill(scratch, kSmallFillWidth, 1),
+        measureDma2dFill(scratch, kLargeFillWidth, kLargeFillHeight),
+    };
+    for (uint32_t measure : cycles) {
+        if (!isMeasured(measure)) {
+            threshold_ = kDefaultThreshold;
+            return;
+        }
+    }
+    int32_t cpuSmall   = static_cast<int32_t>(cycles[0]);
+    int32_t cpuLarge   = static_cast<int32_t>(cycles[1]);
+    int32_t dma2dSmall = static_cast<int32_t>(cycles[2]);
+    int32_t dma2dLarge = static_cast<int32_t>(cycles[3]);
+
+    int32_t cpuSlope   = ((cpuLarge - cpuSmall) << 8) / (kLargeBytes - kSmallBytes);
+    int32_t dma2dSlope = ((dma2dLarge - dma2dSmall) << 8) / (kLargeBytes - kSmallBytes);
+    if (cpuSlope <= 0 || dma2dSlope <= 0) {
+        // the measures were disturbed, e.g. by interrupts
+        threshold_ = kDefaultThreshold;
+        return;
+    }
+    int32_t cpuFixed   = cpuSmall - ((cpuSlope * kSmallBytes) >> 8);
+    int32_t dma2dFixed = dma2dSmall - ((dma2dSlope * kSmallBytes) >> 8);
+
+    if (cpuSlope <= dma2dSlope) {
+        // the CPU is never slower
+        threshold_ = UINT32_MAX;
+    } else if (dma2dFixed <= cpuFixed) {
+        // nor is the DMA2D
+        threshold_ = 0;
+    } else {
+        threshold_ = static_cast<uint32_t>(((dma2dFixed - cpuFixed) << 8) /
+                                           (cpuSlope - dma2dSlope));
+    }
+}
+
+/**
+ * @brief  Sets the threshold, replacing the calibrated one.
+ * @param  nbrOfBytes  Operations writing fewer bytes are done by the CPU
+ */
+void DrawDispatcher::setThreshold(uint32_t nbrOfBytes) { threshold_ = nbrOfBytes; }
+
+/**
+ * @brief  Gets the threshold.
+ * @retval Number of bytes from which operations are done by the DMA2D
+ */
+uint32_t DrawDispatcher::getThreshold() const { return threshold_; }
+
+/**
+ * @brief  Gets the decision counters.
+ * @retval Dispatcher statistics
+ */
+const DrawDispatcher::Stats& DrawDispatcher::getStats() const { return stats_; }
+
+/**
+ * @brief  Resets the decision counters.
+ */
+void DrawDispatcher::resetStats() { stats_ = {}; }
+
+/**
+ * @brief  Fills a rectangle with the CPU.
+ * @param  destination    Address of the top-left pixel
+ * @param  width          Rectangle width
+ * @param  height         Rectangle height
+ * @param  offset         Pixels skipped after each row
+ * @param  bytesPerPixel  1, 2 or 4
+ * @param  value          Pixel value, in the destination format
+ */
+void DrawDispatcher::fillByCpu(uintptr_t destination,
+                               uint32_t width,
+                               uint32_t height,
+                               uint32_t offset,
+                               uint32_t bytesPerPixel,
+                               uint32_t value) {
+    uint32_t pitch = (width + offset) * bytesPerPixel;
+    for (uint32_t i = 0; i < height; i++) {
+        if (bytesPerPixel == 4) {
+            fillRow8888(reinterpret_cast<uint32_t*>(destination),  // NOLINT
+                        width,
+                        value);
+        } else if (bytesPerPixel == 2) {
+            fillRow565(reinterpret_cast<uint16_t*>(destination),  // NOLINT
+                       width,
+                       static_cast<uint16_t>(value));
+        } else {
+            fillRow8(reinterpret_cast<uint8_t*>(destination),  // NOLINT
+                     width,
+                     static_cast<uint8_t>(value));
+        }
+        destination += pitch;
+    }
+}
+
+/**
+ * @brief  Copies contiguous rows of pixels with the CPU.
+ * @param  destination       Address of the top-left pixel
+ * @param  pSource           First pixel of the contiguous rows
+ * @param  bytesPerRow       Bytes of each row
+ * @param  height            Number of rows
+ * @param  destinationPitch  Bytes between the rows of the destination
+ */
+void DrawDispatcher::copyByCpu(uintptr_t destination,
+                               const uint8_t* pSource,
+                               uint32_t bytesPerRow,
+                               uint32_t height,
+                               uint32_t destinationPitch) {
+    for (uint32_t i = 0; i < height; i++) {
+        uint8_t* pRow = reinterpret_cast<uint8_t*>(destination);  // NOLINT
+        memcpy(pRow, pSource, bytesPerRow);
+        pSource     += bytesPerRow;
+        destination += destinationPitch;
+    }
+}
+
+/**
+ * @brief  Gets the size of the pixels the CPU paths can write.
+ * @param  colorMode  DMA2D_OUTPUT_xxx
+ * @retval Bytes per pixel, 0 if the format is left to the DMA2D
+ */
+static uint32_t getBytesPerPixel(uint32_t colorMode) {
+    switch (colorMode) {
+        case DMA2D_OUTPUT_ARGB8888:
+            return 4;
+        case DMA2D_OUTPUT_RGB565:
+            return 2;
+        default:
+            return 0;
+    }
+}
+
+}  // namespace disco
+
+/**
+ * @brief  Fills a rectangle for the BSP, on the CPU or with a polled DMA2D transfer.
+ * @param  pDst       Address of the top left pixel
+ * @param  xSize      Width in pixels
+ * @param  ySize      Height in pixels
+ * @param  OffLine    Pixels skipped after each row
+ * @param  ColorMode  DMA2D_OUTPUT_xxx of the destination
+ * @param  Color      ARGB8888 color
+ */
+extern "C" void DRAW_Dispatch_Fill(uint32_t* pDst,
+                                   uint32_t xSize,
+                                   uint32_t ySize,
+                                   uint32_t OffLine,
+                                   uint32_t ColorMode,
+                                   uint32_t Color) {
+    disco::Dma2dDriver& driver = disco::Dma2dDriver::getInstance();
+    uint32_t bytesPerPixel     = disco::getBytesPerPixel(ColorMode);
+    uintptr_t destination      = reinterpret_cast<uintptr_t>(pDst);
+    uint32_t nbrOfBytes        = xSize * ySize * bytesPerPixel;
+    if (bytesPerPixel != 0 && disco::DrawDispatcher::getInstance().choose(
+                                  nbrOfBytes, !driver.isBusy()) == disco::DrawPath::CPU) {
+        uint32_t value = disco::Dma2dDriver::getOutputColor(Color, ColorMode);
+        disco::DrawDispatcher::fillByCpu(
+            destination, xSize, ySize, OffLine, bytesPerPixel, value);
+        return;
+    }
+
+    disco::Dma2dTransfer transfer = {};
+    transfer.mode                 = DMA2D_R2M;
+    transfer.outputColorMode      = ColorMode;
+    transfer.destination          = destination;
+    transfer.width                = static_cast<uint16_t>(xSize);
+    transfer.height               = static_cast<uint16_t>(ySize);
+    transfer.outputOffset         = static_cast<uint16_t>(OffLine);
+    transfer.color                = Color;
+    (void)driver.run(transfer);
+}
+
+/**
+ * @brief  Fills a rectangle of an L8 framebuffer for the BSP. The DMA2D has no L8
+ *         output: the word-aligned part of the rows is filled by a polled ARGB8888
+ *         transfer of four indices per pixel, the CPU fills the edges.
+ * @param  pDst     Address of the top left pixel
+ * @param  xSize    Width in pixels
+ * @param  ySize    Height in pixels
+ * @param  OffLine  Pixels skipped after each row
+ * @param  Index    Palette index
+ */
+extern "C" void DRAW_Dispatch_FillIndexed(
+    uint8_t* pDst, uint32_t xSize, uint32_t ySize, uint32_t OffLine, uint8_t Index) {
+    disco::Dma2dDriver& driver = disco::Dma2dDriver::getInstance();
+    uintptr_t destination      = reinterpret_cast<uintptr_t>(pDst);
+    uint32_t pitch             = xSize + OffLine;
+
+    uint32_t head = (4 - (destination & 3)) & 3;
+    if (head > xSize) {
+        head = xSize;
+    }
+    uint32_t nbrOfWords = (xSize - head) / 4;
+    uint32_t tail       = xSize - head - 4 * nbrOfWords;
+
+    // the word transfer needs all rows to start at the same word alignment
+    if (nbrOfWords == 0 || (pitch % 4) != 0 ||
+        disco::DrawDispatcher::getInstance().choose(xSize * ySize, !driver.isBusy()) ==
+            disco::DrawPath::CPU) {
+        disco::DrawDispatcher::fillByCpu(destination, xSize, ySize, OffLine, 1, Index);
+        return;
+    }
+
+    for (uint32_t i = 0; i < ySize; i++) {
+        disco::fillRow8(pDst, head, Index);
+        disco::fillRow8(pDst + head + 4 * nbrOfWords, tail, Index);
+        pDst += pitch;
+    }
+
+    disco::Dma2dTransfer transfer = {};
+    transfer.mode                 = DMA2D_R2M;
+    transfer.outputColorMode      = DMA2D_OUTPUT_ARGB8888;
+    transfer.destination          = destination + head;
+    transfer.width                = static_cast<uint16_t>(nbrOfWords);
+    transfer.height               = static_cast<uint16_t>(ySize);
+    transfer.outputOffset         = static_cast<uint16_t>(pitch / 4 - nbrOfWords);
+    transfer.color                = Index * 0x01010101U;
+    (void)driver.run(transfer);
+}
+
+/**
+ * @brief  Converts a line of pixels for the BSP. A line already in the output
+ *         format may be copied by the CPU, others use a polled DMA2D transfer.
+ * @param  pSrc             Source pixels
+ * @param  pDst             Destination pixels
+ * @param  xSize            Number of pixels
+ * @param  InputColorMode   DMA2D_INPUT_xxx of the source
+ * @param  OutputColorMode  DMA2D_OUTPUT_xxx of the destination
+ */
+extern "C" void DRAW_Dispatch_ConvertLine(uint32_t* pSrc,
+                                          uint32_t* pDst,
+                                          uint32_t xSize,
+                                          uint32_t InputColorMode,
+                                          uint32_t OutputColorMode) {
+    disco::Dma2dDriver& driver = disco::Dma2dDriver::getInstance();
+    bool isSameFormat =
+        (InputColorMode == DMA2D_INPUT_ARGB8888 &&
+         OutputColorMode == DMA2D_OUTPUT_ARGB8888) ||
+        (InputColorMode == DMA2D_INPUT_RGB565 && OutputColorMode == DMA2D_OUTPUT_RGB565);
+    uint32_t nbrOfBytes = xSize * disco::getBytesPerPixel(OutputColorMode);
+    if (isSameFormat && disco::DrawDispatcher::getInstance().choose(
+                            nbrOfBytes, !driver.isBusy()) == disco::DrawPath::CPU) {
+        memcpy(pDst, pSrc, nbrOfBytes);
+        return;
+    }
+
+    disco::Dma2dTransfer transfer = {};
+    transfer.mode                 = DMA2D_M2M_PFC;
+    transfer.outputColorMode      = OutputColorMode;
+    transfer.foregroundColorMode  = InputColorMode;
+    transfer.source               = reinterpret_cast<uintptr_t>(pSrc);
+    transfer.destination          = reinterpret_cast<uintptr_t>(pDst);
+    transfer.width                = static_cast<uint16_t>(xSize);
+    transfer.height               = 1;
+    (void)driver.run(transfer);
+}
@@ -0,0 +1,89 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file draw_dispatcher.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Choice between the CPU and the DMA2D for fills and copies, from the
+ *        number of bytes written and a threshold calibrated at startup
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+namespace disco {
+
+enum class DrawPath : uint8_t {
+    CPU,   /*!< Store loop on the CPU, no setup cost */
+    DMA2D  /*!< Transfer on the DMA2D, faster per byte */
+};
+
+class DrawDispatcher {
+   public:
+    static DrawDispatcher& getInstance();
+
+    DrawDispatcher(const DrawDispatcher&)            = delete;
+    DrawDispatcher& operator=(const DrawDispatcher&) = delete;
+
+    struct Stats {
+        // cppcheck-suppress unusedStructMember
+        uint32_t nbrOfCpuOperations;
+        // cppcheck-suppress unusedStructMember
+        uint32_t nbrOfCpuBytes;
+        // cppcheck-suppress unusedStructMember
+        uint32_t nbrOfDma2dOperations;
+        // cppcheck-suppress unusedStructMember
+        uint32_t nbrOfDma2dBytes;
+        // operations below the threshold given to the DMA2D because it was busy
+        // cppcheck-suppress unusedStructMember
+        uint32_t nbrOfBusyFallbacks;
+    };
+
+    DrawPath choose(uint32_t nbrOfBytes, bool isDma2dIdle);
+    void calibrate(uintptr_t scratch);
+    void setThreshold(uint32_t nbrOfBytes);
+    uint32_t getThreshold() const;
+    const Stats& getStats() const;
+    void resetStats();
+
+    static void fillByCpu(uintptr_t destination,
+                          uint32_t width,
+                          uint32_t height,
+                          uint32_t offset,
+                          uint32_t bytesPerPixel,
+                          uint32_t value);
+    static void copyByCpu(uintptr_t destination,
+                          const uint8_t* pSource,
+                          uint32_t bytesPerRow,
+                          uint32_t height,
+                          uint32_t destinationPitch);
+
+    // threshold used until calibrate() is called
+    static constexpr uint32_t kDefaultThreshold = 256;
+    // bytes of scratch memory written by calibrate()
+    static constexpr uint32_t kCalibrationSize = 8192;
+
+   private:
+    DrawDispatcher() = default;
+
+    uint32_t threshold_ = kDefaultThreshold;
+    Stats stats_        = {};
+};
+
+}  // namespace disco
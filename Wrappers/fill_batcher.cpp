@@ -0,0 +1,106 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/****************************************************************************
+ * @file fill_batcher.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Fills waiting to be queued on the DMA2D, merged when they are adjacent
+ *        and of the same color
+ *
+ * Fills are kept in drawing order. A new fill is merged with a pending fill of
+ * the same color and buffer when together they form a rectangle (touching rows
+ * or columns of the same extent, or one holding the other), so that a line drawn
+ * row by row becomes a single register to memory transfer. A fill never moves
+ * before a later pending fill that it overlaps.
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#include "fill_batcher.hpp"
+
+namespace disco {
+
+/**
+ * @brief  Adds a fill, merged with a pending one if possible.
+ * @param  area         Area to fill
+ * @param  color        Color in the framebuffer format
+ * @param  frameBuffer  Address of the buffer drawn to
+ * @retval false if the fill could not be merged and no entry is left, the pending
+ *         fills must be queued first
+ */
+bool FillBatcher::add(const Rect& area, uint32_t color, uint32_t frameBuffer) {
+    for (uint32_t i = nbrOfFills_; i > 0; i--) {
+        PendingFill& fill = fills_[i - 1];
+        if (fill.frameBuffer != frameBuffer) {
+            // buffers drawn to may share memory (scrolling), keep the order
+            break;
+        }
+        Rect merged = getBoundingRect(fill.area, area);
+        bool isExact =
+            contains(fill.area, area) || contains(area, fill.area) ||
+            (!intersects(fill.area, area) &&
+             getArea(merged) == getArea(fill.area) + getArea(area));
+        if (fill.color == color && isExact) {
+            fill.area = merged;
+            stats_.nbrOfFills++;
+            stats_.nbrOfMerges++;
+            return true;
+        }
+        if (intersects(fill.area, area)) {
+            // drawn over this fill, it cannot move before it
+            break;
+        }
+    }
+
+    if (nbrOfFills_ == kMaxNbrOfFills) {
+        return false;
+    }
+    fills_[nbrOfFills_++] = {.area = area, .color = color, .frameBuffer = frameBuffer};
+    stats_.nbrOfFills++;
+    return true;
+}
+
+/**
+ * @brief  Gets the number of pending fills.
+ * @retval Number of fills to queue
+ */
+uint32_t FillBatcher::getNbrOfFills() const { return nbrOfFills_; }
+
+/**
+ * @brief  Gets a pending fill.
+ * @param  index  Fill number, in drawing order
+ * @retval Pending fill
+ */
+const PendingFill& FillBatcher::getFill(uint32_t index) const { return fills_[index]; }
+
+/**
+ * @brief  Drops all pending fills, once they were queued.
+ */
+void FillBatcher::clear() { nbrOfFills_ = 0; }
+
+/**
+ * @brief  Gets the fill and merge counters.
+ * @retval Batcher statistics
+ */
+const FillBatcher::Stats& FillBatcher::getStats() const { return stats_; }
+
+/**
+ * @brief  Resets the fill and merge counters.
+ */
+void FillBatcher::resetStats() { stats_ = {.nbrOfFills = 0, .nbrOfMerges = 0}; }
+
+}  // namespace disco
@@ -0,0 +1,73 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/****************************************************************************
+ * @file fill_batcher.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Fills waiting to be queued on the DMA2D, merged when they are adjacent
+ *        and of the same color
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+#include "rect.hpp"
+
+namespace disco {
+
+struct PendingFill {
+    // cppcheck-suppress unusedStructMember
+    Rect area;
+    // color in the framebuffer format (palette index in L8)
+    // cppcheck-suppress unusedStructMember
+    uint32_t color;
+    // address of the buffer drawn to, pixel (0, 0)
+    // cppcheck-suppress unusedStructMember
+    uint32_t frameBuffer;
+};
+
+class FillBatcher {
+   public:
+    FillBatcher() = default;
+
+    struct Stats {
+        // cppcheck-suppress unusedStructMember
+        uint32_t nbrOfFills;
+        // fills merged with a pending one, which saved a DMA2D job each
+        // cppcheck-suppress unusedStructMember
+        uint32_t nbrOfMerges;
+    };
+
+    bool add(const Rect& area, uint32_t color, uint32_t frameBuffer);
+    uint32_t getNbrOfFills() const;
+    const PendingFill& getFill(uint32_t index) const;
+    void clear();
+    const Stats& getStats() const;
+    void resetStats();
+
+    static constexpr uint32_t kMaxNbrOfFills = 16;
+
+   private:
+    PendingFill fills_[kMaxNbrOfFills] = {};
+    uint32_t nbrOfFills_               = 0;
+    Stats stats_                       = {.nbrOfFills = 0, .nbrOfMerges = 0};
+};
+
+}  // namespace disco
@@ -0,0 +1,118 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file font_converter.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Conversion of 1-bpp fonts into anti-aliased A4/A8 fonts
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#include "font_converter.hpp"
+
+namespace disco {
+
+/**
+ * @brief  Computes the coverage of one destination pixel, i.e. the ratio of set
+ *         source bits in the scale x scale block it covers.
+ * @retval Coverage between 0 and 255
+ */
+static uint32_t computeCoverage(
+    const Font* pSrc, const uint8_t* pGlyph, uint32_t x, uint32_t y, uint32_t scale) {
+    uint32_t nbrOfBytesPerLine = getBytesPerRow(pSrc);
+    uint32_t count             = 0;
+    for (uint32_t i = y * scale; i < (y + 1) * scale && i < pSrc->height; i++) {
+        const uint8_t* pchar = pGlyph + nbrOfBytesPerLine * i;
+        for (uint32_t j = x * scale; j < (x + 1) * scale && j < pSrc->width; j++) {
+            if (pchar[j / 8] & (0x80U >> (j % 8))) {
+                count++;
+            }
+        }
+    }
+    return (count * 255 + (scale * scale) / 2) / (scale * scale);
+}
+
+/**
+ * @brief  Computes the size of the table produced by convertToAlphaFont.
+ * @param  pSrc    1-bpp source font
+ * @param  scale   Downsampling factor (1 keeps the size, 2 halves it, ...)
+ * @param  format  FontFormat::A4 or FontFormat::A8
+ * @retval Number of bytes, or 0 if the arguments are not supported
+ */
+uint32_t getAlphaFontSize(const Font* pSrc, uint32_t scale, FontFormat format) {
+    if (pSrc->format != FontFormat::Mono1 || format == FontFormat::Mono1 || scale == 0) {
+        return 0;
+    }
+    Font dst = {.table  = nullptr,
+                .width  = static_cast<uint16_t>((pSrc->width + scale - 1) / scale),
+                .height = static_cast<uint16_t>((pSrc->height + scale - 1) / scale),
+                .format = format};
+    return getNbrOfGlyphs(pSrc) * getBytesPerGlyph(&dst);
+}
+
+/**
+ * @brief  Converts a 1-bpp font into an A4 or A8 coverage font. Each destination
+ *         pixel is the box-filtered coverage of scale x scale source pixels, which
+ *         gives anti-aliased edges for any scale above 1.
+ * @note   The table is read by the DMA2D: place it in SDRAM (write-through) or
+ *         clean the D-cache after the conversion.
+ * @param  pSrc    1-bpp source font
+ * @param  scale   Downsampling factor (1 keeps the size, 2 halves it, ...)
+ * @param  format  FontFormat::A4 or FontFormat::A8
+ * @param  pTable  Destination table of getAlphaFontSize() bytes
+ * @param  pDst    Font describing the converted table
+ * @retval false if the arguments are not supported
+ */
+bool convertToAlphaFont(
+    const Font* pSrc, uint32_t scale, FontFormat format, uint8_t* pTable, Font* pDst) {
+    if (getAlphaFontSize(pSrc, scale, format) == 0) {
+        return false;
+    }
+
+    pDst->table  = pTable;
+    pDst->width  = static_cast<uint16_t>((pSrc->width + scale - 1) / scale);
+    pDst->height = static_cast<uint16_t>((pSrc->height + scale - 1) / scale);
+    pDst->format = format;
+    // the extra glyphs keep their code points
+    pDst->codePoints       = pSrc->codePoints;
+    pDst->nbrOfExtraGlyphs = pSrc->nbrOfExtraGlyphs;
+
+    uint32_t bytesPerRow = getBytesPerRow(pDst);
+    for (uint32_t glyph = 0; glyph < getNbrOfGlyphs(pSrc); glyph++) {
+        const uint8_t* pGlyph = &pSrc->table[glyph * getBytesPerGlyph(pSrc)];
+        uint8_t* pOut         = &pTable[glyph * getBytesPerGlyph(pDst)];
+        for (uint32_t y = 0; y < pDst->height; y++) {
+            uint8_t* pRow = pOut + y * bytesPerRow;
+            for (uint32_t i = 0; i < bytesPerRow; i++) {
+                pRow[i] = 0;
+            }
+            for (uint32_t x = 0; x < pDst->width; x++) {
+                uint32_t coverage = computeCoverage(pSrc, pGlyph, x, y, scale);
+                if (format == FontFormat::A8) {
+                    pRow[x] = static_cast<uint8_t>(coverage);
+                } else {
+                    // first pixel of each pair in the low nibble, as read by the DMA2D
+                    pRow[x / 2] |= static_cast<uint8_t>((coverage >> 4) << (4 * (x % 2)));
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+}  // namespace disco
@@ -0,0 +1,37 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file font_converter.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Conversion of 1-bpp fonts into anti-aliased A4/A8 fonts
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+#include "fonts.hpp"
+
+namespace disco {
+
+uint32_t getAlphaFontSize(const Font* pSrc, uint32_t scale, FontFormat format);
+bool convertToAlphaFont(
+    const Font* pSrc, uint32_t scale, FontFormat format, uint8_t* pTable, Font* pDst);
+
+}  // namespace disco
@@ -0,0 +1,217 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file font_metrics.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Glyph lookup, metrics, kerning and string measurement
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#include "font_metrics.hpp"
+
+#include "glyph_row_reader.hpp"
+
+namespace disco {
+
+/**
+ * @brief  Maps a code point onto a glyph of the font. Printable ASCII is found
+ *         directly, other code points by a binary search in the sorted codePoints
+ *         table of the extra glyphs.
+ * @param  pFont      Font used for the text
+ * @param  codePoint  Unicode code point
+ * @retval Glyph index, kReplacementGlyph if the font has no such glyph
+ */
+uint32_t getGlyphIndex(const Font* pFont, uint32_t codePoint) {
+    if (codePoint >= ' ' && codePoint <= '~') {
+        return codePoint - ' ';
+    }
+
+    uint32_t low  = 0;
+    uint32_t high = pFont->nbrOfExtraGlyphs;
+    while (low < high) {
+        uint32_t middle = (low + high) / 2;
+        if (pFont->codePoints[middle] == codePoint) {
+            return kFontNbrOfGlyphs + middle;
+        }
+        if (pFont->codePoints[middle] < codePoint) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return kReplacementGlyph;
+}
+
+/**
+ * @brief  Gets the placement of a glyph. Monospaced fonts report their full cell.
+ * @param  pFont       Font the glyph belongs to
+ * @param  glyphIndex  Index of the glyph in the font
+ * @retval Glyph metrics
+ */
+GlyphMetrics getGlyphMetrics(const Font* pFont, uint32_t glyphIndex) {
+    if (pFont->metrics != nullptr) {
+        return pFont->metrics[glyphIndex];
+    }
+    return {.advance   = static_cast<uint8_t>(pFont->width),
+            .bearingX  = 0,
+            .boxX      = 0,
+            .boxY      = 0,
+            .boxWidth  = static_cast<uint8_t>(pFont->width),
+            .boxHeight = static_cast<uint8_t>(pFont->height)};
+}
+
+/**
+ * @brief  Looks up the kerning between two glyphs (binary search).
+ * @param  pFont  Font used for the text
+ * @param  left   Index of the left glyph
+ * @param  right  Index of the right glyph
+ * @retval Pen adjustment in pixels, 0 if the pair is not in the table
+ */
+int32_t getKerning(const Font* pFont, uint32_t left, uint32_t right) {
+    uint32_t low  = 0;
+    uint32_t high = pFont->nbrOfKerningPairs;
+    while (low < high) {
+        uint32_t middle         = (low + high) / 2;
+        const KerningPair& pair = pFont->kerning[middle];
+        if (pair.left == left && pair.right == right) {
+            return pair.offset;
+        }
+        if (pair.left < left || (pair.left == left && pair.right < right)) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief  Gets the pen displacement after the glyph at index, including the
+ *         kerning with the following glyph of the run.
+ * @param  pFont        Font used for the text
+ * @param  glyphs       Glyph indices of the run
+ * @param  nbrOfGlyphs  Number of glyphs in the run
+ * @param  index        Position of the glyph in the run
+ * @retval Pen displacement in pixels
+ */
+int32_t getPenAdvance(const Font* pFont,
+                      const uint16_t* glyphs,
+                      uint32_t nbrOfGlyphs,
+                      uint32_t index) {
+    int32_t advance = getGlyphMetrics(pFont, glyphs[index]).advance;
+    if (pFont->kerning != nullptr && index + 1 < nbrOfGlyphs) {
+        advance += getKerning(pFont, glyphs[index], glyphs[index + 1]);
+    }
+    return advance;
+}
+
+/**
+ * @brief  Measures the width of a run of glyphs.
+ * @param  pFont        Font used for the text
+ * @param  glyphs       Glyph indices of the run
+ * @param  nbrOfGlyphs  Number of glyphs to measure
+ * @retval Width in pixels
+ */
+uint32_t measureGlyphs(const Font* pFont, const uint16_t* glyphs, uint32_t nbrOfGlyphs) {
+    if (pFont->metrics == nullptr && pFont->kerning == nullptr) {
+        return nbrOfGlyphs * pFont->width;
+    }
+    int32_t width = 0;
+    for (uint32_t i = 0; i < nbrOfGlyphs; i++) {
+        width += getPenAdvance(pFont, glyphs, nbrOfGlyphs, i);
+    }
+    return (width > 0) ? static_cast<uint32_t>(width) : 0;
+}
+
+/**
+ * @brief  Counts the leading glyphs of a run that fit in maxWidth pixels.
+ * @param  pFont        Font used for the text
+ * @param  glyphs       Glyph indices of the run
+ * @param  nbrOfGlyphs  Number of glyphs in the run
+ * @param  maxWidth     Available width in pixels
+ * @retval Number of glyphs
+ */
+uint32_t countFittingGlyphs(const Font* pFont,
+                            const uint16_t* glyphs,
+                            uint32_t nbrOfGlyphs,
+                            uint32_t maxWidth) {
+    int32_t width = 0;
+    for (uint32_t i = 0; i < nbrOfGlyphs; i++) {
+        width += getPenAdvance(pFont, glyphs, nbrOfGlyphs, i);
+        if (width > static_cast<int32_t>(maxWidth)) {
+            return i;
+        }
+    }
+    return nbrOfGlyphs;
+}
+
+/**
+ * @brief  Derives proportional metrics from the bitmaps of a monospaced 1-bpp font:
+ *         the inked box of each glyph is the bounding box of its set pixels and
+ *         the advance is the box width plus spacing.
+ * @param  pFont     Mono1 or Rle1 font
+ * @param  spacing   Blank columns between two inked boxes
+ * @param  pMetrics  Destination array of getNbrOfGlyphs(pFont) entries
+ * @retval false if the font is not a 1-bpp font
+ */
+bool computeGlyphMetrics(const Font* pFont, uint32_t spacing, GlyphMetrics* pMetrics) {
+    if (isCoverageFont(pFont)) {
+        return false;
+    }
+
+    for (uint32_t glyph = 0; glyph < getNbrOfGlyphs(pFont); glyph++) {
+        uint32_t xMin = pFont->width;
+        uint32_t xMax = 0;
+        uint32_t yMin = pFont->height;
+        uint32_t yMax = 0;
+        GlyphRowReader reader(pFont, glyph);
+        for (uint32_t i = 0; i < pFont->height; i++) {
+            const uint8_t* pchar = reader.nextRow();
+            for (uint32_t j = 0; j < pFont->width; j++) {
+                if (pchar[j / 8] & (0x80U >> (j % 8))) {
+                    xMin = (j < xMin) ? j : xMin;
+                    xMax = (j > xMax) ? j : xMax;
+                    yMin = (i < yMin) ? i : yMin;
+                    yMax = (i > yMax) ? i : yMax;
+                }
+            }
+        }
+
+        GlyphMetrics& metrics = pMetrics[glyph];
+        if (xMin > xMax) {
+            // blank glyph (space): no inked box, a third of the cell as advance
+            metrics = {.advance   = static_cast<uint8_t>(pFont->width / 3),
+                       .bearingX  = 0,
+                       .boxX      = 0,
+                       .boxY      = 0,
+                       .boxWidth  = 0,
+                       .boxHeight = 0};
+            continue;
+        }
+        metrics = {.advance   = static_cast<uint8_t>(xMax - xMin + 1 + spacing),
+                   .bearingX  = static_cast<int8_t>(spacing / 2),
+                   .boxX      = static_cast<uint8_t>(xMin),
+                   .boxY      = static_cast<uint8_t>(yMin),
+                   .boxWidth  = static_cast<uint8_t>(xMax - xMin + 1),
+                   .boxHeight = static_cast<uint8_t>(yMax - yMin + 1)};
+    }
+
+    return true;
+}
+
+}  // namespace disco
@@ -0,0 +1,50 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file font_metrics.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Glyph lookup, metrics, kerning and string measurement
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+#include "fonts.hpp"
+
+namespace disco {
+
+// glyph drawn for code points that the font does not cover
+constexpr uint32_t kReplacementGlyph = '?' - ' ';
+
+uint32_t getGlyphIndex(const Font* pFont, uint32_t codePoint);
+GlyphMetrics getGlyphMetrics(const Font* pFont, uint32_t glyphIndex);
+int32_t getKerning(const Font* pFont, uint32_t left, uint32_t right);
+int32_t getPenAdvance(const Font* pFont,
+                      const uint16_t* glyphs,
+                      uint32_t nbrOfGlyphs,
+                      uint32_t index);
+uint32_t measureGlyphs(const Font* pFont, const uint16_t* glyphs, uint32_t nbrOfGlyphs);
+uint32_t countFittingGlyphs(const Font* pFont,
+                            const uint16_t* glyphs,
+                            uint32_t nbrOfGlyphs,
+                            uint32_t maxWidth);
+bool computeGlyphMetrics(const Font* pFont, uint32_t spacing, GlyphMetrics* pMetrics);
+
+}  // namespace disco
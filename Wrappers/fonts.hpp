@@ -29,6 +29,40 @@
 
 namespace disco {
 
+// encoding of the glyph table
+enum class FontFormat : uint8_t {
+    Mono1, /*!< 1 bit per pixel, rows padded to a byte, MSB first */
+    Rle1,  /*!< 1 bit per pixel, run-length compressed (see tools/font_rle.py) */
+    A4,    /*!< 4-bit coverage, rows padded to a byte, first pixel in low nibble */
+    A8     /*!< 8-bit coverage */
+};
+
+// placement of a glyph of a proportional font
+struct GlyphMetrics {
+    // cppcheck-suppress unusedStructMember
+    uint8_t advance; /*!< Pen displacement to the next glyph */
+    // cppcheck-suppress unusedStructMember
+    int8_t bearingX; /*!< Offset from the pen position to the left of the inked box */
+    // cppcheck-suppress unusedStructMember
+    uint8_t boxX; /*!< Left of the inked box in the glyph bitmap */
+    // cppcheck-suppress unusedStructMember
+    uint8_t boxY; /*!< Top of the inked box in the glyph bitmap */
+    // cppcheck-suppress unusedStructMember
+    uint8_t boxWidth; /*!< Width of the inked box */
+    // cppcheck-suppress unusedStructMember
+    uint8_t boxHeight; /*!< Height of the inked box */
+};
+
+// pen adjustment between two glyph indices, tables are sorted by (left, right)
+struct KerningPair {
+    // cppcheck-suppress unusedStructMember
+    uint16_t left;
+    // cppcheck-suppress unusedStructMember
+    uint16_t right;
+    // cppcheck-suppress unusedStructMember
+    int8_t offset;
+};
+
 struct Font {
     // cppcheck-suppress unusedStructMember
     const uint8_t* table;
@@ -36,12 +70,104 @@ struct Font {
     uint16_t width;
     // cppcheck-suppress unusedStructMember
     uint16_t height;
+    // cppcheck-suppress unusedStructMember
+    FontFormat format = FontFormat::Mono1;
+    // cppcheck-suppress unusedStructMember
+    const uint16_t* codePoints = nullptr; /*!< Sorted code points of the extra glyphs */
+    // cppcheck-suppress unusedStructMember
+    uint16_t nbrOfExtraGlyphs = 0; /*!< Glyphs stored after '~' */
+    // cppcheck-suppress unusedStructMember
+    const uint16_t* glyphOffsets = nullptr; /*!< Rle1 only: start of each glyph */
+    // cppcheck-suppress unusedStructMember
+    const GlyphMetrics* metrics = nullptr; /*!< Proportional fonts only */
+    // cppcheck-suppress unusedStructMember
+    const KerningPair* kerning = nullptr; /*!< Optional kerning table */
+    // cppcheck-suppress unusedStructMember
+    uint16_t nbrOfKerningPairs = 0;
 };
 
-extern Font* createFont18();
-extern Font* createFont24();
-extern Font* createFont26b();
-extern Font* createFont36();
-extern Font* createFont36b();
+// the first glyphs cover the printable ASCII range ' ' (0x20) to '~' (0x7E), the
+// extra glyphs of a font follow and are found through its codePoints table
+constexpr uint32_t kFontNbrOfGlyphs = 95;
+
+inline uint32_t getNbrOfGlyphs(const Font* pFont) {
+    return kFontNbrOfGlyphs + pFont->nbrOfExtraGlyphs;
+}
+
+inline uint32_t getBytesPerRow(const Font* pFont) {
+    switch (pFont->format) {
+        case FontFormat::A8:
+            return pFont->width;
+        case FontFormat::A4:
+            return (pFont->width + 1) / 2;
+        case FontFormat::Mono1:
+        case FontFormat::Rle1:
+        default:
+            return (pFont->width + 7) / 8;
+    }
+}
+
+inline uint32_t getBytesPerGlyph(const Font* pFont) {
+    return getBytesPerRow(pFont) * pFont->height;
+}
+
+inline bool isCoverageFont(const Font* pFont) {
+    return pFont->format == FontFormat::A4 || pFont->format == FontFormat::A8;
+}
+
+// Fonts are constant-initialized objects placed in flash: no heap allocation and no
+// guard variable. Each font lives in its own translation unit, so only the fonts an
+// application references are kept by the linker.
+extern const Font kFont18;
+extern const Font kFont24;
+extern const Font kFont26b;
+extern const Font kFont36;
+extern const Font kFont36b;
+
+// run-length compressed variants of the fonts above
+extern const Font kFont18Rle;
+extern const Font kFont24Rle;
+extern const Font kFont26bRle;
+extern const Font kFont36Rle;
+extern const Font kFont36bRle;
+
+enum class FontWeight : uint8_t { Regular, Bold };
+
+// Compile-time font lookup by size, weight and encoding. Only the registered
+// combinations are defined, any other one fails to compile.
+template <uint32_t size,
+          FontWeight weight = FontWeight::Regular,
+          FontFormat format = FontFormat::Mono1>
+struct FontRegistry;
+
+#define DISCO_REGISTER_FONT(size, weight, format, font)                 \
+    template <>                                                         \
+    struct FontRegistry<size, FontWeight::weight, FontFormat::format> { \
+        static constexpr const Font* get() { return &font; }            \
+    }
+
+DISCO_REGISTER_FONT(18, Regular, Mono1, kFont18);
+DISCO_REGISTER_FONT(24, Regular, Mono1, kFont24);
+DISCO_REGISTER_FONT(26, Bold, Mono1, kFont26b);
+DISCO_REGISTER_FONT(36, Regular, Mono1, kFont36);
+DISCO_REGISTER_FONT(36, Bold, Mono1, kFont36b);
+DISCO_REGISTER_FONT(18, Regular, Rle1, kFont18Rle);
+DISCO_REGISTER_FONT(24, Regular, Rle1, kFont24Rle);
+DISCO_REGISTER_FONT(26, Bold, Rle1, kFont26bRle);
+DISCO_REGISTER_FONT(36, Regular, Rle1, kFont36Rle);
+DISCO_REGISTER_FONT(36, Bold, Rle1, kFont36bRle);
+
+#undef DISCO_REGISTER_FONT
+
+/**
+ * @brief  Selects a registered font at compile time, e.g. selectFont<36, Bold>().
+ * @retval Pointer to the font in flash
+ */
+template <uint32_t size,
+          FontWeight weight = FontWeight::Regular,
+          FontFormat format = FontFormat::Mono1>
+constexpr const Font* selectFont() {
+    return FontRegistry<size, weight, format>::get();
+}
 
 }  // namespace disco
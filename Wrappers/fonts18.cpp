@@ -2402,12 +2402,438 @@ const uint8_t Font18_Table[] = {
   0x00, 0x00, 0x00,  //
   0x00, 0x00, 0x00,  //
   0x00, 0x00, 0x00,  //
+  // @6555 '°' (22 pixels wide)
+  0x00, 0x00, 0x00,  //
+  0x00, 0x70, 0x00,  //          ###
+  0x00, 0x98, 0x00,  //         #  ##
+  0x00, 0x88, 0x00,  //         #   #
+  0x00, 0x88, 0x00,  //         #   #
+  0x00, 0xC8, 0x00,  //         ##  #
+  0x00, 0x70, 0x00,  //          ###
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  // @6624 'µ' (22 pixels wide)
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x07, 0x9E, 0x00,  //      ####  ####
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x8F, 0x80,  //        ##   #####
+  0x00, 0xF6, 0x00,  //         #### ##
+  0x01, 0x80, 0x00,  //        ##
+  0x01, 0x80, 0x00,  //        ##
+  0x01, 0x80, 0x00,  //        ##
+  0x01, 0x80, 0x00,  //        ##
+  0x01, 0x80, 0x00,  //        ##
+  0x00, 0x00, 0x00,  //
+  // @6693 'à' (22 pixels wide)
+  0x00, 0x00, 0x00,  //
+  0x00, 0x18, 0x00,  //            ##
+  0x00, 0x08, 0x00,  //             #
+  0x00, 0x04, 0x00,  //              #
+  0x00, 0x04, 0x00,  //              #
+  0x00, 0x00, 0x00,  //
+  0x00, 0x7C, 0x00,  //          #####
+  0x01, 0x8E, 0x00,  //        ##   ###
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x00, 0x0E, 0x00,  //             ###
+  0x00, 0x76, 0x00,  //          ### ##
+  0x00, 0xC6, 0x00,  //         ##   ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0xCE, 0x80,  //        ###  ### #
+  0x00, 0xF7, 0x00,  //         #### ###
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  // @6762 'â' (22 pixels wide)
+  0x00, 0x00, 0x00,  //
+  0x00, 0x18, 0x00,  //            ##
+  0x00, 0x24, 0x00,  //           #  #
+  0x00, 0x42, 0x00,  //          #    #
+  0x00, 0x81, 0x00,  //         #      #
+  0x00, 0x00, 0x00,  //
+  0x00, 0x7C, 0x00,  //          #####
+  0x01, 0x8E, 0x00,  //        ##   ###
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x00, 0x0E, 0x00,  //             ###
+  0x00, 0x76, 0x00,  //          ### ##
+  0x00, 0xC6, 0x00,  //         ##   ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0xCE, 0x80,  //        ###  ### #
+  0x00, 0xF7, 0x00,  //         #### ###
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  // @6831 'ä' (22 pixels wide)
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x66, 0x00,  //          ##  ##
+  0x00, 0x66, 0x00,  //          ##  ##
+  0x00, 0x00, 0x00,  //
+  0x00, 0x7C, 0x00,  //          #####
+  0x01, 0x8E, 0x00,  //        ##   ###
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x00, 0x0E, 0x00,  //             ###
+  0x00, 0x76, 0x00,  //          ### ##
+  0x00, 0xC6, 0x00,  //         ##   ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0xCE, 0x80,  //        ###  ### #
+  0x00, 0xF7, 0x00,  //         #### ###
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  // @6900 'ç' (22 pixels wide)
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x3C, 0x00,  //           ####
+  0x00, 0x46, 0x00,  //          #   ##
+  0x00, 0x83, 0x00,  //         #     ##
+  0x01, 0x83, 0x00,  //        ##     ##
+  0x01, 0x80, 0x00,  //        ##
+  0x01, 0x80, 0x00,  //        ##
+  0x01, 0x80, 0x00,  //        ##
+  0x01, 0xC1, 0x00,  //        ###     #
+  0x00, 0xE2, 0x00,  //         ###   #
+  0x00, 0xFE, 0x00,  //         #######
+  0x00, 0x3C, 0x00,  //           ####
+  0x00, 0x70, 0x00,  //          ###
+  0x00, 0x78, 0x00,  //          ####
+  0x00, 0x08, 0x00,  //             #
+  0x00, 0x08, 0x00,  //             #
+  0x00, 0x10, 0x00,  //            #
+  0x00, 0x60, 0x00,  //          ##
+  // @6969 'è' (22 pixels wide)
+  0x00, 0x00, 0x00,  //
+  0x00, 0x30, 0x00,  //           ##
+  0x00, 0x10, 0x00,  //            #
+  0x00, 0x08, 0x00,  //             #
+  0x00, 0x08, 0x00,  //             #
+  0x00, 0x00, 0x00,  //
+  0x00, 0x3C, 0x00,  //           ####
+  0x00, 0xC6, 0x00,  //         ##   ##
+  0x00, 0x83, 0x00,  //         #     ##
+  0x01, 0x83, 0x00,  //        ##     ##
+  0x01, 0xFF, 0x00,  //        #########
+  0x01, 0x80, 0x00,  //        ##
+  0x01, 0x80, 0x00,  //        ##
+  0x01, 0xC1, 0x00,  //        ###     #
+  0x00, 0xE2, 0x00,  //         ###   #
+  0x00, 0xFE, 0x00,  //         #######
+  0x00, 0x38, 0x00,  //           ###
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  // @7038 'é' (22 pixels wide)
+  0x00, 0x00, 0x00,  //
+  0x00, 0x18, 0x00,  //            ##
+  0x00, 0x10, 0x00,  //            #
+  0x00, 0x20, 0x00,  //           #
+  0x00, 0x20, 0x00,  //           #
+  0x00, 0x00, 0x00,  //
+  0x00, 0x3C, 0x00,  //           ####
+  0x00, 0xC6, 0x00,  //         ##   ##
+  0x00, 0x83, 0x00,  //         #     ##
+  0x01, 0x83, 0x00,  //        ##     ##
+  0x01, 0xFF, 0x00,  //        #########
+  0x01, 0x80, 0x00,  //        ##
+  0x01, 0x80, 0x00,  //        ##
+  0x01, 0xC1, 0x00,  //        ###     #
+  0x00, 0xE2, 0x00,  //         ###   #
+  0x00, 0xFE, 0x00,  //         #######
+  0x00, 0x38, 0x00,  //           ###
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  // @7107 'ê' (22 pixels wide)
+  0x00, 0x00, 0x00,  //
+  0x00, 0x30, 0x00,  //           ##
+  0x00, 0x48, 0x00,  //          #  #
+  0x00, 0x84, 0x00,  //         #    #
+  0x01, 0x02, 0x00,  //        #      #
+  0x00, 0x00, 0x00,  //
+  0x00, 0x3C, 0x00,  //           ####
+  0x00, 0xC6, 0x00,  //         ##   ##
+  0x00, 0x83, 0x00,  //         #     ##
+  0x01, 0x83, 0x00,  //        ##     ##
+  0x01, 0xFF, 0x00,  //        #########
+  0x01, 0x80, 0x00,  //        ##
+  0x01, 0x80, 0x00,  //        ##
+  0x01, 0xC1, 0x00,  //        ###     #
+  0x00, 0xE2, 0x00,  //         ###   #
+  0x00, 0xFE, 0x00,  //         #######
+  0x00, 0x38, 0x00,  //           ###
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  // @7176 'ë' (22 pixels wide)
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0xCC, 0x00,  //         ##  ##
+  0x00, 0xCC, 0x00,  //         ##  ##
+  0x00, 0x00, 0x00,  //
+  0x00, 0x3C, 0x00,  //           ####
+  0x00, 0xC6, 0x00,  //         ##   ##
+  0x00, 0x83, 0x00,  //         #     ##
+  0x01, 0x83, 0x00,  //        ##     ##
+  0x01, 0xFF, 0x00,  //        #########
+  0x01, 0x80, 0x00,  //        ##
+  0x01, 0x80, 0x00,  //        ##
+  0x01, 0xC1, 0x00,  //        ###     #
+  0x00, 0xE2, 0x00,  //         ###   #
+  0x00, 0xFE, 0x00,  //         #######
+  0x00, 0x38, 0x00,  //           ###
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  // @7245 'î' (22 pixels wide)
+  0x00, 0x00, 0x00,  //
+  0x00, 0x18, 0x00,  //            ##
+  0x00, 0x24, 0x00,  //           #  #
+  0x00, 0x42, 0x00,  //          #    #
+  0x00, 0x81, 0x00,  //         #      #
+  0x00, 0x00, 0x00,  //
+  0x00, 0x18, 0x00,  //            ##
+  0x00, 0x78, 0x00,  //          ####
+  0x00, 0x18, 0x00,  //            ##
+  0x00, 0x18, 0x00,  //            ##
+  0x00, 0x18, 0x00,  //            ##
+  0x00, 0x18, 0x00,  //            ##
+  0x00, 0x18, 0x00,  //            ##
+  0x00, 0x18, 0x00,  //            ##
+  0x00, 0x18, 0x00,  //            ##
+  0x00, 0x18, 0x00,  //            ##
+  0x00, 0x7E, 0x00,  //          ######
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  // @7314 'ï' (22 pixels wide)
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x66, 0x00,  //          ##  ##
+  0x00, 0x66, 0x00,  //          ##  ##
+  0x00, 0x00, 0x00,  //
+  0x00, 0x18, 0x00,  //            ##
+  0x00, 0x78, 0x00,  //          ####
+  0x00, 0x18, 0x00,  //            ##
+  0x00, 0x18, 0x00,  //            ##
+  0x00, 0x18, 0x00,  //            ##
+  0x00, 0x18, 0x00,  //            ##
+  0x00, 0x18, 0x00,  //            ##
+  0x00, 0x18, 0x00,  //            ##
+  0x00, 0x18, 0x00,  //            ##
+  0x00, 0x18, 0x00,  //            ##
+  0x00, 0x7E, 0x00,  //          ######
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  // @7383 'ô' (22 pixels wide)
+  0x00, 0x00, 0x00,  //
+  0x00, 0x30, 0x00,  //           ##
+  0x00, 0x48, 0x00,  //          #  #
+  0x00, 0x84, 0x00,  //         #    #
+  0x01, 0x02, 0x00,  //        #      #
+  0x00, 0x00, 0x00,  //
+  0x00, 0x78, 0x00,  //          ####
+  0x00, 0x8E, 0x00,  //         #   ###
+  0x01, 0x06, 0x00,  //        #     ##
+  0x03, 0x03, 0x00,  //       ##      ##
+  0x03, 0x03, 0x00,  //       ##      ##
+  0x03, 0x03, 0x00,  //       ##      ##
+  0x03, 0x03, 0x00,  //       ##      ##
+  0x03, 0x03, 0x00,  //       ##      ##
+  0x01, 0x82, 0x00,  //        ##     #
+  0x01, 0xC4, 0x00,  //        ###   #
+  0x00, 0x78, 0x00,  //          ####
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  // @7452 'ö' (22 pixels wide)
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0xCC, 0x00,  //         ##  ##
+  0x00, 0xCC, 0x00,  //         ##  ##
+  0x00, 0x00, 0x00,  //
+  0x00, 0x78, 0x00,  //          ####
+  0x00, 0x8E, 0x00,  //         #   ###
+  0x01, 0x06, 0x00,  //        #     ##
+  0x03, 0x03, 0x00,  //       ##      ##
+  0x03, 0x03, 0x00,  //       ##      ##
+  0x03, 0x03, 0x00,  //       ##      ##
+  0x03, 0x03, 0x00,  //       ##      ##
+  0x03, 0x03, 0x00,  //       ##      ##
+  0x01, 0x82, 0x00,  //        ##     #
+  0x01, 0xC4, 0x00,  //        ###   #
+  0x00, 0x78, 0x00,  //          ####
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  // @7521 'ù' (22 pixels wide)
+  0x00, 0x00, 0x00,  //
+  0x00, 0x30, 0x00,  //           ##
+  0x00, 0x10, 0x00,  //            #
+  0x00, 0x08, 0x00,  //             #
+  0x00, 0x08, 0x00,  //             #
+  0x00, 0x00, 0x00,  //
+  0x07, 0x9E, 0x00,  //      ####  ####
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x8F, 0x80,  //        ##   #####
+  0x00, 0xF6, 0x00,  //         #### ##
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  // @7590 'û' (22 pixels wide)
+  0x00, 0x00, 0x00,  //
+  0x00, 0x30, 0x00,  //           ##
+  0x00, 0x48, 0x00,  //          #  #
+  0x00, 0x84, 0x00,  //         #    #
+  0x01, 0x02, 0x00,  //        #      #
+  0x00, 0x00, 0x00,  //
+  0x07, 0x9E, 0x00,  //      ####  ####
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x8F, 0x80,  //        ##   #####
+  0x00, 0xF6, 0x00,  //         #### ##
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  // @7659 'ü' (22 pixels wide)
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0xCC, 0x00,  //         ##  ##
+  0x00, 0xCC, 0x00,  //         ##  ##
+  0x00, 0x00, 0x00,  //
+  0x07, 0x9E, 0x00,  //      ####  ####
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x86, 0x00,  //        ##    ##
+  0x01, 0x8F, 0x80,  //        ##   #####
+  0x00, 0xF6, 0x00,  //         #### ##
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00,  //
+};
+
+const uint16_t Font18_CodePoints[] = {
+  0x00B0,  // '°'
+  0x00B5,  // 'µ'
+  0x00E0,  // 'à'
+  0x00E2,  // 'â'
+  0x00E4,  // 'ä'
+  0x00E7,  // 'ç'
+  0x00E8,  // 'è'
+  0x00E9,  // 'é'
+  0x00EA,  // 'ê'
+  0x00EB,  // 'ë'
+  0x00EE,  // 'î'
+  0x00EF,  // 'ï'
+  0x00F4,  // 'ô'
+  0x00F6,  // 'ö'
+  0x00F9,  // 'ù'
+  0x00FB,  // 'û'
+  0x00FC,  // 'ü'
 };
 // clang-format on
 
-Font* createFont18() {
-    static Font* pFont18 = new Font{Font18_Table, 22, 23};
-    return pFont18;
-}
+constexpr Font kFont18 = {
+    Font18_Table, 22, 23, FontFormat::Mono1, Font18_CodePoints, 17};
 
 }  // namespace disco
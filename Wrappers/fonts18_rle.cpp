@@ -0,0 +1,496 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file fonts18_rle.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Run-length compressed font (size 18), generated from fonts18.cpp
+ *        by tools/font_rle.py
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "fonts.hpp"
+
+namespace disco {
+// clang-format off
+const uint8_t Font18Rle_Table[] = {
+  0x20, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x01, 0x15, 0x01, 0x15, 0x01, 0x15, 0x01, 0x15, 0x01,
+  0x41, 0x02, 0x14, 0x02, 0x1E, 0x02, 0x02, 0x02, 0x10, 0x02, 0x02, 0x02,
+  0x10, 0x02, 0x02, 0x02, 0x10, 0x02, 0x02, 0x02, 0x10, 0x01, 0x03, 0x01,
+  0x11, 0x01, 0x03, 0x01, 0x11, 0x01, 0x03, 0x01, 0x09, 0x01, 0x04, 0x01,
+  0x10, 0x01, 0x04, 0x01, 0x10, 0x01, 0x04, 0x01, 0x0F, 0x01, 0x04, 0x01,
+  0x10, 0x01, 0x04, 0x01, 0x10, 0x01, 0x04, 0x01, 0x0D, 0x0B, 0x0E, 0x01,
+  0x04, 0x01, 0x10, 0x01, 0x04, 0x01, 0x0F, 0x01, 0x04, 0x01, 0x10, 0x01,
+  0x04, 0x01, 0x0E, 0x0B, 0x0D, 0x01, 0x04, 0x01, 0x10, 0x01, 0x04, 0x01,
+  0x0F, 0x01, 0x04, 0x01, 0x10, 0x01, 0x04, 0x01, 0x10, 0x01, 0x04, 0x01,
+  0x0A, 0x01, 0x13, 0x05, 0x10, 0x02, 0x01, 0x01, 0x02, 0x02, 0x0D, 0x02,
+  0x02, 0x01, 0x03, 0x01, 0x0D, 0x02, 0x02, 0x01, 0x03, 0x01, 0x0D, 0x02,
+  0x02, 0x01, 0x03, 0x01, 0x0D, 0x03, 0x01, 0x01, 0x12, 0x04, 0x13, 0x04,
+  0x14, 0x03, 0x13, 0x01, 0x01, 0x03, 0x11, 0x01, 0x02, 0x03, 0x10, 0x01,
+  0x03, 0x02, 0x0C, 0x01, 0x03, 0x01, 0x03, 0x02, 0x0C, 0x01, 0x03, 0x01,
+  0x03, 0x02, 0x0C, 0x02, 0x02, 0x01, 0x02, 0x02, 0x0E, 0x06, 0x13, 0x01,
+  0x1B, 0x03, 0x09, 0x01, 0x08, 0x02, 0x01, 0x02, 0x07, 0x01, 0x08, 0x02,
+  0x03, 0x02, 0x05, 0x01, 0x09, 0x02, 0x03, 0x02, 0x05, 0x01, 0x09, 0x02,
+  0x03, 0x02, 0x04, 0x01, 0x0A, 0x02, 0x03, 0x02, 0x03, 0x01, 0x0B, 0x02,
+  0x03, 0x02, 0x03, 0x01, 0x0C, 0x02, 0x01, 0x02, 0x03, 0x01, 0x03, 0x03,
+  0x08, 0x03, 0x03, 0x01, 0x03, 0x02, 0x01, 0x02, 0x0C, 0x01, 0x03, 0x02,
+  0x03, 0x02, 0x0B, 0x01, 0x03, 0x02, 0x03, 0x02, 0x0A, 0x01, 0x04, 0x02,
+  0x03, 0x02, 0x09, 0x01, 0x05, 0x02, 0x03, 0x02, 0x09, 0x01, 0x05, 0x02,
+  0x03, 0x02, 0x08, 0x01, 0x07, 0x02, 0x01, 0x02, 0x08, 0x01, 0x09, 0x03,
+  0x1F, 0x04, 0x11, 0x02, 0x02, 0x02, 0x0F, 0x02, 0x04, 0x01, 0x0F, 0x02,
+  0x04, 0x01, 0x0F, 0x02, 0x03, 0x01, 0x10, 0x02, 0x02, 0x01, 0x12, 0x03,
+  0x03, 0x05, 0x0A, 0x03, 0x05, 0x02, 0x0B, 0x01, 0x02, 0x02, 0x04, 0x01,
+  0x0B, 0x01, 0x03, 0x03, 0x03, 0x01, 0x0A, 0x01, 0x05, 0x03, 0x01, 0x01,
+  0x0A, 0x02, 0x06, 0x03, 0x0B, 0x02, 0x07, 0x02, 0x05, 0x01, 0x05, 0x02,
+  0x06, 0x04, 0x03, 0x02, 0x06, 0x02, 0x04, 0x01, 0x02, 0x06, 0x08, 0x05,
+  0x05, 0x03, 0x20, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x01,
+  0x15, 0x01, 0x15, 0x01, 0x0E, 0x01, 0x13, 0x02, 0x13, 0x02, 0x14, 0x01,
+  0x14, 0x01, 0x14, 0x02, 0x14, 0x02, 0x13, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x15, 0x01, 0x15, 0x02,
+  0x14, 0x02, 0x15, 0x01, 0x16, 0x01, 0x15, 0x02, 0x16, 0x01, 0x16, 0x01,
+  0x07, 0x01, 0x16, 0x02, 0x15, 0x02, 0x15, 0x01, 0x16, 0x01, 0x15, 0x02,
+  0x14, 0x02, 0x15, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x13, 0x02, 0x14, 0x02, 0x14, 0x01,
+  0x14, 0x01, 0x14, 0x02, 0x13, 0x02, 0x13, 0x01, 0x0B, 0x01, 0x15, 0x01,
+  0x11, 0x02, 0x02, 0x01, 0x02, 0x02, 0x0D, 0x03, 0x01, 0x01, 0x01, 0x03,
+  0x0F, 0x05, 0x11, 0x05, 0x0F, 0x03, 0x01, 0x01, 0x01, 0x03, 0x0D, 0x02,
+  0x02, 0x01, 0x02, 0x02, 0x11, 0x01, 0x15, 0x01, 0x37, 0x01, 0x15, 0x01,
+  0x15, 0x01, 0x15, 0x01, 0x15, 0x01, 0x15, 0x01, 0x0F, 0x0D, 0x0F, 0x01,
+  0x15, 0x01, 0x15, 0x01, 0x15, 0x01, 0x15, 0x01, 0x15, 0x01, 0xFF, 0x00,
+  0x54, 0x03, 0x13, 0x04, 0x15, 0x01, 0x15, 0x01, 0x14, 0x01, 0x13, 0x02,
+  0xE4, 0x06, 0x10, 0x06, 0xFF, 0x00, 0x55, 0x02, 0x14, 0x02, 0x0E, 0x01,
+  0x14, 0x01, 0x15, 0x01, 0x15, 0x01, 0x14, 0x01, 0x15, 0x01, 0x15, 0x01,
+  0x14, 0x01, 0x15, 0x01, 0x15, 0x01, 0x14, 0x01, 0x15, 0x01, 0x15, 0x01,
+  0x14, 0x01, 0x15, 0x01, 0x15, 0x01, 0x14, 0x01, 0x1F, 0x04, 0x11, 0x02,
+  0x02, 0x02, 0x0F, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x05, 0x01, 0x0D, 0x02,
+  0x06, 0x02, 0x0C, 0x02, 0x06, 0x02, 0x0C, 0x02, 0x06, 0x02, 0x0C, 0x02,
+  0x06, 0x02, 0x0C, 0x02, 0x06, 0x02, 0x0C, 0x02, 0x06, 0x02, 0x0C, 0x02,
+  0x06, 0x02, 0x0C, 0x02, 0x06, 0x02, 0x0D, 0x02, 0x04, 0x02, 0x0E, 0x02,
+  0x04, 0x02, 0x0F, 0x02, 0x02, 0x02, 0x11, 0x04, 0x20, 0x02, 0x12, 0x04,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x12, 0x06, 0x1E, 0x05, 0x10, 0x07, 0x0F, 0x01, 0x04, 0x03,
+  0x0D, 0x01, 0x06, 0x02, 0x0D, 0x01, 0x06, 0x02, 0x14, 0x02, 0x14, 0x01,
+  0x15, 0x01, 0x14, 0x01, 0x14, 0x02, 0x14, 0x01, 0x14, 0x01, 0x14, 0x01,
+  0x14, 0x01, 0x05, 0x02, 0x0D, 0x08, 0x0D, 0x09, 0x1E, 0x04, 0x11, 0x06,
+  0x0F, 0x01, 0x04, 0x03, 0x14, 0x02, 0x14, 0x02, 0x14, 0x01, 0x13, 0x02,
+  0x13, 0x05, 0x13, 0x03, 0x14, 0x03, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x01, 0x0E, 0x02, 0x04, 0x01, 0x0F, 0x06, 0x22, 0x02, 0x14, 0x02,
+  0x13, 0x03, 0x13, 0x03, 0x12, 0x01, 0x01, 0x02, 0x11, 0x01, 0x02, 0x02,
+  0x11, 0x01, 0x02, 0x02, 0x10, 0x01, 0x03, 0x02, 0x10, 0x01, 0x03, 0x02,
+  0x0F, 0x01, 0x04, 0x02, 0x0E, 0x01, 0x05, 0x02, 0x0E, 0x0A, 0x12, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x1F, 0x06, 0x10, 0x05, 0x10, 0x01,
+  0x15, 0x01, 0x14, 0x04, 0x12, 0x06, 0x13, 0x04, 0x14, 0x02, 0x15, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x15, 0x01, 0x14, 0x01, 0x15, 0x01, 0x0E, 0x02,
+  0x04, 0x01, 0x10, 0x05, 0x23, 0x03, 0x11, 0x02, 0x12, 0x02, 0x13, 0x02,
+  0x14, 0x01, 0x14, 0x02, 0x14, 0x01, 0x01, 0x05, 0x0E, 0x03, 0x03, 0x03,
+  0x0D, 0x02, 0x05, 0x03, 0x0C, 0x02, 0x06, 0x02, 0x0C, 0x02, 0x06, 0x02,
+  0x0C, 0x02, 0x06, 0x02, 0x0D, 0x01, 0x06, 0x02, 0x0D, 0x02, 0x05, 0x01,
+  0x0F, 0x02, 0x03, 0x01, 0x11, 0x04, 0x1D, 0x09, 0x0D, 0x08, 0x0D, 0x02,
+  0x06, 0x01, 0x0D, 0x01, 0x06, 0x01, 0x15, 0x01, 0x15, 0x01, 0x14, 0x01,
+  0x15, 0x01, 0x15, 0x01, 0x14, 0x01, 0x15, 0x01, 0x15, 0x01, 0x14, 0x01,
+  0x15, 0x01, 0x15, 0x01, 0x14, 0x01, 0x1E, 0x06, 0x0F, 0x02, 0x04, 0x02,
+  0x0D, 0x02, 0x06, 0x02, 0x0C, 0x02, 0x06, 0x02, 0x0C, 0x03, 0x05, 0x02,
+  0x0D, 0x03, 0x03, 0x02, 0x0F, 0x03, 0x01, 0x01, 0x12, 0x04, 0x12, 0x05,
+  0x0F, 0x02, 0x03, 0x03, 0x0E, 0x01, 0x05, 0x03, 0x0C, 0x02, 0x06, 0x02,
+  0x0C, 0x02, 0x06, 0x02, 0x0C, 0x02, 0x06, 0x02, 0x0D, 0x02, 0x04, 0x02,
+  0x0F, 0x06, 0x1F, 0x04, 0x11, 0x01, 0x03, 0x02, 0x0F, 0x01, 0x05, 0x02,
+  0x0D, 0x02, 0x06, 0x01, 0x0D, 0x02, 0x06, 0x02, 0x0C, 0x02, 0x06, 0x02,
+  0x0C, 0x02, 0x06, 0x02, 0x0C, 0x03, 0x05, 0x02, 0x0D, 0x03, 0x03, 0x03,
+  0x0E, 0x05, 0x01, 0x01, 0x14, 0x02, 0x14, 0x01, 0x14, 0x02, 0x13, 0x02,
+  0x12, 0x02, 0x11, 0x03, 0x8F, 0x02, 0x14, 0x02, 0xAE, 0x02, 0x14, 0x02,
+  0x8D, 0x02, 0x14, 0x02, 0xAE, 0x03, 0x13, 0x04, 0x15, 0x01, 0x15, 0x01,
+  0x14, 0x01, 0x13, 0x02, 0x69, 0x01, 0x12, 0x03, 0x10, 0x03, 0x11, 0x02,
+  0x11, 0x03, 0x12, 0x01, 0x16, 0x03, 0x16, 0x02, 0x16, 0x03, 0x16, 0x03,
+  0x16, 0x01, 0x89, 0x0E, 0x4A, 0x0E, 0x5E, 0x01, 0x16, 0x03, 0x16, 0x03,
+  0x16, 0x02, 0x16, 0x03, 0x16, 0x01, 0x12, 0x03, 0x11, 0x02, 0x11, 0x03,
+  0x10, 0x03, 0x12, 0x01, 0x20, 0x04, 0x11, 0x01, 0x03, 0x02, 0x0F, 0x01,
+  0x05, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x14, 0x02,
+  0x13, 0x02, 0x14, 0x01, 0x15, 0x01, 0x14, 0x01, 0x14, 0x01, 0x15, 0x01,
+  0x15, 0x01, 0x2B, 0x02, 0x14, 0x02, 0x0A, 0x06, 0x0E, 0x02, 0x06, 0x02,
+  0x0A, 0x02, 0x09, 0x02, 0x08, 0x02, 0x0B, 0x02, 0x06, 0x02, 0x0D, 0x01,
+  0x06, 0x01, 0x07, 0x02, 0x02, 0x02, 0x02, 0x01, 0x04, 0x01, 0x06, 0x02,
+  0x02, 0x03, 0x03, 0x01, 0x04, 0x01, 0x05, 0x02, 0x04, 0x02, 0x03, 0x01,
+  0x03, 0x02, 0x05, 0x02, 0x04, 0x02, 0x03, 0x01, 0x03, 0x01, 0x05, 0x02,
+  0x05, 0x02, 0x03, 0x01, 0x03, 0x01, 0x05, 0x02, 0x04, 0x02, 0x04, 0x01,
+  0x03, 0x01, 0x04, 0x03, 0x04, 0x02, 0x04, 0x01, 0x03, 0x01, 0x04, 0x02,
+  0x05, 0x02, 0x03, 0x01, 0x04, 0x01, 0x04, 0x02, 0x04, 0x02, 0x04, 0x01,
+  0x04, 0x01, 0x04, 0x02, 0x03, 0x03, 0x03, 0x01, 0x05, 0x01, 0x04, 0x02,
+  0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x07, 0x01, 0x04, 0x03, 0x02, 0x04,
+  0x04, 0x01, 0x03, 0x01, 0x10, 0x01, 0x05, 0x01, 0x0E, 0x01, 0x06, 0x02,
+  0x0C, 0x01, 0x08, 0x02, 0x0A, 0x01, 0x0B, 0x02, 0x06, 0x02, 0x0E, 0x06,
+  0x21, 0x01, 0x14, 0x02, 0x14, 0x03, 0x12, 0x01, 0x01, 0x02, 0x12, 0x01,
+  0x02, 0x02, 0x10, 0x01, 0x03, 0x02, 0x10, 0x01, 0x03, 0x02, 0x0F, 0x01,
+  0x05, 0x02, 0x0E, 0x01, 0x05, 0x02, 0x0E, 0x01, 0x06, 0x02, 0x0C, 0x0A,
+  0x0C, 0x01, 0x07, 0x02, 0x0B, 0x01, 0x09, 0x02, 0x0A, 0x01, 0x09, 0x02,
+  0x09, 0x02, 0x09, 0x03, 0x07, 0x04, 0x07, 0x06, 0x1A, 0x0A, 0x0E, 0x02,
+  0x05, 0x03, 0x0C, 0x02, 0x06, 0x03, 0x0B, 0x02, 0x07, 0x02, 0x0B, 0x02,
+  0x07, 0x02, 0x0B, 0x02, 0x07, 0x02, 0x0B, 0x02, 0x06, 0x02, 0x0C, 0x09,
+  0x0D, 0x02, 0x05, 0x04, 0x0B, 0x02, 0x07, 0x02, 0x0B, 0x02, 0x08, 0x02,
+  0x0A, 0x02, 0x08, 0x02, 0x0A, 0x02, 0x08, 0x02, 0x0A, 0x02, 0x07, 0x02,
+  0x0B, 0x02, 0x06, 0x03, 0x09, 0x0B, 0x1F, 0x06, 0x02, 0x01, 0x0B, 0x02,
+  0x05, 0x04, 0x0A, 0x02, 0x08, 0x02, 0x09, 0x02, 0x09, 0x02, 0x09, 0x02,
+  0x0A, 0x01, 0x08, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x15, 0x02, 0x14, 0x02, 0x0A, 0x01, 0x0A, 0x02, 0x08, 0x01,
+  0x0C, 0x02, 0x05, 0x02, 0x0F, 0x05, 0x1A, 0x0A, 0x0E, 0x02, 0x05, 0x03,
+  0x0C, 0x02, 0x07, 0x02, 0x0B, 0x02, 0x08, 0x02, 0x0A, 0x02, 0x08, 0x02,
+  0x0A, 0x02, 0x09, 0x02, 0x09, 0x02, 0x09, 0x02, 0x09, 0x02, 0x09, 0x02,
+  0x09, 0x02, 0x09, 0x02, 0x09, 0x02, 0x09, 0x02, 0x09, 0x02, 0x09, 0x02,
+  0x09, 0x02, 0x08, 0x02, 0x0A, 0x02, 0x08, 0x02, 0x0A, 0x02, 0x07, 0x02,
+  0x0B, 0x02, 0x05, 0x03, 0x0A, 0x0A, 0x1B, 0x0C, 0x0C, 0x02, 0x06, 0x02,
+  0x0C, 0x02, 0x07, 0x01, 0x0C, 0x02, 0x07, 0x01, 0x0C, 0x02, 0x14, 0x02,
+  0x05, 0x01, 0x0E, 0x02, 0x05, 0x01, 0x0E, 0x08, 0x0E, 0x02, 0x05, 0x01,
+  0x0E, 0x02, 0x05, 0x01, 0x0E, 0x02, 0x14, 0x02, 0x14, 0x02, 0x08, 0x01,
+  0x0B, 0x02, 0x07, 0x01, 0x0C, 0x02, 0x06, 0x02, 0x0A, 0x0C, 0x1C, 0x0C,
+  0x0C, 0x02, 0x06, 0x02, 0x0C, 0x02, 0x07, 0x01, 0x0C, 0x02, 0x07, 0x01,
+  0x0C, 0x02, 0x14, 0x02, 0x04, 0x01, 0x0F, 0x02, 0x04, 0x01, 0x0F, 0x07,
+  0x0F, 0x02, 0x04, 0x01, 0x0F, 0x02, 0x04, 0x01, 0x0F, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x12, 0x06, 0x1F, 0x06, 0x02, 0x01,
+  0x0B, 0x02, 0x05, 0x04, 0x0A, 0x02, 0x08, 0x02, 0x09, 0x02, 0x09, 0x02,
+  0x09, 0x02, 0x0A, 0x01, 0x08, 0x02, 0x14, 0x02, 0x14, 0x02, 0x08, 0x06,
+  0x06, 0x02, 0x0A, 0x02, 0x08, 0x02, 0x0A, 0x02, 0x08, 0x02, 0x0A, 0x02,
+  0x09, 0x02, 0x09, 0x02, 0x09, 0x02, 0x09, 0x02, 0x0A, 0x02, 0x08, 0x02,
+  0x0B, 0x03, 0x05, 0x03, 0x0D, 0x07, 0x1A, 0x06, 0x03, 0x06, 0x09, 0x02,
+  0x07, 0x02, 0x0B, 0x02, 0x07, 0x02, 0x0B, 0x02, 0x07, 0x02, 0x0B, 0x02,
+  0x07, 0x02, 0x0B, 0x02, 0x07, 0x02, 0x0B, 0x02, 0x07, 0x02, 0x0B, 0x0B,
+  0x0B, 0x02, 0x07, 0x02, 0x0B, 0x02, 0x07, 0x02, 0x0B, 0x02, 0x07, 0x02,
+  0x0B, 0x02, 0x07, 0x02, 0x0B, 0x02, 0x07, 0x02, 0x0B, 0x02, 0x07, 0x02,
+  0x0B, 0x02, 0x07, 0x02, 0x09, 0x06, 0x03, 0x06, 0x1E, 0x06, 0x12, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x12, 0x06, 0x20, 0x06, 0x12, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x10, 0x02, 0x02, 0x02, 0x10, 0x03,
+  0x01, 0x01, 0x12, 0x03, 0x1A, 0x06, 0x03, 0x06, 0x09, 0x02, 0x06, 0x03,
+  0x0B, 0x02, 0x06, 0x01, 0x0D, 0x02, 0x05, 0x01, 0x0E, 0x02, 0x04, 0x01,
+  0x0F, 0x02, 0x03, 0x01, 0x10, 0x02, 0x01, 0x02, 0x11, 0x04, 0x12, 0x05,
+  0x11, 0x02, 0x01, 0x03, 0x10, 0x02, 0x02, 0x03, 0x0F, 0x02, 0x03, 0x03,
+  0x0E, 0x02, 0x04, 0x03, 0x0D, 0x02, 0x05, 0x03, 0x0C, 0x02, 0x06, 0x04,
+  0x08, 0x06, 0x03, 0x07, 0x1B, 0x06, 0x12, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x08, 0x01, 0x0B, 0x02, 0x07, 0x02, 0x0B, 0x02,
+  0x07, 0x02, 0x0B, 0x02, 0x06, 0x02, 0x0A, 0x0C, 0x18, 0x05, 0x0A, 0x04,
+  0x05, 0x03, 0x09, 0x03, 0x07, 0x03, 0x09, 0x03, 0x07, 0x04, 0x08, 0x03,
+  0x07, 0x01, 0x01, 0x02, 0x07, 0x01, 0x01, 0x02, 0x07, 0x01, 0x01, 0x03,
+  0x06, 0x01, 0x01, 0x02, 0x07, 0x01, 0x02, 0x02, 0x05, 0x01, 0x02, 0x02,
+  0x07, 0x01, 0x02, 0x02, 0x05, 0x01, 0x02, 0x02, 0x07, 0x01, 0x03, 0x02,
+  0x04, 0x01, 0x02, 0x02, 0x07, 0x01, 0x03, 0x02, 0x03, 0x01, 0x03, 0x02,
+  0x07, 0x01, 0x03, 0x03, 0x02, 0x01, 0x03, 0x02, 0x07, 0x01, 0x04, 0x02,
+  0x02, 0x01, 0x03, 0x02, 0x07, 0x01, 0x04, 0x04, 0x04, 0x02, 0x07, 0x01,
+  0x05, 0x03, 0x04, 0x02, 0x07, 0x01, 0x05, 0x02, 0x05, 0x02, 0x05, 0x05,
+  0x04, 0x01, 0x03, 0x06, 0x19, 0x05, 0x06, 0x05, 0x08, 0x03, 0x08, 0x01,
+  0x0B, 0x03, 0x07, 0x01, 0x0B, 0x04, 0x06, 0x01, 0x0B, 0x01, 0x01, 0x03,
+  0x05, 0x01, 0x0B, 0x01, 0x02, 0x02, 0x05, 0x01, 0x0B, 0x01, 0x02, 0x03,
+  0x04, 0x01, 0x0B, 0x01, 0x03, 0x03, 0x03, 0x01, 0x0B, 0x01, 0x04, 0x03,
+  0x02, 0x01, 0x0B, 0x01, 0x05, 0x02, 0x02, 0x01, 0x0B, 0x01, 0x05, 0x03,
+  0x01, 0x01, 0x0B, 0x01, 0x06, 0x04, 0x0B, 0x01, 0x07, 0x03, 0x0B, 0x01,
+  0x08, 0x02, 0x0B, 0x01, 0x08, 0x02, 0x09, 0x05, 0x07, 0x01, 0x1F, 0x05,
+  0x0F, 0x02, 0x05, 0x02, 0x0C, 0x02, 0x07, 0x02, 0x0A, 0x02, 0x09, 0x02,
+  0x09, 0x02, 0x09, 0x02, 0x08, 0x02, 0x0B, 0x02, 0x07, 0x02, 0x0B, 0x02,
+  0x07, 0x02, 0x0B, 0x02, 0x07, 0x02, 0x0B, 0x02, 0x07, 0x02, 0x0B, 0x02,
+  0x07, 0x02, 0x0B, 0x02, 0x08, 0x02, 0x0A, 0x01, 0x09, 0x02, 0x09, 0x02,
+  0x0A, 0x02, 0x07, 0x02, 0x0C, 0x02, 0x05, 0x02, 0x0F, 0x05, 0x1C, 0x09,
+  0x0F, 0x02, 0x04, 0x03, 0x0D, 0x02, 0x05, 0x03, 0x0C, 0x02, 0x06, 0x02,
+  0x0C, 0x02, 0x06, 0x02, 0x0C, 0x02, 0x06, 0x02, 0x0C, 0x02, 0x05, 0x03,
+  0x0C, 0x02, 0x04, 0x03, 0x0D, 0x08, 0x0E, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x12, 0x06, 0x1F, 0x05, 0x0F, 0x02,
+  0x05, 0x02, 0x0C, 0x02, 0x07, 0x02, 0x0A, 0x02, 0x09, 0x02, 0x09, 0x02,
+  0x09, 0x02, 0x08, 0x02, 0x0B, 0x02, 0x07, 0x02, 0x0B, 0x02, 0x07, 0x02,
+  0x0B, 0x02, 0x07, 0x02, 0x0B, 0x02, 0x07, 0x02, 0x0B, 0x02, 0x07, 0x02,
+  0x0B, 0x02, 0x08, 0x02, 0x0A, 0x01, 0x09, 0x02, 0x09, 0x02, 0x0A, 0x02,
+  0x07, 0x02, 0x0C, 0x02, 0x05, 0x02, 0x0E, 0x06, 0x11, 0x04, 0x14, 0x03,
+  0x14, 0x03, 0x15, 0x03, 0x15, 0x03, 0x1A, 0x0A, 0x0E, 0x02, 0x04, 0x03,
+  0x0D, 0x02, 0x05, 0x03, 0x0C, 0x02, 0x06, 0x02, 0x0C, 0x02, 0x06, 0x02,
+  0x0C, 0x02, 0x06, 0x02, 0x0C, 0x02, 0x05, 0x02, 0x0D, 0x02, 0x04, 0x03,
+  0x0D, 0x07, 0x0F, 0x02, 0x03, 0x02, 0x0F, 0x02, 0x03, 0x03, 0x0E, 0x02,
+  0x04, 0x02, 0x0E, 0x02, 0x05, 0x02, 0x0D, 0x02, 0x05, 0x02, 0x0D, 0x02,
+  0x06, 0x03, 0x09, 0x06, 0x05, 0x04, 0x1F, 0x04, 0x02, 0x01, 0x0E, 0x02,
+  0x03, 0x03, 0x0D, 0x02, 0x05, 0x02, 0x0D, 0x02, 0x06, 0x01, 0x0D, 0x02,
+  0x06, 0x01, 0x0E, 0x03, 0x13, 0x04, 0x14, 0x04, 0x14, 0x03, 0x14, 0x03,
+  0x14, 0x03, 0x0C, 0x01, 0x07, 0x02, 0x0C, 0x01, 0x07, 0x02, 0x0C, 0x02,
+  0x06, 0x02, 0x0C, 0x03, 0x04, 0x02, 0x0D, 0x01, 0x02, 0x05, 0x1A, 0x0E,
+  0x08, 0x02, 0x04, 0x02, 0x04, 0x02, 0x08, 0x01, 0x05, 0x02, 0x05, 0x01,
+  0x08, 0x01, 0x05, 0x02, 0x05, 0x01, 0x0E, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x12, 0x06, 0x1A, 0x06, 0x05, 0x05, 0x08, 0x02,
+  0x09, 0x01, 0x0A, 0x02, 0x09, 0x01, 0x0A, 0x02, 0x09, 0x01, 0x0A, 0x02,
+  0x09, 0x01, 0x0A, 0x02, 0x09, 0x01, 0x0A, 0x02, 0x09, 0x01, 0x0A, 0x02,
+  0x09, 0x01, 0x0A, 0x02, 0x09, 0x01, 0x0A, 0x02, 0x09, 0x01, 0x0A, 0x02,
+  0x09, 0x01, 0x0A, 0x02, 0x09, 0x01, 0x0A, 0x02, 0x09, 0x01, 0x0B, 0x02,
+  0x07, 0x01, 0x0C, 0x03, 0x05, 0x01, 0x0F, 0x06, 0x1A, 0x06, 0x06, 0x04,
+  0x08, 0x02, 0x09, 0x02, 0x0A, 0x02, 0x08, 0x01, 0x0B, 0x02, 0x08, 0x01,
+  0x0B, 0x02, 0x07, 0x01, 0x0D, 0x02, 0x06, 0x01, 0x0D, 0x02, 0x05, 0x01,
+  0x0E, 0x02, 0x05, 0x01, 0x0F, 0x02, 0x03, 0x01, 0x10, 0x02, 0x03, 0x01,
+  0x11, 0x01, 0x03, 0x01, 0x11, 0x02, 0x01, 0x01, 0x12, 0x02, 0x01, 0x01,
+  0x13, 0x02, 0x14, 0x02, 0x14, 0x02, 0x16, 0x06, 0x02, 0x06, 0x04, 0x04,
+  0x02, 0x03, 0x05, 0x02, 0x07, 0x02, 0x04, 0x02, 0x05, 0x02, 0x07, 0x01,
+  0x05, 0x02, 0x06, 0x02, 0x06, 0x01, 0x05, 0x02, 0x06, 0x02, 0x06, 0x01,
+  0x06, 0x02, 0x05, 0x02, 0x05, 0x01, 0x07, 0x02, 0x05, 0x03, 0x04, 0x01,
+  0x08, 0x01, 0x04, 0x04, 0x04, 0x01, 0x08, 0x02, 0x03, 0x01, 0x01, 0x02,
+  0x03, 0x01, 0x09, 0x02, 0x03, 0x01, 0x02, 0x02, 0x02, 0x01, 0x0A, 0x02,
+  0x01, 0x01, 0x03, 0x02, 0x02, 0x01, 0x0A, 0x02, 0x01, 0x01, 0x03, 0x02,
+  0x01, 0x01, 0x0B, 0x02, 0x01, 0x01, 0x04, 0x03, 0x0C, 0x02, 0x05, 0x03,
+  0x0C, 0x02, 0x06, 0x01, 0x0E, 0x01, 0x06, 0x01, 0x1A, 0x07, 0x03, 0x06,
+  0x08, 0x03, 0x07, 0x02, 0x0B, 0x02, 0x07, 0x01, 0x0D, 0x02, 0x05, 0x01,
+  0x0E, 0x03, 0x03, 0x01, 0x10, 0x02, 0x02, 0x01, 0x12, 0x02, 0x01, 0x01,
+  0x13, 0x02, 0x14, 0x02, 0x13, 0x01, 0x01, 0x02, 0x12, 0x01, 0x02, 0x02,
+  0x10, 0x01, 0x03, 0x02, 0x0F, 0x01, 0x05, 0x02, 0x0D, 0x02, 0x06, 0x02,
+  0x0B, 0x02, 0x07, 0x03, 0x08, 0x05, 0x04, 0x07, 0x1A, 0x06, 0x05, 0x05,
+  0x08, 0x03, 0x07, 0x02, 0x0B, 0x02, 0x07, 0x01, 0x0C, 0x03, 0x05, 0x01,
+  0x0E, 0x02, 0x05, 0x01, 0x0F, 0x02, 0x03, 0x01, 0x10, 0x02, 0x02, 0x01,
+  0x12, 0x02, 0x01, 0x01, 0x13, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x12, 0x06, 0x1B, 0x0C, 0x0A, 0x02,
+  0x07, 0x02, 0x0B, 0x01, 0x07, 0x02, 0x0C, 0x01, 0x06, 0x03, 0x13, 0x02,
+  0x13, 0x02, 0x13, 0x03, 0x13, 0x02, 0x13, 0x02, 0x13, 0x02, 0x14, 0x02,
+  0x13, 0x02, 0x13, 0x02, 0x09, 0x01, 0x09, 0x03, 0x08, 0x02, 0x09, 0x02,
+  0x09, 0x01, 0x09, 0x0D, 0x09, 0x05, 0x11, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x05,
+  0x08, 0x01, 0x16, 0x01, 0x15, 0x01, 0x15, 0x01, 0x16, 0x01, 0x15, 0x01,
+  0x15, 0x01, 0x16, 0x01, 0x15, 0x01, 0x15, 0x01, 0x16, 0x01, 0x15, 0x01,
+  0x15, 0x01, 0x16, 0x01, 0x15, 0x01, 0x15, 0x01, 0x16, 0x01, 0x08, 0x05,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x11, 0x05, 0x21, 0x02, 0x13, 0x01, 0x02, 0x01,
+  0x12, 0x01, 0x02, 0x01, 0x11, 0x01, 0x04, 0x01, 0x10, 0x01, 0x04, 0x01,
+  0x0F, 0x01, 0x06, 0x01, 0x0E, 0x01, 0x06, 0x01, 0x0D, 0x01, 0x08, 0x01,
+  0xFF, 0x00, 0xD4, 0x0C, 0x1E, 0x02, 0x15, 0x01, 0x16, 0x01, 0x15, 0x01,
+  0x8D, 0x05, 0x0F, 0x02, 0x03, 0x03, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02,
+  0x04, 0x02, 0x13, 0x03, 0x10, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x03, 0x02,
+  0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x03, 0x02, 0x03,
+  0x01, 0x01, 0x0D, 0x04, 0x01, 0x03, 0x07, 0x02, 0x12, 0x04, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x01, 0x04, 0x0F, 0x03,
+  0x03, 0x02, 0x0E, 0x02, 0x04, 0x03, 0x0D, 0x02, 0x05, 0x02, 0x0D, 0x02,
+  0x05, 0x02, 0x0D, 0x02, 0x05, 0x02, 0x0D, 0x02, 0x05, 0x02, 0x0D, 0x02,
+  0x05, 0x02, 0x0D, 0x02, 0x04, 0x02, 0x0E, 0x03, 0x03, 0x01, 0x11, 0x04,
+  0x8E, 0x04, 0x11, 0x01, 0x03, 0x02, 0x0F, 0x01, 0x05, 0x02, 0x0D, 0x02,
+  0x05, 0x02, 0x0D, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x03, 0x05, 0x01,
+  0x0E, 0x03, 0x03, 0x01, 0x0F, 0x07, 0x11, 0x04, 0x0D, 0x02, 0x12, 0x04,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x10, 0x03, 0x01, 0x02,
+  0x0F, 0x01, 0x03, 0x03, 0x0E, 0x02, 0x04, 0x02, 0x0D, 0x02, 0x05, 0x02,
+  0x0D, 0x02, 0x05, 0x02, 0x0D, 0x02, 0x05, 0x02, 0x0D, 0x02, 0x05, 0x02,
+  0x0D, 0x02, 0x05, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x03, 0x02, 0x05,
+  0x0D, 0x04, 0x01, 0x02, 0x8E, 0x04, 0x10, 0x02, 0x03, 0x02, 0x0F, 0x01,
+  0x05, 0x02, 0x0D, 0x02, 0x05, 0x02, 0x0D, 0x09, 0x0D, 0x02, 0x14, 0x02,
+  0x14, 0x03, 0x05, 0x01, 0x0E, 0x03, 0x03, 0x01, 0x0F, 0x07, 0x11, 0x03,
+  0x0D, 0x04, 0x10, 0x02, 0x02, 0x03, 0x0F, 0x01, 0x04, 0x02, 0x0E, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x12, 0x07, 0x11, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x12, 0x06, 0x8D, 0x04, 0x11, 0x02, 0x02, 0x05, 0x0C, 0x02, 0x04, 0x02,
+  0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02,
+  0x0F, 0x02, 0x02, 0x02, 0x11, 0x04, 0x10, 0x02, 0x14, 0x09, 0x0E, 0x09,
+  0x0D, 0x01, 0x07, 0x01, 0x0C, 0x01, 0x08, 0x01, 0x0B, 0x02, 0x07, 0x01,
+  0x0C, 0x03, 0x05, 0x01, 0x0F, 0x06, 0x07, 0x02, 0x12, 0x04, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x02, 0x03, 0x0F, 0x04,
+  0x02, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02,
+  0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02,
+  0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0C, 0x05,
+  0x02, 0x05, 0x0B, 0x02, 0x14, 0x02, 0x6C, 0x02, 0x12, 0x04, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x12, 0x06, 0x0B, 0x02, 0x14, 0x02, 0x6C, 0x02, 0x12, 0x04,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x10, 0x02, 0x02, 0x01, 0x11, 0x04, 0x07, 0x02, 0x12, 0x04, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x03, 0x04, 0x0D, 0x02,
+  0x04, 0x01, 0x0F, 0x02, 0x03, 0x01, 0x10, 0x02, 0x02, 0x01, 0x11, 0x02,
+  0x01, 0x01, 0x12, 0x04, 0x12, 0x02, 0x01, 0x02, 0x11, 0x02, 0x02, 0x02,
+  0x10, 0x02, 0x03, 0x02, 0x0F, 0x02, 0x04, 0x02, 0x0C, 0x06, 0x01, 0x05,
+  0x0B, 0x02, 0x12, 0x04, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x12, 0x06, 0x88, 0x02,
+  0x02, 0x03, 0x03, 0x03, 0x07, 0x06, 0x01, 0x05, 0x02, 0x02, 0x08, 0x02,
+  0x04, 0x02, 0x04, 0x02, 0x08, 0x02, 0x04, 0x02, 0x04, 0x02, 0x08, 0x02,
+  0x04, 0x02, 0x04, 0x02, 0x08, 0x02, 0x04, 0x02, 0x04, 0x02, 0x08, 0x02,
+  0x04, 0x02, 0x04, 0x02, 0x08, 0x02, 0x04, 0x02, 0x04, 0x02, 0x08, 0x02,
+  0x04, 0x02, 0x04, 0x02, 0x08, 0x02, 0x04, 0x02, 0x04, 0x02, 0x06, 0x05,
+  0x02, 0x04, 0x02, 0x04, 0x8B, 0x02, 0x02, 0x03, 0x0D, 0x06, 0x02, 0x02,
+  0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02,
+  0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02,
+  0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0C, 0x05, 0x02, 0x05,
+  0x8D, 0x04, 0x11, 0x01, 0x03, 0x03, 0x0E, 0x01, 0x05, 0x02, 0x0D, 0x02,
+  0x06, 0x02, 0x0C, 0x02, 0x06, 0x02, 0x0C, 0x02, 0x06, 0x02, 0x0C, 0x02,
+  0x06, 0x02, 0x0C, 0x02, 0x06, 0x02, 0x0D, 0x02, 0x05, 0x01, 0x0E, 0x03,
+  0x03, 0x01, 0x11, 0x04, 0x8B, 0x02, 0x01, 0x04, 0x0D, 0x05, 0x03, 0x02,
+  0x0E, 0x02, 0x04, 0x03, 0x0D, 0x02, 0x05, 0x02, 0x0D, 0x02, 0x05, 0x02,
+  0x0D, 0x02, 0x05, 0x02, 0x0D, 0x02, 0x05, 0x02, 0x0D, 0x02, 0x05, 0x02,
+  0x0D, 0x02, 0x04, 0x02, 0x0E, 0x03, 0x03, 0x02, 0x0E, 0x02, 0x01, 0x03,
+  0x10, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x12, 0x06, 0x8D, 0x04,
+  0x01, 0x01, 0x0F, 0x01, 0x03, 0x03, 0x0E, 0x02, 0x04, 0x02, 0x0D, 0x02,
+  0x05, 0x02, 0x0D, 0x02, 0x05, 0x02, 0x0D, 0x02, 0x05, 0x02, 0x0D, 0x02,
+  0x05, 0x02, 0x0D, 0x02, 0x05, 0x02, 0x0D, 0x03, 0x04, 0x02, 0x0E, 0x02,
+  0x03, 0x03, 0x0F, 0x04, 0x01, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x12, 0x06, 0x8D, 0x02, 0x01, 0x03, 0x0E, 0x05, 0x01, 0x02,
+  0x10, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x12, 0x06, 0x8D, 0x04, 0x01, 0x01, 0x10, 0x01,
+  0x03, 0x02, 0x0F, 0x01, 0x04, 0x02, 0x0F, 0x02, 0x04, 0x01, 0x0F, 0x04,
+  0x13, 0x05, 0x13, 0x04, 0x0F, 0x01, 0x04, 0x02, 0x0F, 0x02, 0x04, 0x01,
+  0x0F, 0x03, 0x02, 0x01, 0x10, 0x01, 0x01, 0x03, 0x37, 0x01, 0x15, 0x01,
+  0x14, 0x02, 0x14, 0x02, 0x12, 0x07, 0x11, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x02, 0x01, 0x12, 0x03, 0x89, 0x04, 0x02, 0x04, 0x0E, 0x02, 0x04, 0x02,
+  0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02,
+  0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02,
+  0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x03, 0x05, 0x0D, 0x04, 0x01, 0x02,
+  0x89, 0x05, 0x03, 0x04, 0x0B, 0x03, 0x05, 0x01, 0x0E, 0x02, 0x05, 0x01,
+  0x0E, 0x02, 0x04, 0x01, 0x10, 0x02, 0x03, 0x01, 0x10, 0x02, 0x03, 0x01,
+  0x11, 0x02, 0x01, 0x01, 0x12, 0x02, 0x01, 0x01, 0x13, 0x02, 0x14, 0x02,
+  0x15, 0x01, 0x87, 0x05, 0x01, 0x05, 0x02, 0x04, 0x07, 0x02, 0x04, 0x02,
+  0x04, 0x01, 0x09, 0x02, 0x04, 0x02, 0x04, 0x01, 0x09, 0x03, 0x03, 0x03,
+  0x02, 0x01, 0x0B, 0x02, 0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x0B, 0x02,
+  0x02, 0x01, 0x01, 0x02, 0x02, 0x01, 0x0B, 0x02, 0x01, 0x01, 0x02, 0x02,
+  0x01, 0x01, 0x0D, 0x03, 0x03, 0x03, 0x0D, 0x03, 0x03, 0x03, 0x0D, 0x02,
+  0x04, 0x02, 0x0F, 0x01, 0x05, 0x01, 0x89, 0x05, 0x02, 0x04, 0x0D, 0x02,
+  0x04, 0x01, 0x10, 0x02, 0x02, 0x01, 0x12, 0x03, 0x13, 0x03, 0x14, 0x02,
+  0x13, 0x01, 0x01, 0x02, 0x11, 0x01, 0x02, 0x03, 0x10, 0x01, 0x03, 0x02,
+  0x0E, 0x02, 0x05, 0x02, 0x0C, 0x04, 0x03, 0x05, 0x89, 0x05, 0x03, 0x04,
+  0x0B, 0x03, 0x05, 0x01, 0x0E, 0x02, 0x05, 0x01, 0x0E, 0x02, 0x04, 0x01,
+  0x10, 0x02, 0x03, 0x01, 0x10, 0x02, 0x03, 0x01, 0x11, 0x02, 0x01, 0x01,
+  0x12, 0x02, 0x01, 0x01, 0x13, 0x02, 0x14, 0x02, 0x15, 0x01, 0x14, 0x01,
+  0x15, 0x01, 0x14, 0x02, 0x10, 0x05, 0x11, 0x04, 0x8C, 0x09, 0x0D, 0x01,
+  0x05, 0x02, 0x0E, 0x01, 0x04, 0x02, 0x13, 0x03, 0x13, 0x02, 0x13, 0x02,
+  0x13, 0x02, 0x13, 0x03, 0x13, 0x02, 0x05, 0x01, 0x0D, 0x02, 0x06, 0x01,
+  0x0C, 0x0A, 0x0E, 0x02, 0x12, 0x02, 0x14, 0x01, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x13, 0x02, 0x13, 0x01,
+  0x16, 0x02, 0x15, 0x01, 0x15, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x15, 0x01, 0x16, 0x02, 0x15, 0x02, 0x0B, 0x01,
+  0x15, 0x01, 0x15, 0x01, 0x15, 0x01, 0x15, 0x01, 0x15, 0x01, 0x15, 0x01,
+  0x15, 0x01, 0x15, 0x01, 0x15, 0x01, 0x15, 0x01, 0x15, 0x01, 0x15, 0x01,
+  0x15, 0x01, 0x15, 0x01, 0x15, 0x01, 0x15, 0x01, 0x15, 0x01, 0x15, 0x01,
+  0x15, 0x01, 0x15, 0x01, 0x15, 0x01, 0x08, 0x02, 0x16, 0x02, 0x15, 0x01,
+  0x15, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x15, 0x02, 0x16, 0x01, 0x13, 0x02, 0x14, 0x01, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x01, 0x13, 0x02,
+  0x13, 0x02, 0xCC, 0x04, 0x07, 0x01, 0x09, 0x02, 0x03, 0x03, 0x03, 0x02,
+  0x09, 0x01, 0x07, 0x04, 0x1F, 0x03, 0x12, 0x01, 0x02, 0x02, 0x11, 0x01,
+  0x03, 0x01, 0x11, 0x01, 0x03, 0x01, 0x11, 0x02, 0x02, 0x01, 0x12, 0x03,
+  0x89, 0x04, 0x02, 0x04, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02,
+  0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02,
+  0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02,
+  0x0E, 0x02, 0x03, 0x05, 0x0D, 0x04, 0x01, 0x02, 0x0E, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x21, 0x02, 0x15, 0x01, 0x16, 0x01,
+  0x15, 0x01, 0x27, 0x05, 0x0F, 0x02, 0x03, 0x03, 0x0E, 0x02, 0x04, 0x02,
+  0x0E, 0x02, 0x04, 0x02, 0x13, 0x03, 0x10, 0x03, 0x01, 0x02, 0x0F, 0x02,
+  0x03, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x03,
+  0x02, 0x03, 0x01, 0x01, 0x0D, 0x04, 0x01, 0x03, 0x21, 0x02, 0x13, 0x01,
+  0x02, 0x01, 0x11, 0x01, 0x04, 0x01, 0x0F, 0x01, 0x06, 0x01, 0x25, 0x05,
+  0x0F, 0x02, 0x03, 0x03, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02,
+  0x13, 0x03, 0x10, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x03, 0x02, 0x0E, 0x02,
+  0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x03, 0x02, 0x03, 0x01, 0x01,
+  0x0D, 0x04, 0x01, 0x03, 0x4B, 0x02, 0x02, 0x02, 0x10, 0x02, 0x02, 0x02,
+  0x26, 0x05, 0x0F, 0x02, 0x03, 0x03, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02,
+  0x04, 0x02, 0x13, 0x03, 0x10, 0x03, 0x01, 0x02, 0x0F, 0x02, 0x03, 0x02,
+  0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x03, 0x02, 0x03,
+  0x01, 0x01, 0x0D, 0x04, 0x01, 0x03, 0x8E, 0x04, 0x11, 0x01, 0x03, 0x02,
+  0x0F, 0x01, 0x05, 0x02, 0x0D, 0x02, 0x05, 0x02, 0x0D, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x03, 0x05, 0x01, 0x0E, 0x03, 0x03, 0x01, 0x0F, 0x07,
+  0x11, 0x04, 0x11, 0x03, 0x13, 0x04, 0x15, 0x01, 0x15, 0x01, 0x14, 0x01,
+  0x13, 0x02, 0x20, 0x02, 0x15, 0x01, 0x16, 0x01, 0x15, 0x01, 0x29, 0x04,
+  0x10, 0x02, 0x03, 0x02, 0x0F, 0x01, 0x05, 0x02, 0x0D, 0x02, 0x05, 0x02,
+  0x0D, 0x09, 0x0D, 0x02, 0x14, 0x02, 0x14, 0x03, 0x05, 0x01, 0x0E, 0x03,
+  0x03, 0x01, 0x0F, 0x07, 0x11, 0x03, 0x21, 0x02, 0x14, 0x01, 0x14, 0x01,
+  0x15, 0x01, 0x2B, 0x04, 0x10, 0x02, 0x03, 0x02, 0x0F, 0x01, 0x05, 0x02,
+  0x0D, 0x02, 0x05, 0x02, 0x0D, 0x09, 0x0D, 0x02, 0x14, 0x02, 0x14, 0x03,
+  0x05, 0x01, 0x0E, 0x03, 0x03, 0x01, 0x0F, 0x07, 0x11, 0x03, 0x20, 0x02,
+  0x13, 0x01, 0x02, 0x01, 0x11, 0x01, 0x04, 0x01, 0x0F, 0x01, 0x06, 0x01,
+  0x27, 0x04, 0x10, 0x02, 0x03, 0x02, 0x0F, 0x01, 0x05, 0x02, 0x0D, 0x02,
+  0x05, 0x02, 0x0D, 0x09, 0x0D, 0x02, 0x14, 0x02, 0x14, 0x03, 0x05, 0x01,
+  0x0E, 0x03, 0x03, 0x01, 0x0F, 0x07, 0x11, 0x03, 0x4A, 0x02, 0x02, 0x02,
+  0x10, 0x02, 0x02, 0x02, 0x28, 0x04, 0x10, 0x02, 0x03, 0x02, 0x0F, 0x01,
+  0x05, 0x02, 0x0D, 0x02, 0x05, 0x02, 0x0D, 0x09, 0x0D, 0x02, 0x14, 0x02,
+  0x14, 0x03, 0x05, 0x01, 0x0E, 0x03, 0x03, 0x01, 0x0F, 0x07, 0x11, 0x03,
+  0x21, 0x02, 0x13, 0x01, 0x02, 0x01, 0x11, 0x01, 0x04, 0x01, 0x0F, 0x01,
+  0x06, 0x01, 0x27, 0x02, 0x12, 0x04, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x12, 0x06,
+  0x4B, 0x02, 0x02, 0x02, 0x10, 0x02, 0x02, 0x02, 0x28, 0x02, 0x12, 0x04,
+  0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02, 0x14, 0x02,
+  0x14, 0x02, 0x14, 0x02, 0x12, 0x06, 0x20, 0x02, 0x13, 0x01, 0x02, 0x01,
+  0x11, 0x01, 0x04, 0x01, 0x0F, 0x01, 0x06, 0x01, 0x26, 0x04, 0x11, 0x01,
+  0x03, 0x03, 0x0E, 0x01, 0x05, 0x02, 0x0D, 0x02, 0x06, 0x02, 0x0C, 0x02,
+  0x06, 0x02, 0x0C, 0x02, 0x06, 0x02, 0x0C, 0x02, 0x06, 0x02, 0x0C, 0x02,
+  0x06, 0x02, 0x0D, 0x02, 0x05, 0x01, 0x0E, 0x03, 0x03, 0x01, 0x11, 0x04,
+  0x4A, 0x02, 0x02, 0x02, 0x10, 0x02, 0x02, 0x02, 0x27, 0x04, 0x11, 0x01,
+  0x03, 0x03, 0x0E, 0x01, 0x05, 0x02, 0x0D, 0x02, 0x06, 0x02, 0x0C, 0x02,
+  0x06, 0x02, 0x0C, 0x02, 0x06, 0x02, 0x0C, 0x02, 0x06, 0x02, 0x0C, 0x02,
+  0x06, 0x02, 0x0D, 0x02, 0x05, 0x01, 0x0E, 0x03, 0x03, 0x01, 0x11, 0x04,
+  0x20, 0x02, 0x15, 0x01, 0x16, 0x01, 0x15, 0x01, 0x24, 0x04, 0x02, 0x04,
+  0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02,
+  0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02,
+  0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x03, 0x05,
+  0x0D, 0x04, 0x01, 0x02, 0x20, 0x02, 0x13, 0x01, 0x02, 0x01, 0x11, 0x01,
+  0x04, 0x01, 0x0F, 0x01, 0x06, 0x01, 0x22, 0x04, 0x02, 0x04, 0x0E, 0x02,
+  0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02,
+  0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02,
+  0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x03, 0x05, 0x0D, 0x04,
+  0x01, 0x02, 0x4A, 0x02, 0x02, 0x02, 0x10, 0x02, 0x02, 0x02, 0x23, 0x04,
+  0x02, 0x04, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02,
+  0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02,
+  0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02, 0x04, 0x02, 0x0E, 0x02,
+  0x03, 0x05, 0x0D, 0x04, 0x01, 0x02,
+};
+
+const uint16_t Font18Rle_Offsets[] = {
+      0,     0,    28,    56,   120,   192,   288,   362,
+    376,   420,   464,   500,   526,   540,   544,   550,
+    584,   644,   676,   716,   752,   798,   832,   882,
+    918,   974,  1024,  1032,  1048,  1070,  1074,  1096,
+   1134,  1272,  1328,  1386,  1434,  1494,  1546,  1592,
+   1650,  1712,  1744,  1780,  1840,  1880,  1984,  2062,
+   2122,  2168,  2238,  2298,  2350,  2394,  2456,  2514,
+   2612,  2672,  2720,  2764,  2808,  2842,  2886,  2916,
+   2920,  2928,  2970,  3024,  3056,  3112,  3144,  3182,
+   3234,  3290,  3316,  3354,  3408,  3442,  3508,  3552,
+   3592,  3646,  3700,  3726,  3764,  3796,  3840,  3878,
+   3942,  3980,  4028,  4058,  4102,  4146,  4190,  4204,
+   4224,  4278,  4328,  4384,  4434,  4478,  4518,  4558,
+   4604,  4644,  4680,  4710,  4764,  4812,  4864,  4922,
+   4974,
+};
+
+const uint16_t Font18Rle_CodePoints[] = {
+  0x00B0,  // '°'
+  0x00B5,  // 'µ'
+  0x00E0,  // 'à'
+  0x00E2,  // 'â'
+  0x00E4,  // 'ä'
+  0x00E7,  // 'ç'
+  0x00E8,  // 'è'
+  0x00E9,  // 'é'
+  0x00EA,  // 'ê'
+  0x00EB,  // 'ë'
+  0x00EE,  // 'î'
+  0x00EF,  // 'ï'
+  0x00F4,  // 'ô'
+  0x00F6,  // 'ö'
+  0x00F9,  // 'ù'
+  0x00FB,  // 'û'
+  0x00FC,  // 'ü'
+};
+// clang-format on
+
+constexpr Font kFont18Rle = {Font18Rle_Table,
+                             22,
+                             23,
+                             FontFormat::Rle1,
+                             Font18Rle_CodePoints,
+                             17,
+                             Font18Rle_Offsets};
+
+}  // namespace disco
@@ -3067,12 +3067,557 @@ const uint8_t Font24_Table[] = {
 	0x00, 0x00, 0x00, 0x00, //
 	0x00, 0x00, 0x00, 0x00, //
 	0x00, 0x00, 0x00, 0x00, //
+  // @11400 '°' (28 pixels wide)
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x0E, 0x00, 0x00,  //             ###
+  0x00, 0x13, 0x00, 0x00,  //            #  ##
+  0x00, 0x31, 0x80, 0x00,  //           ##   ##
+  0x00, 0x31, 0x80, 0x00,  //           ##   ##
+  0x00, 0x31, 0x80, 0x00,  //           ##   ##
+  0x00, 0x31, 0x80, 0x00,  //           ##   ##
+  0x00, 0x1B, 0x00, 0x00,  //            ## ##
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  // @11520 'µ' (28 pixels wide)
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x03, 0xE3, 0xE0, 0x00,  //       #####   #####
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xF3, 0xF8, 0x00,  //         ####  #######
+  0x00, 0x7E, 0xF0, 0x00,  //          ###### ####
+  0x00, 0x38, 0xC0, 0x00,  //           ###   ##
+  0x00, 0xE0, 0x00, 0x00,  //         ###
+  0x00, 0xE0, 0x00, 0x00,  //         ###
+  0x00, 0xE0, 0x00, 0x00,  //         ###
+  0x00, 0xE0, 0x00, 0x00,  //         ###
+  0x00, 0xE0, 0x00, 0x00,  //         ###
+  0x00, 0xE0, 0x00, 0x00,  //         ###
+  0x00, 0xE0, 0x00, 0x00,  //         ###
+  // @11640 'à' (28 pixels wide)
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x0E, 0x00, 0x00,  //             ###
+  0x00, 0x07, 0x00, 0x00,  //              ###
+  0x00, 0x03, 0x00, 0x00,  //               ##
+  0x00, 0x01, 0x00, 0x00,  //                #
+  0x00, 0x00, 0x80, 0x00,  //                 #
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x1F, 0x80, 0x00,  //            ######
+  0x00, 0x31, 0xC0, 0x00,  //           ##   ###
+  0x00, 0x70, 0xE0, 0x00,  //          ###    ###
+  0x00, 0x70, 0xE0, 0x00,  //          ###    ###
+  0x00, 0x70, 0xE0, 0x00,  //          ###    ###
+  0x00, 0x01, 0xE0, 0x00,  //                ####
+  0x00, 0x0E, 0xE0, 0x00,  //             ### ###
+  0x00, 0x38, 0xE0, 0x00,  //           ###   ###
+  0x00, 0x60, 0xE0, 0x00,  //          ##     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xF1, 0xE8, 0x00,  //         ####   #### #
+  0x00, 0x7E, 0xF0, 0x00,  //          ###### ####
+  0x00, 0x38, 0x60, 0x00,  //           ###    ##
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  // @11760 'â' (28 pixels wide)
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x06, 0x00, 0x00,  //              ##
+  0x00, 0x09, 0x00, 0x00,  //             #  #
+  0x00, 0x10, 0x80, 0x00,  //            #    #
+  0x00, 0x10, 0x80, 0x00,  //            #    #
+  0x00, 0x40, 0x20, 0x00,  //          #        #
+  0x00, 0x40, 0x20, 0x00,  //          #        #
+  0x00, 0x80, 0x10, 0x00,  //         #          #
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x1F, 0x80, 0x00,  //            ######
+  0x00, 0x31, 0xC0, 0x00,  //           ##   ###
+  0x00, 0x70, 0xE0, 0x00,  //          ###    ###
+  0x00, 0x70, 0xE0, 0x00,  //          ###    ###
+  0x00, 0x70, 0xE0, 0x00,  //          ###    ###
+  0x00, 0x01, 0xE0, 0x00,  //                ####
+  0x00, 0x0E, 0xE0, 0x00,  //             ### ###
+  0x00, 0x38, 0xE0, 0x00,  //           ###   ###
+  0x00, 0x60, 0xE0, 0x00,  //          ##     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xF1, 0xE8, 0x00,  //         ####   #### #
+  0x00, 0x7E, 0xF0, 0x00,  //          ###### ####
+  0x00, 0x38, 0x60, 0x00,  //           ###    ##
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  // @11880 'ä' (28 pixels wide)
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x38, 0xE0, 0x00,  //           ###   ###
+  0x00, 0x38, 0xE0, 0x00,  //           ###   ###
+  0x00, 0x38, 0xE0, 0x00,  //           ###   ###
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x1F, 0x80, 0x00,  //            ######
+  0x00, 0x31, 0xC0, 0x00,  //           ##   ###
+  0x00, 0x70, 0xE0, 0x00,  //          ###    ###
+  0x00, 0x70, 0xE0, 0x00,  //          ###    ###
+  0x00, 0x70, 0xE0, 0x00,  //          ###    ###
+  0x00, 0x01, 0xE0, 0x00,  //                ####
+  0x00, 0x0E, 0xE0, 0x00,  //             ### ###
+  0x00, 0x38, 0xE0, 0x00,  //           ###   ###
+  0x00, 0x60, 0xE0, 0x00,  //          ##     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xF1, 0xE8, 0x00,  //         ####   #### #
+  0x00, 0x7E, 0xF0, 0x00,  //          ###### ####
+  0x00, 0x38, 0x60, 0x00,  //           ###    ##
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  // @12000 'ç' (28 pixels wide)
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x0F, 0x80, 0x00,  //             #####
+  0x00, 0x31, 0xC0, 0x00,  //           ##   ###
+  0x00, 0x60, 0xE0, 0x00,  //          ##     ###
+  0x00, 0x60, 0xE0, 0x00,  //          ##     ###
+  0x00, 0xC0, 0x60, 0x00,  //         ##       ##
+  0x00, 0xC0, 0x00, 0x00,  //         ##
+  0x00, 0xC0, 0x00, 0x00,  //         ##
+  0x00, 0xE0, 0x10, 0x00,  //         ###        #
+  0x00, 0xE0, 0x30, 0x00,  //         ###       ##
+  0x00, 0xF0, 0x20, 0x00,  //         ####      #
+  0x00, 0x78, 0x60, 0x00,  //          ####    ##
+  0x00, 0x7F, 0xE0, 0x00,  //          ##########
+  0x00, 0x3F, 0xC0, 0x00,  //           ########
+  0x00, 0x0F, 0x00, 0x00,  //             ####
+  0x00, 0x07, 0x00, 0x00,  //              ###
+  0x00, 0x0F, 0x80, 0x00,  //             #####
+  0x00, 0x0F, 0x80, 0x00,  //             #####
+  0x00, 0x00, 0x80, 0x00,  //                 #
+  0x00, 0x00, 0x80, 0x00,  //                 #
+  0x00, 0x01, 0x00, 0x00,  //                #
+  0x00, 0x02, 0x00, 0x00,  //               #
+  // @12120 'è' (28 pixels wide)
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x0E, 0x00, 0x00,  //             ###
+  0x00, 0x07, 0x00, 0x00,  //              ###
+  0x00, 0x03, 0x00, 0x00,  //               ##
+  0x00, 0x01, 0x00, 0x00,  //                #
+  0x00, 0x00, 0x80, 0x00,  //                 #
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x0F, 0x80, 0x00,  //             #####
+  0x00, 0x30, 0xE0, 0x00,  //           ##    ###
+  0x00, 0x60, 0x60, 0x00,  //          ##      ##
+  0x00, 0x40, 0x70, 0x00,  //          #       ###
+  0x00, 0xFF, 0xF0, 0x00,  //         ############
+  0x00, 0xC0, 0x00, 0x00,  //         ##
+  0x00, 0xC0, 0x00, 0x00,  //         ##
+  0x00, 0xC0, 0x00, 0x00,  //         ##
+  0x00, 0xE0, 0x10, 0x00,  //         ###        #
+  0x00, 0xF0, 0x30, 0x00,  //         ####      ##
+  0x00, 0x78, 0x60, 0x00,  //          ####    ##
+  0x00, 0x7F, 0xE0, 0x00,  //          ##########
+  0x00, 0x3F, 0xC0, 0x00,  //           ########
+  0x00, 0x0F, 0x80, 0x00,  //             #####
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  // @12240 'é' (28 pixels wide)
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x03, 0x80, 0x00,  //               ###
+  0x00, 0x07, 0x00, 0x00,  //              ###
+  0x00, 0x06, 0x00, 0x00,  //              ##
+  0x00, 0x04, 0x00, 0x00,  //              #
+  0x00, 0x08, 0x00, 0x00,  //             #
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x0F, 0x80, 0x00,  //             #####
+  0x00, 0x30, 0xE0, 0x00,  //           ##    ###
+  0x00, 0x60, 0x60, 0x00,  //          ##      ##
+  0x00, 0x40, 0x70, 0x00,  //          #       ###
+  0x00, 0xFF, 0xF0, 0x00,  //         ############
+  0x00, 0xC0, 0x00, 0x00,  //         ##
+  0x00, 0xC0, 0x00, 0x00,  //         ##
+  0x00, 0xC0, 0x00, 0x00,  //         ##
+  0x00, 0xE0, 0x10, 0x00,  //         ###        #
+  0x00, 0xF0, 0x30, 0x00,  //         ####      ##
+  0x00, 0x78, 0x60, 0x00,  //          ####    ##
+  0x00, 0x7F, 0xE0, 0x00,  //          ##########
+  0x00, 0x3F, 0xC0, 0x00,  //           ########
+  0x00, 0x0F, 0x80, 0x00,  //             #####
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  // @12360 'ê' (28 pixels wide)
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x06, 0x00, 0x00,  //              ##
+  0x00, 0x09, 0x00, 0x00,  //             #  #
+  0x00, 0x10, 0x80, 0x00,  //            #    #
+  0x00, 0x10, 0x80, 0x00,  //            #    #
+  0x00, 0x40, 0x20, 0x00,  //          #        #
+  0x00, 0x40, 0x20, 0x00,  //          #        #
+  0x00, 0x80, 0x10, 0x00,  //         #          #
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x0F, 0x80, 0x00,  //             #####
+  0x00, 0x30, 0xE0, 0x00,  //           ##    ###
+  0x00, 0x60, 0x60, 0x00,  //          ##      ##
+  0x00, 0x40, 0x70, 0x00,  //          #       ###
+  0x00, 0xFF, 0xF0, 0x00,  //         ############
+  0x00, 0xC0, 0x00, 0x00,  //         ##
+  0x00, 0xC0, 0x00, 0x00,  //         ##
+  0x00, 0xC0, 0x00, 0x00,  //         ##
+  0x00, 0xE0, 0x10, 0x00,  //         ###        #
+  0x00, 0xF0, 0x30, 0x00,  //         ####      ##
+  0x00, 0x78, 0x60, 0x00,  //          ####    ##
+  0x00, 0x7F, 0xE0, 0x00,  //          ##########
+  0x00, 0x3F, 0xC0, 0x00,  //           ########
+  0x00, 0x0F, 0x80, 0x00,  //             #####
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  // @12480 'ë' (28 pixels wide)
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x38, 0xE0, 0x00,  //           ###   ###
+  0x00, 0x38, 0xE0, 0x00,  //           ###   ###
+  0x00, 0x38, 0xE0, 0x00,  //           ###   ###
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x0F, 0x80, 0x00,  //             #####
+  0x00, 0x30, 0xE0, 0x00,  //           ##    ###
+  0x00, 0x60, 0x60, 0x00,  //          ##      ##
+  0x00, 0x40, 0x70, 0x00,  //          #       ###
+  0x00, 0xFF, 0xF0, 0x00,  //         ############
+  0x00, 0xC0, 0x00, 0x00,  //         ##
+  0x00, 0xC0, 0x00, 0x00,  //         ##
+  0x00, 0xC0, 0x00, 0x00,  //         ##
+  0x00, 0xE0, 0x10, 0x00,  //         ###        #
+  0x00, 0xF0, 0x30, 0x00,  //         ####      ##
+  0x00, 0x78, 0x60, 0x00,  //          ####    ##
+  0x00, 0x7F, 0xE0, 0x00,  //          ##########
+  0x00, 0x3F, 0xC0, 0x00,  //           ########
+  0x00, 0x0F, 0x80, 0x00,  //             #####
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  // @12600 'î' (28 pixels wide)
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x0C, 0x00, 0x00,  //             ##
+  0x00, 0x12, 0x00, 0x00,  //            #  #
+  0x00, 0x21, 0x00, 0x00,  //           #    #
+  0x00, 0x21, 0x00, 0x00,  //           #    #
+  0x00, 0x80, 0x40, 0x00,  //         #        #
+  0x00, 0x80, 0x40, 0x00,  //         #        #
+  0x01, 0x00, 0x20, 0x00,  //        #          #
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x06, 0x00, 0x00,  //              ##
+  0x00, 0x1E, 0x00, 0x00,  //            ####
+  0x00, 0x3E, 0x00, 0x00,  //           #####
+  0x00, 0x0E, 0x00, 0x00,  //             ###
+  0x00, 0x0E, 0x00, 0x00,  //             ###
+  0x00, 0x0E, 0x00, 0x00,  //             ###
+  0x00, 0x0E, 0x00, 0x00,  //             ###
+  0x00, 0x0E, 0x00, 0x00,  //             ###
+  0x00, 0x0E, 0x00, 0x00,  //             ###
+  0x00, 0x0E, 0x00, 0x00,  //             ###
+  0x00, 0x0E, 0x00, 0x00,  //             ###
+  0x00, 0x0E, 0x00, 0x00,  //             ###
+  0x00, 0x0E, 0x00, 0x00,  //             ###
+  0x00, 0x3F, 0x80, 0x00,  //           #######
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  // @12720 'ï' (28 pixels wide)
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x71, 0xC0, 0x00,  //          ###   ###
+  0x00, 0x71, 0xC0, 0x00,  //          ###   ###
+  0x00, 0x71, 0xC0, 0x00,  //          ###   ###
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x06, 0x00, 0x00,  //              ##
+  0x00, 0x1E, 0x00, 0x00,  //            ####
+  0x00, 0x3E, 0x00, 0x00,  //           #####
+  0x00, 0x0E, 0x00, 0x00,  //             ###
+  0x00, 0x0E, 0x00, 0x00,  //             ###
+  0x00, 0x0E, 0x00, 0x00,  //             ###
+  0x00, 0x0E, 0x00, 0x00,  //             ###
+  0x00, 0x0E, 0x00, 0x00,  //             ###
+  0x00, 0x0E, 0x00, 0x00,  //             ###
+  0x00, 0x0E, 0x00, 0x00,  //             ###
+  0x00, 0x0E, 0x00, 0x00,  //             ###
+  0x00, 0x0E, 0x00, 0x00,  //             ###
+  0x00, 0x0E, 0x00, 0x00,  //             ###
+  0x00, 0x3F, 0x80, 0x00,  //           #######
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  // @12840 'ô' (28 pixels wide)
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x06, 0x00, 0x00,  //              ##
+  0x00, 0x09, 0x00, 0x00,  //             #  #
+  0x00, 0x10, 0x80, 0x00,  //            #    #
+  0x00, 0x10, 0x80, 0x00,  //            #    #
+  0x00, 0x40, 0x20, 0x00,  //          #        #
+  0x00, 0x40, 0x20, 0x00,  //          #        #
+  0x00, 0x80, 0x10, 0x00,  //         #          #
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x1F, 0x80, 0x00,  //            ######
+  0x00, 0x31, 0xE0, 0x00,  //           ##   ####
+  0x00, 0x60, 0xE0, 0x00,  //          ##     ###
+  0x00, 0xC0, 0x70, 0x00,  //         ##       ###
+  0x00, 0xC0, 0x38, 0x00,  //         ##        ###
+  0x01, 0xC0, 0x38, 0x00,  //        ###        ###
+  0x01, 0xC0, 0x38, 0x00,  //        ###        ###
+  0x01, 0xC0, 0x38, 0x00,  //        ###        ###
+  0x01, 0xC0, 0x38, 0x00,  //        ###        ###
+  0x01, 0xE0, 0x30, 0x00,  //        ####       ##
+  0x00, 0xE0, 0x30, 0x00,  //         ###       ##
+  0x00, 0x70, 0x60, 0x00,  //          ###     ##
+  0x00, 0x78, 0xC0, 0x00,  //          ####   ##
+  0x00, 0x1F, 0x80, 0x00,  //            ######
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  // @12960 'ö' (28 pixels wide)
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x38, 0xE0, 0x00,  //           ###   ###
+  0x00, 0x38, 0xE0, 0x00,  //           ###   ###
+  0x00, 0x38, 0xE0, 0x00,  //           ###   ###
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x1F, 0x80, 0x00,  //            ######
+  0x00, 0x31, 0xE0, 0x00,  //           ##   ####
+  0x00, 0x60, 0xE0, 0x00,  //          ##     ###
+  0x00, 0xC0, 0x70, 0x00,  //         ##       ###
+  0x00, 0xC0, 0x38, 0x00,  //         ##        ###
+  0x01, 0xC0, 0x38, 0x00,  //        ###        ###
+  0x01, 0xC0, 0x38, 0x00,  //        ###        ###
+  0x01, 0xC0, 0x38, 0x00,  //        ###        ###
+  0x01, 0xC0, 0x38, 0x00,  //        ###        ###
+  0x01, 0xE0, 0x30, 0x00,  //        ####       ##
+  0x00, 0xE0, 0x30, 0x00,  //         ###       ##
+  0x00, 0x70, 0x60, 0x00,  //          ###     ##
+  0x00, 0x78, 0xC0, 0x00,  //          ####   ##
+  0x00, 0x1F, 0x80, 0x00,  //            ######
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  // @13080 'ù' (28 pixels wide)
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x1C, 0x00, 0x00,  //            ###
+  0x00, 0x0E, 0x00, 0x00,  //             ###
+  0x00, 0x06, 0x00, 0x00,  //              ##
+  0x00, 0x02, 0x00, 0x00,  //               #
+  0x00, 0x01, 0x00, 0x00,  //                #
+  0x00, 0x00, 0x00, 0x00,  //
+  0x03, 0xE3, 0xE0, 0x00,  //       #####   #####
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xF3, 0xF8, 0x00,  //         ####  #######
+  0x00, 0x7E, 0xF0, 0x00,  //          ###### ####
+  0x00, 0x38, 0xC0, 0x00,  //           ###   ##
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  // @13200 'û' (28 pixels wide)
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x0C, 0x00, 0x00,  //             ##
+  0x00, 0x12, 0x00, 0x00,  //            #  #
+  0x00, 0x21, 0x00, 0x00,  //           #    #
+  0x00, 0x21, 0x00, 0x00,  //           #    #
+  0x00, 0x80, 0x40, 0x00,  //         #        #
+  0x00, 0x80, 0x40, 0x00,  //         #        #
+  0x01, 0x00, 0x20, 0x00,  //        #          #
+  0x00, 0x00, 0x00, 0x00,  //
+  0x03, 0xE3, 0xE0, 0x00,  //       #####   #####
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xF3, 0xF8, 0x00,  //         ####  #######
+  0x00, 0x7E, 0xF0, 0x00,  //          ###### ####
+  0x00, 0x38, 0xC0, 0x00,  //           ###   ##
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  // @13320 'ü' (28 pixels wide)
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x71, 0xC0, 0x00,  //          ###   ###
+  0x00, 0x71, 0xC0, 0x00,  //          ###   ###
+  0x00, 0x71, 0xC0, 0x00,  //          ###   ###
+  0x00, 0x00, 0x00, 0x00,  //
+  0x03, 0xE3, 0xE0, 0x00,  //       #####   #####
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xE0, 0xE0, 0x00,  //         ###     ###
+  0x00, 0xF3, 0xF8, 0x00,  //         ####  #######
+  0x00, 0x7E, 0xF0, 0x00,  //          ###### ####
+  0x00, 0x38, 0xC0, 0x00,  //           ###   ##
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00,  //
+};
+
+const uint16_t Font24_CodePoints[] = {
+  0x00B0,  // '°'
+  0x00B5,  // 'µ'
+  0x00E0,  // 'à'
+  0x00E2,  // 'â'
+  0x00E4,  // 'ä'
+  0x00E7,  // 'ç'
+  0x00E8,  // 'è'
+  0x00E9,  // 'é'
+  0x00EA,  // 'ê'
+  0x00EB,  // 'ë'
+  0x00EE,  // 'î'
+  0x00EF,  // 'ï'
+  0x00F4,  // 'ô'
+  0x00F6,  // 'ö'
+  0x00F9,  // 'ù'
+  0x00FB,  // 'û'
+  0x00FC,  // 'ü'
 };
 // clang-format on
 
-Font* createFont24() {
-    static Font* pFont24 = new Font{Font24_Table, 28, 30};
-    return pFont24;
-}
+constexpr Font kFont24 = {
+    Font24_Table, 28, 30, FontFormat::Mono1, Font24_CodePoints, 17};
 
 }  // namespace disco
@@ -0,0 +1,633 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file fonts24_rle.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Run-length compressed font (size 24), generated from fonts24.cpp
+ *        by tools/font_rle.py
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "fonts.hpp"
+
+namespace disco {
+// clang-format off
+const uint8_t Font24Rle_Table[] = {
+  0x45, 0x02, 0x1A, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x1A, 0x01, 0x1B, 0x01, 0x1B, 0x01,
+  0x1B, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x6E, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x41, 0x03, 0x03, 0x03, 0x13, 0x03, 0x03, 0x03, 0x13, 0x03, 0x03, 0x03,
+  0x13, 0x03, 0x03, 0x03, 0x13, 0x03, 0x03, 0x03, 0x13, 0x03, 0x03, 0x03,
+  0x14, 0x01, 0x05, 0x01, 0x15, 0x01, 0x05, 0x01, 0x15, 0x01, 0x05, 0x01,
+  0x28, 0x01, 0x05, 0x01, 0x15, 0x01, 0x05, 0x01, 0x15, 0x01, 0x05, 0x01,
+  0x14, 0x01, 0x05, 0x01, 0x15, 0x01, 0x05, 0x01, 0x15, 0x01, 0x05, 0x01,
+  0x15, 0x01, 0x05, 0x01, 0x15, 0x01, 0x05, 0x01, 0x11, 0x0D, 0x12, 0x01,
+  0x05, 0x01, 0x15, 0x01, 0x05, 0x01, 0x15, 0x01, 0x05, 0x01, 0x15, 0x01,
+  0x05, 0x01, 0x15, 0x01, 0x05, 0x01, 0x12, 0x0D, 0x11, 0x01, 0x05, 0x01,
+  0x15, 0x01, 0x05, 0x01, 0x15, 0x01, 0x05, 0x01, 0x15, 0x01, 0x05, 0x01,
+  0x14, 0x01, 0x05, 0x01, 0x15, 0x01, 0x05, 0x01, 0x15, 0x01, 0x05, 0x01,
+  0x0E, 0x01, 0x1B, 0x01, 0x19, 0x06, 0x14, 0x02, 0x02, 0x01, 0x02, 0x03,
+  0x11, 0x02, 0x03, 0x01, 0x03, 0x02, 0x10, 0x03, 0x03, 0x01, 0x03, 0x02,
+  0x10, 0x03, 0x03, 0x01, 0x04, 0x01, 0x10, 0x03, 0x03, 0x01, 0x04, 0x01,
+  0x10, 0x04, 0x02, 0x01, 0x16, 0x04, 0x01, 0x01, 0x17, 0x05, 0x18, 0x05,
+  0x19, 0x05, 0x18, 0x05, 0x17, 0x01, 0x01, 0x04, 0x16, 0x01, 0x02, 0x04,
+  0x15, 0x01, 0x03, 0x03, 0x0F, 0x01, 0x05, 0x01, 0x03, 0x03, 0x0F, 0x01,
+  0x05, 0x01, 0x03, 0x03, 0x0F, 0x02, 0x04, 0x01, 0x03, 0x03, 0x0F, 0x02,
+  0x04, 0x01, 0x02, 0x03, 0x10, 0x04, 0x02, 0x01, 0x01, 0x03, 0x13, 0x07,
+  0x19, 0x01, 0x1B, 0x01, 0x3C, 0x04, 0x0D, 0x01, 0x09, 0x02, 0x02, 0x03,
+  0x0B, 0x01, 0x08, 0x02, 0x04, 0x02, 0x0A, 0x01, 0x08, 0x03, 0x04, 0x03,
+  0x08, 0x01, 0x09, 0x03, 0x04, 0x03, 0x07, 0x01, 0x0A, 0x03, 0x04, 0x03,
+  0x06, 0x01, 0x0B, 0x03, 0x04, 0x03, 0x06, 0x01, 0x0B, 0x03, 0x04, 0x03,
+  0x05, 0x01, 0x0D, 0x02, 0x04, 0x02, 0x05, 0x01, 0x0E, 0x03, 0x02, 0x03,
+  0x04, 0x01, 0x11, 0x04, 0x06, 0x01, 0x05, 0x04, 0x11, 0x01, 0x04, 0x03,
+  0x02, 0x03, 0x0E, 0x01, 0x05, 0x02, 0x04, 0x02, 0x0D, 0x01, 0x05, 0x03,
+  0x04, 0x03, 0x0C, 0x01, 0x05, 0x03, 0x04, 0x03, 0x0B, 0x01, 0x06, 0x03,
+  0x04, 0x03, 0x0A, 0x01, 0x07, 0x03, 0x04, 0x03, 0x09, 0x01, 0x08, 0x03,
+  0x04, 0x03, 0x09, 0x01, 0x09, 0x02, 0x04, 0x02, 0x09, 0x01, 0x0B, 0x02,
+  0x02, 0x03, 0x08, 0x01, 0x0D, 0x04, 0x43, 0x05, 0x15, 0x03, 0x03, 0x02,
+  0x14, 0x02, 0x05, 0x02, 0x12, 0x03, 0x05, 0x02, 0x12, 0x03, 0x05, 0x02,
+  0x12, 0x03, 0x05, 0x02, 0x12, 0x03, 0x04, 0x02, 0x13, 0x03, 0x02, 0x03,
+  0x15, 0x05, 0x04, 0x06, 0x0D, 0x03, 0x07, 0x03, 0x0E, 0x05, 0x06, 0x02,
+  0x0D, 0x02, 0x02, 0x03, 0x06, 0x02, 0x0C, 0x02, 0x03, 0x04, 0x05, 0x01,
+  0x0C, 0x02, 0x05, 0x04, 0x03, 0x01, 0x0D, 0x02, 0x06, 0x03, 0x02, 0x01,
+  0x0D, 0x03, 0x06, 0x05, 0x0E, 0x03, 0x07, 0x04, 0x0E, 0x04, 0x07, 0x04,
+  0x07, 0x01, 0x05, 0x05, 0x04, 0x07, 0x05, 0x01, 0x07, 0x09, 0x03, 0x09,
+  0x09, 0x05, 0x07, 0x05, 0x45, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x1A, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x4A, 0x01,
+  0x19, 0x02, 0x19, 0x02, 0x19, 0x02, 0x19, 0x02, 0x19, 0x02, 0x1A, 0x02,
+  0x19, 0x03, 0x19, 0x02, 0x1A, 0x02, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x1A, 0x02, 0x1A, 0x03,
+  0x19, 0x03, 0x1A, 0x02, 0x1A, 0x03, 0x1A, 0x02, 0x1B, 0x02, 0x1B, 0x02,
+  0x1B, 0x02, 0x1C, 0x01, 0x42, 0x01, 0x1C, 0x02, 0x1B, 0x02, 0x1B, 0x02,
+  0x1B, 0x02, 0x1B, 0x02, 0x1A, 0x02, 0x1A, 0x03, 0x19, 0x03, 0x1A, 0x02,
+  0x1A, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x02, 0x1A, 0x02, 0x19, 0x03, 0x19, 0x02, 0x1A, 0x02,
+  0x19, 0x02, 0x19, 0x02, 0x19, 0x02, 0x19, 0x02, 0x19, 0x01, 0x29, 0x01,
+  0x1A, 0x03, 0x19, 0x03, 0x15, 0x02, 0x03, 0x01, 0x03, 0x02, 0x11, 0x03,
+  0x02, 0x01, 0x02, 0x03, 0x12, 0x03, 0x01, 0x01, 0x01, 0x03, 0x16, 0x03,
+  0x18, 0x04, 0x16, 0x03, 0x01, 0x01, 0x01, 0x03, 0x12, 0x03, 0x02, 0x01,
+  0x02, 0x03, 0x11, 0x02, 0x03, 0x01, 0x03, 0x02, 0x15, 0x03, 0x19, 0x03,
+  0x1A, 0x01, 0x7D, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x1B, 0x01,
+  0x1B, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x13, 0x11, 0x13, 0x01, 0x1B, 0x01,
+  0x1B, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x1B, 0x01,
+  0xFF, 0x00, 0xFF, 0x00, 0x3E, 0x03, 0x18, 0x05, 0x17, 0x05, 0x1B, 0x01,
+  0x1B, 0x01, 0x1A, 0x01, 0x1A, 0x01, 0x19, 0x02, 0xFF, 0x00, 0x93, 0x08,
+  0x14, 0x08, 0x14, 0x08, 0xFF, 0x00, 0xFF, 0x00, 0x3E, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x2D, 0x01, 0x1A, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x1A, 0x01,
+  0x1B, 0x01, 0x1B, 0x01, 0x1A, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x1A, 0x01,
+  0x1B, 0x01, 0x1A, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x1A, 0x01, 0x1B, 0x01,
+  0x1B, 0x01, 0x1A, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x1A, 0x01, 0x44, 0x04,
+  0x16, 0x02, 0x03, 0x02, 0x14, 0x02, 0x05, 0x02, 0x13, 0x02, 0x05, 0x02,
+  0x12, 0x03, 0x05, 0x03, 0x11, 0x02, 0x07, 0x02, 0x10, 0x03, 0x07, 0x03,
+  0x0F, 0x03, 0x07, 0x03, 0x0F, 0x03, 0x07, 0x03, 0x0F, 0x03, 0x07, 0x03,
+  0x0F, 0x03, 0x07, 0x03, 0x0F, 0x03, 0x07, 0x03, 0x0F, 0x03, 0x07, 0x03,
+  0x0F, 0x03, 0x07, 0x03, 0x0F, 0x03, 0x07, 0x03, 0x10, 0x02, 0x07, 0x02,
+  0x11, 0x03, 0x05, 0x03, 0x12, 0x02, 0x05, 0x02, 0x13, 0x02, 0x05, 0x02,
+  0x14, 0x02, 0x03, 0x02, 0x16, 0x04, 0x45, 0x02, 0x17, 0x05, 0x16, 0x06,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x16, 0x09,
+  0x43, 0x05, 0x15, 0x09, 0x12, 0x02, 0x05, 0x04, 0x11, 0x01, 0x07, 0x04,
+  0x0F, 0x01, 0x09, 0x03, 0x0F, 0x01, 0x09, 0x03, 0x19, 0x03, 0x19, 0x02,
+  0x1A, 0x02, 0x19, 0x02, 0x1A, 0x02, 0x19, 0x02, 0x1A, 0x01, 0x1A, 0x01,
+  0x1A, 0x01, 0x1A, 0x02, 0x19, 0x02, 0x19, 0x02, 0x08, 0x01, 0x10, 0x02,
+  0x08, 0x02, 0x0F, 0x0C, 0x0F, 0x0D, 0x42, 0x05, 0x16, 0x08, 0x13, 0x02,
+  0x04, 0x04, 0x11, 0x01, 0x07, 0x03, 0x1A, 0x02, 0x1A, 0x02, 0x1A, 0x01,
+  0x1A, 0x01, 0x1A, 0x01, 0x1A, 0x04, 0x16, 0x07, 0x18, 0x04, 0x1A, 0x03,
+  0x19, 0x03, 0x1A, 0x02, 0x1A, 0x02, 0x1A, 0x02, 0x1A, 0x01, 0x11, 0x03,
+  0x06, 0x01, 0x12, 0x04, 0x04, 0x01, 0x14, 0x07, 0x48, 0x02, 0x19, 0x03,
+  0x18, 0x04, 0x18, 0x04, 0x17, 0x01, 0x01, 0x03, 0x17, 0x01, 0x01, 0x03,
+  0x16, 0x01, 0x02, 0x03, 0x15, 0x01, 0x03, 0x03, 0x15, 0x01, 0x03, 0x03,
+  0x14, 0x01, 0x04, 0x03, 0x13, 0x01, 0x05, 0x03, 0x13, 0x01, 0x05, 0x03,
+  0x12, 0x01, 0x06, 0x03, 0x11, 0x02, 0x06, 0x03, 0x11, 0x0E, 0x0E, 0x0E,
+  0x16, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x44, 0x07,
+  0x14, 0x07, 0x15, 0x07, 0x14, 0x02, 0x1A, 0x01, 0x1A, 0x04, 0x18, 0x07,
+  0x14, 0x09, 0x17, 0x06, 0x18, 0x04, 0x19, 0x04, 0x19, 0x03, 0x1A, 0x02,
+  0x1A, 0x02, 0x1A, 0x02, 0x1A, 0x02, 0x1A, 0x01, 0x1A, 0x02, 0x12, 0x02,
+  0x05, 0x02, 0x13, 0x08, 0x15, 0x05, 0x48, 0x04, 0x16, 0x03, 0x17, 0x03,
+  0x18, 0x03, 0x18, 0x03, 0x18, 0x03, 0x19, 0x02, 0x19, 0x03, 0x19, 0x02,
+  0x02, 0x05, 0x12, 0x05, 0x03, 0x03, 0x11, 0x03, 0x06, 0x03, 0x10, 0x03,
+  0x06, 0x04, 0x0F, 0x03, 0x07, 0x03, 0x0F, 0x03, 0x07, 0x03, 0x0F, 0x03,
+  0x07, 0x03, 0x0F, 0x03, 0x07, 0x03, 0x10, 0x02, 0x07, 0x03, 0x10, 0x03,
+  0x06, 0x02, 0x12, 0x02, 0x05, 0x02, 0x14, 0x02, 0x03, 0x03, 0x15, 0x05,
+  0x41, 0x0C, 0x0F, 0x0D, 0x0F, 0x0C, 0x10, 0x01, 0x09, 0x02, 0x0F, 0x01,
+  0x09, 0x03, 0x0F, 0x01, 0x09, 0x02, 0x1A, 0x02, 0x19, 0x03, 0x19, 0x02,
+  0x1A, 0x02, 0x19, 0x03, 0x19, 0x02, 0x1A, 0x02, 0x19, 0x03, 0x19, 0x02,
+  0x1A, 0x02, 0x19, 0x03, 0x19, 0x02, 0x1A, 0x02, 0x19, 0x03, 0x19, 0x02,
+  0x43, 0x06, 0x15, 0x02, 0x04, 0x03, 0x12, 0x02, 0x06, 0x02, 0x11, 0x03,
+  0x06, 0x03, 0x10, 0x03, 0x06, 0x03, 0x10, 0x03, 0x06, 0x03, 0x10, 0x04,
+  0x04, 0x03, 0x12, 0x04, 0x03, 0x02, 0x14, 0x04, 0x01, 0x02, 0x16, 0x05,
+  0x18, 0x05, 0x16, 0x01, 0x01, 0x05, 0x14, 0x02, 0x02, 0x05, 0x12, 0x02,
+  0x04, 0x04, 0x11, 0x03, 0x05, 0x04, 0x10, 0x03, 0x06, 0x03, 0x10, 0x03,
+  0x06, 0x03, 0x10, 0x03, 0x06, 0x03, 0x11, 0x03, 0x05, 0x02, 0x13, 0x03,
+  0x03, 0x02, 0x15, 0x06, 0x43, 0x05, 0x16, 0x02, 0x03, 0x03, 0x13, 0x02,
+  0x05, 0x03, 0x11, 0x02, 0x07, 0x03, 0x0F, 0x03, 0x07, 0x03, 0x0F, 0x03,
+  0x08, 0x03, 0x0E, 0x03, 0x08, 0x03, 0x0E, 0x03, 0x08, 0x03, 0x0E, 0x03,
+  0x08, 0x03, 0x0E, 0x04, 0x07, 0x03, 0x0F, 0x03, 0x07, 0x03, 0x10, 0x03,
+  0x05, 0x04, 0x11, 0x07, 0x01, 0x02, 0x19, 0x03, 0x18, 0x03, 0x19, 0x02,
+  0x19, 0x03, 0x18, 0x03, 0x18, 0x02, 0x17, 0x04, 0x15, 0x04, 0xFF, 0x00,
+  0x09, 0x03, 0x19, 0x03, 0x19, 0x03, 0xF9, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0xFF, 0x00, 0x08, 0x03, 0x19, 0x03, 0x19, 0x03, 0xFA, 0x03, 0x18, 0x05,
+  0x17, 0x05, 0x1B, 0x01, 0x1B, 0x01, 0x1A, 0x01, 0x1A, 0x01, 0x19, 0x02,
+  0xA2, 0x01, 0x18, 0x03, 0x17, 0x02, 0x17, 0x03, 0x17, 0x02, 0x18, 0x02,
+  0x17, 0x03, 0x18, 0x01, 0x1C, 0x03, 0x1C, 0x02, 0x1C, 0x02, 0x1C, 0x03,
+  0x1C, 0x02, 0x1C, 0x03, 0x1C, 0x01, 0xFF, 0x00, 0x03, 0x10, 0x7C, 0x10,
+  0x91, 0x01, 0x1C, 0x03, 0x1C, 0x02, 0x1C, 0x03, 0x1C, 0x02, 0x1C, 0x02,
+  0x1C, 0x03, 0x1C, 0x01, 0x18, 0x03, 0x17, 0x02, 0x18, 0x02, 0x17, 0x03,
+  0x17, 0x02, 0x17, 0x03, 0x18, 0x01, 0x43, 0x05, 0x15, 0x02, 0x03, 0x04,
+  0x13, 0x01, 0x05, 0x03, 0x12, 0x02, 0x06, 0x03, 0x11, 0x03, 0x05, 0x03,
+  0x11, 0x03, 0x05, 0x03, 0x12, 0x02, 0x05, 0x03, 0x19, 0x02, 0x19, 0x03,
+  0x19, 0x02, 0x19, 0x02, 0x1A, 0x01, 0x1B, 0x01, 0x1A, 0x01, 0x1B, 0x01,
+  0x1B, 0x01, 0x52, 0x03, 0x19, 0x03, 0x19, 0x03, 0x27, 0x08, 0x11, 0x03,
+  0x07, 0x03, 0x0E, 0x02, 0x0B, 0x02, 0x0B, 0x02, 0x0F, 0x01, 0x09, 0x02,
+  0x11, 0x01, 0x07, 0x02, 0x13, 0x01, 0x06, 0x01, 0x14, 0x01, 0x05, 0x01,
+  0x0A, 0x04, 0x03, 0x02, 0x02, 0x02, 0x04, 0x01, 0x09, 0x02, 0x03, 0x04,
+  0x04, 0x01, 0x03, 0x01, 0x08, 0x03, 0x05, 0x03, 0x04, 0x01, 0x03, 0x01,
+  0x07, 0x03, 0x06, 0x03, 0x04, 0x01, 0x03, 0x01, 0x07, 0x02, 0x07, 0x02,
+  0x05, 0x01, 0x02, 0x01, 0x07, 0x03, 0x07, 0x02, 0x05, 0x01, 0x02, 0x01,
+  0x06, 0x03, 0x07, 0x03, 0x05, 0x01, 0x02, 0x01, 0x06, 0x03, 0x07, 0x02,
+  0x05, 0x01, 0x03, 0x01, 0x05, 0x03, 0x07, 0x03, 0x05, 0x01, 0x03, 0x01,
+  0x05, 0x03, 0x06, 0x04, 0x05, 0x01, 0x03, 0x01, 0x05, 0x03, 0x06, 0x03,
+  0x05, 0x01, 0x04, 0x01, 0x05, 0x03, 0x05, 0x04, 0x05, 0x01, 0x04, 0x01,
+  0x05, 0x04, 0x02, 0x02, 0x01, 0x03, 0x04, 0x01, 0x06, 0x01, 0x05, 0x05,
+  0x03, 0x03, 0x03, 0x01, 0x04, 0x01, 0x02, 0x01, 0x05, 0x04, 0x05, 0x05,
+  0x04, 0x01, 0x03, 0x01, 0x17, 0x01, 0x04, 0x01, 0x15, 0x01, 0x06, 0x01,
+  0x13, 0x01, 0x07, 0x02, 0x11, 0x01, 0x09, 0x02, 0x0F, 0x01, 0x0C, 0x01,
+  0x0D, 0x01, 0x0E, 0x03, 0x07, 0x03, 0x46, 0x01, 0x1A, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x18, 0x01, 0x01, 0x03, 0x17, 0x01, 0x01, 0x03, 0x16, 0x01,
+  0x03, 0x03, 0x15, 0x01, 0x03, 0x03, 0x15, 0x01, 0x03, 0x04, 0x13, 0x01,
+  0x05, 0x03, 0x13, 0x01, 0x05, 0x03, 0x12, 0x01, 0x07, 0x03, 0x11, 0x01,
+  0x07, 0x03, 0x11, 0x0C, 0x0F, 0x01, 0x09, 0x03, 0x0F, 0x01, 0x09, 0x03,
+  0x0E, 0x01, 0x0B, 0x03, 0x0D, 0x01, 0x0B, 0x03, 0x0C, 0x02, 0x0C, 0x03,
+  0x0A, 0x03, 0x0B, 0x05, 0x08, 0x06, 0x07, 0x09, 0x3C, 0x0E, 0x10, 0x04,
+  0x06, 0x04, 0x0F, 0x03, 0x08, 0x03, 0x0E, 0x03, 0x08, 0x03, 0x0E, 0x03,
+  0x09, 0x03, 0x0D, 0x03, 0x09, 0x03, 0x0D, 0x03, 0x09, 0x03, 0x0D, 0x03,
+  0x09, 0x03, 0x0D, 0x03, 0x08, 0x03, 0x0E, 0x03, 0x06, 0x04, 0x0F, 0x0B,
+  0x11, 0x03, 0x06, 0x05, 0x0E, 0x03, 0x08, 0x04, 0x0D, 0x03, 0x09, 0x04,
+  0x0C, 0x03, 0x0A, 0x03, 0x0C, 0x03, 0x0A, 0x03, 0x0C, 0x03, 0x0A, 0x03,
+  0x0C, 0x03, 0x0A, 0x03, 0x0C, 0x03, 0x09, 0x03, 0x0C, 0x04, 0x07, 0x04,
+  0x0B, 0x0F, 0x44, 0x07, 0x03, 0x01, 0x0F, 0x03, 0x05, 0x05, 0x0E, 0x02,
+  0x08, 0x04, 0x0D, 0x02, 0x0A, 0x03, 0x0C, 0x02, 0x0C, 0x02, 0x0B, 0x03,
+  0x0C, 0x02, 0x0B, 0x03, 0x0D, 0x01, 0x0A, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x1A, 0x02, 0x1A, 0x03,
+  0x1A, 0x02, 0x0E, 0x01, 0x0B, 0x03, 0x0C, 0x01, 0x0D, 0x03, 0x0A, 0x01,
+  0x10, 0x03, 0x06, 0x02, 0x13, 0x07, 0x3B, 0x0F, 0x0F, 0x04, 0x07, 0x04,
+  0x0E, 0x03, 0x09, 0x04, 0x0C, 0x03, 0x0A, 0x04, 0x0B, 0x03, 0x0B, 0x03,
+  0x0B, 0x03, 0x0C, 0x03, 0x0A, 0x03, 0x0C, 0x03, 0x0A, 0x03, 0x0D, 0x03,
+  0x09, 0x03, 0x0D, 0x03, 0x09, 0x03, 0x0D, 0x03, 0x09, 0x03, 0x0D, 0x03,
+  0x09, 0x03, 0x0D, 0x03, 0x09, 0x03, 0x0D, 0x03, 0x09, 0x03, 0x0D, 0x03,
+  0x09, 0x03, 0x0C, 0x03, 0x0A, 0x03, 0x0C, 0x03, 0x0A, 0x03, 0x0B, 0x03,
+  0x0B, 0x03, 0x0A, 0x03, 0x0C, 0x03, 0x09, 0x03, 0x0C, 0x04, 0x07, 0x04,
+  0x0B, 0x0E, 0x3C, 0x11, 0x0D, 0x04, 0x08, 0x03, 0x0E, 0x03, 0x09, 0x02,
+  0x0E, 0x03, 0x0A, 0x01, 0x0E, 0x03, 0x0A, 0x01, 0x0E, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x07, 0x01, 0x11, 0x03, 0x07, 0x01, 0x11, 0x03, 0x06, 0x02,
+  0x11, 0x0B, 0x11, 0x03, 0x06, 0x02, 0x11, 0x03, 0x07, 0x01, 0x11, 0x03,
+  0x07, 0x01, 0x11, 0x03, 0x19, 0x03, 0x19, 0x03, 0x0C, 0x01, 0x0C, 0x03,
+  0x0B, 0x01, 0x0D, 0x03, 0x0A, 0x02, 0x0C, 0x04, 0x09, 0x03, 0x0A, 0x11,
+  0x3D, 0x10, 0x0E, 0x04, 0x08, 0x02, 0x0F, 0x03, 0x09, 0x01, 0x0F, 0x03,
+  0x09, 0x01, 0x0F, 0x03, 0x09, 0x01, 0x0F, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x06, 0x01, 0x12, 0x03, 0x06, 0x01, 0x12, 0x03, 0x05, 0x02, 0x12, 0x0A,
+  0x12, 0x03, 0x05, 0x02, 0x12, 0x03, 0x06, 0x01, 0x12, 0x03, 0x06, 0x01,
+  0x12, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x18, 0x05,
+  0x15, 0x09, 0x44, 0x07, 0x03, 0x01, 0x0E, 0x03, 0x06, 0x05, 0x0D, 0x02,
+  0x09, 0x04, 0x0C, 0x02, 0x0B, 0x03, 0x0B, 0x02, 0x0D, 0x02, 0x0A, 0x03,
+  0x0D, 0x02, 0x0A, 0x03, 0x0E, 0x01, 0x0A, 0x02, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x0A, 0x09, 0x06, 0x03, 0x0C, 0x05, 0x08, 0x03, 0x0D, 0x03,
+  0x09, 0x03, 0x0D, 0x03, 0x0A, 0x03, 0x0C, 0x03, 0x0A, 0x03, 0x0C, 0x03,
+  0x0B, 0x03, 0x0B, 0x03, 0x0C, 0x03, 0x0A, 0x03, 0x0D, 0x03, 0x09, 0x03,
+  0x0E, 0x04, 0x06, 0x04, 0x11, 0x08, 0x3B, 0x09, 0x05, 0x09, 0x07, 0x05,
+  0x09, 0x05, 0x0A, 0x03, 0x0B, 0x03, 0x0B, 0x03, 0x0B, 0x03, 0x0B, 0x03,
+  0x0B, 0x03, 0x0B, 0x03, 0x0B, 0x03, 0x0B, 0x03, 0x0B, 0x03, 0x0B, 0x03,
+  0x0B, 0x03, 0x0B, 0x03, 0x0B, 0x03, 0x0B, 0x03, 0x0B, 0x03, 0x0B, 0x11,
+  0x0B, 0x03, 0x0B, 0x03, 0x0B, 0x03, 0x0B, 0x03, 0x0B, 0x03, 0x0B, 0x03,
+  0x0B, 0x03, 0x0B, 0x03, 0x0B, 0x03, 0x0B, 0x03, 0x0B, 0x03, 0x0B, 0x03,
+  0x0B, 0x03, 0x0B, 0x03, 0x0B, 0x03, 0x0B, 0x03, 0x0A, 0x05, 0x09, 0x05,
+  0x07, 0x09, 0x05, 0x09, 0x42, 0x09, 0x15, 0x05, 0x18, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x18, 0x05, 0x15, 0x09, 0x44, 0x09,
+  0x15, 0x05, 0x18, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x13, 0x03, 0x03, 0x02,
+  0x14, 0x03, 0x03, 0x02, 0x14, 0x04, 0x02, 0x01, 0x16, 0x05, 0x3B, 0x09,
+  0x04, 0x07, 0x0A, 0x05, 0x08, 0x03, 0x0D, 0x03, 0x09, 0x01, 0x0F, 0x03,
+  0x08, 0x01, 0x10, 0x03, 0x07, 0x01, 0x11, 0x03, 0x06, 0x01, 0x12, 0x03,
+  0x05, 0x01, 0x13, 0x03, 0x04, 0x01, 0x14, 0x03, 0x03, 0x01, 0x15, 0x03,
+  0x01, 0x02, 0x16, 0x06, 0x16, 0x03, 0x01, 0x03, 0x15, 0x03, 0x02, 0x04,
+  0x13, 0x03, 0x03, 0x04, 0x12, 0x03, 0x04, 0x04, 0x11, 0x03, 0x05, 0x04,
+  0x10, 0x03, 0x07, 0x03, 0x0F, 0x03, 0x08, 0x04, 0x0D, 0x03, 0x09, 0x04,
+  0x0B, 0x05, 0x08, 0x05, 0x08, 0x09, 0x04, 0x09, 0x3C, 0x09, 0x15, 0x05,
+  0x18, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x0B, 0x01, 0x0D, 0x03, 0x0A, 0x02, 0x0D, 0x03,
+  0x0A, 0x01, 0x0E, 0x03, 0x09, 0x02, 0x0D, 0x04, 0x08, 0x03, 0x0B, 0x10,
+  0x38, 0x06, 0x10, 0x06, 0x02, 0x04, 0x10, 0x04, 0x05, 0x04, 0x0E, 0x04,
+  0x06, 0x04, 0x0E, 0x04, 0x06, 0x01, 0x01, 0x03, 0x0C, 0x01, 0x01, 0x03,
+  0x06, 0x01, 0x01, 0x03, 0x0C, 0x01, 0x01, 0x03, 0x06, 0x01, 0x02, 0x03,
+  0x0B, 0x01, 0x01, 0x03, 0x06, 0x01, 0x02, 0x03, 0x0A, 0x01, 0x02, 0x03,
+  0x06, 0x01, 0x03, 0x03, 0x09, 0x01, 0x02, 0x03, 0x06, 0x01, 0x03, 0x03,
+  0x08, 0x01, 0x03, 0x03, 0x06, 0x01, 0x04, 0x03, 0x07, 0x01, 0x03, 0x03,
+  0x06, 0x01, 0x04, 0x03, 0x06, 0x01, 0x04, 0x03, 0x06, 0x01, 0x05, 0x03,
+  0x05, 0x01, 0x04, 0x03, 0x06, 0x01, 0x05, 0x03, 0x04, 0x01, 0x05, 0x03,
+  0x06, 0x01, 0x06, 0x03, 0x03, 0x01, 0x05, 0x03, 0x06, 0x01, 0x06, 0x03,
+  0x02, 0x01, 0x06, 0x03, 0x06, 0x01, 0x07, 0x03, 0x01, 0x01, 0x06, 0x03,
+  0x06, 0x01, 0x07, 0x03, 0x01, 0x01, 0x06, 0x03, 0x06, 0x01, 0x08, 0x03,
+  0x07, 0x03, 0x05, 0x03, 0x07, 0x03, 0x06, 0x05, 0x02, 0x07, 0x06, 0x01,
+  0x05, 0x09, 0x3B, 0x05, 0x0B, 0x07, 0x07, 0x04, 0x0C, 0x03, 0x0B, 0x03,
+  0x0C, 0x01, 0x0C, 0x03, 0x0C, 0x01, 0x0C, 0x04, 0x0B, 0x01, 0x0C, 0x01,
+  0x01, 0x03, 0x0A, 0x01, 0x0C, 0x01, 0x02, 0x03, 0x09, 0x01, 0x0C, 0x01,
+  0x03, 0x03, 0x08, 0x01, 0x0C, 0x01, 0x04, 0x03, 0x07, 0x01, 0x0C, 0x01,
+  0x05, 0x02, 0x07, 0x01, 0x0C, 0x01, 0x05, 0x03, 0x06, 0x01, 0x0C, 0x01,
+  0x06, 0x03, 0x05, 0x01, 0x0C, 0x01, 0x07, 0x03, 0x04, 0x01, 0x0C, 0x01,
+  0x08, 0x03, 0x03, 0x01, 0x0C, 0x01, 0x09, 0x03, 0x02, 0x01, 0x0C, 0x01,
+  0x0A, 0x02, 0x02, 0x01, 0x0C, 0x01, 0x0A, 0x03, 0x01, 0x01, 0x0C, 0x01,
+  0x0B, 0x04, 0x0C, 0x01, 0x0C, 0x03, 0x0B, 0x03, 0x0C, 0x02, 0x09, 0x07,
+  0x0B, 0x01, 0x43, 0x07, 0x13, 0x03, 0x05, 0x03, 0x10, 0x02, 0x09, 0x02,
+  0x0E, 0x02, 0x0B, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0A, 0x03, 0x0D, 0x03,
+  0x09, 0x02, 0x0E, 0x03, 0x08, 0x03, 0x0F, 0x03, 0x07, 0x03, 0x0F, 0x03,
+  0x07, 0x03, 0x0F, 0x03, 0x07, 0x03, 0x0F, 0x03, 0x07, 0x03, 0x0F, 0x03,
+  0x07, 0x03, 0x0F, 0x03, 0x07, 0x03, 0x0F, 0x03, 0x08, 0x03, 0x0E, 0x02,
+  0x09, 0x03, 0x0D, 0x03, 0x0A, 0x02, 0x0D, 0x02, 0x0B, 0x03, 0x0B, 0x02,
+  0x0E, 0x02, 0x09, 0x02, 0x10, 0x03, 0x05, 0x03, 0x13, 0x07, 0x3D, 0x0D,
+  0x11, 0x04, 0x05, 0x04, 0x10, 0x03, 0x07, 0x03, 0x0F, 0x03, 0x07, 0x03,
+  0x0F, 0x03, 0x08, 0x03, 0x0E, 0x03, 0x08, 0x03, 0x0E, 0x03, 0x08, 0x03,
+  0x0E, 0x03, 0x08, 0x03, 0x0E, 0x03, 0x07, 0x04, 0x0E, 0x03, 0x07, 0x03,
+  0x0F, 0x03, 0x05, 0x04, 0x10, 0x0A, 0x12, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x18, 0x05, 0x15, 0x09,
+  0x43, 0x07, 0x13, 0x03, 0x05, 0x03, 0x10, 0x02, 0x09, 0x02, 0x0E, 0x02,
+  0x0B, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0A, 0x03, 0x0D, 0x03, 0x09, 0x02,
+  0x0E, 0x03, 0x08, 0x03, 0x0F, 0x03, 0x07, 0x03, 0x0F, 0x03, 0x07, 0x03,
+  0x0F, 0x03, 0x07, 0x03, 0x0F, 0x03, 0x07, 0x03, 0x0F, 0x03, 0x07, 0x03,
+  0x0F, 0x03, 0x07, 0x03, 0x0F, 0x03, 0x08, 0x03, 0x0E, 0x02, 0x09, 0x03,
+  0x0D, 0x03, 0x0A, 0x02, 0x0D, 0x02, 0x0B, 0x03, 0x0B, 0x03, 0x0C, 0x03,
+  0x09, 0x03, 0x0F, 0x03, 0x05, 0x03, 0x13, 0x07, 0x17, 0x04, 0x19, 0x04,
+  0x19, 0x04, 0x1A, 0x03, 0x1B, 0x03, 0x1C, 0x03, 0x3C, 0x0D, 0x11, 0x05,
+  0x04, 0x04, 0x10, 0x03, 0x07, 0x03, 0x0F, 0x03, 0x08, 0x03, 0x0E, 0x03,
+  0x08, 0x03, 0x0E, 0x03, 0x08, 0x03, 0x0E, 0x03, 0x08, 0x03, 0x0E, 0x03,
+  0x07, 0x04, 0x0E, 0x03, 0x07, 0x03, 0x0F, 0x03, 0x05, 0x04, 0x10, 0x09,
+  0x13, 0x03, 0x03, 0x03, 0x13, 0x03, 0x03, 0x04, 0x12, 0x03, 0x04, 0x04,
+  0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x06, 0x03, 0x10, 0x03, 0x06, 0x04,
+  0x0F, 0x03, 0x07, 0x04, 0x0E, 0x03, 0x08, 0x04, 0x0C, 0x05, 0x08, 0x04,
+  0x09, 0x09, 0x06, 0x06, 0x42, 0x06, 0x03, 0x01, 0x11, 0x03, 0x04, 0x04,
+  0x10, 0x03, 0x06, 0x03, 0x0F, 0x03, 0x08, 0x02, 0x0F, 0x03, 0x08, 0x02,
+  0x0F, 0x03, 0x09, 0x01, 0x0F, 0x04, 0x08, 0x01, 0x10, 0x05, 0x18, 0x05,
+  0x19, 0x05, 0x18, 0x06, 0x18, 0x05, 0x19, 0x04, 0x19, 0x04, 0x0E, 0x01,
+  0x0A, 0x03, 0x0E, 0x01, 0x0A, 0x03, 0x0E, 0x02, 0x09, 0x03, 0x0E, 0x02,
+  0x09, 0x03, 0x0E, 0x03, 0x07, 0x03, 0x0F, 0x05, 0x04, 0x03, 0x10, 0x01,
+  0x03, 0x06, 0x3D, 0x11, 0x0B, 0x02, 0x05, 0x03, 0x05, 0x02, 0x0B, 0x02,
+  0x05, 0x03, 0x05, 0x02, 0x0B, 0x01, 0x06, 0x03, 0x06, 0x01, 0x0B, 0x01,
+  0x06, 0x03, 0x06, 0x01, 0x12, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x18, 0x05, 0x15, 0x09,
+  0x3B, 0x09, 0x06, 0x07, 0x08, 0x05, 0x0A, 0x03, 0x0B, 0x03, 0x0C, 0x01,
+  0x0C, 0x03, 0x0C, 0x01, 0x0C, 0x03, 0x0C, 0x01, 0x0C, 0x03, 0x0C, 0x01,
+  0x0C, 0x03, 0x0C, 0x01, 0x0C, 0x03, 0x0C, 0x01, 0x0C, 0x03, 0x0C, 0x01,
+  0x0C, 0x03, 0x0C, 0x01, 0x0C, 0x03, 0x0C, 0x01, 0x0C, 0x03, 0x0C, 0x01,
+  0x0C, 0x03, 0x0C, 0x01, 0x0C, 0x03, 0x0C, 0x01, 0x0C, 0x03, 0x0C, 0x01,
+  0x0C, 0x03, 0x0C, 0x01, 0x0C, 0x03, 0x0C, 0x01, 0x0D, 0x03, 0x0A, 0x01,
+  0x0F, 0x02, 0x09, 0x01, 0x11, 0x03, 0x05, 0x02, 0x13, 0x08, 0x3B, 0x09,
+  0x06, 0x07, 0x08, 0x05, 0x0A, 0x03, 0x0B, 0x03, 0x0C, 0x01, 0x0D, 0x02,
+  0x0B, 0x01, 0x0E, 0x03, 0x0A, 0x01, 0x0F, 0x02, 0x0A, 0x01, 0x0F, 0x03,
+  0x08, 0x01, 0x10, 0x03, 0x08, 0x01, 0x11, 0x03, 0x07, 0x01, 0x11, 0x03,
+  0x06, 0x01, 0x13, 0x03, 0x05, 0x01, 0x13, 0x03, 0x05, 0x01, 0x14, 0x02,
+  0x04, 0x01, 0x15, 0x03, 0x03, 0x01, 0x15, 0x03, 0x02, 0x01, 0x17, 0x03,
+  0x01, 0x01, 0x17, 0x03, 0x01, 0x01, 0x18, 0x03, 0x19, 0x03, 0x1A, 0x02,
+  0x1A, 0x01, 0x38, 0x07, 0x02, 0x09, 0x04, 0x06, 0x02, 0x04, 0x05, 0x05,
+  0x08, 0x03, 0x03, 0x03, 0x07, 0x03, 0x0A, 0x01, 0x05, 0x03, 0x07, 0x03,
+  0x08, 0x01, 0x06, 0x03, 0x07, 0x03, 0x08, 0x01, 0x06, 0x03, 0x07, 0x03,
+  0x08, 0x01, 0x07, 0x03, 0x06, 0x04, 0x06, 0x01, 0x08, 0x03, 0x06, 0x04,
+  0x06, 0x01, 0x09, 0x02, 0x06, 0x04, 0x06, 0x01, 0x09, 0x03, 0x05, 0x01,
+  0x01, 0x03, 0x04, 0x01, 0x0A, 0x03, 0x04, 0x01, 0x02, 0x03, 0x04, 0x01,
+  0x0B, 0x03, 0x03, 0x01, 0x02, 0x04, 0x03, 0x01, 0x0B, 0x03, 0x03, 0x01,
+  0x03, 0x03, 0x02, 0x02, 0x0B, 0x03, 0x02, 0x01, 0x04, 0x03, 0x02, 0x01,
+  0x0D, 0x03, 0x01, 0x01, 0x05, 0x03, 0x01, 0x01, 0x0D, 0x03, 0x01, 0x01,
+  0x05, 0x03, 0x01, 0x01, 0x0D, 0x04, 0x06, 0x04, 0x0F, 0x03, 0x07, 0x03,
+  0x0F, 0x03, 0x07, 0x03, 0x10, 0x02, 0x07, 0x02, 0x11, 0x01, 0x09, 0x01,
+  0x3B, 0x0A, 0x05, 0x07, 0x09, 0x05, 0x09, 0x03, 0x0C, 0x04, 0x09, 0x02,
+  0x0E, 0x03, 0x08, 0x02, 0x10, 0x03, 0x07, 0x01, 0x11, 0x04, 0x05, 0x01,
+  0x13, 0x03, 0x04, 0x01, 0x15, 0x03, 0x02, 0x01, 0x17, 0x04, 0x18, 0x04,
+  0x19, 0x03, 0x19, 0x04, 0x17, 0x01, 0x01, 0x04, 0x15, 0x01, 0x03, 0x03,
+  0x14, 0x01, 0x05, 0x03, 0x12, 0x01, 0x07, 0x03, 0x10, 0x01, 0x08, 0x03,
+  0x0F, 0x02, 0x09, 0x03, 0x0D, 0x02, 0x0B, 0x03, 0x0B, 0x03, 0x0A, 0x05,
+  0x08, 0x07, 0x07, 0x08, 0x3C, 0x08, 0x06, 0x07, 0x09, 0x04, 0x0A, 0x03,
+  0x0C, 0x03, 0x0A, 0x02, 0x0E, 0x03, 0x09, 0x01, 0x0F, 0x03, 0x08, 0x01,
+  0x11, 0x03, 0x07, 0x01, 0x12, 0x03, 0x05, 0x01, 0x13, 0x03, 0x04, 0x01,
+  0x15, 0x03, 0x03, 0x01, 0x16, 0x03, 0x01, 0x01, 0x17, 0x03, 0x01, 0x01,
+  0x18, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x18, 0x05, 0x15, 0x09, 0x3F, 0x0E, 0x0E, 0x02,
+  0x08, 0x03, 0x0F, 0x01, 0x09, 0x03, 0x0E, 0x01, 0x09, 0x03, 0x0F, 0x01,
+  0x08, 0x03, 0x18, 0x03, 0x19, 0x03, 0x18, 0x03, 0x18, 0x03, 0x19, 0x03,
+  0x18, 0x03, 0x18, 0x03, 0x19, 0x03, 0x18, 0x03, 0x18, 0x03, 0x19, 0x03,
+  0x18, 0x03, 0x0B, 0x01, 0x0C, 0x03, 0x0B, 0x02, 0x0B, 0x03, 0x0C, 0x01,
+  0x0C, 0x03, 0x0B, 0x02, 0x0B, 0x11, 0x44, 0x07, 0x15, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x07,
+  0x26, 0x01, 0x1B, 0x01, 0x1C, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x1C, 0x01,
+  0x1B, 0x01, 0x1B, 0x01, 0x1C, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x1C, 0x01,
+  0x1B, 0x01, 0x1B, 0x01, 0x1C, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x1C, 0x01,
+  0x1B, 0x01, 0x1B, 0x01, 0x1C, 0x01, 0x1B, 0x01, 0x42, 0x07, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x15, 0x07, 0x45, 0x02, 0x19, 0x01, 0x02, 0x01, 0x18, 0x01, 0x02, 0x01,
+  0x17, 0x01, 0x04, 0x01, 0x16, 0x01, 0x04, 0x01, 0x15, 0x01, 0x06, 0x01,
+  0x13, 0x01, 0x08, 0x01, 0x12, 0x01, 0x08, 0x01, 0x11, 0x01, 0x0A, 0x01,
+  0x10, 0x01, 0x0A, 0x01, 0x0F, 0x01, 0x0C, 0x01, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0x35, 0x10, 0x43, 0x03, 0x1A, 0x03, 0x1A, 0x02, 0x1B, 0x01,
+  0x1C, 0x01, 0xFF, 0x00, 0x08, 0x06, 0x15, 0x02, 0x03, 0x03, 0x13, 0x03,
+  0x04, 0x03, 0x12, 0x03, 0x04, 0x03, 0x12, 0x03, 0x04, 0x03, 0x18, 0x04,
+  0x15, 0x03, 0x01, 0x03, 0x13, 0x03, 0x03, 0x03, 0x12, 0x02, 0x05, 0x03,
+  0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x04, 0x03, 0x04,
+  0x01, 0x01, 0x10, 0x06, 0x01, 0x04, 0x12, 0x03, 0x04, 0x02, 0x25, 0x02,
+  0x18, 0x04, 0x17, 0x05, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x02, 0x05, 0x12, 0x03, 0x01, 0x07, 0x11, 0x04,
+  0x04, 0x04, 0x10, 0x03, 0x06, 0x03, 0x10, 0x03, 0x07, 0x03, 0x0F, 0x03,
+  0x07, 0x03, 0x0F, 0x03, 0x07, 0x03, 0x0F, 0x03, 0x07, 0x03, 0x0F, 0x03,
+  0x07, 0x03, 0x0F, 0x03, 0x07, 0x02, 0x10, 0x03, 0x06, 0x03, 0x10, 0x03,
+  0x06, 0x02, 0x11, 0x04, 0x04, 0x02, 0x14, 0x06, 0xFF, 0x00, 0x09, 0x05,
+  0x15, 0x02, 0x03, 0x03, 0x13, 0x02, 0x05, 0x03, 0x12, 0x02, 0x05, 0x03,
+  0x11, 0x02, 0x07, 0x02, 0x11, 0x02, 0x1A, 0x02, 0x1A, 0x03, 0x08, 0x01,
+  0x10, 0x03, 0x07, 0x02, 0x10, 0x04, 0x06, 0x01, 0x12, 0x04, 0x04, 0x02,
+  0x12, 0x0A, 0x13, 0x08, 0x16, 0x04, 0x2E, 0x02, 0x18, 0x04, 0x17, 0x05,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x13, 0x05,
+  0x01, 0x03, 0x12, 0x02, 0x03, 0x05, 0x11, 0x02, 0x05, 0x04, 0x10, 0x02,
+  0x07, 0x03, 0x10, 0x02, 0x07, 0x03, 0x0F, 0x03, 0x07, 0x03, 0x0F, 0x03,
+  0x07, 0x03, 0x0F, 0x03, 0x07, 0x03, 0x0F, 0x03, 0x07, 0x03, 0x0F, 0x04,
+  0x06, 0x03, 0x10, 0x03, 0x06, 0x03, 0x10, 0x05, 0x03, 0x06, 0x0F, 0x07,
+  0x01, 0x04, 0x12, 0x04, 0x02, 0x02, 0xFF, 0x00, 0x09, 0x05, 0x15, 0x02,
+  0x04, 0x03, 0x12, 0x02, 0x06, 0x02, 0x12, 0x01, 0x07, 0x03, 0x10, 0x0C,
+  0x10, 0x02, 0x1A, 0x02, 0x1A, 0x02, 0x1A, 0x03, 0x08, 0x01, 0x10, 0x04,
+  0x06, 0x02, 0x11, 0x04, 0x04, 0x02, 0x12, 0x0A, 0x13, 0x08, 0x16, 0x05,
+  0x2C, 0x04, 0x16, 0x02, 0x02, 0x04, 0x13, 0x02, 0x04, 0x03, 0x13, 0x02,
+  0x05, 0x02, 0x12, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x16, 0x0A,
+  0x15, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x18, 0x05,
+  0x15, 0x09, 0xFF, 0x00, 0x08, 0x05, 0x16, 0x02, 0x03, 0x06, 0x10, 0x02,
+  0x04, 0x03, 0x12, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03,
+  0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x12, 0x03, 0x04, 0x02, 0x14, 0x02,
+  0x03, 0x03, 0x14, 0x06, 0x15, 0x01, 0x1A, 0x02, 0x1A, 0x0A, 0x13, 0x0B,
+  0x11, 0x01, 0x08, 0x02, 0x10, 0x01, 0x0A, 0x01, 0x10, 0x01, 0x0A, 0x01,
+  0x0F, 0x02, 0x09, 0x01, 0x10, 0x04, 0x06, 0x02, 0x11, 0x0A, 0x14, 0x06,
+  0x25, 0x02, 0x18, 0x04, 0x17, 0x05, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x03, 0x03, 0x13, 0x03, 0x01, 0x06,
+  0x12, 0x04, 0x03, 0x04, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03,
+  0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03,
+  0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03,
+  0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x0F, 0x07, 0x02, 0x06,
+  0x28, 0x03, 0x19, 0x03, 0x19, 0x03, 0xA6, 0x02, 0x18, 0x04, 0x17, 0x05,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x17, 0x07, 0x28, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0xA6, 0x02, 0x18, 0x04, 0x17, 0x05, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x02, 0x14, 0x03, 0x03, 0x02, 0x14, 0x04, 0x02, 0x01,
+  0x16, 0x05, 0x25, 0x02, 0x18, 0x04, 0x17, 0x05, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x04, 0x06, 0x0F, 0x03,
+  0x05, 0x02, 0x12, 0x03, 0x05, 0x01, 0x13, 0x03, 0x03, 0x02, 0x14, 0x03,
+  0x02, 0x01, 0x16, 0x03, 0x01, 0x01, 0x17, 0x06, 0x16, 0x03, 0x01, 0x03,
+  0x15, 0x03, 0x02, 0x03, 0x14, 0x03, 0x03, 0x03, 0x13, 0x03, 0x04, 0x03,
+  0x12, 0x03, 0x04, 0x04, 0x11, 0x03, 0x05, 0x03, 0x0F, 0x07, 0x02, 0x07,
+  0x29, 0x02, 0x18, 0x04, 0x17, 0x05, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x17, 0x07, 0xFF, 0x00, 0x03, 0x02,
+  0x03, 0x03, 0x05, 0x03, 0x0A, 0x04, 0x01, 0x06, 0x02, 0x06, 0x08, 0x05,
+  0x01, 0x01, 0x02, 0x06, 0x02, 0x04, 0x09, 0x04, 0x04, 0x03, 0x05, 0x03,
+  0x09, 0x03, 0x05, 0x03, 0x05, 0x03, 0x09, 0x03, 0x05, 0x03, 0x05, 0x03,
+  0x09, 0x03, 0x05, 0x03, 0x05, 0x03, 0x09, 0x03, 0x05, 0x03, 0x05, 0x03,
+  0x09, 0x03, 0x05, 0x03, 0x05, 0x03, 0x09, 0x03, 0x05, 0x03, 0x05, 0x03,
+  0x09, 0x03, 0x05, 0x03, 0x05, 0x03, 0x09, 0x03, 0x05, 0x03, 0x05, 0x03,
+  0x09, 0x03, 0x05, 0x03, 0x05, 0x03, 0x07, 0x07, 0x01, 0x07, 0x01, 0x07,
+  0xFF, 0x00, 0x06, 0x02, 0x03, 0x03, 0x12, 0x04, 0x01, 0x06, 0x10, 0x07,
+  0x02, 0x04, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03,
+  0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03,
+  0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03,
+  0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x0F, 0x07, 0x02, 0x06, 0xFF, 0x00,
+  0x08, 0x06, 0x15, 0x02, 0x03, 0x04, 0x12, 0x02, 0x05, 0x03, 0x11, 0x02,
+  0x07, 0x03, 0x10, 0x02, 0x08, 0x03, 0x0E, 0x03, 0x08, 0x03, 0x0E, 0x03,
+  0x08, 0x03, 0x0E, 0x03, 0x08, 0x03, 0x0E, 0x03, 0x08, 0x03, 0x0E, 0x04,
+  0x07, 0x02, 0x10, 0x03, 0x07, 0x02, 0x11, 0x03, 0x05, 0x02, 0x12, 0x04,
+  0x03, 0x02, 0x15, 0x06, 0xFF, 0x00, 0x06, 0x02, 0x03, 0x04, 0x11, 0x04,
+  0x01, 0x07, 0x0F, 0x07, 0x03, 0x04, 0x10, 0x03, 0x06, 0x03, 0x10, 0x03,
+  0x06, 0x04, 0x0F, 0x03, 0x07, 0x03, 0x0F, 0x03, 0x07, 0x03, 0x0F, 0x03,
+  0x07, 0x03, 0x0F, 0x03, 0x07, 0x03, 0x0F, 0x03, 0x07, 0x03, 0x0F, 0x03,
+  0x07, 0x02, 0x10, 0x03, 0x06, 0x02, 0x11, 0x04, 0x04, 0x03, 0x11, 0x03,
+  0x01, 0x05, 0x13, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x17, 0x07, 0xFF, 0x00, 0x08, 0x05, 0x02, 0x02, 0x12, 0x02,
+  0x04, 0x04, 0x11, 0x02, 0x06, 0x03, 0x10, 0x03, 0x06, 0x03, 0x10, 0x02,
+  0x07, 0x03, 0x0F, 0x03, 0x07, 0x03, 0x0F, 0x03, 0x07, 0x03, 0x0F, 0x03,
+  0x07, 0x03, 0x0F, 0x03, 0x07, 0x03, 0x0F, 0x04, 0x06, 0x03, 0x10, 0x03,
+  0x06, 0x03, 0x10, 0x04, 0x04, 0x04, 0x11, 0x07, 0x01, 0x03, 0x12, 0x04,
+  0x03, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x17, 0x07, 0xFF, 0x00, 0x09, 0x02, 0x02, 0x03, 0x13, 0x04,
+  0x01, 0x05, 0x11, 0x06, 0x02, 0x03, 0x13, 0x04, 0x18, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x17, 0x07, 0xFF, 0x00, 0x09, 0x03, 0x02, 0x01, 0x15, 0x02,
+  0x02, 0x03, 0x14, 0x02, 0x04, 0x02, 0x14, 0x02, 0x05, 0x01, 0x14, 0x03,
+  0x04, 0x01, 0x14, 0x05, 0x18, 0x06, 0x17, 0x06, 0x18, 0x05, 0x13, 0x01,
+  0x05, 0x03, 0x13, 0x01, 0x06, 0x02, 0x13, 0x02, 0x05, 0x02, 0x13, 0x03,
+  0x03, 0x02, 0x14, 0x01, 0x02, 0x04, 0x7D, 0x01, 0x1A, 0x02, 0x1A, 0x02,
+  0x19, 0x03, 0x18, 0x04, 0x17, 0x08, 0x16, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x03, 0x01, 0x15, 0x06, 0x17, 0x04, 0xFF, 0x00,
+  0x03, 0x05, 0x03, 0x05, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03,
+  0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03,
+  0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03,
+  0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x04, 0x02, 0x07,
+  0x10, 0x06, 0x01, 0x04, 0x12, 0x03, 0x03, 0x02, 0xFF, 0x00, 0x03, 0x06,
+  0x05, 0x04, 0x0E, 0x03, 0x08, 0x02, 0x10, 0x03, 0x07, 0x01, 0x11, 0x03,
+  0x07, 0x01, 0x12, 0x02, 0x06, 0x01, 0x13, 0x03, 0x05, 0x01, 0x14, 0x02,
+  0x04, 0x01, 0x15, 0x03, 0x03, 0x01, 0x16, 0x02, 0x02, 0x01, 0x17, 0x03,
+  0x01, 0x01, 0x17, 0x03, 0x01, 0x01, 0x18, 0x03, 0x19, 0x03, 0x1A, 0x01,
+  0xFF, 0x06, 0x03, 0x06, 0x04, 0x04, 0x06, 0x04, 0x06, 0x03, 0x07, 0x01,
+  0x08, 0x03, 0x06, 0x03, 0x06, 0x01, 0x09, 0x03, 0x07, 0x02, 0x06, 0x01,
+  0x0A, 0x03, 0x06, 0x03, 0x04, 0x01, 0x0B, 0x03, 0x05, 0x04, 0x04, 0x01,
+  0x0C, 0x03, 0x04, 0x01, 0x01, 0x03, 0x03, 0x01, 0x0C, 0x03, 0x03, 0x01,
+  0x02, 0x03, 0x02, 0x01, 0x0D, 0x03, 0x03, 0x01, 0x03, 0x03, 0x01, 0x01,
+  0x0E, 0x03, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01, 0x0E, 0x03, 0x01, 0x01,
+  0x05, 0x03, 0x10, 0x03, 0x06, 0x03, 0x10, 0x03, 0x06, 0x03, 0x11, 0x01,
+  0x08, 0x01, 0xFF, 0x00, 0x03, 0x05, 0x03, 0x07, 0x0F, 0x02, 0x06, 0x03,
+  0x11, 0x03, 0x05, 0x01, 0x14, 0x03, 0x03, 0x01, 0x16, 0x03, 0x01, 0x01,
+  0x18, 0x03, 0x1A, 0x03, 0x19, 0x03, 0x18, 0x01, 0x01, 0x03, 0x16, 0x01,
+  0x03, 0x03, 0x14, 0x01, 0x05, 0x03, 0x12, 0x01, 0x07, 0x03, 0x10, 0x02,
+  0x07, 0x04, 0x0E, 0x05, 0x03, 0x07, 0xFF, 0x00, 0x03, 0x07, 0x04, 0x04,
+  0x0F, 0x04, 0x06, 0x02, 0x10, 0x04, 0x06, 0x01, 0x12, 0x03, 0x06, 0x01,
+  0x12, 0x04, 0x04, 0x01, 0x14, 0x03, 0x04, 0x01, 0x14, 0x03, 0x04, 0x01,
+  0x15, 0x03, 0x02, 0x01, 0x16, 0x03, 0x02, 0x01, 0x17, 0x03, 0x01, 0x01,
+  0x17, 0x04, 0x19, 0x03, 0x19, 0x02, 0x1A, 0x02, 0x1B, 0x01, 0x1A, 0x01,
+  0x1B, 0x01, 0x1B, 0x01, 0x15, 0x03, 0x02, 0x01, 0x16, 0x05, 0x18, 0x03,
+  0xFF, 0x00, 0x05, 0x0C, 0x10, 0x02, 0x06, 0x03, 0x11, 0x01, 0x06, 0x03,
+  0x19, 0x03, 0x18, 0x03, 0x18, 0x03, 0x18, 0x03, 0x19, 0x03, 0x18, 0x03,
+  0x18, 0x03, 0x18, 0x03, 0x19, 0x03, 0x07, 0x01, 0x10, 0x03, 0x07, 0x02,
+  0x0F, 0x0D, 0x49, 0x02, 0x18, 0x02, 0x18, 0x03, 0x19, 0x02, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x04, 0x18, 0x04, 0x19, 0x03, 0x19, 0x03, 0x19, 0x02,
+  0x19, 0x02, 0x19, 0x02, 0x18, 0x02, 0x1C, 0x02, 0x1B, 0x02, 0x1B, 0x02,
+  0x1A, 0x03, 0x19, 0x03, 0x18, 0x04, 0x18, 0x04, 0x18, 0x03, 0x19, 0x03,
+  0x1A, 0x02, 0x1A, 0x03, 0x1B, 0x02, 0x1C, 0x02, 0x2A, 0x01, 0x1B, 0x01,
+  0x1B, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x1B, 0x01,
+  0x1B, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x1B, 0x01,
+  0x1B, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x1B, 0x01,
+  0x1B, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x1B, 0x01,
+  0x1B, 0x01, 0x1B, 0x01, 0x1B, 0x01, 0x42, 0x02, 0x1C, 0x02, 0x1B, 0x03,
+  0x1A, 0x02, 0x1A, 0x03, 0x19, 0x03, 0x18, 0x04, 0x18, 0x04, 0x18, 0x03,
+  0x19, 0x03, 0x1A, 0x02, 0x1B, 0x02, 0x1B, 0x02, 0x1C, 0x02, 0x18, 0x02,
+  0x19, 0x02, 0x19, 0x02, 0x19, 0x03, 0x19, 0x03, 0x19, 0x04, 0x18, 0x04,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x02, 0x19, 0x03, 0x18, 0x02, 0x18, 0x02,
+  0xFF, 0x00, 0x59, 0x04, 0x0A, 0x01, 0x0C, 0x01, 0x04, 0x03, 0x07, 0x01,
+  0x0B, 0x01, 0x07, 0x03, 0x04, 0x01, 0x0C, 0x01, 0x0A, 0x04, 0x44, 0x03,
+  0x18, 0x01, 0x02, 0x02, 0x16, 0x02, 0x03, 0x02, 0x15, 0x02, 0x03, 0x02,
+  0x15, 0x02, 0x03, 0x02, 0x15, 0x02, 0x03, 0x02, 0x16, 0x02, 0x01, 0x02,
+  0xFF, 0x00, 0x03, 0x05, 0x03, 0x05, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03,
+  0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03,
+  0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03,
+  0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x04,
+  0x02, 0x07, 0x10, 0x06, 0x01, 0x04, 0x12, 0x03, 0x03, 0x02, 0x12, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x60, 0x03, 0x1A, 0x03, 0x1A, 0x02, 0x1B, 0x01, 0x1C, 0x01, 0x32, 0x06,
+  0x15, 0x02, 0x03, 0x03, 0x13, 0x03, 0x04, 0x03, 0x12, 0x03, 0x04, 0x03,
+  0x12, 0x03, 0x04, 0x03, 0x18, 0x04, 0x15, 0x03, 0x01, 0x03, 0x13, 0x03,
+  0x03, 0x03, 0x12, 0x02, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03,
+  0x05, 0x03, 0x11, 0x04, 0x03, 0x04, 0x01, 0x01, 0x10, 0x06, 0x01, 0x04,
+  0x12, 0x03, 0x04, 0x02, 0x29, 0x02, 0x19, 0x01, 0x02, 0x01, 0x17, 0x01,
+  0x04, 0x01, 0x16, 0x01, 0x04, 0x01, 0x14, 0x01, 0x08, 0x01, 0x12, 0x01,
+  0x08, 0x01, 0x11, 0x01, 0x0A, 0x01, 0x2F, 0x06, 0x15, 0x02, 0x03, 0x03,
+  0x13, 0x03, 0x04, 0x03, 0x12, 0x03, 0x04, 0x03, 0x12, 0x03, 0x04, 0x03,
+  0x18, 0x04, 0x15, 0x03, 0x01, 0x03, 0x13, 0x03, 0x03, 0x03, 0x12, 0x02,
+  0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x04,
+  0x03, 0x04, 0x01, 0x01, 0x10, 0x06, 0x01, 0x04, 0x12, 0x03, 0x04, 0x02,
+  0x96, 0x03, 0x03, 0x03, 0x13, 0x03, 0x03, 0x03, 0x13, 0x03, 0x03, 0x03,
+  0x30, 0x06, 0x15, 0x02, 0x03, 0x03, 0x13, 0x03, 0x04, 0x03, 0x12, 0x03,
+  0x04, 0x03, 0x12, 0x03, 0x04, 0x03, 0x18, 0x04, 0x15, 0x03, 0x01, 0x03,
+  0x13, 0x03, 0x03, 0x03, 0x12, 0x02, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03,
+  0x11, 0x03, 0x05, 0x03, 0x11, 0x04, 0x03, 0x04, 0x01, 0x01, 0x10, 0x06,
+  0x01, 0x04, 0x12, 0x03, 0x04, 0x02, 0xFF, 0x00, 0x09, 0x05, 0x15, 0x02,
+  0x03, 0x03, 0x13, 0x02, 0x05, 0x03, 0x12, 0x02, 0x05, 0x03, 0x11, 0x02,
+  0x07, 0x02, 0x11, 0x02, 0x1A, 0x02, 0x1A, 0x03, 0x08, 0x01, 0x10, 0x03,
+  0x07, 0x02, 0x10, 0x04, 0x06, 0x01, 0x12, 0x04, 0x04, 0x02, 0x12, 0x0A,
+  0x13, 0x08, 0x16, 0x04, 0x19, 0x03, 0x18, 0x05, 0x17, 0x05, 0x1B, 0x01,
+  0x1B, 0x01, 0x1A, 0x01, 0x1A, 0x01, 0x60, 0x03, 0x1A, 0x03, 0x1A, 0x02,
+  0x1B, 0x01, 0x1C, 0x01, 0x33, 0x05, 0x15, 0x02, 0x04, 0x03, 0x12, 0x02,
+  0x06, 0x02, 0x12, 0x01, 0x07, 0x03, 0x10, 0x0C, 0x10, 0x02, 0x1A, 0x02,
+  0x1A, 0x02, 0x1A, 0x03, 0x08, 0x01, 0x10, 0x04, 0x06, 0x02, 0x11, 0x04,
+  0x04, 0x02, 0x12, 0x0A, 0x13, 0x08, 0x16, 0x05, 0x62, 0x03, 0x18, 0x03,
+  0x19, 0x02, 0x1A, 0x01, 0x1A, 0x01, 0x37, 0x05, 0x15, 0x02, 0x04, 0x03,
+  0x12, 0x02, 0x06, 0x02, 0x12, 0x01, 0x07, 0x03, 0x10, 0x0C, 0x10, 0x02,
+  0x1A, 0x02, 0x1A, 0x02, 0x1A, 0x03, 0x08, 0x01, 0x10, 0x04, 0x06, 0x02,
+  0x11, 0x04, 0x04, 0x02, 0x12, 0x0A, 0x13, 0x08, 0x16, 0x05, 0x29, 0x02,
+  0x19, 0x01, 0x02, 0x01, 0x17, 0x01, 0x04, 0x01, 0x16, 0x01, 0x04, 0x01,
+  0x14, 0x01, 0x08, 0x01, 0x12, 0x01, 0x08, 0x01, 0x11, 0x01, 0x0A, 0x01,
+  0x30, 0x05, 0x15, 0x02, 0x04, 0x03, 0x12, 0x02, 0x06, 0x02, 0x12, 0x01,
+  0x07, 0x03, 0x10, 0x0C, 0x10, 0x02, 0x1A, 0x02, 0x1A, 0x02, 0x1A, 0x03,
+  0x08, 0x01, 0x10, 0x04, 0x06, 0x02, 0x11, 0x04, 0x04, 0x02, 0x12, 0x0A,
+  0x13, 0x08, 0x16, 0x05, 0x96, 0x03, 0x03, 0x03, 0x13, 0x03, 0x03, 0x03,
+  0x13, 0x03, 0x03, 0x03, 0x31, 0x05, 0x15, 0x02, 0x04, 0x03, 0x12, 0x02,
+  0x06, 0x02, 0x12, 0x01, 0x07, 0x03, 0x10, 0x0C, 0x10, 0x02, 0x1A, 0x02,
+  0x1A, 0x02, 0x1A, 0x03, 0x08, 0x01, 0x10, 0x04, 0x06, 0x02, 0x11, 0x04,
+  0x04, 0x02, 0x12, 0x0A, 0x13, 0x08, 0x16, 0x05, 0x28, 0x02, 0x19, 0x01,
+  0x02, 0x01, 0x17, 0x01, 0x04, 0x01, 0x16, 0x01, 0x04, 0x01, 0x14, 0x01,
+  0x08, 0x01, 0x12, 0x01, 0x08, 0x01, 0x11, 0x01, 0x0A, 0x01, 0x32, 0x02,
+  0x18, 0x04, 0x17, 0x05, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x17, 0x07, 0x95, 0x03, 0x03, 0x03, 0x13, 0x03, 0x03, 0x03, 0x13, 0x03,
+  0x03, 0x03, 0x33, 0x02, 0x18, 0x04, 0x17, 0x05, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03, 0x19, 0x03,
+  0x19, 0x03, 0x19, 0x03, 0x17, 0x07, 0x29, 0x02, 0x19, 0x01, 0x02, 0x01,
+  0x17, 0x01, 0x04, 0x01, 0x16, 0x01, 0x04, 0x01, 0x14, 0x01, 0x08, 0x01,
+  0x12, 0x01, 0x08, 0x01, 0x11, 0x01, 0x0A, 0x01, 0x2F, 0x06, 0x15, 0x02,
+  0x03, 0x04, 0x12, 0x02, 0x05, 0x03, 0x11, 0x02, 0x07, 0x03, 0x10, 0x02,
+  0x08, 0x03, 0x0E, 0x03, 0x08, 0x03, 0x0E, 0x03, 0x08, 0x03, 0x0E, 0x03,
+  0x08, 0x03, 0x0E, 0x03, 0x08, 0x03, 0x0E, 0x04, 0x07, 0x02, 0x10, 0x03,
+  0x07, 0x02, 0x11, 0x03, 0x05, 0x02, 0x12, 0x04, 0x03, 0x02, 0x15, 0x06,
+  0x96, 0x03, 0x03, 0x03, 0x13, 0x03, 0x03, 0x03, 0x13, 0x03, 0x03, 0x03,
+  0x30, 0x06, 0x15, 0x02, 0x03, 0x04, 0x12, 0x02, 0x05, 0x03, 0x11, 0x02,
+  0x07, 0x03, 0x10, 0x02, 0x08, 0x03, 0x0E, 0x03, 0x08, 0x03, 0x0E, 0x03,
+  0x08, 0x03, 0x0E, 0x03, 0x08, 0x03, 0x0E, 0x03, 0x08, 0x03, 0x0E, 0x04,
+  0x07, 0x02, 0x10, 0x03, 0x07, 0x02, 0x11, 0x03, 0x05, 0x02, 0x12, 0x04,
+  0x03, 0x02, 0x15, 0x06, 0x5F, 0x03, 0x1A, 0x03, 0x1A, 0x02, 0x1B, 0x01,
+  0x1C, 0x01, 0x2E, 0x05, 0x03, 0x05, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03,
+  0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03,
+  0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03,
+  0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x04,
+  0x02, 0x07, 0x10, 0x06, 0x01, 0x04, 0x12, 0x03, 0x03, 0x02, 0x28, 0x02,
+  0x19, 0x01, 0x02, 0x01, 0x17, 0x01, 0x04, 0x01, 0x16, 0x01, 0x04, 0x01,
+  0x14, 0x01, 0x08, 0x01, 0x12, 0x01, 0x08, 0x01, 0x11, 0x01, 0x0A, 0x01,
+  0x2B, 0x05, 0x03, 0x05, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03,
+  0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03,
+  0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03,
+  0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x04, 0x02, 0x07,
+  0x10, 0x06, 0x01, 0x04, 0x12, 0x03, 0x03, 0x02, 0x95, 0x03, 0x03, 0x03,
+  0x13, 0x03, 0x03, 0x03, 0x13, 0x03, 0x03, 0x03, 0x2C, 0x05, 0x03, 0x05,
+  0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03,
+  0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03,
+  0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03, 0x11, 0x03, 0x05, 0x03,
+  0x11, 0x03, 0x05, 0x03, 0x11, 0x04, 0x02, 0x07, 0x10, 0x06, 0x01, 0x04,
+  0x12, 0x03, 0x03, 0x02,
+};
+
+const uint16_t Font24Rle_Offsets[] = {
+      0,     0,    36,    72,   156,   256,   378,   472,
+    490,   544,   598,   650,   684,   704,   712,   722,
+    766,   846,   888,   942,   992,  1054,  1098,  1164,
+   1212,  1288,  1354,  1368,  1392,  1422,  1428,  1458,
+   1508,  1686,  1760,  1838,  1902,  1982,  2052,  2114,
+   2190,  2272,  2314,  2362,  2444,  2496,  2642,  2750,
+   2830,  2892,  2984,  3064,  3134,  3192,  3274,  3350,
+   3480,  3556,  3620,  3678,  3732,  3776,  3830,  3872,
+   3880,  3890,  3946,  4016,  4062,  4134,  4176,  4226,
+   4296,  4368,  4402,  4454,  4524,  4568,  4656,  4714,
+   4768,  4840,  4912,  4948,  4998,  5038,  5096,  5148,
+   5234,  5286,  5352,  5390,  5444,  5502,  5556,  5578,
+   5604,  5676,  5740,  5820,  5886,  5946,  5996,  6046,
+   6112,  6164,  6218,  6258,  6336,  6400,  6466,  6548,
+   6616,
+};
+
+const uint16_t Font24Rle_CodePoints[] = {
+  0x00B0,  // '°'
+  0x00B5,  // 'µ'
+  0x00E0,  // 'à'
+  0x00E2,  // 'â'
+  0x00E4,  // 'ä'
+  0x00E7,  // 'ç'
+  0x00E8,  // 'è'
+  0x00E9,  // 'é'
+  0x00EA,  // 'ê'
+  0x00EB,  // 'ë'
+  0x00EE,  // 'î'
+  0x00EF,  // 'ï'
+  0x00F4,  // 'ô'
+  0x00F6,  // 'ö'
+  0x00F9,  // 'ù'
+  0x00FB,  // 'û'
+  0x00FC,  // 'ü'
+};
+// clang-format on
+
+constexpr Font kFont24Rle = {Font24Rle_Table,
+                             28,
+                             30,
+                             FontFormat::Rle1,
+                             Font24Rle_CodePoints,
+                             17,
+                             Font24Rle_Offsets};
+
+}  // namespace disco
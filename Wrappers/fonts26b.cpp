@@ -3352,12 +3352,608 @@ const uint8_t Font26b_Table[] = {
   0x00, 0x00, 0x00, 0x00, 0x00,  //
   0x00, 0x00, 0x00, 0x00, 0x00,  //
   0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @15675 '°' (35 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x01, 0xE0, 0x00, 0x00,  //                ####
+  0x00, 0x03, 0x30, 0x00, 0x00,  //               ##  ##
+  0x00, 0x07, 0x38, 0x00, 0x00,  //              ###  ###
+  0x00, 0x07, 0x38, 0x00, 0x00,  //              ###  ###
+  0x00, 0x07, 0x38, 0x00, 0x00,  //              ###  ###
+  0x00, 0x07, 0x38, 0x00, 0x00,  //              ###  ###
+  0x00, 0x07, 0x38, 0x00, 0x00,  //              ###  ###
+  0x00, 0x03, 0x30, 0x00, 0x00,  //               ##  ##
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @15840 'µ' (35 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0xFE, 0x3F, 0x80, 0x00,  //         #######   #######
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x1F, 0x80, 0x00,  //           #####    ######
+  0x00, 0x1F, 0x3F, 0x80, 0x00,  //            #####  #######
+  0x00, 0x1F, 0xEF, 0x80, 0x00,  //            ######## #####
+  0x00, 0x07, 0xCF, 0xE0, 0x00,  //              #####  #######
+  0x00, 0x3E, 0x00, 0x00, 0x00,  //           #####
+  0x00, 0x3E, 0x00, 0x00, 0x00,  //           #####
+  0x00, 0x3E, 0x00, 0x00, 0x00,  //           #####
+  0x00, 0x3E, 0x00, 0x00, 0x00,  //           #####
+  0x00, 0x3E, 0x00, 0x00, 0x00,  //           #####
+  0x00, 0x3E, 0x00, 0x00, 0x00,  //           #####
+  0x00, 0x3E, 0x00, 0x00, 0x00,  //           #####
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @16005 'à' (35 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x01, 0xE0, 0x00, 0x00,  //                ####
+  0x00, 0x00, 0xF0, 0x00, 0x00,  //                 ####
+  0x00, 0x00, 0x70, 0x00, 0x00,  //                  ###
+  0x00, 0x00, 0x30, 0x00, 0x00,  //                   ##
+  0x00, 0x00, 0x18, 0x00, 0x00,  //                    ##
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x01, 0xF8, 0x00, 0x00,  //                ######
+  0x00, 0x06, 0x3E, 0x00, 0x00,  //              ##   #####
+  0x00, 0x0E, 0x1F, 0x00, 0x00,  //             ###    #####
+  0x00, 0x1F, 0x1F, 0x00, 0x00,  //            #####   #####
+  0x00, 0x1F, 0x1F, 0x00, 0x00,  //            #####   #####
+  0x00, 0x0E, 0x1F, 0x00, 0x00,  //             ###    #####
+  0x00, 0x00, 0x3F, 0x00, 0x00,  //                   ######
+  0x00, 0x00, 0xDF, 0x00, 0x00,  //                 ## #####
+  0x00, 0x03, 0x9F, 0x00, 0x00,  //               ###  #####
+  0x00, 0x07, 0x1F, 0x00, 0x00,  //              ###   #####
+  0x00, 0x0F, 0x1F, 0x00, 0x00,  //             ####   #####
+  0x00, 0x1F, 0x1F, 0x00, 0x00,  //            #####   #####
+  0x00, 0x1F, 0x1F, 0x00, 0x00,  //            #####   #####
+  0x00, 0x1F, 0x3F, 0x00, 0x00,  //            #####  ######
+  0x00, 0x1F, 0xDF, 0xC0, 0x00,  //            ####### #######
+  0x00, 0x0F, 0x8F, 0x00, 0x00,  //             #####   ####
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @16170 'â' (35 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x20, 0x00, 0x00,  //                   #
+  0x00, 0x00, 0x70, 0x00, 0x00,  //                  ###
+  0x00, 0x00, 0xD8, 0x00, 0x00,  //                 ## ##
+  0x00, 0x01, 0x8C, 0x00, 0x00,  //                ##   ##
+  0x00, 0x03, 0x06, 0x00, 0x00,  //               ##     ##
+  0x00, 0x06, 0x03, 0x00, 0x00,  //              ##       ##
+  0x00, 0x0C, 0x01, 0x80, 0x00,  //             ##         ##
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x01, 0xF8, 0x00, 0x00,  //                ######
+  0x00, 0x06, 0x3E, 0x00, 0x00,  //              ##   #####
+  0x00, 0x0E, 0x1F, 0x00, 0x00,  //             ###    #####
+  0x00, 0x1F, 0x1F, 0x00, 0x00,  //            #####   #####
+  0x00, 0x1F, 0x1F, 0x00, 0x00,  //            #####   #####
+  0x00, 0x0E, 0x1F, 0x00, 0x00,  //             ###    #####
+  0x00, 0x00, 0x3F, 0x00, 0x00,  //                   ######
+  0x00, 0x00, 0xDF, 0x00, 0x00,  //                 ## #####
+  0x00, 0x03, 0x9F, 0x00, 0x00,  //               ###  #####
+  0x00, 0x07, 0x1F, 0x00, 0x00,  //              ###   #####
+  0x00, 0x0F, 0x1F, 0x00, 0x00,  //             ####   #####
+  0x00, 0x1F, 0x1F, 0x00, 0x00,  //            #####   #####
+  0x00, 0x1F, 0x1F, 0x00, 0x00,  //            #####   #####
+  0x00, 0x1F, 0x3F, 0x00, 0x00,  //            #####  ######
+  0x00, 0x1F, 0xDF, 0xC0, 0x00,  //            ####### #######
+  0x00, 0x0F, 0x8F, 0x00, 0x00,  //             #####   ####
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @16335 'ä' (35 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x0E, 0x03, 0x80, 0x00,  //             ###       ###
+  0x00, 0x1F, 0x07, 0xC0, 0x00,  //            #####     #####
+  0x00, 0x1F, 0x07, 0xC0, 0x00,  //            #####     #####
+  0x00, 0x1F, 0x07, 0xC0, 0x00,  //            #####     #####
+  0x00, 0x0E, 0x03, 0x80, 0x00,  //             ###       ###
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x01, 0xF8, 0x00, 0x00,  //                ######
+  0x00, 0x06, 0x3E, 0x00, 0x00,  //              ##   #####
+  0x00, 0x0E, 0x1F, 0x00, 0x00,  //             ###    #####
+  0x00, 0x1F, 0x1F, 0x00, 0x00,  //            #####   #####
+  0x00, 0x1F, 0x1F, 0x00, 0x00,  //            #####   #####
+  0x00, 0x0E, 0x1F, 0x00, 0x00,  //             ###    #####
+  0x00, 0x00, 0x3F, 0x00, 0x00,  //                   ######
+  0x00, 0x00, 0xDF, 0x00, 0x00,  //                 ## #####
+  0x00, 0x03, 0x9F, 0x00, 0x00,  //               ###  #####
+  0x00, 0x07, 0x1F, 0x00, 0x00,  //              ###   #####
+  0x00, 0x0F, 0x1F, 0x00, 0x00,  //             ####   #####
+  0x00, 0x1F, 0x1F, 0x00, 0x00,  //            #####   #####
+  0x00, 0x1F, 0x1F, 0x00, 0x00,  //            #####   #####
+  0x00, 0x1F, 0x3F, 0x00, 0x00,  //            #####  ######
+  0x00, 0x1F, 0xDF, 0xC0, 0x00,  //            ####### #######
+  0x00, 0x0F, 0x8F, 0x00, 0x00,  //             #####   ####
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @16500 'ç' (35 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0xFC, 0x00, 0x00,  //                 ######
+  0x00, 0x03, 0x8F, 0x00, 0x00,  //               ###   ####
+  0x00, 0x07, 0x8F, 0x80, 0x00,  //              ####   #####
+  0x00, 0x0F, 0x0F, 0x80, 0x00,  //             ####    #####
+  0x00, 0x0F, 0x07, 0x00, 0x00,  //             ####     ###
+  0x00, 0x1F, 0x00, 0x00, 0x00,  //            #####
+  0x00, 0x1F, 0x00, 0x00, 0x00,  //            #####
+  0x00, 0x1F, 0x00, 0x00, 0x00,  //            #####
+  0x00, 0x1F, 0x00, 0x00, 0x00,  //            #####
+  0x00, 0x1F, 0x00, 0x00, 0x00,  //            #####
+  0x00, 0x1F, 0x80, 0x00, 0x00,  //            ######
+  0x00, 0x0F, 0x80, 0x00, 0x00,  //             #####
+  0x00, 0x0F, 0xC1, 0x80, 0x00,  //             ######     ##
+  0x00, 0x07, 0xE3, 0x00, 0x00,  //              ######   ##
+  0x00, 0x03, 0xFE, 0x00, 0x00,  //               #########
+  0x00, 0x00, 0xF8, 0x00, 0x00,  //                 #####
+  0x00, 0x00, 0xE0, 0x00, 0x00,  //                 ###
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x01, 0xF8, 0x00, 0x00,  //                ######
+  0x00, 0x00, 0xF8, 0x00, 0x00,  //                 #####
+  0x00, 0x00, 0x18, 0x00, 0x00,  //                    ##
+  0x00, 0x00, 0x18, 0x00, 0x00,  //                    ##
+  0x00, 0x00, 0x30, 0x00, 0x00,  //                   ##
+  0x00, 0x00, 0x60, 0x00, 0x00,  //                  ##
+  // @16665 'è' (35 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x01, 0xE0, 0x00, 0x00,  //                ####
+  0x00, 0x00, 0xF0, 0x00, 0x00,  //                 ####
+  0x00, 0x00, 0x70, 0x00, 0x00,  //                  ###
+  0x00, 0x00, 0x30, 0x00, 0x00,  //                   ##
+  0x00, 0x00, 0x18, 0x00, 0x00,  //                    ##
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0xF8, 0x00, 0x00,  //                 #####
+  0x00, 0x03, 0x9E, 0x00, 0x00,  //               ###  ####
+  0x00, 0x07, 0x0F, 0x00, 0x00,  //              ###    ####
+  0x00, 0x0F, 0x0F, 0x00, 0x00,  //             ####    ####
+  0x00, 0x0F, 0x0F, 0x80, 0x00,  //             ####    #####
+  0x00, 0x1F, 0x0F, 0x80, 0x00,  //            #####    #####
+  0x00, 0x1F, 0xFF, 0x80, 0x00,  //            ##############
+  0x00, 0x1F, 0x00, 0x00, 0x00,  //            #####
+  0x00, 0x1F, 0x00, 0x00, 0x00,  //            #####
+  0x00, 0x1F, 0x00, 0x00, 0x00,  //            #####
+  0x00, 0x1F, 0x80, 0x00, 0x00,  //            ######
+  0x00, 0x0F, 0x80, 0x80, 0x00,  //             #####       #
+  0x00, 0x0F, 0xC1, 0x00, 0x00,  //             ######     #
+  0x00, 0x07, 0xE2, 0x00, 0x00,  //              ######   #
+  0x00, 0x03, 0xFC, 0x00, 0x00,  //               ########
+  0x00, 0x01, 0xF8, 0x00, 0x00,  //                ######
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @16830 'é' (35 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x78, 0x00, 0x00,  //                  ####
+  0x00, 0x00, 0xF0, 0x00, 0x00,  //                 ####
+  0x00, 0x00, 0xE0, 0x00, 0x00,  //                 ###
+  0x00, 0x00, 0xC0, 0x00, 0x00,  //                 ##
+  0x00, 0x01, 0x80, 0x00, 0x00,  //                ##
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0xF8, 0x00, 0x00,  //                 #####
+  0x00, 0x03, 0x9E, 0x00, 0x00,  //               ###  ####
+  0x00, 0x07, 0x0F, 0x00, 0x00,  //              ###    ####
+  0x00, 0x0F, 0x0F, 0x00, 0x00,  //             ####    ####
+  0x00, 0x0F, 0x0F, 0x80, 0x00,  //             ####    #####
+  0x00, 0x1F, 0x0F, 0x80, 0x00,  //            #####    #####
+  0x00, 0x1F, 0xFF, 0x80, 0x00,  //            ##############
+  0x00, 0x1F, 0x00, 0x00, 0x00,  //            #####
+  0x00, 0x1F, 0x00, 0x00, 0x00,  //            #####
+  0x00, 0x1F, 0x00, 0x00, 0x00,  //            #####
+  0x00, 0x1F, 0x80, 0x00, 0x00,  //            ######
+  0x00, 0x0F, 0x80, 0x80, 0x00,  //             #####       #
+  0x00, 0x0F, 0xC1, 0x00, 0x00,  //             ######     #
+  0x00, 0x07, 0xE2, 0x00, 0x00,  //              ######   #
+  0x00, 0x03, 0xFC, 0x00, 0x00,  //               ########
+  0x00, 0x01, 0xF8, 0x00, 0x00,  //                ######
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @16995 'ê' (35 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x20, 0x00, 0x00,  //                   #
+  0x00, 0x00, 0x70, 0x00, 0x00,  //                  ###
+  0x00, 0x00, 0xD8, 0x00, 0x00,  //                 ## ##
+  0x00, 0x01, 0x8C, 0x00, 0x00,  //                ##   ##
+  0x00, 0x03, 0x06, 0x00, 0x00,  //               ##     ##
+  0x00, 0x06, 0x03, 0x00, 0x00,  //              ##       ##
+  0x00, 0x0C, 0x01, 0x80, 0x00,  //             ##         ##
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0xF8, 0x00, 0x00,  //                 #####
+  0x00, 0x03, 0x9E, 0x00, 0x00,  //               ###  ####
+  0x00, 0x07, 0x0F, 0x00, 0x00,  //              ###    ####
+  0x00, 0x0F, 0x0F, 0x00, 0x00,  //             ####    ####
+  0x00, 0x0F, 0x0F, 0x80, 0x00,  //             ####    #####
+  0x00, 0x1F, 0x0F, 0x80, 0x00,  //            #####    #####
+  0x00, 0x1F, 0xFF, 0x80, 0x00,  //            ##############
+  0x00, 0x1F, 0x00, 0x00, 0x00,  //            #####
+  0x00, 0x1F, 0x00, 0x00, 0x00,  //            #####
+  0x00, 0x1F, 0x00, 0x00, 0x00,  //            #####
+  0x00, 0x1F, 0x80, 0x00, 0x00,  //            ######
+  0x00, 0x0F, 0x80, 0x80, 0x00,  //             #####       #
+  0x00, 0x0F, 0xC1, 0x00, 0x00,  //             ######     #
+  0x00, 0x07, 0xE2, 0x00, 0x00,  //              ######   #
+  0x00, 0x03, 0xFC, 0x00, 0x00,  //               ########
+  0x00, 0x01, 0xF8, 0x00, 0x00,  //                ######
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @17160 'ë' (35 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x0E, 0x03, 0x80, 0x00,  //             ###       ###
+  0x00, 0x1F, 0x07, 0xC0, 0x00,  //            #####     #####
+  0x00, 0x1F, 0x07, 0xC0, 0x00,  //            #####     #####
+  0x00, 0x1F, 0x07, 0xC0, 0x00,  //            #####     #####
+  0x00, 0x0E, 0x03, 0x80, 0x00,  //             ###       ###
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0xF8, 0x00, 0x00,  //                 #####
+  0x00, 0x03, 0x9E, 0x00, 0x00,  //               ###  ####
+  0x00, 0x07, 0x0F, 0x00, 0x00,  //              ###    ####
+  0x00, 0x0F, 0x0F, 0x00, 0x00,  //             ####    ####
+  0x00, 0x0F, 0x0F, 0x80, 0x00,  //             ####    #####
+  0x00, 0x1F, 0x0F, 0x80, 0x00,  //            #####    #####
+  0x00, 0x1F, 0xFF, 0x80, 0x00,  //            ##############
+  0x00, 0x1F, 0x00, 0x00, 0x00,  //            #####
+  0x00, 0x1F, 0x00, 0x00, 0x00,  //            #####
+  0x00, 0x1F, 0x00, 0x00, 0x00,  //            #####
+  0x00, 0x1F, 0x80, 0x00, 0x00,  //            ######
+  0x00, 0x0F, 0x80, 0x80, 0x00,  //             #####       #
+  0x00, 0x0F, 0xC1, 0x00, 0x00,  //             ######     #
+  0x00, 0x07, 0xE2, 0x00, 0x00,  //              ######   #
+  0x00, 0x03, 0xFC, 0x00, 0x00,  //               ########
+  0x00, 0x01, 0xF8, 0x00, 0x00,  //                ######
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @17325 'î' (35 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x40, 0x00, 0x00,  //                  #
+  0x00, 0x00, 0xE0, 0x00, 0x00,  //                 ###
+  0x00, 0x01, 0xB0, 0x00, 0x00,  //                ## ##
+  0x00, 0x03, 0x18, 0x00, 0x00,  //               ##   ##
+  0x00, 0x06, 0x0C, 0x00, 0x00,  //              ##     ##
+  0x00, 0x0C, 0x06, 0x00, 0x00,  //             ##       ##
+  0x00, 0x18, 0x03, 0x00, 0x00,  //            ##         ##
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x07, 0xF0, 0x00, 0x00,  //              #######
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x07, 0xFC, 0x00, 0x00,  //              #########
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @17490 'ï' (35 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x1C, 0x07, 0x00, 0x00,  //            ###       ###
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x1C, 0x07, 0x00, 0x00,  //            ###       ###
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x07, 0xF0, 0x00, 0x00,  //              #######
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x01, 0xF0, 0x00, 0x00,  //                #####
+  0x00, 0x07, 0xFC, 0x00, 0x00,  //              #########
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @17655 'ô' (35 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x20, 0x00, 0x00,  //                   #
+  0x00, 0x00, 0x70, 0x00, 0x00,  //                  ###
+  0x00, 0x00, 0xD8, 0x00, 0x00,  //                 ## ##
+  0x00, 0x01, 0x8C, 0x00, 0x00,  //                ##   ##
+  0x00, 0x03, 0x06, 0x00, 0x00,  //               ##     ##
+  0x00, 0x06, 0x03, 0x00, 0x00,  //              ##       ##
+  0x00, 0x0C, 0x01, 0x80, 0x00,  //             ##         ##
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x01, 0xF8, 0x00, 0x00,  //                ######
+  0x00, 0x07, 0x0E, 0x00, 0x00,  //              ###    ###
+  0x00, 0x0F, 0x0F, 0x00, 0x00,  //             ####    ####
+  0x00, 0x1E, 0x07, 0x80, 0x00,  //            ####      ####
+  0x00, 0x1E, 0x07, 0x80, 0x00,  //            ####      ####
+  0x00, 0x3E, 0x07, 0xC0, 0x00,  //           #####      #####
+  0x00, 0x3E, 0x07, 0xC0, 0x00,  //           #####      #####
+  0x00, 0x3E, 0x07, 0xC0, 0x00,  //           #####      #####
+  0x00, 0x3E, 0x07, 0xC0, 0x00,  //           #####      #####
+  0x00, 0x3E, 0x07, 0xC0, 0x00,  //           #####      #####
+  0x00, 0x3E, 0x07, 0xC0, 0x00,  //           #####      #####
+  0x00, 0x1E, 0x07, 0x80, 0x00,  //            ####      ####
+  0x00, 0x1E, 0x07, 0x80, 0x00,  //            ####      ####
+  0x00, 0x0F, 0x0F, 0x00, 0x00,  //             ####    ####
+  0x00, 0x07, 0x0E, 0x00, 0x00,  //              ###    ###
+  0x00, 0x01, 0xF8, 0x00, 0x00,  //                ######
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @17820 'ö' (35 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x0E, 0x03, 0x80, 0x00,  //             ###       ###
+  0x00, 0x1F, 0x07, 0xC0, 0x00,  //            #####     #####
+  0x00, 0x1F, 0x07, 0xC0, 0x00,  //            #####     #####
+  0x00, 0x1F, 0x07, 0xC0, 0x00,  //            #####     #####
+  0x00, 0x0E, 0x03, 0x80, 0x00,  //             ###       ###
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x01, 0xF8, 0x00, 0x00,  //                ######
+  0x00, 0x07, 0x0E, 0x00, 0x00,  //              ###    ###
+  0x00, 0x0F, 0x0F, 0x00, 0x00,  //             ####    ####
+  0x00, 0x1E, 0x07, 0x80, 0x00,  //            ####      ####
+  0x00, 0x1E, 0x07, 0x80, 0x00,  //            ####      ####
+  0x00, 0x3E, 0x07, 0xC0, 0x00,  //           #####      #####
+  0x00, 0x3E, 0x07, 0xC0, 0x00,  //           #####      #####
+  0x00, 0x3E, 0x07, 0xC0, 0x00,  //           #####      #####
+  0x00, 0x3E, 0x07, 0xC0, 0x00,  //           #####      #####
+  0x00, 0x3E, 0x07, 0xC0, 0x00,  //           #####      #####
+  0x00, 0x3E, 0x07, 0xC0, 0x00,  //           #####      #####
+  0x00, 0x1E, 0x07, 0x80, 0x00,  //            ####      ####
+  0x00, 0x1E, 0x07, 0x80, 0x00,  //            ####      ####
+  0x00, 0x0F, 0x0F, 0x00, 0x00,  //             ####    ####
+  0x00, 0x07, 0x0E, 0x00, 0x00,  //              ###    ###
+  0x00, 0x01, 0xF8, 0x00, 0x00,  //                ######
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @17985 'ù' (35 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x03, 0xC0, 0x00, 0x00,  //               ####
+  0x00, 0x01, 0xE0, 0x00, 0x00,  //                ####
+  0x00, 0x00, 0xE0, 0x00, 0x00,  //                 ###
+  0x00, 0x00, 0x60, 0x00, 0x00,  //                  ##
+  0x00, 0x00, 0x30, 0x00, 0x00,  //                   ##
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0xFE, 0x3F, 0x80, 0x00,  //         #######   #######
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x1F, 0x80, 0x00,  //           #####    ######
+  0x00, 0x1F, 0x3F, 0x80, 0x00,  //            #####  #######
+  0x00, 0x1F, 0xEF, 0x80, 0x00,  //            ######## #####
+  0x00, 0x07, 0xCF, 0xE0, 0x00,  //              #####  #######
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @18150 'û' (35 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x40, 0x00, 0x00,  //                  #
+  0x00, 0x00, 0xE0, 0x00, 0x00,  //                 ###
+  0x00, 0x01, 0xB0, 0x00, 0x00,  //                ## ##
+  0x00, 0x03, 0x18, 0x00, 0x00,  //               ##   ##
+  0x00, 0x06, 0x0C, 0x00, 0x00,  //              ##     ##
+  0x00, 0x0C, 0x06, 0x00, 0x00,  //             ##       ##
+  0x00, 0x18, 0x03, 0x00, 0x00,  //            ##         ##
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0xFE, 0x3F, 0x80, 0x00,  //         #######   #######
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x1F, 0x80, 0x00,  //           #####    ######
+  0x00, 0x1F, 0x3F, 0x80, 0x00,  //            #####  #######
+  0x00, 0x1F, 0xEF, 0x80, 0x00,  //            ######## #####
+  0x00, 0x07, 0xCF, 0xE0, 0x00,  //              #####  #######
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @18315 'ü' (35 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x1C, 0x07, 0x00, 0x00,  //            ###       ###
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x1C, 0x07, 0x00, 0x00,  //            ###       ###
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0xFE, 0x3F, 0x80, 0x00,  //         #######   #######
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x0F, 0x80, 0x00,  //           #####     #####
+  0x00, 0x3E, 0x1F, 0x80, 0x00,  //           #####    ######
+  0x00, 0x1F, 0x3F, 0x80, 0x00,  //            #####  #######
+  0x00, 0x1F, 0xEF, 0x80, 0x00,  //            ######## #####
+  0x00, 0x07, 0xCF, 0xE0, 0x00,  //              #####  #######
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00,  //
+};
+
+const uint16_t Font26b_CodePoints[] = {
+  0x00B0,  // '°'
+  0x00B5,  // 'µ'
+  0x00E0,  // 'à'
+  0x00E2,  // 'â'
+  0x00E4,  // 'ä'
+  0x00E7,  // 'ç'
+  0x00E8,  // 'è'
+  0x00E9,  // 'é'
+  0x00EA,  // 'ê'
+  0x00EB,  // 'ë'
+  0x00EE,  // 'î'
+  0x00EF,  // 'ï'
+  0x00F4,  // 'ô'
+  0x00F6,  // 'ö'
+  0x00F9,  // 'ù'
+  0x00FB,  // 'û'
+  0x00FC,  // 'ü'
 };
 // clang-format on
 
-Font* createFont26b() {
-    static Font* pFont26b = new Font{Font26b_Table, 35, 33};
-    return pFont26b;
-}
+constexpr Font kFont26b = {
+    Font26b_Table, 35, 33, FontFormat::Mono1, Font26b_CodePoints, 17};
 
 }  // namespace disco
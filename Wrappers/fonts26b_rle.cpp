@@ -0,0 +1,706 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file fonts26b_rle.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Run-length compressed font (size 26b), generated from fonts26b.cpp
+ *        by tools/font_rle.py
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "fonts.hpp"
+
+namespace disco {
+// clang-format off
+const uint8_t Font26bRle_Table[] = {
+  0x34, 0x03, 0x1F, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1F, 0x03, 0x20, 0x03, 0x20, 0x03, 0x20, 0x03, 0x20, 0x03,
+  0x21, 0x01, 0x22, 0x01, 0x22, 0x01, 0x22, 0x01, 0x8A, 0x03, 0x1F, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1F, 0x03, 0x2F, 0x03, 0x05, 0x03, 0x17, 0x05,
+  0x03, 0x05, 0x16, 0x05, 0x03, 0x05, 0x16, 0x05, 0x03, 0x05, 0x16, 0x05,
+  0x03, 0x05, 0x17, 0x03, 0x05, 0x03, 0x18, 0x03, 0x05, 0x03, 0x18, 0x03,
+  0x05, 0x03, 0x18, 0x03, 0x05, 0x03, 0x19, 0x01, 0x07, 0x01, 0x1A, 0x01,
+  0x07, 0x01, 0x32, 0x02, 0x06, 0x02, 0x19, 0x02, 0x06, 0x02, 0x18, 0x03,
+  0x05, 0x02, 0x19, 0x02, 0x06, 0x02, 0x19, 0x02, 0x06, 0x02, 0x19, 0x02,
+  0x06, 0x02, 0x19, 0x02, 0x06, 0x02, 0x18, 0x02, 0x06, 0x02, 0x15, 0x11,
+  0x12, 0x11, 0x16, 0x02, 0x06, 0x02, 0x19, 0x02, 0x06, 0x02, 0x18, 0x02,
+  0x06, 0x02, 0x19, 0x02, 0x06, 0x02, 0x19, 0x02, 0x06, 0x02, 0x16, 0x11,
+  0x12, 0x11, 0x14, 0x02, 0x06, 0x02, 0x19, 0x02, 0x06, 0x02, 0x19, 0x02,
+  0x06, 0x02, 0x19, 0x02, 0x06, 0x02, 0x19, 0x02, 0x05, 0x03, 0x18, 0x02,
+  0x06, 0x02, 0x19, 0x02, 0x06, 0x02, 0x11, 0x01, 0x20, 0x06, 0x1B, 0x02,
+  0x02, 0x01, 0x01, 0x04, 0x17, 0x04, 0x02, 0x01, 0x03, 0x03, 0x16, 0x03,
+  0x03, 0x01, 0x04, 0x02, 0x15, 0x04, 0x03, 0x01, 0x04, 0x02, 0x15, 0x04,
+  0x03, 0x01, 0x05, 0x01, 0x15, 0x05, 0x02, 0x01, 0x05, 0x01, 0x15, 0x06,
+  0x01, 0x01, 0x1B, 0x08, 0x1C, 0x07, 0x1D, 0x08, 0x1C, 0x08, 0x1C, 0x08,
+  0x1D, 0x07, 0x1D, 0x07, 0x1C, 0x01, 0x01, 0x06, 0x1B, 0x01, 0x02, 0x05,
+  0x14, 0x01, 0x06, 0x01, 0x02, 0x05, 0x14, 0x01, 0x06, 0x01, 0x03, 0x04,
+  0x14, 0x02, 0x05, 0x01, 0x03, 0x04, 0x14, 0x02, 0x05, 0x01, 0x03, 0x03,
+  0x15, 0x03, 0x04, 0x01, 0x02, 0x04, 0x15, 0x05, 0x02, 0x01, 0x01, 0x03,
+  0x19, 0x09, 0x1F, 0x01, 0x22, 0x01, 0x2A, 0x05, 0x0D, 0x02, 0x0E, 0x03,
+  0x01, 0x03, 0x0B, 0x02, 0x0E, 0x03, 0x03, 0x03, 0x09, 0x03, 0x0D, 0x04,
+  0x03, 0x04, 0x08, 0x02, 0x0E, 0x04, 0x03, 0x04, 0x07, 0x02, 0x0F, 0x04,
+  0x03, 0x04, 0x07, 0x02, 0x0F, 0x04, 0x03, 0x04, 0x06, 0x02, 0x10, 0x04,
+  0x03, 0x04, 0x05, 0x03, 0x10, 0x04, 0x03, 0x04, 0x05, 0x02, 0x12, 0x03,
+  0x03, 0x03, 0x05, 0x02, 0x14, 0x03, 0x01, 0x03, 0x05, 0x03, 0x15, 0x05,
+  0x06, 0x02, 0x20, 0x02, 0x06, 0x05, 0x16, 0x02, 0x05, 0x03, 0x01, 0x03,
+  0x14, 0x02, 0x05, 0x03, 0x03, 0x03, 0x12, 0x03, 0x04, 0x04, 0x03, 0x04,
+  0x11, 0x02, 0x05, 0x04, 0x03, 0x04, 0x10, 0x02, 0x06, 0x04, 0x03, 0x04,
+  0x0F, 0x03, 0x06, 0x04, 0x03, 0x04, 0x0F, 0x02, 0x07, 0x04, 0x03, 0x04,
+  0x0E, 0x02, 0x08, 0x04, 0x03, 0x04, 0x0E, 0x02, 0x09, 0x03, 0x03, 0x03,
+  0x0E, 0x02, 0x0B, 0x03, 0x01, 0x03, 0x0E, 0x03, 0x0C, 0x05, 0x31, 0x06,
+  0x1B, 0x03, 0x03, 0x04, 0x18, 0x03, 0x04, 0x05, 0x17, 0x03, 0x05, 0x04,
+  0x16, 0x04, 0x05, 0x04, 0x16, 0x04, 0x05, 0x04, 0x16, 0x05, 0x04, 0x03,
+  0x17, 0x05, 0x03, 0x03, 0x18, 0x09, 0x1B, 0x05, 0x1D, 0x07, 0x05, 0x07,
+  0x0E, 0x03, 0x01, 0x06, 0x05, 0x05, 0x0E, 0x03, 0x02, 0x06, 0x06, 0x03,
+  0x0E, 0x03, 0x04, 0x06, 0x05, 0x02, 0x0E, 0x04, 0x04, 0x07, 0x04, 0x01,
+  0x0F, 0x04, 0x05, 0x07, 0x02, 0x02, 0x0E, 0x05, 0x06, 0x09, 0x0F, 0x06,
+  0x06, 0x07, 0x10, 0x06, 0x07, 0x07, 0x0F, 0x07, 0x07, 0x07, 0x03, 0x02,
+  0x0A, 0x08, 0x04, 0x0C, 0x0B, 0x0D, 0x02, 0x08, 0x0D, 0x0B, 0x04, 0x07,
+  0x0F, 0x07, 0x07, 0x04, 0x33, 0x03, 0x1F, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1F, 0x03, 0x20, 0x03, 0x20, 0x03, 0x20, 0x03, 0x21, 0x01,
+  0x22, 0x01, 0x3A, 0x01, 0x20, 0x02, 0x1F, 0x03, 0x1F, 0x03, 0x1F, 0x03,
+  0x1F, 0x04, 0x1F, 0x03, 0x1F, 0x04, 0x1E, 0x05, 0x1E, 0x04, 0x1F, 0x04,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1F, 0x04, 0x1F, 0x04, 0x20, 0x04,
+  0x1F, 0x04, 0x20, 0x03, 0x20, 0x04, 0x20, 0x03, 0x21, 0x03, 0x21, 0x03,
+  0x22, 0x02, 0x23, 0x01, 0x2F, 0x01, 0x23, 0x02, 0x22, 0x03, 0x21, 0x03,
+  0x21, 0x03, 0x20, 0x04, 0x20, 0x03, 0x20, 0x04, 0x1F, 0x04, 0x20, 0x04,
+  0x1F, 0x04, 0x1F, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x04, 0x1F, 0x04,
+  0x1E, 0x05, 0x1E, 0x04, 0x1F, 0x03, 0x1F, 0x04, 0x1F, 0x03, 0x1F, 0x03,
+  0x1F, 0x03, 0x1F, 0x02, 0x20, 0x01, 0x79, 0x03, 0x20, 0x03, 0x20, 0x03,
+  0x1C, 0x03, 0x02, 0x01, 0x02, 0x03, 0x18, 0x04, 0x01, 0x01, 0x01, 0x04,
+  0x18, 0x0B, 0x1C, 0x03, 0x1F, 0x02, 0x01, 0x02, 0x1C, 0x04, 0x01, 0x04,
+  0x1A, 0x03, 0x03, 0x03, 0x1A, 0x03, 0x03, 0x03, 0xBF, 0x02, 0x21, 0x02,
+  0x21, 0x02, 0x21, 0x02, 0x21, 0x02, 0x21, 0x02, 0x21, 0x02, 0x21, 0x02,
+  0x19, 0x12, 0x11, 0x12, 0x19, 0x02, 0x21, 0x02, 0x21, 0x02, 0x21, 0x02,
+  0x21, 0x02, 0x21, 0x02, 0x21, 0x02, 0x21, 0x02, 0xFF, 0x00, 0xFF, 0x00,
+  0xCD, 0x03, 0x1F, 0x05, 0x1E, 0x06, 0x1D, 0x06, 0x1E, 0x05, 0x21, 0x02,
+  0x21, 0x02, 0x20, 0x02, 0x21, 0x02, 0x20, 0x02, 0x20, 0x01, 0xFF, 0x00,
+  0xFF, 0x00, 0x3F, 0x0A, 0x19, 0x0A, 0x19, 0x0A, 0xFF, 0x00, 0xFF, 0x00,
+  0xCD, 0x03, 0x1F, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1F, 0x03, 0x38, 0x02,
+  0x20, 0x03, 0x20, 0x02, 0x21, 0x02, 0x20, 0x03, 0x20, 0x02, 0x21, 0x02,
+  0x20, 0x03, 0x20, 0x02, 0x21, 0x02, 0x20, 0x03, 0x20, 0x02, 0x21, 0x02,
+  0x20, 0x03, 0x20, 0x02, 0x21, 0x02, 0x20, 0x03, 0x20, 0x02, 0x21, 0x02,
+  0x20, 0x03, 0x20, 0x02, 0x21, 0x02, 0x20, 0x03, 0x20, 0x02, 0x32, 0x05,
+  0x1D, 0x02, 0x03, 0x02, 0x1B, 0x03, 0x04, 0x02, 0x19, 0x03, 0x05, 0x03,
+  0x17, 0x04, 0x05, 0x04, 0x16, 0x04, 0x05, 0x04, 0x16, 0x04, 0x05, 0x04,
+  0x15, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x15, 0x04, 0x05, 0x04, 0x16, 0x04, 0x05, 0x04,
+  0x16, 0x04, 0x05, 0x04, 0x17, 0x03, 0x05, 0x03, 0x19, 0x03, 0x04, 0x02,
+  0x1B, 0x02, 0x03, 0x02, 0x1D, 0x05, 0x35, 0x02, 0x1F, 0x04, 0x1D, 0x06,
+  0x1B, 0x08, 0x1A, 0x02, 0x01, 0x06, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1D, 0x07, 0x19, 0x0C, 0x31, 0x06, 0x1C, 0x09,
+  0x18, 0x0C, 0x17, 0x0C, 0x16, 0x03, 0x04, 0x07, 0x15, 0x01, 0x07, 0x06,
+  0x15, 0x01, 0x08, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x04, 0x1F, 0x04,
+  0x1E, 0x04, 0x1F, 0x03, 0x1F, 0x03, 0x20, 0x02, 0x20, 0x03, 0x1F, 0x03,
+  0x1F, 0x03, 0x07, 0x01, 0x18, 0x02, 0x07, 0x02, 0x17, 0x0C, 0x16, 0x0C,
+  0x16, 0x0D, 0x15, 0x0E, 0x14, 0x0F, 0x32, 0x06, 0x1B, 0x0A, 0x17, 0x02,
+  0x04, 0x06, 0x16, 0x02, 0x06, 0x06, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x04,
+  0x1E, 0x03, 0x20, 0x01, 0x20, 0x05, 0x1C, 0x09, 0x1B, 0x09, 0x1C, 0x08,
+  0x1C, 0x07, 0x1D, 0x06, 0x1D, 0x06, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x04,
+  0x15, 0x02, 0x08, 0x04, 0x14, 0x05, 0x05, 0x04, 0x15, 0x06, 0x04, 0x03,
+  0x17, 0x0B, 0x19, 0x07, 0x38, 0x03, 0x20, 0x03, 0x1F, 0x04, 0x1E, 0x05,
+  0x1D, 0x06, 0x1C, 0x01, 0x01, 0x05, 0x1C, 0x01, 0x01, 0x05, 0x1B, 0x01,
+  0x02, 0x05, 0x1A, 0x01, 0x03, 0x05, 0x19, 0x01, 0x04, 0x05, 0x19, 0x01,
+  0x04, 0x05, 0x18, 0x01, 0x05, 0x05, 0x17, 0x01, 0x06, 0x05, 0x16, 0x01,
+  0x07, 0x05, 0x15, 0x01, 0x08, 0x05, 0x15, 0x10, 0x13, 0x10, 0x13, 0x10,
+  0x13, 0x10, 0x1C, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x31, 0x0B, 0x17, 0x0B, 0x18, 0x0B, 0x18, 0x0B, 0x17, 0x0B, 0x18, 0x01,
+  0x22, 0x01, 0x21, 0x06, 0x1D, 0x09, 0x1A, 0x0A, 0x18, 0x0D, 0x16, 0x0E,
+  0x1B, 0x08, 0x1E, 0x06, 0x1E, 0x05, 0x20, 0x03, 0x20, 0x03, 0x21, 0x02,
+  0x21, 0x02, 0x15, 0x03, 0x09, 0x02, 0x14, 0x05, 0x08, 0x01, 0x15, 0x06,
+  0x06, 0x02, 0x16, 0x07, 0x03, 0x02, 0x18, 0x09, 0x39, 0x04, 0x1C, 0x05,
+  0x1C, 0x04, 0x1D, 0x05, 0x1D, 0x05, 0x1D, 0x05, 0x1E, 0x04, 0x1E, 0x04,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x0B, 0x17, 0x05, 0x04, 0x05, 0x15, 0x05,
+  0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x06, 0x05, 0x13, 0x05,
+  0x06, 0x05, 0x13, 0x05, 0x06, 0x05, 0x13, 0x05, 0x06, 0x05, 0x14, 0x04,
+  0x06, 0x05, 0x14, 0x05, 0x05, 0x04, 0x16, 0x04, 0x05, 0x04, 0x16, 0x04,
+  0x05, 0x03, 0x19, 0x03, 0x03, 0x03, 0x1B, 0x06, 0x2F, 0x0D, 0x15, 0x0E,
+  0x15, 0x0E, 0x15, 0x0D, 0x16, 0x0D, 0x16, 0x02, 0x09, 0x02, 0x15, 0x02,
+  0x09, 0x02, 0x16, 0x01, 0x0A, 0x02, 0x21, 0x02, 0x20, 0x02, 0x21, 0x02,
+  0x20, 0x02, 0x21, 0x02, 0x21, 0x02, 0x20, 0x02, 0x21, 0x02, 0x21, 0x02,
+  0x20, 0x02, 0x21, 0x02, 0x21, 0x02, 0x20, 0x02, 0x21, 0x02, 0x21, 0x02,
+  0x20, 0x02, 0x31, 0x07, 0x1A, 0x04, 0x04, 0x03, 0x17, 0x04, 0x05, 0x04,
+  0x16, 0x04, 0x06, 0x04, 0x14, 0x05, 0x06, 0x04, 0x14, 0x05, 0x06, 0x04,
+  0x14, 0x06, 0x05, 0x04, 0x14, 0x07, 0x04, 0x03, 0x16, 0x07, 0x02, 0x04,
+  0x16, 0x0C, 0x18, 0x09, 0x1B, 0x09, 0x1B, 0x09, 0x19, 0x0B, 0x16, 0x04,
+  0x03, 0x06, 0x16, 0x03, 0x05, 0x06, 0x14, 0x04, 0x05, 0x06, 0x14, 0x04,
+  0x06, 0x05, 0x14, 0x04, 0x06, 0x05, 0x14, 0x04, 0x06, 0x05, 0x14, 0x04,
+  0x06, 0x04, 0x16, 0x04, 0x05, 0x03, 0x18, 0x04, 0x03, 0x03, 0x1B, 0x06,
+  0x32, 0x05, 0x1C, 0x03, 0x03, 0x03, 0x19, 0x03, 0x05, 0x03, 0x17, 0x04,
+  0x05, 0x04, 0x16, 0x04, 0x05, 0x05, 0x14, 0x05, 0x06, 0x04, 0x14, 0x05,
+  0x06, 0x05, 0x13, 0x05, 0x06, 0x05, 0x13, 0x05, 0x06, 0x05, 0x13, 0x05,
+  0x06, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x15, 0x05,
+  0x04, 0x05, 0x17, 0x0B, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x04, 0x1E, 0x05,
+  0x1D, 0x05, 0x1D, 0x05, 0x1D, 0x05, 0x1D, 0x04, 0x1C, 0x05, 0x1C, 0x04,
+  0xFF, 0x00, 0x4C, 0x03, 0x1F, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1F, 0x03,
+  0xF2, 0x03, 0x1F, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1F, 0x03, 0xFF, 0x00,
+  0x4B, 0x03, 0x1F, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1F, 0x03, 0xF2, 0x03,
+  0x1F, 0x05, 0x1E, 0x06, 0x1D, 0x06, 0x1E, 0x05, 0x21, 0x02, 0x21, 0x02,
+  0x21, 0x01, 0x21, 0x02, 0x20, 0x02, 0x20, 0x01, 0xC9, 0x01, 0x1F, 0x04,
+  0x1D, 0x05, 0x1C, 0x05, 0x1B, 0x05, 0x1C, 0x05, 0x1C, 0x05, 0x1B, 0x05,
+  0x1D, 0x04, 0x20, 0x05, 0x21, 0x05, 0x20, 0x05, 0x20, 0x05, 0x21, 0x05,
+  0x20, 0x05, 0x20, 0x04, 0x22, 0x01, 0xFF, 0x00, 0x67, 0x13, 0x10, 0x13,
+  0x9C, 0x13, 0x10, 0x13, 0xB8, 0x01, 0x22, 0x04, 0x20, 0x05, 0x20, 0x05,
+  0x21, 0x05, 0x20, 0x05, 0x20, 0x05, 0x21, 0x05, 0x20, 0x04, 0x1D, 0x05,
+  0x1B, 0x05, 0x1C, 0x05, 0x1C, 0x05, 0x1B, 0x05, 0x1C, 0x05, 0x1D, 0x04,
+  0x1F, 0x01, 0x32, 0x06, 0x1B, 0x02, 0x03, 0x05, 0x18, 0x03, 0x04, 0x05,
+  0x16, 0x04, 0x05, 0x05, 0x15, 0x05, 0x04, 0x05, 0x15, 0x05, 0x04, 0x05,
+  0x15, 0x05, 0x04, 0x05, 0x16, 0x03, 0x05, 0x05, 0x1D, 0x05, 0x1E, 0x04,
+  0x1E, 0x04, 0x1F, 0x03, 0x1F, 0x02, 0x21, 0x02, 0x21, 0x01, 0x22, 0x01,
+  0x8A, 0x03, 0x1F, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1F, 0x03, 0x33, 0x08,
+  0x18, 0x03, 0x08, 0x03, 0x13, 0x02, 0x0E, 0x02, 0x0F, 0x02, 0x11, 0x02,
+  0x0D, 0x02, 0x13, 0x02, 0x0B, 0x02, 0x15, 0x01, 0x0A, 0x02, 0x17, 0x01,
+  0x09, 0x01, 0x18, 0x01, 0x08, 0x01, 0x0B, 0x04, 0x02, 0x04, 0x04, 0x02,
+  0x07, 0x01, 0x09, 0x03, 0x02, 0x02, 0x01, 0x04, 0x05, 0x01, 0x06, 0x01,
+  0x09, 0x04, 0x03, 0x05, 0x06, 0x01, 0x06, 0x01, 0x08, 0x04, 0x04, 0x05,
+  0x06, 0x01, 0x05, 0x02, 0x07, 0x04, 0x05, 0x05, 0x06, 0x01, 0x05, 0x01,
+  0x07, 0x05, 0x05, 0x05, 0x06, 0x01, 0x05, 0x01, 0x07, 0x04, 0x05, 0x06,
+  0x06, 0x01, 0x05, 0x01, 0x06, 0x05, 0x05, 0x05, 0x07, 0x01, 0x05, 0x01,
+  0x06, 0x05, 0x05, 0x05, 0x06, 0x01, 0x06, 0x01, 0x05, 0x05, 0x05, 0x06,
+  0x06, 0x01, 0x06, 0x01, 0x05, 0x05, 0x05, 0x06, 0x05, 0x01, 0x07, 0x01,
+  0x05, 0x05, 0x04, 0x06, 0x06, 0x01, 0x07, 0x01, 0x05, 0x05, 0x03, 0x01,
+  0x01, 0x05, 0x05, 0x01, 0x09, 0x01, 0x04, 0x05, 0x02, 0x01, 0x02, 0x05,
+  0x04, 0x01, 0x0A, 0x01, 0x04, 0x07, 0x03, 0x05, 0x03, 0x01, 0x05, 0x01,
+  0x05, 0x01, 0x05, 0x04, 0x06, 0x07, 0x05, 0x01, 0x07, 0x01, 0x1A, 0x01,
+  0x08, 0x01, 0x18, 0x01, 0x09, 0x01, 0x17, 0x01, 0x0B, 0x01, 0x15, 0x01,
+  0x0D, 0x02, 0x12, 0x01, 0x10, 0x01, 0x0F, 0x02, 0x12, 0x03, 0x09, 0x03,
+  0x17, 0x09, 0x34, 0x01, 0x22, 0x02, 0x20, 0x03, 0x20, 0x04, 0x1E, 0x05,
+  0x1E, 0x06, 0x1C, 0x01, 0x01, 0x05, 0x1C, 0x01, 0x01, 0x05, 0x1B, 0x01,
+  0x03, 0x05, 0x1A, 0x01, 0x03, 0x05, 0x1A, 0x01, 0x03, 0x06, 0x18, 0x01,
+  0x05, 0x05, 0x18, 0x01, 0x05, 0x06, 0x16, 0x01, 0x07, 0x05, 0x16, 0x01,
+  0x07, 0x05, 0x15, 0x01, 0x09, 0x05, 0x14, 0x0F, 0x14, 0x01, 0x09, 0x06,
+  0x12, 0x01, 0x0B, 0x05, 0x12, 0x01, 0x0B, 0x06, 0x10, 0x01, 0x0D, 0x05,
+  0x10, 0x01, 0x0D, 0x06, 0x0E, 0x03, 0x0C, 0x06, 0x0C, 0x07, 0x07, 0x0B,
+  0x2B, 0x10, 0x15, 0x06, 0x04, 0x06, 0x14, 0x05, 0x06, 0x05, 0x13, 0x05,
+  0x06, 0x05, 0x13, 0x05, 0x07, 0x05, 0x12, 0x05, 0x07, 0x05, 0x12, 0x05,
+  0x07, 0x05, 0x12, 0x05, 0x07, 0x05, 0x12, 0x05, 0x06, 0x05, 0x13, 0x05,
+  0x06, 0x05, 0x13, 0x05, 0x04, 0x05, 0x15, 0x0D, 0x16, 0x05, 0x04, 0x06,
+  0x14, 0x05, 0x06, 0x05, 0x13, 0x05, 0x06, 0x06, 0x12, 0x05, 0x07, 0x06,
+  0x11, 0x05, 0x07, 0x06, 0x11, 0x05, 0x07, 0x06, 0x11, 0x05, 0x07, 0x06,
+  0x11, 0x05, 0x07, 0x06, 0x11, 0x05, 0x06, 0x06, 0x12, 0x05, 0x06, 0x05,
+  0x12, 0x06, 0x04, 0x06, 0x11, 0x10, 0x33, 0x07, 0x05, 0x01, 0x14, 0x04,
+  0x05, 0x02, 0x02, 0x02, 0x12, 0x04, 0x09, 0x04, 0x11, 0x04, 0x0B, 0x03,
+  0x10, 0x05, 0x0C, 0x02, 0x0F, 0x05, 0x0D, 0x02, 0x0F, 0x05, 0x0E, 0x01,
+  0x0E, 0x05, 0x0F, 0x01, 0x0E, 0x05, 0x1D, 0x06, 0x1D, 0x06, 0x1D, 0x06,
+  0x1D, 0x06, 0x1D, 0x06, 0x1D, 0x06, 0x1D, 0x06, 0x1E, 0x05, 0x1E, 0x06,
+  0x1E, 0x05, 0x1E, 0x06, 0x0C, 0x01, 0x11, 0x05, 0x0B, 0x02, 0x12, 0x05,
+  0x09, 0x02, 0x15, 0x05, 0x05, 0x03, 0x18, 0x08, 0x29, 0x0F, 0x16, 0x06,
+  0x04, 0x05, 0x15, 0x05, 0x06, 0x05, 0x13, 0x05, 0x07, 0x05, 0x12, 0x05,
+  0x07, 0x06, 0x11, 0x05, 0x08, 0x05, 0x11, 0x05, 0x08, 0x06, 0x10, 0x05,
+  0x09, 0x05, 0x10, 0x05, 0x09, 0x06, 0x0F, 0x05, 0x09, 0x06, 0x0F, 0x05,
+  0x09, 0x06, 0x0F, 0x05, 0x09, 0x06, 0x0F, 0x05, 0x09, 0x06, 0x0F, 0x05,
+  0x09, 0x06, 0x0F, 0x05, 0x09, 0x06, 0x0F, 0x05, 0x09, 0x06, 0x0F, 0x05,
+  0x09, 0x05, 0x10, 0x05, 0x08, 0x06, 0x10, 0x05, 0x08, 0x05, 0x11, 0x05,
+  0x08, 0x05, 0x11, 0x05, 0x07, 0x05, 0x12, 0x05, 0x06, 0x05, 0x12, 0x06,
+  0x05, 0x04, 0x12, 0x0F, 0x2B, 0x12, 0x13, 0x06, 0x06, 0x04, 0x14, 0x05,
+  0x07, 0x03, 0x14, 0x05, 0x08, 0x02, 0x14, 0x05, 0x09, 0x01, 0x14, 0x05,
+  0x09, 0x01, 0x14, 0x05, 0x05, 0x01, 0x18, 0x05, 0x05, 0x01, 0x18, 0x05,
+  0x04, 0x02, 0x18, 0x05, 0x04, 0x02, 0x18, 0x05, 0x03, 0x03, 0x18, 0x0B,
+  0x18, 0x05, 0x03, 0x03, 0x18, 0x05, 0x04, 0x02, 0x18, 0x05, 0x04, 0x02,
+  0x18, 0x05, 0x05, 0x01, 0x18, 0x05, 0x05, 0x01, 0x18, 0x05, 0x0A, 0x01,
+  0x13, 0x05, 0x0A, 0x01, 0x13, 0x05, 0x0A, 0x01, 0x13, 0x05, 0x09, 0x02,
+  0x13, 0x05, 0x08, 0x02, 0x13, 0x06, 0x06, 0x04, 0x11, 0x12, 0x2C, 0x13,
+  0x12, 0x06, 0x07, 0x04, 0x13, 0x05, 0x09, 0x02, 0x13, 0x05, 0x09, 0x02,
+  0x13, 0x05, 0x0A, 0x01, 0x13, 0x05, 0x0A, 0x01, 0x13, 0x05, 0x1E, 0x05,
+  0x05, 0x01, 0x18, 0x05, 0x05, 0x01, 0x18, 0x05, 0x04, 0x02, 0x18, 0x05,
+  0x04, 0x02, 0x18, 0x05, 0x03, 0x03, 0x18, 0x0B, 0x18, 0x05, 0x02, 0x04,
+  0x18, 0x05, 0x04, 0x02, 0x18, 0x05, 0x04, 0x02, 0x18, 0x05, 0x05, 0x01,
+  0x18, 0x05, 0x05, 0x01, 0x18, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1D, 0x07, 0x1A, 0x0B, 0x32, 0x07, 0x05, 0x01, 0x13, 0x04, 0x06, 0x02,
+  0x02, 0x02, 0x12, 0x04, 0x08, 0x05, 0x11, 0x04, 0x0B, 0x03, 0x10, 0x04,
+  0x0C, 0x03, 0x0F, 0x05, 0x0D, 0x02, 0x0E, 0x06, 0x0D, 0x02, 0x0E, 0x05,
+  0x0F, 0x01, 0x0E, 0x05, 0x1D, 0x06, 0x1D, 0x06, 0x1D, 0x06, 0x1D, 0x06,
+  0x1D, 0x06, 0x1D, 0x06, 0x08, 0x0B, 0x0A, 0x06, 0x0A, 0x07, 0x0D, 0x05,
+  0x0B, 0x05, 0x0E, 0x06, 0x0A, 0x05, 0x0F, 0x05, 0x0A, 0x05, 0x0F, 0x05,
+  0x0A, 0x05, 0x10, 0x05, 0x09, 0x05, 0x12, 0x04, 0x08, 0x05, 0x13, 0x05,
+  0x05, 0x05, 0x17, 0x09, 0x28, 0x0B, 0x03, 0x0B, 0x0C, 0x07, 0x07, 0x07,
+  0x0F, 0x05, 0x09, 0x05, 0x10, 0x05, 0x09, 0x05, 0x10, 0x05, 0x09, 0x05,
+  0x10, 0x05, 0x09, 0x05, 0x10, 0x05, 0x09, 0x05, 0x10, 0x05, 0x09, 0x05,
+  0x10, 0x05, 0x09, 0x05, 0x10, 0x05, 0x09, 0x05, 0x10, 0x05, 0x09, 0x05,
+  0x10, 0x13, 0x10, 0x05, 0x09, 0x05, 0x10, 0x05, 0x09, 0x05, 0x10, 0x05,
+  0x09, 0x05, 0x10, 0x05, 0x09, 0x05, 0x10, 0x05, 0x09, 0x05, 0x10, 0x05,
+  0x09, 0x05, 0x10, 0x05, 0x09, 0x05, 0x10, 0x05, 0x09, 0x05, 0x10, 0x05,
+  0x09, 0x05, 0x10, 0x05, 0x09, 0x05, 0x0F, 0x07, 0x07, 0x07, 0x0C, 0x0B,
+  0x03, 0x0B, 0x30, 0x0B, 0x1A, 0x07, 0x1D, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1D, 0x07,
+  0x1A, 0x0B, 0x32, 0x0C, 0x1A, 0x07, 0x1D, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x15, 0x03,
+  0x06, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05,
+  0x05, 0x05, 0x14, 0x04, 0x06, 0x04, 0x16, 0x03, 0x06, 0x04, 0x17, 0x03,
+  0x04, 0x03, 0x1B, 0x06, 0x28, 0x0B, 0x06, 0x09, 0x0B, 0x07, 0x0B, 0x04,
+  0x0E, 0x05, 0x0C, 0x03, 0x0F, 0x05, 0x0B, 0x02, 0x11, 0x05, 0x0B, 0x01,
+  0x12, 0x05, 0x09, 0x02, 0x13, 0x05, 0x08, 0x01, 0x15, 0x05, 0x07, 0x01,
+  0x16, 0x05, 0x05, 0x02, 0x17, 0x05, 0x04, 0x01, 0x19, 0x05, 0x03, 0x02,
+  0x19, 0x05, 0x01, 0x05, 0x18, 0x0C, 0x17, 0x05, 0x02, 0x06, 0x16, 0x05,
+  0x03, 0x06, 0x15, 0x05, 0x04, 0x06, 0x14, 0x05, 0x04, 0x07, 0x13, 0x05,
+  0x05, 0x07, 0x12, 0x05, 0x06, 0x06, 0x12, 0x05, 0x07, 0x06, 0x11, 0x05,
+  0x08, 0x06, 0x10, 0x05, 0x08, 0x07, 0x0E, 0x07, 0x07, 0x09, 0x0A, 0x0B,
+  0x04, 0x0C, 0x2B, 0x0B, 0x1A, 0x07, 0x1D, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x0C, 0x01, 0x11, 0x05, 0x0C, 0x01, 0x11, 0x05, 0x0B, 0x02, 0x11, 0x05,
+  0x0B, 0x02, 0x11, 0x05, 0x0A, 0x02, 0x12, 0x05, 0x09, 0x03, 0x11, 0x06,
+  0x08, 0x04, 0x0F, 0x14, 0x26, 0x08, 0x0F, 0x08, 0x06, 0x07, 0x0E, 0x06,
+  0x09, 0x06, 0x0D, 0x06, 0x0A, 0x06, 0x0D, 0x06, 0x0A, 0x07, 0x0B, 0x01,
+  0x01, 0x05, 0x0A, 0x01, 0x01, 0x05, 0x0B, 0x01, 0x01, 0x05, 0x0A, 0x01,
+  0x01, 0x06, 0x09, 0x01, 0x02, 0x05, 0x0A, 0x01, 0x02, 0x05, 0x09, 0x01,
+  0x02, 0x05, 0x0A, 0x01, 0x02, 0x06, 0x08, 0x01, 0x02, 0x05, 0x0A, 0x01,
+  0x03, 0x05, 0x07, 0x01, 0x03, 0x05, 0x0A, 0x01, 0x03, 0x05, 0x07, 0x01,
+  0x03, 0x05, 0x0A, 0x01, 0x03, 0x06, 0x05, 0x01, 0x04, 0x05, 0x0A, 0x01,
+  0x04, 0x05, 0x05, 0x01, 0x04, 0x05, 0x0A, 0x01, 0x04, 0x06, 0x03, 0x01,
+  0x05, 0x05, 0x0A, 0x01, 0x05, 0x05, 0x03, 0x01, 0x05, 0x05, 0x0A, 0x01,
+  0x05, 0x05, 0x02, 0x01, 0x06, 0x05, 0x0A, 0x01, 0x06, 0x05, 0x01, 0x01,
+  0x06, 0x05, 0x0A, 0x01, 0x06, 0x05, 0x01, 0x01, 0x06, 0x05, 0x0A, 0x01,
+  0x06, 0x06, 0x07, 0x05, 0x0A, 0x01, 0x07, 0x05, 0x07, 0x05, 0x0A, 0x01,
+  0x07, 0x04, 0x08, 0x05, 0x0A, 0x01, 0x08, 0x03, 0x08, 0x05, 0x09, 0x03,
+  0x07, 0x02, 0x08, 0x07, 0x06, 0x07, 0x06, 0x01, 0x06, 0x0B, 0x29, 0x08,
+  0x08, 0x07, 0x0E, 0x07, 0x09, 0x03, 0x11, 0x06, 0x0A, 0x01, 0x12, 0x07,
+  0x09, 0x01, 0x12, 0x01, 0x01, 0x06, 0x08, 0x01, 0x12, 0x01, 0x02, 0x06,
+  0x07, 0x01, 0x12, 0x01, 0x02, 0x06, 0x07, 0x01, 0x12, 0x01, 0x03, 0x06,
+  0x06, 0x01, 0x12, 0x01, 0x04, 0x06, 0x05, 0x01, 0x12, 0x01, 0x05, 0x06,
+  0x04, 0x01, 0x12, 0x01, 0x05, 0x06, 0x04, 0x01, 0x12, 0x01, 0x06, 0x06,
+  0x03, 0x01, 0x12, 0x01, 0x07, 0x06, 0x02, 0x01, 0x12, 0x01, 0x08, 0x06,
+  0x01, 0x01, 0x12, 0x01, 0x08, 0x06, 0x01, 0x01, 0x12, 0x01, 0x09, 0x07,
+  0x12, 0x01, 0x0A, 0x06, 0x12, 0x01, 0x0B, 0x05, 0x12, 0x01, 0x0B, 0x05,
+  0x12, 0x01, 0x0C, 0x04, 0x12, 0x01, 0x0D, 0x03, 0x12, 0x01, 0x0E, 0x02,
+  0x11, 0x03, 0x0D, 0x02, 0x0F, 0x07, 0x0C, 0x01, 0x31, 0x08, 0x19, 0x04,
+  0x04, 0x04, 0x15, 0x05, 0x07, 0x04, 0x12, 0x05, 0x08, 0x05, 0x10, 0x05,
+  0x0A, 0x05, 0x0F, 0x05, 0x0A, 0x05, 0x0E, 0x06, 0x0B, 0x05, 0x0D, 0x05,
+  0x0C, 0x05, 0x0C, 0x06, 0x0C, 0x06, 0x0B, 0x06, 0x0C, 0x06, 0x0B, 0x06,
+  0x0C, 0x06, 0x0B, 0x06, 0x0C, 0x06, 0x0B, 0x06, 0x0C, 0x06, 0x0B, 0x06,
+  0x0C, 0x06, 0x0B, 0x06, 0x0C, 0x06, 0x0B, 0x06, 0x0C, 0x06, 0x0C, 0x05,
+  0x0C, 0x05, 0x0D, 0x06, 0x0A, 0x06, 0x0E, 0x05, 0x0A, 0x05, 0x0F, 0x05,
+  0x0A, 0x05, 0x10, 0x05, 0x08, 0x05, 0x12, 0x04, 0x08, 0x04, 0x15, 0x04,
+  0x04, 0x04, 0x19, 0x08, 0x2B, 0x0F, 0x16, 0x06, 0x04, 0x05, 0x15, 0x05,
+  0x06, 0x04, 0x14, 0x05, 0x06, 0x05, 0x13, 0x05, 0x07, 0x05, 0x12, 0x05,
+  0x07, 0x05, 0x12, 0x05, 0x07, 0x05, 0x12, 0x05, 0x07, 0x05, 0x12, 0x05,
+  0x07, 0x05, 0x12, 0x05, 0x06, 0x05, 0x13, 0x05, 0x06, 0x04, 0x14, 0x05,
+  0x04, 0x05, 0x15, 0x0C, 0x17, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1D, 0x07,
+  0x1A, 0x0B, 0x32, 0x07, 0x19, 0x04, 0x05, 0x04, 0x15, 0x04, 0x07, 0x04,
+  0x12, 0x05, 0x09, 0x05, 0x10, 0x04, 0x0B, 0x04, 0x0F, 0x05, 0x0B, 0x05,
+  0x0D, 0x06, 0x0B, 0x06, 0x0C, 0x05, 0x0D, 0x05, 0x0B, 0x06, 0x0D, 0x06,
+  0x0A, 0x06, 0x0D, 0x06, 0x0A, 0x06, 0x0D, 0x06, 0x0A, 0x06, 0x0D, 0x06,
+  0x0A, 0x06, 0x0D, 0x06, 0x0A, 0x06, 0x0D, 0x06, 0x0A, 0x06, 0x0D, 0x06,
+  0x0A, 0x06, 0x0D, 0x06, 0x0B, 0x05, 0x0D, 0x05, 0x0C, 0x06, 0x0B, 0x06,
+  0x0D, 0x05, 0x0B, 0x05, 0x0E, 0x05, 0x0B, 0x05, 0x0F, 0x05, 0x09, 0x05,
+  0x11, 0x05, 0x07, 0x05, 0x14, 0x04, 0x05, 0x05, 0x17, 0x0A, 0x1B, 0x06,
+  0x1D, 0x07, 0x1D, 0x07, 0x1E, 0x06, 0x1F, 0x09, 0x29, 0x10, 0x15, 0x06,
+  0x05, 0x05, 0x14, 0x05, 0x07, 0x05, 0x12, 0x05, 0x07, 0x05, 0x12, 0x05,
+  0x08, 0x05, 0x11, 0x05, 0x08, 0x05, 0x11, 0x05, 0x08, 0x05, 0x11, 0x05,
+  0x08, 0x05, 0x11, 0x05, 0x08, 0x05, 0x11, 0x05, 0x07, 0x05, 0x12, 0x05,
+  0x07, 0x05, 0x12, 0x05, 0x05, 0x05, 0x14, 0x0D, 0x16, 0x05, 0x02, 0x06,
+  0x16, 0x05, 0x03, 0x06, 0x15, 0x05, 0x04, 0x05, 0x15, 0x05, 0x04, 0x06,
+  0x14, 0x05, 0x05, 0x06, 0x13, 0x05, 0x06, 0x06, 0x12, 0x05, 0x06, 0x06,
+  0x12, 0x05, 0x07, 0x06, 0x11, 0x05, 0x08, 0x06, 0x0F, 0x07, 0x08, 0x06,
+  0x0C, 0x0B, 0x06, 0x08, 0x31, 0x06, 0x04, 0x01, 0x16, 0x04, 0x04, 0x02,
+  0x02, 0x01, 0x15, 0x04, 0x06, 0x04, 0x15, 0x03, 0x08, 0x03, 0x14, 0x04,
+  0x09, 0x02, 0x14, 0x04, 0x09, 0x02, 0x14, 0x05, 0x09, 0x01, 0x14, 0x06,
+  0x08, 0x01, 0x14, 0x08, 0x1C, 0x09, 0x1A, 0x0B, 0x19, 0x0B, 0x1A, 0x0A,
+  0x1A, 0x0A, 0x1B, 0x09, 0x13, 0x01, 0x08, 0x07, 0x13, 0x01, 0x09, 0x06,
+  0x13, 0x02, 0x09, 0x05, 0x13, 0x02, 0x0A, 0x04, 0x13, 0x03, 0x09, 0x04,
+  0x13, 0x03, 0x09, 0x03, 0x14, 0x04, 0x07, 0x03, 0x15, 0x02, 0x02, 0x02,
+  0x04, 0x03, 0x16, 0x01, 0x05, 0x05, 0x2A, 0x15, 0x0E, 0x03, 0x05, 0x05,
+  0x04, 0x04, 0x0E, 0x02, 0x06, 0x05, 0x06, 0x02, 0x0E, 0x02, 0x06, 0x05,
+  0x06, 0x02, 0x0E, 0x01, 0x07, 0x05, 0x07, 0x01, 0x0E, 0x01, 0x07, 0x05,
+  0x07, 0x01, 0x16, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1D, 0x07,
+  0x1A, 0x0B, 0x29, 0x0B, 0x05, 0x07, 0x0E, 0x06, 0x0A, 0x03, 0x11, 0x05,
+  0x0B, 0x01, 0x12, 0x05, 0x0B, 0x01, 0x12, 0x05, 0x0B, 0x01, 0x12, 0x05,
+  0x0B, 0x01, 0x12, 0x05, 0x0B, 0x01, 0x12, 0x05, 0x0B, 0x01, 0x12, 0x05,
+  0x0B, 0x01, 0x12, 0x05, 0x0B, 0x01, 0x12, 0x05, 0x0B, 0x01, 0x12, 0x05,
+  0x0B, 0x01, 0x12, 0x05, 0x0B, 0x01, 0x12, 0x05, 0x0B, 0x01, 0x12, 0x05,
+  0x0B, 0x01, 0x12, 0x05, 0x0B, 0x01, 0x12, 0x05, 0x0B, 0x01, 0x12, 0x05,
+  0x0B, 0x01, 0x12, 0x05, 0x0B, 0x01, 0x13, 0x04, 0x0A, 0x01, 0x14, 0x05,
+  0x09, 0x01, 0x15, 0x04, 0x08, 0x01, 0x17, 0x04, 0x06, 0x01, 0x1A, 0x08,
+  0x29, 0x0A, 0x06, 0x08, 0x0C, 0x07, 0x0B, 0x03, 0x0F, 0x06, 0x0B, 0x02,
+  0x10, 0x06, 0x0B, 0x01, 0x12, 0x05, 0x0B, 0x01, 0x12, 0x06, 0x09, 0x01,
+  0x14, 0x05, 0x09, 0x01, 0x14, 0x06, 0x08, 0x01, 0x15, 0x05, 0x07, 0x01,
+  0x16, 0x05, 0x07, 0x01, 0x16, 0x06, 0x05, 0x01, 0x18, 0x05, 0x05, 0x01,
+  0x18, 0x06, 0x03, 0x01, 0x1A, 0x05, 0x03, 0x01, 0x1A, 0x05, 0x03, 0x01,
+  0x1A, 0x06, 0x01, 0x01, 0x1C, 0x05, 0x01, 0x01, 0x1C, 0x06, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x04, 0x20, 0x03, 0x20, 0x02, 0x22, 0x01, 0x23, 0x0A,
+  0x03, 0x0B, 0x05, 0x06, 0x02, 0x06, 0x07, 0x07, 0x09, 0x03, 0x04, 0x05,
+  0x08, 0x05, 0x0A, 0x02, 0x05, 0x05, 0x08, 0x06, 0x09, 0x01, 0x07, 0x05,
+  0x08, 0x05, 0x09, 0x01, 0x07, 0x05, 0x08, 0x06, 0x07, 0x01, 0x08, 0x06,
+  0x07, 0x06, 0x07, 0x01, 0x09, 0x05, 0x07, 0x06, 0x07, 0x01, 0x09, 0x05,
+  0x07, 0x07, 0x05, 0x01, 0x0A, 0x06, 0x05, 0x01, 0x02, 0x05, 0x05, 0x01,
+  0x0B, 0x05, 0x05, 0x01, 0x02, 0x05, 0x05, 0x01, 0x0B, 0x05, 0x05, 0x01,
+  0x02, 0x06, 0x03, 0x01, 0x0D, 0x05, 0x03, 0x01, 0x04, 0x05, 0x03, 0x01,
+  0x0D, 0x05, 0x03, 0x01, 0x04, 0x05, 0x03, 0x01, 0x0D, 0x06, 0x01, 0x01,
+  0x06, 0x05, 0x01, 0x01, 0x0F, 0x05, 0x01, 0x01, 0x06, 0x05, 0x01, 0x01,
+  0x0F, 0x05, 0x01, 0x01, 0x06, 0x06, 0x10, 0x06, 0x08, 0x05, 0x11, 0x05,
+  0x08, 0x05, 0x11, 0x04, 0x09, 0x04, 0x12, 0x04, 0x0A, 0x03, 0x13, 0x03,
+  0x0A, 0x03, 0x13, 0x02, 0x0B, 0x02, 0x15, 0x01, 0x0C, 0x01, 0x29, 0x0A,
+  0x05, 0x08, 0x0D, 0x07, 0x09, 0x04, 0x10, 0x06, 0x09, 0x02, 0x13, 0x06,
+  0x08, 0x01, 0x14, 0x06, 0x07, 0x01, 0x16, 0x06, 0x06, 0x01, 0x17, 0x06,
+  0x04, 0x01, 0x18, 0x06, 0x03, 0x01, 0x1A, 0x06, 0x01, 0x01, 0x1C, 0x06,
+  0x1D, 0x06, 0x1E, 0x06, 0x1E, 0x06, 0x1D, 0x06, 0x1C, 0x01, 0x01, 0x06,
+  0x1B, 0x01, 0x02, 0x06, 0x19, 0x01, 0x03, 0x06, 0x18, 0x01, 0x05, 0x06,
+  0x16, 0x01, 0x07, 0x05, 0x15, 0x01, 0x08, 0x06, 0x13, 0x02, 0x09, 0x06,
+  0x11, 0x02, 0x0B, 0x06, 0x0F, 0x04, 0x09, 0x08, 0x0C, 0x09, 0x05, 0x0A,
+  0x29, 0x0A, 0x07, 0x06, 0x0E, 0x06, 0x0B, 0x03, 0x0F, 0x06, 0x0C, 0x01,
+  0x11, 0x06, 0x0A, 0x01, 0x13, 0x05, 0x0A, 0x01, 0x13, 0x06, 0x08, 0x01,
+  0x15, 0x05, 0x08, 0x01, 0x15, 0x06, 0x06, 0x01, 0x17, 0x05, 0x05, 0x01,
+  0x18, 0x06, 0x04, 0x01, 0x19, 0x05, 0x03, 0x01, 0x1A, 0x06, 0x02, 0x01,
+  0x1B, 0x05, 0x01, 0x01, 0x1C, 0x07, 0x1D, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1B, 0x0B, 0x2D, 0x12, 0x11, 0x04, 0x08, 0x05, 0x12, 0x02, 0x09, 0x05,
+  0x12, 0x02, 0x09, 0x06, 0x12, 0x02, 0x09, 0x05, 0x13, 0x01, 0x09, 0x05,
+  0x14, 0x01, 0x08, 0x06, 0x1D, 0x05, 0x1D, 0x06, 0x1C, 0x06, 0x1D, 0x05,
+  0x1D, 0x06, 0x1C, 0x06, 0x1D, 0x05, 0x1D, 0x06, 0x1C, 0x06, 0x0A, 0x01,
+  0x12, 0x05, 0x0B, 0x01, 0x11, 0x06, 0x0A, 0x02, 0x11, 0x05, 0x0B, 0x02,
+  0x10, 0x05, 0x0B, 0x03, 0x0F, 0x06, 0x0A, 0x03, 0x10, 0x05, 0x0A, 0x04,
+  0x0F, 0x05, 0x09, 0x06, 0x0E, 0x15, 0x33, 0x07, 0x1C, 0x04, 0x1F, 0x04,
+  0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04,
+  0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04,
+  0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04,
+  0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04,
+  0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x07, 0x30, 0x02, 0x21, 0x03,
+  0x21, 0x02, 0x21, 0x02, 0x21, 0x03, 0x21, 0x02, 0x21, 0x02, 0x21, 0x03,
+  0x21, 0x02, 0x21, 0x02, 0x21, 0x03, 0x21, 0x02, 0x21, 0x02, 0x21, 0x03,
+  0x21, 0x02, 0x21, 0x02, 0x21, 0x03, 0x21, 0x02, 0x21, 0x02, 0x21, 0x03,
+  0x21, 0x02, 0x21, 0x02, 0x21, 0x03, 0x21, 0x02, 0x30, 0x07, 0x1F, 0x04,
+  0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04,
+  0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04,
+  0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04,
+  0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04,
+  0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1C, 0x07, 0x34, 0x01,
+  0x21, 0x03, 0x20, 0x03, 0x1F, 0x02, 0x01, 0x02, 0x1D, 0x03, 0x01, 0x03,
+  0x1C, 0x02, 0x03, 0x02, 0x1B, 0x02, 0x05, 0x02, 0x1A, 0x02, 0x05, 0x02,
+  0x19, 0x02, 0x07, 0x02, 0x17, 0x03, 0x07, 0x03, 0x16, 0x02, 0x09, 0x02,
+  0x15, 0x02, 0x0B, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0x49, 0x13, 0x10, 0x13, 0x53, 0x04, 0x20, 0x04, 0x20, 0x03, 0x21, 0x02,
+  0x22, 0x02, 0xFF, 0x00, 0x4B, 0x06, 0x1B, 0x02, 0x03, 0x05, 0x18, 0x03,
+  0x04, 0x05, 0x16, 0x05, 0x03, 0x05, 0x16, 0x05, 0x03, 0x05, 0x17, 0x03,
+  0x04, 0x05, 0x1D, 0x06, 0x1B, 0x02, 0x01, 0x05, 0x19, 0x03, 0x02, 0x05,
+  0x18, 0x03, 0x03, 0x05, 0x17, 0x04, 0x03, 0x05, 0x16, 0x05, 0x03, 0x05,
+  0x16, 0x05, 0x03, 0x05, 0x16, 0x05, 0x02, 0x06, 0x16, 0x07, 0x01, 0x07,
+  0x15, 0x05, 0x03, 0x04, 0x2C, 0x07, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x02, 0x04,
+  0x18, 0x05, 0x01, 0x07, 0x16, 0x06, 0x03, 0x05, 0x15, 0x05, 0x04, 0x05,
+  0x15, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x04, 0x15, 0x05, 0x05, 0x04,
+  0x15, 0x05, 0x04, 0x04, 0x16, 0x02, 0x01, 0x03, 0x03, 0x03, 0x17, 0x01,
+  0x04, 0x05, 0xFF, 0x00, 0x4C, 0x06, 0x1B, 0x03, 0x03, 0x04, 0x18, 0x04,
+  0x03, 0x05, 0x16, 0x04, 0x04, 0x05, 0x16, 0x04, 0x05, 0x03, 0x16, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x06, 0x1E, 0x05,
+  0x1E, 0x06, 0x05, 0x02, 0x17, 0x06, 0x03, 0x02, 0x19, 0x09, 0x1C, 0x05,
+  0x34, 0x07, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x18, 0x04, 0x02, 0x05, 0x16, 0x04, 0x02, 0x07,
+  0x16, 0x04, 0x03, 0x06, 0x15, 0x04, 0x05, 0x05, 0x15, 0x04, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x15, 0x05, 0x04, 0x05, 0x15, 0x05, 0x03, 0x06,
+  0x16, 0x07, 0x01, 0x07, 0x16, 0x04, 0x02, 0x04, 0xFF, 0x00, 0x4C, 0x05,
+  0x1C, 0x03, 0x02, 0x04, 0x19, 0x03, 0x04, 0x04, 0x17, 0x04, 0x04, 0x04,
+  0x17, 0x04, 0x04, 0x05, 0x15, 0x05, 0x04, 0x05, 0x15, 0x0E, 0x15, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x06, 0x1E, 0x05, 0x07, 0x01, 0x16, 0x06,
+  0x05, 0x01, 0x18, 0x06, 0x03, 0x01, 0x1A, 0x08, 0x1C, 0x06, 0x37, 0x06,
+  0x1B, 0x03, 0x02, 0x04, 0x19, 0x04, 0x02, 0x04, 0x19, 0x04, 0x02, 0x04,
+  0x18, 0x05, 0x03, 0x02, 0x19, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1C, 0x09,
+  0x1A, 0x09, 0x1C, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1C, 0x09, 0xFF, 0x00, 0x4B, 0x0C, 0x15, 0x04,
+  0x02, 0x08, 0x14, 0x04, 0x04, 0x04, 0x16, 0x05, 0x04, 0x05, 0x15, 0x05,
+  0x04, 0x05, 0x15, 0x05, 0x04, 0x05, 0x15, 0x05, 0x04, 0x05, 0x15, 0x05,
+  0x04, 0x05, 0x16, 0x04, 0x04, 0x04, 0x18, 0x04, 0x02, 0x04, 0x1B, 0x06,
+  0x1B, 0x02, 0x20, 0x02, 0x20, 0x03, 0x20, 0x0D, 0x16, 0x0F, 0x15, 0x0F,
+  0x15, 0x0E, 0x13, 0x03, 0x0A, 0x03, 0x13, 0x02, 0x0C, 0x02, 0x13, 0x02,
+  0x0C, 0x01, 0x15, 0x03, 0x08, 0x02, 0x18, 0x09, 0x2B, 0x07, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x03, 0x04, 0x17, 0x05, 0x01, 0x08, 0x15, 0x07, 0x02, 0x05,
+  0x15, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x12, 0x08, 0x03, 0x08, 0x33, 0x03, 0x1F, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1F, 0x03, 0x86, 0x07, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1C, 0x09, 0x34, 0x03,
+  0x1F, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1F, 0x03, 0x86, 0x07, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1A, 0x02, 0x02, 0x05,
+  0x19, 0x03, 0x02, 0x05, 0x19, 0x03, 0x02, 0x04, 0x1A, 0x03, 0x02, 0x04,
+  0x1C, 0x05, 0x2C, 0x07, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x04, 0x06, 0x14, 0x05,
+  0x05, 0x03, 0x16, 0x05, 0x05, 0x02, 0x17, 0x05, 0x05, 0x01, 0x18, 0x05,
+  0x04, 0x01, 0x19, 0x05, 0x03, 0x02, 0x19, 0x05, 0x02, 0x04, 0x18, 0x05,
+  0x01, 0x05, 0x18, 0x0C, 0x17, 0x05, 0x02, 0x05, 0x17, 0x05, 0x02, 0x06,
+  0x16, 0x05, 0x03, 0x06, 0x15, 0x05, 0x04, 0x05, 0x15, 0x05, 0x04, 0x06,
+  0x14, 0x05, 0x05, 0x06, 0x11, 0x09, 0x02, 0x08, 0x30, 0x07, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1C, 0x09, 0xFF, 0x00, 0x40, 0x07,
+  0x02, 0x05, 0x05, 0x04, 0x0E, 0x05, 0x01, 0x07, 0x02, 0x07, 0x0D, 0x06,
+  0x03, 0x06, 0x03, 0x05, 0x0C, 0x05, 0x04, 0x05, 0x04, 0x05, 0x0C, 0x05,
+  0x04, 0x05, 0x04, 0x05, 0x0C, 0x05, 0x04, 0x05, 0x04, 0x05, 0x0C, 0x05,
+  0x04, 0x05, 0x04, 0x05, 0x0C, 0x05, 0x04, 0x05, 0x04, 0x05, 0x0C, 0x05,
+  0x04, 0x05, 0x04, 0x05, 0x0C, 0x05, 0x04, 0x05, 0x04, 0x05, 0x0C, 0x05,
+  0x04, 0x05, 0x04, 0x05, 0x0C, 0x05, 0x04, 0x05, 0x04, 0x05, 0x0C, 0x05,
+  0x04, 0x05, 0x04, 0x05, 0x0C, 0x05, 0x04, 0x05, 0x04, 0x05, 0x0C, 0x05,
+  0x04, 0x05, 0x04, 0x05, 0x0A, 0x08, 0x02, 0x07, 0x02, 0x08, 0xFF, 0x00,
+  0x44, 0x07, 0x03, 0x05, 0x16, 0x05, 0x01, 0x08, 0x15, 0x07, 0x02, 0x06,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x12, 0x08, 0x03, 0x08, 0xFF, 0x00, 0x4B, 0x06, 0x1B, 0x03, 0x04, 0x03,
+  0x18, 0x04, 0x04, 0x04, 0x16, 0x04, 0x06, 0x04, 0x15, 0x04, 0x06, 0x04,
+  0x14, 0x05, 0x06, 0x05, 0x13, 0x05, 0x06, 0x05, 0x13, 0x05, 0x06, 0x05,
+  0x13, 0x05, 0x06, 0x05, 0x13, 0x05, 0x06, 0x05, 0x13, 0x05, 0x06, 0x05,
+  0x14, 0x04, 0x06, 0x04, 0x15, 0x04, 0x06, 0x04, 0x16, 0x04, 0x04, 0x04,
+  0x18, 0x03, 0x04, 0x03, 0x1B, 0x06, 0xFF, 0x00, 0x45, 0x07, 0x01, 0x05,
+  0x18, 0x0D, 0x16, 0x06, 0x03, 0x05, 0x15, 0x05, 0x04, 0x05, 0x15, 0x05,
+  0x05, 0x04, 0x15, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05,
+  0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05,
+  0x05, 0x05, 0x14, 0x05, 0x05, 0x04, 0x15, 0x05, 0x05, 0x04, 0x15, 0x05,
+  0x04, 0x05, 0x15, 0x06, 0x03, 0x04, 0x16, 0x05, 0x01, 0x05, 0x18, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1C, 0x09,
+  0xFF, 0x00, 0x4A, 0x05, 0x04, 0x01, 0x17, 0x03, 0x03, 0x03, 0x01, 0x02,
+  0x16, 0x04, 0x04, 0x05, 0x15, 0x04, 0x05, 0x05, 0x15, 0x04, 0x05, 0x05,
+  0x15, 0x04, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x15, 0x05, 0x04, 0x05, 0x15, 0x05, 0x03, 0x06,
+  0x16, 0x07, 0x01, 0x05, 0x18, 0x04, 0x02, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1C, 0x09, 0xFF, 0x00,
+  0x47, 0x07, 0x03, 0x03, 0x18, 0x05, 0x02, 0x05, 0x17, 0x05, 0x01, 0x01,
+  0x01, 0x04, 0x17, 0x06, 0x02, 0x04, 0x17, 0x06, 0x03, 0x02, 0x18, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1C, 0x09, 0xFF, 0x00, 0x4B, 0x05,
+  0x02, 0x01, 0x19, 0x03, 0x03, 0x04, 0x19, 0x02, 0x05, 0x03, 0x18, 0x04,
+  0x05, 0x02, 0x18, 0x05, 0x05, 0x01, 0x18, 0x07, 0x1D, 0x08, 0x1B, 0x09,
+  0x1C, 0x08, 0x1C, 0x08, 0x1D, 0x06, 0x17, 0x01, 0x07, 0x04, 0x17, 0x02,
+  0x07, 0x03, 0x17, 0x03, 0x06, 0x02, 0x18, 0x05, 0x03, 0x02, 0x19, 0x01,
+  0x03, 0x05, 0x7C, 0x01, 0x22, 0x01, 0x21, 0x02, 0x20, 0x03, 0x1F, 0x04,
+  0x1E, 0x05, 0x1D, 0x0A, 0x18, 0x0B, 0x1A, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x02, 0x01, 0x1B, 0x05, 0x01, 0x02, 0x1C, 0x06,
+  0x1E, 0x04, 0xFF, 0x00, 0x44, 0x07, 0x03, 0x07, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x04, 0x06, 0x15, 0x05, 0x02, 0x07,
+  0x15, 0x08, 0x01, 0x05, 0x17, 0x05, 0x02, 0x07, 0xFF, 0x00, 0x45, 0x09,
+  0x03, 0x05, 0x13, 0x06, 0x06, 0x03, 0x15, 0x05, 0x07, 0x01, 0x16, 0x06,
+  0x05, 0x01, 0x18, 0x05, 0x05, 0x01, 0x18, 0x06, 0x03, 0x01, 0x1A, 0x05,
+  0x03, 0x01, 0x1A, 0x05, 0x03, 0x01, 0x1B, 0x05, 0x01, 0x01, 0x1C, 0x05,
+  0x01, 0x01, 0x1C, 0x06, 0x1E, 0x05, 0x1E, 0x04, 0x20, 0x03, 0x20, 0x02,
+  0x22, 0x01, 0xFF, 0x00, 0x42, 0x08, 0x01, 0x08, 0x02, 0x05, 0x0C, 0x06,
+  0x03, 0x06, 0x04, 0x02, 0x0E, 0x06, 0x04, 0x05, 0x05, 0x01, 0x0F, 0x05,
+  0x04, 0x06, 0x03, 0x01, 0x10, 0x06, 0x03, 0x06, 0x03, 0x01, 0x11, 0x05,
+  0x03, 0x06, 0x03, 0x01, 0x11, 0x05, 0x02, 0x01, 0x01, 0x06, 0x01, 0x01,
+  0x13, 0x05, 0x01, 0x01, 0x02, 0x05, 0x01, 0x01, 0x13, 0x05, 0x01, 0x01,
+  0x02, 0x05, 0x01, 0x01, 0x13, 0x06, 0x03, 0x06, 0x15, 0x05, 0x04, 0x05,
+  0x15, 0x05, 0x04, 0x05, 0x16, 0x03, 0x05, 0x05, 0x16, 0x03, 0x06, 0x03,
+  0x17, 0x03, 0x06, 0x03, 0x18, 0x01, 0x08, 0x02, 0xFF, 0x00, 0x46, 0x08,
+  0x01, 0x06, 0x15, 0x06, 0x04, 0x02, 0x18, 0x06, 0x03, 0x01, 0x1A, 0x05,
+  0x02, 0x01, 0x1B, 0x06, 0x01, 0x01, 0x1C, 0x06, 0x1D, 0x06, 0x1E, 0x06,
+  0x1E, 0x05, 0x1E, 0x06, 0x1D, 0x06, 0x1C, 0x01, 0x01, 0x06, 0x1A, 0x01,
+  0x03, 0x05, 0x19, 0x02, 0x03, 0x06, 0x17, 0x03, 0x04, 0x06, 0x14, 0x07,
+  0x01, 0x08, 0xFF, 0x00, 0x45, 0x09, 0x03, 0x05, 0x13, 0x06, 0x07, 0x02,
+  0x15, 0x05, 0x07, 0x01, 0x16, 0x06, 0x06, 0x01, 0x17, 0x05, 0x05, 0x01,
+  0x18, 0x06, 0x04, 0x01, 0x19, 0x05, 0x03, 0x01, 0x1A, 0x06, 0x02, 0x01,
+  0x1B, 0x05, 0x02, 0x01, 0x1B, 0x07, 0x1D, 0x06, 0x1D, 0x05, 0x1F, 0x04,
+  0x1F, 0x04, 0x20, 0x02, 0x21, 0x02, 0x21, 0x01, 0x22, 0x01, 0x1B, 0x03,
+  0x04, 0x01, 0x1A, 0x05, 0x02, 0x01, 0x1B, 0x05, 0x01, 0x01, 0x1C, 0x07,
+  0x1D, 0x05, 0xFF, 0x00, 0x48, 0x0C, 0x17, 0x02, 0x04, 0x05, 0x18, 0x02,
+  0x03, 0x06, 0x18, 0x01, 0x04, 0x05, 0x19, 0x01, 0x03, 0x06, 0x1D, 0x05,
+  0x1D, 0x06, 0x1D, 0x05, 0x1D, 0x06, 0x1D, 0x05, 0x1D, 0x06, 0x1D, 0x05,
+  0x05, 0x01, 0x17, 0x06, 0x05, 0x01, 0x17, 0x05, 0x05, 0x02, 0x16, 0x06,
+  0x04, 0x03, 0x16, 0x0D, 0x36, 0x03, 0x1E, 0x04, 0x1E, 0x04, 0x1F, 0x03,
+  0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x05, 0x1F, 0x04, 0x1F, 0x04,
+  0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x03, 0x1F, 0x03, 0x1F, 0x03, 0x1F, 0x01,
+  0x23, 0x03, 0x21, 0x03, 0x21, 0x03, 0x20, 0x04, 0x1F, 0x04, 0x1F, 0x04,
+  0x1F, 0x04, 0x1E, 0x05, 0x1E, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04,
+  0x20, 0x04, 0x20, 0x04, 0x21, 0x03, 0x34, 0x02, 0x21, 0x02, 0x21, 0x02,
+  0x21, 0x02, 0x21, 0x02, 0x21, 0x02, 0x21, 0x02, 0x21, 0x02, 0x21, 0x02,
+  0x21, 0x02, 0x21, 0x02, 0x21, 0x02, 0x21, 0x02, 0x21, 0x02, 0x21, 0x02,
+  0x21, 0x02, 0x21, 0x02, 0x21, 0x02, 0x21, 0x02, 0x21, 0x02, 0x21, 0x02,
+  0x21, 0x02, 0x21, 0x02, 0x21, 0x02, 0x21, 0x02, 0x21, 0x02, 0x21, 0x02,
+  0x21, 0x02, 0x21, 0x02, 0x21, 0x02, 0x21, 0x02, 0x21, 0x02, 0x30, 0x03,
+  0x21, 0x04, 0x20, 0x04, 0x20, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04,
+  0x1E, 0x05, 0x1E, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x20, 0x03,
+  0x21, 0x03, 0x21, 0x03, 0x23, 0x01, 0x1F, 0x03, 0x1F, 0x03, 0x1F, 0x03,
+  0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x05, 0x1F, 0x04,
+  0x1F, 0x04, 0x1F, 0x04, 0x1F, 0x03, 0x1F, 0x04, 0x1E, 0x04, 0x1E, 0x03,
+  0xFF, 0x00, 0xD3, 0x05, 0x0A, 0x01, 0x12, 0x09, 0x07, 0x01, 0x12, 0x01,
+  0x04, 0x06, 0x04, 0x01, 0x12, 0x01, 0x08, 0x08, 0x12, 0x01, 0x0A, 0x05,
+  0x32, 0x04, 0x1E, 0x02, 0x02, 0x02, 0x1C, 0x03, 0x02, 0x03, 0x1B, 0x03,
+  0x02, 0x03, 0x1B, 0x03, 0x02, 0x03, 0x1B, 0x03, 0x02, 0x03, 0x1B, 0x03,
+  0x02, 0x03, 0x1C, 0x02, 0x02, 0x02, 0xFF, 0x00, 0x44, 0x07, 0x03, 0x07,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x04, 0x06,
+  0x15, 0x05, 0x02, 0x07, 0x15, 0x08, 0x01, 0x05, 0x17, 0x05, 0x02, 0x07,
+  0x12, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x78, 0x04, 0x20, 0x04, 0x20, 0x03, 0x21, 0x02, 0x22, 0x02,
+  0x40, 0x06, 0x1B, 0x02, 0x03, 0x05, 0x18, 0x03, 0x04, 0x05, 0x16, 0x05,
+  0x03, 0x05, 0x16, 0x05, 0x03, 0x05, 0x17, 0x03, 0x04, 0x05, 0x1D, 0x06,
+  0x1B, 0x02, 0x01, 0x05, 0x19, 0x03, 0x02, 0x05, 0x18, 0x03, 0x03, 0x05,
+  0x17, 0x04, 0x03, 0x05, 0x16, 0x05, 0x03, 0x05, 0x16, 0x05, 0x03, 0x05,
+  0x16, 0x05, 0x02, 0x06, 0x16, 0x07, 0x01, 0x07, 0x15, 0x05, 0x03, 0x04,
+  0x35, 0x01, 0x21, 0x03, 0x1F, 0x02, 0x01, 0x02, 0x1D, 0x02, 0x03, 0x02,
+  0x1B, 0x02, 0x05, 0x02, 0x19, 0x02, 0x07, 0x02, 0x17, 0x02, 0x09, 0x02,
+  0x3C, 0x06, 0x1B, 0x02, 0x03, 0x05, 0x18, 0x03, 0x04, 0x05, 0x16, 0x05,
+  0x03, 0x05, 0x16, 0x05, 0x03, 0x05, 0x17, 0x03, 0x04, 0x05, 0x1D, 0x06,
+  0x1B, 0x02, 0x01, 0x05, 0x19, 0x03, 0x02, 0x05, 0x18, 0x03, 0x03, 0x05,
+  0x17, 0x04, 0x03, 0x05, 0x16, 0x05, 0x03, 0x05, 0x16, 0x05, 0x03, 0x05,
+  0x16, 0x05, 0x02, 0x06, 0x16, 0x07, 0x01, 0x07, 0x15, 0x05, 0x03, 0x04,
+  0x75, 0x03, 0x07, 0x03, 0x15, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x15, 0x03, 0x07, 0x03, 0x3C, 0x06, 0x1B, 0x02,
+  0x03, 0x05, 0x18, 0x03, 0x04, 0x05, 0x16, 0x05, 0x03, 0x05, 0x16, 0x05,
+  0x03, 0x05, 0x17, 0x03, 0x04, 0x05, 0x1D, 0x06, 0x1B, 0x02, 0x01, 0x05,
+  0x19, 0x03, 0x02, 0x05, 0x18, 0x03, 0x03, 0x05, 0x17, 0x04, 0x03, 0x05,
+  0x16, 0x05, 0x03, 0x05, 0x16, 0x05, 0x03, 0x05, 0x16, 0x05, 0x02, 0x06,
+  0x16, 0x07, 0x01, 0x07, 0x15, 0x05, 0x03, 0x04, 0xFF, 0x00, 0x4C, 0x06,
+  0x1B, 0x03, 0x03, 0x04, 0x18, 0x04, 0x03, 0x05, 0x16, 0x04, 0x04, 0x05,
+  0x16, 0x04, 0x05, 0x03, 0x16, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x06, 0x1E, 0x05, 0x1E, 0x06, 0x05, 0x02, 0x17, 0x06,
+  0x03, 0x02, 0x19, 0x09, 0x1C, 0x05, 0x1E, 0x03, 0x1F, 0x05, 0x1E, 0x06,
+  0x1E, 0x05, 0x21, 0x02, 0x21, 0x02, 0x20, 0x02, 0x20, 0x02, 0x78, 0x04,
+  0x20, 0x04, 0x20, 0x03, 0x21, 0x02, 0x22, 0x02, 0x41, 0x05, 0x1C, 0x03,
+  0x02, 0x04, 0x19, 0x03, 0x04, 0x04, 0x17, 0x04, 0x04, 0x04, 0x17, 0x04,
+  0x04, 0x05, 0x15, 0x05, 0x04, 0x05, 0x15, 0x0E, 0x15, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x06, 0x1E, 0x05, 0x07, 0x01, 0x16, 0x06, 0x05, 0x01,
+  0x18, 0x06, 0x03, 0x01, 0x1A, 0x08, 0x1C, 0x06, 0x7A, 0x04, 0x1E, 0x04,
+  0x1F, 0x03, 0x20, 0x02, 0x20, 0x02, 0x45, 0x05, 0x1C, 0x03, 0x02, 0x04,
+  0x19, 0x03, 0x04, 0x04, 0x17, 0x04, 0x04, 0x04, 0x17, 0x04, 0x04, 0x05,
+  0x15, 0x05, 0x04, 0x05, 0x15, 0x0E, 0x15, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x06, 0x1E, 0x05, 0x07, 0x01, 0x16, 0x06, 0x05, 0x01, 0x18, 0x06,
+  0x03, 0x01, 0x1A, 0x08, 0x1C, 0x06, 0x35, 0x01, 0x21, 0x03, 0x1F, 0x02,
+  0x01, 0x02, 0x1D, 0x02, 0x03, 0x02, 0x1B, 0x02, 0x05, 0x02, 0x19, 0x02,
+  0x07, 0x02, 0x17, 0x02, 0x09, 0x02, 0x3D, 0x05, 0x1C, 0x03, 0x02, 0x04,
+  0x19, 0x03, 0x04, 0x04, 0x17, 0x04, 0x04, 0x04, 0x17, 0x04, 0x04, 0x05,
+  0x15, 0x05, 0x04, 0x05, 0x15, 0x0E, 0x15, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x06, 0x1E, 0x05, 0x07, 0x01, 0x16, 0x06, 0x05, 0x01, 0x18, 0x06,
+  0x03, 0x01, 0x1A, 0x08, 0x1C, 0x06, 0x75, 0x03, 0x07, 0x03, 0x15, 0x05,
+  0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x15, 0x03,
+  0x07, 0x03, 0x3D, 0x05, 0x1C, 0x03, 0x02, 0x04, 0x19, 0x03, 0x04, 0x04,
+  0x17, 0x04, 0x04, 0x04, 0x17, 0x04, 0x04, 0x05, 0x15, 0x05, 0x04, 0x05,
+  0x15, 0x0E, 0x15, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x06, 0x1E, 0x05,
+  0x07, 0x01, 0x16, 0x06, 0x05, 0x01, 0x18, 0x06, 0x03, 0x01, 0x1A, 0x08,
+  0x1C, 0x06, 0x34, 0x01, 0x21, 0x03, 0x1F, 0x02, 0x01, 0x02, 0x1D, 0x02,
+  0x03, 0x02, 0x1B, 0x02, 0x05, 0x02, 0x19, 0x02, 0x07, 0x02, 0x17, 0x02,
+  0x09, 0x02, 0x3B, 0x07, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1C, 0x09, 0x74, 0x03,
+  0x07, 0x03, 0x15, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05,
+  0x05, 0x05, 0x15, 0x03, 0x07, 0x03, 0x3B, 0x07, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05, 0x1E, 0x05,
+  0x1C, 0x09, 0x35, 0x01, 0x21, 0x03, 0x1F, 0x02, 0x01, 0x02, 0x1D, 0x02,
+  0x03, 0x02, 0x1B, 0x02, 0x05, 0x02, 0x19, 0x02, 0x07, 0x02, 0x17, 0x02,
+  0x09, 0x02, 0x3C, 0x06, 0x1B, 0x03, 0x04, 0x03, 0x18, 0x04, 0x04, 0x04,
+  0x16, 0x04, 0x06, 0x04, 0x15, 0x04, 0x06, 0x04, 0x14, 0x05, 0x06, 0x05,
+  0x13, 0x05, 0x06, 0x05, 0x13, 0x05, 0x06, 0x05, 0x13, 0x05, 0x06, 0x05,
+  0x13, 0x05, 0x06, 0x05, 0x13, 0x05, 0x06, 0x05, 0x14, 0x04, 0x06, 0x04,
+  0x15, 0x04, 0x06, 0x04, 0x16, 0x04, 0x04, 0x04, 0x18, 0x03, 0x04, 0x03,
+  0x1B, 0x06, 0x75, 0x03, 0x07, 0x03, 0x15, 0x05, 0x05, 0x05, 0x14, 0x05,
+  0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x15, 0x03, 0x07, 0x03, 0x3C, 0x06,
+  0x1B, 0x03, 0x04, 0x03, 0x18, 0x04, 0x04, 0x04, 0x16, 0x04, 0x06, 0x04,
+  0x15, 0x04, 0x06, 0x04, 0x14, 0x05, 0x06, 0x05, 0x13, 0x05, 0x06, 0x05,
+  0x13, 0x05, 0x06, 0x05, 0x13, 0x05, 0x06, 0x05, 0x13, 0x05, 0x06, 0x05,
+  0x13, 0x05, 0x06, 0x05, 0x14, 0x04, 0x06, 0x04, 0x15, 0x04, 0x06, 0x04,
+  0x16, 0x04, 0x04, 0x04, 0x18, 0x03, 0x04, 0x03, 0x1B, 0x06, 0x77, 0x04,
+  0x20, 0x04, 0x20, 0x03, 0x21, 0x02, 0x22, 0x02, 0x3A, 0x07, 0x03, 0x07,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x04, 0x06,
+  0x15, 0x05, 0x02, 0x07, 0x15, 0x08, 0x01, 0x05, 0x17, 0x05, 0x02, 0x07,
+  0x34, 0x01, 0x21, 0x03, 0x1F, 0x02, 0x01, 0x02, 0x1D, 0x02, 0x03, 0x02,
+  0x1B, 0x02, 0x05, 0x02, 0x19, 0x02, 0x07, 0x02, 0x17, 0x02, 0x09, 0x02,
+  0x36, 0x07, 0x03, 0x07, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x04, 0x06, 0x15, 0x05, 0x02, 0x07, 0x15, 0x08, 0x01, 0x05,
+  0x17, 0x05, 0x02, 0x07, 0x74, 0x03, 0x07, 0x03, 0x15, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x15, 0x03, 0x07, 0x03,
+  0x36, 0x07, 0x03, 0x07, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05, 0x14, 0x05, 0x05, 0x05,
+  0x14, 0x05, 0x04, 0x06, 0x15, 0x05, 0x02, 0x07, 0x15, 0x08, 0x01, 0x05,
+  0x17, 0x05, 0x02, 0x07,
+};
+
+const uint16_t Font26bRle_Offsets[] = {
+      0,     0,    42,    86,   174,   282,   418,   520,
+    542,   604,   666,   704,   740,   766,   776,   790,
+    838,   930,   980,  1038,  1096,  1164,  1220,  1292,
+   1346,  1428,  1500,  1522,  1556,  1590,  1600,  1634,
+   1690,  1886,  1968,  2058,  2132,  2224,  2314,  2392,
+   2476,  2570,  2618,  2680,  2774,  2836,  2998,  3116,
+   3208,  3278,  3380,  3472,  3558,  3626,  3720,  3802,
+   3946,  4032,  4106,  4182,  4244,  4292,  4354,  4396,
+   4408,  4418,  4480,  4562,  4608,  4688,  4738,  4794,
+   4868,  4948,  4990,  5054,  5132,  5180,  5278,  5344,
+   5406,  5484,  5566,  5612,  5666,  5714,  5780,  5834,
+   5924,  5978,  6050,  6100,  6162,  6226,  6288,  6312,
+   6342,  6422,  6492,  6576,  6656,  6718,  6776,  6834,
+   6906,  6974,  7030,  7082,  7166,  7246,  7320,  7408,
+   7492,
+};
+
+const uint16_t Font26bRle_CodePoints[] = {
+  0x00B0,  // '°'
+  0x00B5,  // 'µ'
+  0x00E0,  // 'à'
+  0x00E2,  // 'â'
+  0x00E4,  // 'ä'
+  0x00E7,  // 'ç'
+  0x00E8,  // 'è'
+  0x00E9,  // 'é'
+  0x00EA,  // 'ê'
+  0x00EB,  // 'ë'
+  0x00EE,  // 'î'
+  0x00EF,  // 'ï'
+  0x00F4,  // 'ô'
+  0x00F6,  // 'ö'
+  0x00F9,  // 'ù'
+  0x00FB,  // 'û'
+  0x00FC,  // 'ü'
+};
+// clang-format on
+
+constexpr Font kFont26bRle = {Font26bRle_Table,
+                              35,
+                              33,
+                              FontFormat::Rle1,
+                              Font26bRle_CodePoints,
+                              17,
+                              Font26bRle_Offsets};
+
+}  // namespace disco
@@ -4587,12 +4587,829 @@ const uint8_t Font36_Table[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @26220 '°' (45 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,  //                     ####
+  0x00, 0x00, 0x19, 0xC0, 0x00, 0x00,  //                    ##  ###
+  0x00, 0x00, 0x30, 0xE0, 0x00, 0x00,  //                   ##    ###
+  0x00, 0x00, 0x70, 0xE0, 0x00, 0x00,  //                  ###    ###
+  0x00, 0x00, 0x60, 0x70, 0x00, 0x00,  //                  ##      ###
+  0x00, 0x00, 0x60, 0x70, 0x00, 0x00,  //                  ##      ###
+  0x00, 0x00, 0x70, 0x70, 0x00, 0x00,  //                  ###     ###
+  0x00, 0x00, 0x70, 0x70, 0x00, 0x00,  //                  ###     ###
+  0x00, 0x00, 0x70, 0x60, 0x00, 0x00,  //                  ###     ##
+  0x00, 0x00, 0x38, 0x60, 0x00, 0x00,  //                   ###    ##
+  0x00, 0x00, 0x1D, 0xC0, 0x00, 0x00,  //                    ### ###
+  0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,  //                     ####
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @26496 'µ' (45 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00,  //             #######      #######
+  0x00, 0x03, 0xE0, 0x1F, 0x00, 0x00,  //               #####        #####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x1F, 0x00, 0x00,  //                ####        #####
+  0x00, 0x01, 0xF0, 0x3F, 0x00, 0x00,  //                #####      ######
+  0x00, 0x00, 0xF8, 0x6F, 0x00, 0x00,  //                 #####    ## ####
+  0x00, 0x00, 0xFF, 0xCF, 0xE0, 0x00,  //                 ##########  #######
+  0x00, 0x00, 0x7F, 0x8F, 0x80, 0x00,  //                  ########   #####
+  0x00, 0x00, 0x3E, 0x0C, 0x00, 0x00,  //                   #####     ##
+  0x00, 0x01, 0xE0, 0x00, 0x00, 0x00,  //                ####
+  0x00, 0x01, 0xE0, 0x00, 0x00, 0x00,  //                ####
+  0x00, 0x01, 0xE0, 0x00, 0x00, 0x00,  //                ####
+  0x00, 0x01, 0xE0, 0x00, 0x00, 0x00,  //                ####
+  0x00, 0x01, 0xE0, 0x00, 0x00, 0x00,  //                ####
+  0x00, 0x01, 0xE0, 0x00, 0x00, 0x00,  //                ####
+  0x00, 0x01, 0xE0, 0x00, 0x00, 0x00,  //                ####
+  0x00, 0x01, 0xE0, 0x00, 0x00, 0x00,  //                ####
+  0x00, 0x01, 0xE0, 0x00, 0x00, 0x00,  //                ####
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @26772 'à' (45 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,  //                       ####
+  0x00, 0x00, 0x01, 0xC0, 0x00, 0x00,  //                        ###
+  0x00, 0x00, 0x00, 0xC0, 0x00, 0x00,  //                         ##
+  0x00, 0x00, 0x00, 0x60, 0x00, 0x00,  //                          ##
+  0x00, 0x00, 0x00, 0x60, 0x00, 0x00,  //                          ##
+  0x00, 0x00, 0x00, 0x20, 0x00, 0x00,  //                           #
+  0x00, 0x00, 0x00, 0x10, 0x00, 0x00,  //                            #
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,  //                    #######
+  0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,  //                  ###########
+  0x00, 0x00, 0xF0, 0xF8, 0x00, 0x00,  //                 ####    #####
+  0x00, 0x00, 0xE0, 0x7C, 0x00, 0x00,  //                 ###      #####
+  0x00, 0x01, 0xE0, 0x3C, 0x00, 0x00,  //                ####       ####
+  0x00, 0x01, 0xE0, 0x3C, 0x00, 0x00,  //                ####       ####
+  0x00, 0x01, 0xE0, 0x3C, 0x00, 0x00,  //                ####       ####
+  0x00, 0x00, 0xC0, 0x3C, 0x00, 0x00,  //                 ##        ####
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,  //                          #####
+  0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,  //                       ########
+  0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00,  //                     ##### ####
+  0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00,  //                   ####    ####
+  0x00, 0x00, 0x70, 0x3C, 0x00, 0x00,  //                  ###      ####
+  0x00, 0x00, 0xE0, 0x3C, 0x00, 0x00,  //                 ###       ####
+  0x00, 0x01, 0xC0, 0x3C, 0x00, 0x00,  //                ###        ####
+  0x00, 0x03, 0xC0, 0x3C, 0x00, 0x00,  //               ####        ####
+  0x00, 0x03, 0xC0, 0x3C, 0x00, 0x00,  //               ####        ####
+  0x00, 0x03, 0xC0, 0x3C, 0x00, 0x00,  //               ####        ####
+  0x00, 0x03, 0xE0, 0x7C, 0x40, 0x00,  //               #####      #####   #
+  0x00, 0x03, 0xF1, 0xFC, 0xC0, 0x00,  //               ######   #######  ##
+  0x00, 0x01, 0xFF, 0x3F, 0x80, 0x00,  //                #########  #######
+  0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00,  //                 #######   ######
+  0x00, 0x00, 0x7C, 0x1E, 0x00, 0x00,  //                  #####     ####
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @27048 'â' (45 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x01, 0x80, 0x00, 0x00,  //                        ##
+  0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,  //                       ####
+  0x00, 0x00, 0x06, 0x60, 0x00, 0x00,  //                      ##  ##
+  0x00, 0x00, 0x0C, 0x30, 0x00, 0x00,  //                     ##    ##
+  0x00, 0x00, 0x18, 0x18, 0x00, 0x00,  //                    ##      ##
+  0x00, 0x00, 0x30, 0x0C, 0x00, 0x00,  //                   ##        ##
+  0x00, 0x00, 0x60, 0x06, 0x00, 0x00,  //                  ##          ##
+  0x00, 0x00, 0xC0, 0x03, 0x00, 0x00,  //                 ##            ##
+  0x00, 0x01, 0x80, 0x01, 0x80, 0x00,  //                ##              ##
+  0x00, 0x03, 0x00, 0x00, 0xC0, 0x00,  //               ##                ##
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,  //                    #######
+  0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,  //                  ###########
+  0x00, 0x00, 0xF0, 0xF8, 0x00, 0x00,  //                 ####    #####
+  0x00, 0x00, 0xE0, 0x7C, 0x00, 0x00,  //                 ###      #####
+  0x00, 0x01, 0xE0, 0x3C, 0x00, 0x00,  //                ####       ####
+  0x00, 0x01, 0xE0, 0x3C, 0x00, 0x00,  //                ####       ####
+  0x00, 0x01, 0xE0, 0x3C, 0x00, 0x00,  //                ####       ####
+  0x00, 0x00, 0xC0, 0x3C, 0x00, 0x00,  //                 ##        ####
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,  //                          #####
+  0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,  //                       ########
+  0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00,  //                     ##### ####
+  0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00,  //                   ####    ####
+  0x00, 0x00, 0x70, 0x3C, 0x00, 0x00,  //                  ###      ####
+  0x00, 0x00, 0xE0, 0x3C, 0x00, 0x00,  //                 ###       ####
+  0x00, 0x01, 0xC0, 0x3C, 0x00, 0x00,  //                ###        ####
+  0x00, 0x03, 0xC0, 0x3C, 0x00, 0x00,  //               ####        ####
+  0x00, 0x03, 0xC0, 0x3C, 0x00, 0x00,  //               ####        ####
+  0x00, 0x03, 0xC0, 0x3C, 0x00, 0x00,  //               ####        ####
+  0x00, 0x03, 0xE0, 0x7C, 0x40, 0x00,  //               #####      #####   #
+  0x00, 0x03, 0xF1, 0xFC, 0xC0, 0x00,  //               ######   #######  ##
+  0x00, 0x01, 0xFF, 0x3F, 0x80, 0x00,  //                #########  #######
+  0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00,  //                 #######   ######
+  0x00, 0x00, 0x7C, 0x1E, 0x00, 0x00,  //                  #####     ####
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @27324 'ä' (45 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x18, 0x18, 0x00, 0x00,  //                    ##      ##
+  0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00,  //                   ####    ####
+  0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00,  //                   ####    ####
+  0x00, 0x00, 0x18, 0x18, 0x00, 0x00,  //                    ##      ##
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,  //                    #######
+  0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,  //                  ###########
+  0x00, 0x00, 0xF0, 0xF8, 0x00, 0x00,  //                 ####    #####
+  0x00, 0x00, 0xE0, 0x7C, 0x00, 0x00,  //                 ###      #####
+  0x00, 0x01, 0xE0, 0x3C, 0x00, 0x00,  //                ####       ####
+  0x00, 0x01, 0xE0, 0x3C, 0x00, 0x00,  //                ####       ####
+  0x00, 0x01, 0xE0, 0x3C, 0x00, 0x00,  //                ####       ####
+  0x00, 0x00, 0xC0, 0x3C, 0x00, 0x00,  //                 ##        ####
+  0x00, 0x00, 0x00, 0x7C, 0x00, 0x00,  //                          #####
+  0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,  //                       ########
+  0x00, 0x00, 0x0F, 0xBC, 0x00, 0x00,  //                     ##### ####
+  0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00,  //                   ####    ####
+  0x00, 0x00, 0x70, 0x3C, 0x00, 0x00,  //                  ###      ####
+  0x00, 0x00, 0xE0, 0x3C, 0x00, 0x00,  //                 ###       ####
+  0x00, 0x01, 0xC0, 0x3C, 0x00, 0x00,  //                ###        ####
+  0x00, 0x03, 0xC0, 0x3C, 0x00, 0x00,  //               ####        ####
+  0x00, 0x03, 0xC0, 0x3C, 0x00, 0x00,  //               ####        ####
+  0x00, 0x03, 0xC0, 0x3C, 0x00, 0x00,  //               ####        ####
+  0x00, 0x03, 0xE0, 0x7C, 0x40, 0x00,  //               #####      #####   #
+  0x00, 0x03, 0xF1, 0xFC, 0xC0, 0x00,  //               ######   #######  ##
+  0x00, 0x01, 0xFF, 0x3F, 0x80, 0x00,  //                #########  #######
+  0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00,  //                 #######   ######
+  0x00, 0x00, 0x7C, 0x1E, 0x00, 0x00,  //                  #####     ####
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @27600 'ç' (45 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,  //                      ######
+  0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,  //                    ##########
+  0x00, 0x00, 0x38, 0x7C, 0x00, 0x00,  //                   ###    #####
+  0x00, 0x00, 0x70, 0x3E, 0x00, 0x00,  //                  ###      #####
+  0x00, 0x00, 0xE0, 0x3E, 0x00, 0x00,  //                 ###       #####
+  0x00, 0x01, 0xE0, 0x1E, 0x00, 0x00,  //                ####        ####
+  0x00, 0x01, 0xC0, 0x0C, 0x00, 0x00,  //                ###          ##
+  0x00, 0x01, 0xC0, 0x00, 0x00, 0x00,  //                ###
+  0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,  //               ####
+  0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,  //               ####
+  0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,  //               ####
+  0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,  //               ####
+  0x00, 0x03, 0xC0, 0x00, 0x00, 0x00,  //               ####
+  0x00, 0x03, 0xE0, 0x00, 0x00, 0x00,  //               #####
+  0x00, 0x03, 0xE0, 0x01, 0x00, 0x00,  //               #####            #
+  0x00, 0x03, 0xE0, 0x03, 0x00, 0x00,  //               #####           ##
+  0x00, 0x01, 0xF0, 0x02, 0x00, 0x00,  //                #####          #
+  0x00, 0x01, 0xF8, 0x06, 0x00, 0x00,  //                ######        ##
+  0x00, 0x00, 0xFC, 0x0E, 0x00, 0x00,  //                 ######      ###
+  0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,  //                 ##############
+  0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,  //                  ############
+  0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,  //                   ##########
+  0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,  //                     ######
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,  //                     ######
+  0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,  //                     #######
+  0x00, 0x00, 0x07, 0x60, 0x00, 0x00,  //                      ### ##
+  0x00, 0x00, 0x00, 0x60, 0x00, 0x00,  //                          ##
+  0x00, 0x00, 0x00, 0x60, 0x00, 0x00,  //                          ##
+  0x00, 0x00, 0x00, 0xC0, 0x00, 0x00,  //                         ##
+  0x00, 0x00, 0x00, 0xC0, 0x00, 0x00,  //                         ##
+  0x00, 0x00, 0x01, 0x80, 0x00, 0x00,  //                        ##
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00,  //                      ###
+  0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,  //                     ##
+  // @27876 'è' (45 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,  //                     ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x03, 0x80, 0x00, 0x00,  //                       ###
+  0x00, 0x00, 0x01, 0x80, 0x00, 0x00,  //                        ##
+  0x00, 0x00, 0x00, 0xC0, 0x00, 0x00,  //                         ##
+  0x00, 0x00, 0x00, 0xC0, 0x00, 0x00,  //                         ##
+  0x00, 0x00, 0x00, 0x40, 0x00, 0x00,  //                          #
+  0x00, 0x00, 0x00, 0x20, 0x00, 0x00,  //                           #
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,  //                      ######
+  0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,  //                    #########
+  0x00, 0x00, 0x70, 0xFC, 0x00, 0x00,  //                  ###    ######
+  0x00, 0x00, 0xE0, 0x3C, 0x00, 0x00,  //                 ###       ####
+  0x00, 0x00, 0xC0, 0x3E, 0x00, 0x00,  //                 ##        #####
+  0x00, 0x01, 0xC0, 0x1E, 0x00, 0x00,  //                ###         ####
+  0x00, 0x01, 0x80, 0x1F, 0x00, 0x00,  //                ##          #####
+  0x00, 0x01, 0x80, 0x1F, 0x00, 0x00,  //                ##          #####
+  0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00,  //               ##################
+  0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00,  //               ##################
+  0x00, 0x03, 0x80, 0x00, 0x00, 0x00,  //               ###
+  0x00, 0x03, 0x80, 0x00, 0x00, 0x00,  //               ###
+  0x00, 0x03, 0x80, 0x00, 0x00, 0x00,  //               ###
+  0x00, 0x03, 0x80, 0x00, 0x00, 0x00,  //               ###
+  0x00, 0x03, 0xC0, 0x01, 0x00, 0x00,  //               ####             #
+  0x00, 0x03, 0xC0, 0x03, 0x00, 0x00,  //               ####            ##
+  0x00, 0x01, 0xE0, 0x03, 0x00, 0x00,  //                ####           ##
+  0x00, 0x01, 0xF0, 0x06, 0x00, 0x00,  //                #####         ##
+  0x00, 0x00, 0xFC, 0x0E, 0x00, 0x00,  //                 ######      ###
+  0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,  //                 ##############
+  0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,  //                  ############
+  0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,  //                   ##########
+  0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,  //                     ######
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @28152 'é' (45 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x01, 0xE0, 0x00, 0x00,  //                        ####
+  0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,  //                       ####
+  0x00, 0x00, 0x03, 0x80, 0x00, 0x00,  //                       ###
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00,  //                       ##
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00,  //                      ##
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00,  //                      ##
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x00,  //                      #
+  0x00, 0x00, 0x08, 0x00, 0x00, 0x00,  //                     #
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,  //                      ######
+  0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,  //                    #########
+  0x00, 0x00, 0x70, 0xFC, 0x00, 0x00,  //                  ###    ######
+  0x00, 0x00, 0xE0, 0x3C, 0x00, 0x00,  //                 ###       ####
+  0x00, 0x00, 0xC0, 0x3E, 0x00, 0x00,  //                 ##        #####
+  0x00, 0x01, 0xC0, 0x1E, 0x00, 0x00,  //                ###         ####
+  0x00, 0x01, 0x80, 0x1F, 0x00, 0x00,  //                ##          #####
+  0x00, 0x01, 0x80, 0x1F, 0x00, 0x00,  //                ##          #####
+  0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00,  //               ##################
+  0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00,  //               ##################
+  0x00, 0x03, 0x80, 0x00, 0x00, 0x00,  //               ###
+  0x00, 0x03, 0x80, 0x00, 0x00, 0x00,  //               ###
+  0x00, 0x03, 0x80, 0x00, 0x00, 0x00,  //               ###
+  0x00, 0x03, 0x80, 0x00, 0x00, 0x00,  //               ###
+  0x00, 0x03, 0xC0, 0x01, 0x00, 0x00,  //               ####             #
+  0x00, 0x03, 0xC0, 0x03, 0x00, 0x00,  //               ####            ##
+  0x00, 0x01, 0xE0, 0x03, 0x00, 0x00,  //                ####           ##
+  0x00, 0x01, 0xF0, 0x06, 0x00, 0x00,  //                #####         ##
+  0x00, 0x00, 0xFC, 0x0E, 0x00, 0x00,  //                 ######      ###
+  0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,  //                 ##############
+  0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,  //                  ############
+  0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,  //                   ##########
+  0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,  //                     ######
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @28428 'ê' (45 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00,  //                       ##
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x0C, 0xC0, 0x00, 0x00,  //                     ##  ##
+  0x00, 0x00, 0x18, 0x60, 0x00, 0x00,  //                    ##    ##
+  0x00, 0x00, 0x30, 0x30, 0x00, 0x00,  //                   ##      ##
+  0x00, 0x00, 0x60, 0x18, 0x00, 0x00,  //                  ##        ##
+  0x00, 0x00, 0xC0, 0x0C, 0x00, 0x00,  //                 ##          ##
+  0x00, 0x01, 0x80, 0x06, 0x00, 0x00,  //                ##            ##
+  0x00, 0x03, 0x00, 0x03, 0x00, 0x00,  //               ##              ##
+  0x00, 0x06, 0x00, 0x01, 0x80, 0x00,  //              ##                ##
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,  //                      ######
+  0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,  //                    #########
+  0x00, 0x00, 0x70, 0xFC, 0x00, 0x00,  //                  ###    ######
+  0x00, 0x00, 0xE0, 0x3C, 0x00, 0x00,  //                 ###       ####
+  0x00, 0x00, 0xC0, 0x3E, 0x00, 0x00,  //                 ##        #####
+  0x00, 0x01, 0xC0, 0x1E, 0x00, 0x00,  //                ###         ####
+  0x00, 0x01, 0x80, 0x1F, 0x00, 0x00,  //                ##          #####
+  0x00, 0x01, 0x80, 0x1F, 0x00, 0x00,  //                ##          #####
+  0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00,  //               ##################
+  0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00,  //               ##################
+  0x00, 0x03, 0x80, 0x00, 0x00, 0x00,  //               ###
+  0x00, 0x03, 0x80, 0x00, 0x00, 0x00,  //               ###
+  0x00, 0x03, 0x80, 0x00, 0x00, 0x00,  //               ###
+  0x00, 0x03, 0x80, 0x00, 0x00, 0x00,  //               ###
+  0x00, 0x03, 0xC0, 0x01, 0x00, 0x00,  //               ####             #
+  0x00, 0x03, 0xC0, 0x03, 0x00, 0x00,  //               ####            ##
+  0x00, 0x01, 0xE0, 0x03, 0x00, 0x00,  //                ####           ##
+  0x00, 0x01, 0xF0, 0x06, 0x00, 0x00,  //                #####         ##
+  0x00, 0x00, 0xFC, 0x0E, 0x00, 0x00,  //                 ######      ###
+  0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,  //                 ##############
+  0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,  //                  ############
+  0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,  //                   ##########
+  0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,  //                     ######
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @28704 'ë' (45 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x30, 0x30, 0x00, 0x00,  //                   ##      ##
+  0x00, 0x00, 0x78, 0x78, 0x00, 0x00,  //                  ####    ####
+  0x00, 0x00, 0x78, 0x78, 0x00, 0x00,  //                  ####    ####
+  0x00, 0x00, 0x30, 0x30, 0x00, 0x00,  //                   ##      ##
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,  //                      ######
+  0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,  //                    #########
+  0x00, 0x00, 0x70, 0xFC, 0x00, 0x00,  //                  ###    ######
+  0x00, 0x00, 0xE0, 0x3C, 0x00, 0x00,  //                 ###       ####
+  0x00, 0x00, 0xC0, 0x3E, 0x00, 0x00,  //                 ##        #####
+  0x00, 0x01, 0xC0, 0x1E, 0x00, 0x00,  //                ###         ####
+  0x00, 0x01, 0x80, 0x1F, 0x00, 0x00,  //                ##          #####
+  0x00, 0x01, 0x80, 0x1F, 0x00, 0x00,  //                ##          #####
+  0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00,  //               ##################
+  0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00,  //               ##################
+  0x00, 0x03, 0x80, 0x00, 0x00, 0x00,  //               ###
+  0x00, 0x03, 0x80, 0x00, 0x00, 0x00,  //               ###
+  0x00, 0x03, 0x80, 0x00, 0x00, 0x00,  //               ###
+  0x00, 0x03, 0x80, 0x00, 0x00, 0x00,  //               ###
+  0x00, 0x03, 0xC0, 0x01, 0x00, 0x00,  //               ####             #
+  0x00, 0x03, 0xC0, 0x03, 0x00, 0x00,  //               ####            ##
+  0x00, 0x01, 0xE0, 0x03, 0x00, 0x00,  //                ####           ##
+  0x00, 0x01, 0xF0, 0x06, 0x00, 0x00,  //                #####         ##
+  0x00, 0x00, 0xFC, 0x0E, 0x00, 0x00,  //                 ######      ###
+  0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,  //                 ##############
+  0x00, 0x00, 0x7F, 0xF8, 0x00, 0x00,  //                  ############
+  0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,  //                   ##########
+  0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,  //                     ######
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @28980 'î' (45 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00,  //                       ##
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x0C, 0xC0, 0x00, 0x00,  //                     ##  ##
+  0x00, 0x00, 0x18, 0x60, 0x00, 0x00,  //                    ##    ##
+  0x00, 0x00, 0x30, 0x30, 0x00, 0x00,  //                   ##      ##
+  0x00, 0x00, 0x30, 0x30, 0x00, 0x00,  //                   ##      ##
+  0x00, 0x00, 0xC0, 0x0C, 0x00, 0x00,  //                 ##          ##
+  0x00, 0x00, 0xC0, 0x0C, 0x00, 0x00,  //                 ##          ##
+  0x00, 0x01, 0x80, 0x06, 0x00, 0x00,  //                ##            ##
+  0x00, 0x03, 0x00, 0x03, 0x00, 0x00,  //               ##              ##
+  0x00, 0x06, 0x00, 0x01, 0x80, 0x00,  //              ##                ##
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,  //                     #####
+  0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,  //                   #######
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,  //                     ######
+  0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,  //                   ##########
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @29256 'ï' (45 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x30, 0x30, 0x00, 0x00,  //                   ##      ##
+  0x00, 0x00, 0x78, 0x78, 0x00, 0x00,  //                  ####    ####
+  0x00, 0x00, 0x78, 0x78, 0x00, 0x00,  //                  ####    ####
+  0x00, 0x00, 0x30, 0x30, 0x00, 0x00,  //                   ##      ##
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,  //                     #####
+  0x00, 0x00, 0x3F, 0x80, 0x00, 0x00,  //                   #######
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00,  //                     ######
+  0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00,  //                   ##########
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @29532 'ô' (45 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x06, 0x00, 0x00, 0x00,  //                      ##
+  0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,  //                     ####
+  0x00, 0x00, 0x19, 0x80, 0x00, 0x00,  //                    ##  ##
+  0x00, 0x00, 0x30, 0xC0, 0x00, 0x00,  //                   ##    ##
+  0x00, 0x00, 0x60, 0x60, 0x00, 0x00,  //                  ##      ##
+  0x00, 0x00, 0xC0, 0x30, 0x00, 0x00,  //                 ##        ##
+  0x00, 0x01, 0x80, 0x18, 0x00, 0x00,  //                ##          ##
+  0x00, 0x03, 0x00, 0x0C, 0x00, 0x00,  //               ##            ##
+  0x00, 0x06, 0x00, 0x06, 0x00, 0x00,  //              ##              ##
+  0x00, 0x0C, 0x00, 0x03, 0x00, 0x00,  //             ##                ##
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,  //                    #######
+  0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,  //                  ###########
+  0x00, 0x00, 0xF0, 0xF8, 0x00, 0x00,  //                 ####    #####
+  0x00, 0x01, 0xC0, 0x3C, 0x00, 0x00,  //                ###        ####
+  0x00, 0x03, 0xC0, 0x3E, 0x00, 0x00,  //               ####        #####
+  0x00, 0x03, 0x80, 0x1F, 0x00, 0x00,  //               ###          #####
+  0x00, 0x07, 0x80, 0x1F, 0x00, 0x00,  //              ####          #####
+  0x00, 0x07, 0x80, 0x0F, 0x00, 0x00,  //              ####           ####
+  0x00, 0x0F, 0x00, 0x0F, 0x80, 0x00,  //             ####            #####
+  0x00, 0x0F, 0x00, 0x0F, 0x80, 0x00,  //             ####            #####
+  0x00, 0x0F, 0x00, 0x0F, 0x80, 0x00,  //             ####            #####
+  0x00, 0x0F, 0x00, 0x07, 0x80, 0x00,  //             ####             ####
+  0x00, 0x0F, 0x80, 0x07, 0x80, 0x00,  //             #####            ####
+  0x00, 0x0F, 0x80, 0x07, 0x80, 0x00,  //             #####            ####
+  0x00, 0x0F, 0x80, 0x07, 0x80, 0x00,  //             #####            ####
+  0x00, 0x07, 0x80, 0x0F, 0x00, 0x00,  //              ####           ####
+  0x00, 0x07, 0xC0, 0x0F, 0x00, 0x00,  //              #####          ####
+  0x00, 0x07, 0xC0, 0x0E, 0x00, 0x00,  //              #####          ###
+  0x00, 0x03, 0xE0, 0x0E, 0x00, 0x00,  //               #####         ###
+  0x00, 0x01, 0xF0, 0x1C, 0x00, 0x00,  //                #####       ###
+  0x00, 0x00, 0xF8, 0x78, 0x00, 0x00,  //                 #####    ####
+  0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,  //                  ###########
+  0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,  //                    #######
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @29808 'ö' (45 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x60, 0x60, 0x00, 0x00,  //                  ##      ##
+  0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00,  //                 ####    ####
+  0x00, 0x00, 0xF0, 0xF0, 0x00, 0x00,  //                 ####    ####
+  0x00, 0x00, 0x60, 0x60, 0x00, 0x00,  //                  ##      ##
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,  //                    #######
+  0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,  //                  ###########
+  0x00, 0x00, 0xF0, 0xF8, 0x00, 0x00,  //                 ####    #####
+  0x00, 0x01, 0xC0, 0x3C, 0x00, 0x00,  //                ###        ####
+  0x00, 0x03, 0xC0, 0x3E, 0x00, 0x00,  //               ####        #####
+  0x00, 0x03, 0x80, 0x1F, 0x00, 0x00,  //               ###          #####
+  0x00, 0x07, 0x80, 0x1F, 0x00, 0x00,  //              ####          #####
+  0x00, 0x07, 0x80, 0x0F, 0x00, 0x00,  //              ####           ####
+  0x00, 0x0F, 0x00, 0x0F, 0x80, 0x00,  //             ####            #####
+  0x00, 0x0F, 0x00, 0x0F, 0x80, 0x00,  //             ####            #####
+  0x00, 0x0F, 0x00, 0x0F, 0x80, 0x00,  //             ####            #####
+  0x00, 0x0F, 0x00, 0x07, 0x80, 0x00,  //             ####             ####
+  0x00, 0x0F, 0x80, 0x07, 0x80, 0x00,  //             #####            ####
+  0x00, 0x0F, 0x80, 0x07, 0x80, 0x00,  //             #####            ####
+  0x00, 0x0F, 0x80, 0x07, 0x80, 0x00,  //             #####            ####
+  0x00, 0x07, 0x80, 0x0F, 0x00, 0x00,  //              ####           ####
+  0x00, 0x07, 0xC0, 0x0F, 0x00, 0x00,  //              #####          ####
+  0x00, 0x07, 0xC0, 0x0E, 0x00, 0x00,  //              #####          ###
+  0x00, 0x03, 0xE0, 0x0E, 0x00, 0x00,  //               #####         ###
+  0x00, 0x01, 0xF0, 0x1C, 0x00, 0x00,  //                #####       ###
+  0x00, 0x00, 0xF8, 0x78, 0x00, 0x00,  //                 #####    ####
+  0x00, 0x00, 0x7F, 0xF0, 0x00, 0x00,  //                  ###########
+  0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,  //                    #######
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @30084 'ù' (45 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,  //                     ####
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x03, 0x80, 0x00, 0x00,  //                       ###
+  0x00, 0x00, 0x01, 0x80, 0x00, 0x00,  //                        ##
+  0x00, 0x00, 0x00, 0xC0, 0x00, 0x00,  //                         ##
+  0x00, 0x00, 0x00, 0xC0, 0x00, 0x00,  //                         ##
+  0x00, 0x00, 0x00, 0x40, 0x00, 0x00,  //                          #
+  0x00, 0x00, 0x00, 0x20, 0x00, 0x00,  //                           #
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00,  //             #######      #######
+  0x00, 0x03, 0xE0, 0x1F, 0x00, 0x00,  //               #####        #####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x1F, 0x00, 0x00,  //                ####        #####
+  0x00, 0x01, 0xF0, 0x3F, 0x00, 0x00,  //                #####      ######
+  0x00, 0x00, 0xF8, 0x6F, 0x00, 0x00,  //                 #####    ## ####
+  0x00, 0x00, 0xFF, 0xCF, 0xE0, 0x00,  //                 ##########  #######
+  0x00, 0x00, 0x7F, 0x8F, 0x80, 0x00,  //                  ########   #####
+  0x00, 0x00, 0x3E, 0x0C, 0x00, 0x00,  //                   #####     ##
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @30360 'û' (45 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x03, 0x00, 0x00, 0x00,  //                       ##
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x0C, 0xC0, 0x00, 0x00,  //                     ##  ##
+  0x00, 0x00, 0x18, 0x60, 0x00, 0x00,  //                    ##    ##
+  0x00, 0x00, 0x30, 0x30, 0x00, 0x00,  //                   ##      ##
+  0x00, 0x00, 0x30, 0x30, 0x00, 0x00,  //                   ##      ##
+  0x00, 0x00, 0xC0, 0x0C, 0x00, 0x00,  //                 ##          ##
+  0x00, 0x00, 0xC0, 0x0C, 0x00, 0x00,  //                 ##          ##
+  0x00, 0x01, 0x80, 0x06, 0x00, 0x00,  //                ##            ##
+  0x00, 0x03, 0x00, 0x03, 0x00, 0x00,  //               ##              ##
+  0x00, 0x06, 0x00, 0x01, 0x80, 0x00,  //              ##                ##
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00,  //             #######      #######
+  0x00, 0x03, 0xE0, 0x1F, 0x00, 0x00,  //               #####        #####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x1F, 0x00, 0x00,  //                ####        #####
+  0x00, 0x01, 0xF0, 0x3F, 0x00, 0x00,  //                #####      ######
+  0x00, 0x00, 0xF8, 0x6F, 0x00, 0x00,  //                 #####    ## ####
+  0x00, 0x00, 0xFF, 0xCF, 0xE0, 0x00,  //                 ##########  #######
+  0x00, 0x00, 0x7F, 0x8F, 0x80, 0x00,  //                  ########   #####
+  0x00, 0x00, 0x3E, 0x0C, 0x00, 0x00,  //                   #####     ##
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @30636 'ü' (45 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x30, 0x30, 0x00, 0x00,  //                   ##      ##
+  0x00, 0x00, 0x78, 0x78, 0x00, 0x00,  //                  ####    ####
+  0x00, 0x00, 0x78, 0x78, 0x00, 0x00,  //                  ####    ####
+  0x00, 0x00, 0x30, 0x30, 0x00, 0x00,  //                   ##      ##
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x0F, 0xE0, 0x7F, 0x00, 0x00,  //             #######      #######
+  0x00, 0x03, 0xE0, 0x1F, 0x00, 0x00,  //               #####        #####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x0F, 0x00, 0x00,  //                ####         ####
+  0x00, 0x01, 0xE0, 0x1F, 0x00, 0x00,  //                ####        #####
+  0x00, 0x01, 0xF0, 0x3F, 0x00, 0x00,  //                #####      ######
+  0x00, 0x00, 0xF8, 0x6F, 0x00, 0x00,  //                 #####    ## ####
+  0x00, 0x00, 0xFF, 0xCF, 0xE0, 0x00,  //                 ##########  #######
+  0x00, 0x00, 0x7F, 0x8F, 0x80, 0x00,  //                  ########   #####
+  0x00, 0x00, 0x3E, 0x0C, 0x00, 0x00,  //                   #####     ##
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+};
+
+const uint16_t Font36_CodePoints[] = {
+  0x00B0,  // '°'
+  0x00B5,  // 'µ'
+  0x00E0,  // 'à'
+  0x00E2,  // 'â'
+  0x00E4,  // 'ä'
+  0x00E7,  // 'ç'
+  0x00E8,  // 'è'
+  0x00E9,  // 'é'
+  0x00EA,  // 'ê'
+  0x00EB,  // 'ë'
+  0x00EE,  // 'î'
+  0x00EF,  // 'ï'
+  0x00F4,  // 'ô'
+  0x00F6,  // 'ö'
+  0x00F9,  // 'ù'
+  0x00FB,  // 'û'
+  0x00FC,  // 'ü'
 };
 // clang-format on
 
-Font* createFont36() {
-    static Font* pFont36 = new Font{Font36_Table, 45, 46};
-    return pFont36;
-}
+constexpr Font kFont36 = {
+    Font36_Table, 45, 46, FontFormat::Mono1, Font36_CodePoints, 17};
 
 }  // namespace disco
@@ -0,0 +1,941 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file fonts36_rle.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Run-length compressed font (size 36), generated from fonts36.cpp
+ *        by tools/font_rle.py
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "fonts.hpp"
+
+namespace disco {
+// clang-format off
+const uint8_t Font36Rle_Table[] = {
+  0x42, 0x02, 0x2A, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x2A, 0x02, 0x2B, 0x02, 0x2B, 0x02,
+  0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02,
+  0x2B, 0x02, 0x2B, 0x02, 0xDF, 0x02, 0x2A, 0x04, 0x29, 0x04, 0x2A, 0x02,
+  0x3E, 0x02, 0x06, 0x02, 0x22, 0x04, 0x04, 0x04, 0x21, 0x04, 0x04, 0x04,
+  0x21, 0x04, 0x04, 0x04, 0x21, 0x04, 0x04, 0x04, 0x21, 0x04, 0x04, 0x04,
+  0x21, 0x04, 0x04, 0x04, 0x21, 0x04, 0x04, 0x04, 0x22, 0x02, 0x06, 0x02,
+  0x23, 0x02, 0x06, 0x02, 0x23, 0x02, 0x06, 0x02, 0x23, 0x02, 0x06, 0x02,
+  0x23, 0x02, 0x06, 0x02, 0x15, 0x02, 0x08, 0x02, 0x21, 0x02, 0x08, 0x02,
+  0x20, 0x03, 0x07, 0x03, 0x20, 0x02, 0x08, 0x02, 0x21, 0x02, 0x08, 0x02,
+  0x21, 0x02, 0x08, 0x02, 0x21, 0x02, 0x08, 0x02, 0x20, 0x02, 0x08, 0x02,
+  0x21, 0x02, 0x08, 0x02, 0x21, 0x02, 0x08, 0x02, 0x21, 0x02, 0x08, 0x02,
+  0x21, 0x02, 0x08, 0x02, 0x20, 0x02, 0x08, 0x02, 0x1B, 0x17, 0x16, 0x17,
+  0x1C, 0x02, 0x08, 0x02, 0x21, 0x02, 0x08, 0x02, 0x20, 0x02, 0x08, 0x02,
+  0x21, 0x02, 0x08, 0x02, 0x21, 0x02, 0x08, 0x02, 0x21, 0x02, 0x08, 0x02,
+  0x21, 0x02, 0x08, 0x02, 0x20, 0x02, 0x08, 0x02, 0x1D, 0x17, 0x16, 0x17,
+  0x1A, 0x02, 0x08, 0x02, 0x21, 0x02, 0x08, 0x02, 0x20, 0x02, 0x08, 0x02,
+  0x21, 0x02, 0x08, 0x02, 0x21, 0x02, 0x08, 0x02, 0x21, 0x02, 0x08, 0x02,
+  0x21, 0x02, 0x08, 0x02, 0x20, 0x02, 0x08, 0x02, 0x21, 0x02, 0x08, 0x02,
+  0x16, 0x02, 0x2B, 0x02, 0x29, 0x07, 0x23, 0x0D, 0x1F, 0x04, 0x02, 0x02,
+  0x03, 0x05, 0x1C, 0x04, 0x03, 0x02, 0x04, 0x04, 0x1C, 0x03, 0x04, 0x02,
+  0x05, 0x03, 0x1B, 0x04, 0x04, 0x02, 0x06, 0x02, 0x1B, 0x04, 0x04, 0x02,
+  0x06, 0x02, 0x1B, 0x04, 0x04, 0x02, 0x07, 0x01, 0x1B, 0x04, 0x04, 0x02,
+  0x07, 0x01, 0x1B, 0x05, 0x03, 0x02, 0x24, 0x05, 0x02, 0x02, 0x24, 0x06,
+  0x01, 0x02, 0x25, 0x08, 0x26, 0x07, 0x27, 0x08, 0x26, 0x08, 0x27, 0x07,
+  0x27, 0x08, 0x25, 0x09, 0x24, 0x02, 0x01, 0x07, 0x23, 0x02, 0x03, 0x05,
+  0x23, 0x02, 0x04, 0x05, 0x22, 0x02, 0x04, 0x05, 0x22, 0x02, 0x05, 0x04,
+  0x1A, 0x01, 0x07, 0x02, 0x05, 0x04, 0x1A, 0x01, 0x07, 0x02, 0x05, 0x04,
+  0x1A, 0x02, 0x06, 0x02, 0x05, 0x03, 0x1B, 0x02, 0x06, 0x02, 0x04, 0x04,
+  0x1B, 0x03, 0x05, 0x02, 0x03, 0x04, 0x1C, 0x05, 0x03, 0x02, 0x02, 0x04,
+  0x1F, 0x0D, 0x23, 0x08, 0x28, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x35, 0x05,
+  0x14, 0x02, 0x10, 0x08, 0x12, 0x02, 0x10, 0x04, 0x02, 0x04, 0x10, 0x02,
+  0x10, 0x04, 0x04, 0x04, 0x0E, 0x03, 0x10, 0x03, 0x06, 0x03, 0x0E, 0x02,
+  0x10, 0x04, 0x06, 0x04, 0x0C, 0x02, 0x11, 0x04, 0x06, 0x04, 0x0B, 0x02,
+  0x12, 0x04, 0x06, 0x04, 0x0B, 0x02, 0x12, 0x04, 0x06, 0x04, 0x0A, 0x02,
+  0x13, 0x04, 0x06, 0x04, 0x09, 0x02, 0x14, 0x04, 0x06, 0x04, 0x09, 0x02,
+  0x14, 0x04, 0x06, 0x04, 0x08, 0x02, 0x16, 0x03, 0x06, 0x03, 0x08, 0x02,
+  0x17, 0x04, 0x04, 0x04, 0x07, 0x02, 0x19, 0x04, 0x02, 0x04, 0x08, 0x02,
+  0x1A, 0x08, 0x08, 0x02, 0x1D, 0x05, 0x08, 0x02, 0x2B, 0x02, 0x09, 0x04,
+  0x1D, 0x02, 0x08, 0x08, 0x1A, 0x02, 0x08, 0x04, 0x02, 0x04, 0x18, 0x03,
+  0x07, 0x04, 0x04, 0x04, 0x17, 0x02, 0x08, 0x03, 0x06, 0x03, 0x16, 0x02,
+  0x08, 0x04, 0x06, 0x04, 0x14, 0x02, 0x09, 0x04, 0x06, 0x04, 0x14, 0x02,
+  0x09, 0x04, 0x06, 0x04, 0x13, 0x02, 0x0A, 0x04, 0x06, 0x04, 0x12, 0x02,
+  0x0B, 0x04, 0x06, 0x04, 0x12, 0x02, 0x0B, 0x04, 0x06, 0x04, 0x11, 0x02,
+  0x0C, 0x04, 0x06, 0x04, 0x10, 0x02, 0x0E, 0x03, 0x06, 0x03, 0x10, 0x02,
+  0x0F, 0x04, 0x04, 0x04, 0x10, 0x02, 0x10, 0x04, 0x02, 0x04, 0x10, 0x02,
+  0x12, 0x08, 0x10, 0x02, 0x15, 0x05, 0x3F, 0x06, 0x25, 0x0A, 0x22, 0x04,
+  0x04, 0x04, 0x20, 0x04, 0x06, 0x03, 0x20, 0x03, 0x08, 0x03, 0x1E, 0x04,
+  0x08, 0x03, 0x1E, 0x04, 0x08, 0x03, 0x1E, 0x04, 0x08, 0x03, 0x1E, 0x04,
+  0x07, 0x03, 0x1F, 0x05, 0x06, 0x03, 0x1F, 0x05, 0x05, 0x03, 0x21, 0x05,
+  0x02, 0x04, 0x22, 0x0A, 0x05, 0x0A, 0x14, 0x08, 0x08, 0x07, 0x17, 0x05,
+  0x0B, 0x04, 0x18, 0x06, 0x0B, 0x03, 0x17, 0x09, 0x0A, 0x03, 0x16, 0x03,
+  0x02, 0x05, 0x0A, 0x02, 0x15, 0x04, 0x04, 0x05, 0x08, 0x02, 0x15, 0x05,
+  0x04, 0x05, 0x08, 0x01, 0x15, 0x05, 0x06, 0x05, 0x06, 0x02, 0x15, 0x05,
+  0x06, 0x05, 0x05, 0x02, 0x15, 0x05, 0x08, 0x05, 0x03, 0x02, 0x16, 0x05,
+  0x08, 0x05, 0x01, 0x03, 0x16, 0x06, 0x09, 0x07, 0x17, 0x06, 0x0A, 0x05,
+  0x18, 0x06, 0x0A, 0x05, 0x18, 0x07, 0x0A, 0x05, 0x0B, 0x01, 0x0B, 0x07,
+  0x09, 0x08, 0x08, 0x02, 0x0C, 0x07, 0x07, 0x02, 0x01, 0x08, 0x05, 0x02,
+  0x0D, 0x08, 0x04, 0x03, 0x03, 0x0E, 0x0E, 0x0D, 0x05, 0x0C, 0x10, 0x0B,
+  0x08, 0x09, 0x13, 0x06, 0x0D, 0x05, 0x43, 0x02, 0x2A, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x2A, 0x02,
+  0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x1C, 0x01, 0x2A, 0x02,
+  0x2A, 0x02, 0x2A, 0x02, 0x2A, 0x02, 0x2A, 0x02, 0x2A, 0x03, 0x29, 0x03,
+  0x2A, 0x03, 0x29, 0x04, 0x29, 0x03, 0x29, 0x04, 0x29, 0x04, 0x28, 0x05,
+  0x28, 0x05, 0x28, 0x04, 0x29, 0x04, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05,
+  0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05,
+  0x28, 0x05, 0x28, 0x05, 0x29, 0x04, 0x29, 0x04, 0x29, 0x05, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x2A, 0x03, 0x2A, 0x04, 0x2A, 0x03, 0x2A, 0x04,
+  0x2A, 0x03, 0x2B, 0x03, 0x2B, 0x02, 0x2C, 0x02, 0x2C, 0x02, 0x2C, 0x02,
+  0x2D, 0x01, 0x0F, 0x01, 0x2D, 0x02, 0x2C, 0x02, 0x2C, 0x02, 0x2C, 0x02,
+  0x2B, 0x03, 0x2B, 0x03, 0x2A, 0x04, 0x2A, 0x03, 0x2A, 0x04, 0x2A, 0x03,
+  0x2A, 0x04, 0x29, 0x04, 0x29, 0x05, 0x28, 0x05, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05,
+  0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x04,
+  0x29, 0x04, 0x28, 0x05, 0x28, 0x05, 0x28, 0x04, 0x29, 0x04, 0x29, 0x03,
+  0x29, 0x04, 0x29, 0x03, 0x2A, 0x03, 0x29, 0x03, 0x2A, 0x02, 0x2A, 0x02,
+  0x2A, 0x02, 0x2A, 0x02, 0x2A, 0x02, 0x2A, 0x01, 0x15, 0x03, 0x2A, 0x03,
+  0x2A, 0x03, 0x2A, 0x03, 0x24, 0x02, 0x04, 0x03, 0x04, 0x02, 0x1D, 0x05,
+  0x02, 0x03, 0x02, 0x05, 0x1C, 0x05, 0x03, 0x01, 0x03, 0x05, 0x1D, 0x05,
+  0x02, 0x01, 0x02, 0x05, 0x21, 0x09, 0x27, 0x03, 0x27, 0x09, 0x21, 0x05,
+  0x02, 0x01, 0x02, 0x05, 0x1D, 0x05, 0x03, 0x01, 0x03, 0x05, 0x1C, 0x04,
+  0x03, 0x03, 0x02, 0x05, 0x1D, 0x02, 0x04, 0x03, 0x04, 0x02, 0x24, 0x03,
+  0x2A, 0x03, 0x2A, 0x03, 0x2A, 0x03, 0xF7, 0x02, 0x2B, 0x02, 0x2B, 0x02,
+  0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02,
+  0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x1F, 0x1A, 0x13, 0x1A, 0x1F, 0x02,
+  0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02,
+  0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x8B, 0x04, 0x28, 0x06,
+  0x27, 0x07, 0x27, 0x03, 0x01, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2A, 0x02,
+  0x2B, 0x02, 0x2A, 0x02, 0x29, 0x03, 0x29, 0x02, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0xC4, 0x0C, 0x21, 0x0C, 0x21, 0x0C, 0x21, 0x0C, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x8C, 0x02, 0x2A, 0x04,
+  0x29, 0x04, 0x2A, 0x02, 0x1C, 0x02, 0x2A, 0x03, 0x2A, 0x02, 0x2B, 0x02,
+  0x2A, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2A, 0x02, 0x2B, 0x02, 0x2B, 0x02,
+  0x2A, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2A, 0x02, 0x2B, 0x02, 0x2B, 0x02,
+  0x2A, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2A, 0x02, 0x2B, 0x02, 0x2B, 0x02,
+  0x2A, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2A, 0x02, 0x2B, 0x02, 0x2B, 0x02,
+  0x2A, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2A, 0x02, 0x2B, 0x02, 0x2B, 0x02,
+  0x2A, 0x02, 0x6F, 0x05, 0x26, 0x08, 0x24, 0x03, 0x04, 0x03, 0x22, 0x03,
+  0x06, 0x03, 0x20, 0x03, 0x08, 0x03, 0x1E, 0x04, 0x09, 0x03, 0x1D, 0x03,
+  0x0A, 0x03, 0x1C, 0x04, 0x0A, 0x04, 0x1B, 0x04, 0x0A, 0x04, 0x1B, 0x04,
+  0x0B, 0x03, 0x1B, 0x03, 0x0C, 0x04, 0x19, 0x04, 0x0C, 0x04, 0x19, 0x04,
+  0x0C, 0x04, 0x19, 0x04, 0x0C, 0x04, 0x19, 0x04, 0x0C, 0x04, 0x19, 0x04,
+  0x0C, 0x04, 0x19, 0x04, 0x0C, 0x04, 0x19, 0x04, 0x0C, 0x04, 0x19, 0x04,
+  0x0C, 0x04, 0x19, 0x04, 0x0C, 0x04, 0x19, 0x04, 0x0C, 0x04, 0x1A, 0x03,
+  0x0C, 0x03, 0x1B, 0x03, 0x0B, 0x04, 0x1B, 0x04, 0x0A, 0x04, 0x1B, 0x04,
+  0x0A, 0x04, 0x1C, 0x03, 0x0A, 0x03, 0x1D, 0x04, 0x08, 0x04, 0x1E, 0x03,
+  0x08, 0x03, 0x20, 0x03, 0x06, 0x03, 0x21, 0x04, 0x04, 0x03, 0x24, 0x08,
+  0x26, 0x05, 0x70, 0x03, 0x26, 0x07, 0x24, 0x02, 0x02, 0x05, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x28, 0x06, 0x24, 0x0C, 0x6D, 0x06, 0x25, 0x0A,
+  0x22, 0x0D, 0x1F, 0x0E, 0x1E, 0x04, 0x05, 0x07, 0x1D, 0x02, 0x09, 0x06,
+  0x1C, 0x01, 0x0B, 0x05, 0x1B, 0x02, 0x0B, 0x05, 0x1B, 0x01, 0x0D, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x03, 0x2A, 0x03, 0x29, 0x03, 0x2A, 0x03,
+  0x2A, 0x02, 0x2A, 0x03, 0x29, 0x03, 0x2A, 0x02, 0x2A, 0x02, 0x2A, 0x03,
+  0x29, 0x03, 0x2A, 0x02, 0x2A, 0x02, 0x2A, 0x02, 0x2A, 0x02, 0x0C, 0x01,
+  0x1D, 0x02, 0x0C, 0x02, 0x1C, 0x02, 0x0C, 0x02, 0x1C, 0x11, 0x1B, 0x12,
+  0x1A, 0x12, 0x1A, 0x13, 0x6D, 0x06, 0x25, 0x0A, 0x22, 0x0C, 0x20, 0x02,
+  0x05, 0x06, 0x1F, 0x02, 0x08, 0x05, 0x1E, 0x01, 0x09, 0x05, 0x1D, 0x01,
+  0x0B, 0x04, 0x29, 0x04, 0x29, 0x03, 0x2A, 0x03, 0x2A, 0x02, 0x2A, 0x02,
+  0x2A, 0x02, 0x2A, 0x03, 0x28, 0x07, 0x24, 0x0A, 0x26, 0x08, 0x27, 0x06,
+  0x28, 0x06, 0x28, 0x05, 0x28, 0x05, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x03, 0x29, 0x04, 0x29, 0x03, 0x1E, 0x03, 0x08, 0x03,
+  0x1F, 0x05, 0x05, 0x03, 0x20, 0x0C, 0x23, 0x07, 0x74, 0x03, 0x29, 0x04,
+  0x29, 0x04, 0x28, 0x05, 0x27, 0x06, 0x27, 0x06, 0x26, 0x02, 0x01, 0x04,
+  0x25, 0x02, 0x02, 0x04, 0x25, 0x02, 0x02, 0x04, 0x24, 0x02, 0x03, 0x04,
+  0x23, 0x02, 0x04, 0x04, 0x23, 0x02, 0x04, 0x04, 0x22, 0x02, 0x05, 0x04,
+  0x21, 0x02, 0x06, 0x04, 0x21, 0x02, 0x06, 0x04, 0x20, 0x02, 0x07, 0x04,
+  0x1F, 0x02, 0x08, 0x04, 0x1F, 0x02, 0x08, 0x04, 0x1E, 0x02, 0x09, 0x04,
+  0x1D, 0x02, 0x0A, 0x04, 0x1D, 0x02, 0x0A, 0x04, 0x1C, 0x15, 0x18, 0x15,
+  0x18, 0x15, 0x25, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x6E, 0x0B, 0x21, 0x0B, 0x22, 0x0B,
+  0x21, 0x0C, 0x21, 0x02, 0x2A, 0x03, 0x2A, 0x02, 0x2B, 0x02, 0x2A, 0x05,
+  0x28, 0x08, 0x24, 0x0A, 0x23, 0x0C, 0x25, 0x09, 0x27, 0x07, 0x27, 0x06,
+  0x29, 0x05, 0x29, 0x04, 0x29, 0x05, 0x29, 0x04, 0x29, 0x04, 0x2A, 0x03,
+  0x2A, 0x03, 0x2A, 0x03, 0x2A, 0x03, 0x2A, 0x02, 0x2B, 0x02, 0x2A, 0x02,
+  0x2A, 0x02, 0x1F, 0x04, 0x07, 0x02, 0x20, 0x05, 0x05, 0x02, 0x22, 0x0A,
+  0x24, 0x06, 0x75, 0x05, 0x25, 0x05, 0x26, 0x04, 0x28, 0x04, 0x28, 0x03,
+  0x29, 0x03, 0x29, 0x03, 0x29, 0x04, 0x28, 0x04, 0x29, 0x03, 0x29, 0x04,
+  0x29, 0x03, 0x29, 0x04, 0x03, 0x06, 0x20, 0x04, 0x01, 0x0A, 0x1E, 0x06,
+  0x05, 0x05, 0x1C, 0x05, 0x08, 0x05, 0x1B, 0x04, 0x0A, 0x05, 0x1A, 0x04,
+  0x0B, 0x04, 0x1A, 0x04, 0x0B, 0x05, 0x19, 0x04, 0x0C, 0x04, 0x19, 0x04,
+  0x0C, 0x04, 0x19, 0x04, 0x0C, 0x04, 0x19, 0x04, 0x0C, 0x04, 0x1A, 0x03,
+  0x0C, 0x04, 0x1A, 0x04, 0x0B, 0x03, 0x1B, 0x04, 0x0B, 0x03, 0x1C, 0x03,
+  0x0A, 0x04, 0x1C, 0x04, 0x09, 0x03, 0x1E, 0x04, 0x07, 0x03, 0x20, 0x04,
+  0x05, 0x03, 0x22, 0x0A, 0x25, 0x06, 0x6A, 0x12, 0x1A, 0x13, 0x1A, 0x13,
+  0x1A, 0x12, 0x1A, 0x03, 0x0D, 0x03, 0x1A, 0x02, 0x0D, 0x03, 0x1A, 0x02,
+  0x0E, 0x03, 0x1A, 0x01, 0x0F, 0x03, 0x29, 0x03, 0x2A, 0x03, 0x2A, 0x03,
+  0x29, 0x03, 0x2A, 0x03, 0x2A, 0x03, 0x29, 0x03, 0x2A, 0x03, 0x2A, 0x03,
+  0x29, 0x03, 0x2A, 0x03, 0x29, 0x03, 0x2A, 0x03, 0x2A, 0x03, 0x29, 0x03,
+  0x2A, 0x03, 0x2A, 0x03, 0x29, 0x03, 0x2A, 0x03, 0x2A, 0x03, 0x29, 0x03,
+  0x2A, 0x03, 0x2A, 0x03, 0x29, 0x03, 0x6D, 0x07, 0x24, 0x0B, 0x21, 0x04,
+  0x05, 0x04, 0x1F, 0x04, 0x07, 0x04, 0x1E, 0x03, 0x09, 0x04, 0x1C, 0x04,
+  0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x05,
+  0x08, 0x04, 0x1C, 0x05, 0x08, 0x03, 0x1E, 0x05, 0x06, 0x04, 0x1E, 0x06,
+  0x05, 0x03, 0x20, 0x06, 0x03, 0x03, 0x22, 0x06, 0x01, 0x03, 0x24, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x24, 0x03, 0x01, 0x06, 0x22, 0x03, 0x03, 0x06,
+  0x20, 0x03, 0x05, 0x06, 0x1E, 0x04, 0x06, 0x06, 0x1D, 0x03, 0x08, 0x05,
+  0x1C, 0x04, 0x09, 0x05, 0x1B, 0x04, 0x0A, 0x04, 0x1B, 0x04, 0x0A, 0x04,
+  0x1B, 0x04, 0x0A, 0x04, 0x1B, 0x04, 0x0A, 0x04, 0x1C, 0x04, 0x09, 0x03,
+  0x1D, 0x05, 0x07, 0x04, 0x1E, 0x05, 0x05, 0x04, 0x20, 0x0B, 0x24, 0x07,
+  0x6E, 0x06, 0x25, 0x0A, 0x22, 0x03, 0x05, 0x04, 0x20, 0x03, 0x07, 0x04,
+  0x1E, 0x03, 0x09, 0x04, 0x1C, 0x04, 0x0A, 0x03, 0x1C, 0x03, 0x0B, 0x04,
+  0x1A, 0x04, 0x0B, 0x04, 0x1A, 0x04, 0x0C, 0x03, 0x1A, 0x04, 0x0C, 0x04,
+  0x19, 0x04, 0x0C, 0x04, 0x19, 0x04, 0x0C, 0x04, 0x19, 0x04, 0x0C, 0x04,
+  0x19, 0x05, 0x0B, 0x04, 0x1A, 0x04, 0x0B, 0x04, 0x1A, 0x05, 0x0A, 0x04,
+  0x1B, 0x05, 0x09, 0x04, 0x1C, 0x05, 0x05, 0x06, 0x1E, 0x0A, 0x01, 0x04,
+  0x20, 0x06, 0x03, 0x04, 0x29, 0x03, 0x29, 0x04, 0x29, 0x03, 0x29, 0x04,
+  0x28, 0x04, 0x29, 0x03, 0x29, 0x03, 0x29, 0x03, 0x29, 0x03, 0x28, 0x04,
+  0x27, 0x04, 0x25, 0x05, 0xFF, 0x00, 0xFF, 0x00, 0x34, 0x02, 0x2A, 0x04,
+  0x29, 0x04, 0x2A, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xD0, 0x02, 0x2A, 0x04,
+  0x29, 0x04, 0x2A, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0x33, 0x02, 0x2A, 0x04,
+  0x29, 0x04, 0x2A, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xCF, 0x04, 0x28, 0x06,
+  0x27, 0x07, 0x27, 0x06, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x01, 0x2B, 0x02,
+  0x2A, 0x02, 0x2A, 0x02, 0x29, 0x02, 0xFF, 0x00, 0x5E, 0x01, 0x2A, 0x03,
+  0x27, 0x05, 0x26, 0x05, 0x26, 0x04, 0x26, 0x05, 0x26, 0x05, 0x26, 0x05,
+  0x26, 0x04, 0x26, 0x05, 0x26, 0x05, 0x27, 0x03, 0x2B, 0x05, 0x2A, 0x05,
+  0x2B, 0x04, 0x2B, 0x05, 0x2A, 0x05, 0x2A, 0x05, 0x2B, 0x04, 0x2B, 0x05,
+  0x2A, 0x05, 0x2B, 0x03, 0x2C, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0x55, 0x19,
+  0x14, 0x19, 0xFF, 0x00, 0x23, 0x19, 0x14, 0x19, 0xFF, 0x00, 0x46, 0x01,
+  0x2C, 0x03, 0x2B, 0x05, 0x2A, 0x05, 0x2B, 0x04, 0x2B, 0x05, 0x2A, 0x05,
+  0x2A, 0x05, 0x2B, 0x04, 0x2B, 0x05, 0x2A, 0x05, 0x2B, 0x03, 0x27, 0x05,
+  0x26, 0x05, 0x26, 0x04, 0x26, 0x05, 0x26, 0x05, 0x26, 0x05, 0x26, 0x04,
+  0x26, 0x05, 0x26, 0x05, 0x27, 0x03, 0x2A, 0x01, 0x41, 0x07, 0x24, 0x0B,
+  0x21, 0x03, 0x05, 0x05, 0x1F, 0x02, 0x08, 0x05, 0x1E, 0x02, 0x09, 0x04,
+  0x1D, 0x03, 0x09, 0x05, 0x1C, 0x03, 0x0A, 0x04, 0x1C, 0x04, 0x09, 0x04,
+  0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1D, 0x02, 0x0A, 0x04,
+  0x29, 0x03, 0x29, 0x04, 0x29, 0x03, 0x29, 0x03, 0x2A, 0x03, 0x29, 0x03,
+  0x2A, 0x02, 0x2A, 0x02, 0x2B, 0x01, 0x2B, 0x02, 0x2B, 0x01, 0x2C, 0x01,
+  0x2B, 0x01, 0x2C, 0x01, 0x2C, 0x01, 0x2C, 0x01, 0xB3, 0x02, 0x2A, 0x04,
+  0x29, 0x04, 0x2A, 0x02, 0x15, 0x09, 0x20, 0x10, 0x1B, 0x06, 0x08, 0x06,
+  0x18, 0x04, 0x0E, 0x04, 0x15, 0x04, 0x12, 0x03, 0x13, 0x03, 0x15, 0x03,
+  0x11, 0x03, 0x17, 0x03, 0x0F, 0x03, 0x19, 0x03, 0x0D, 0x03, 0x1B, 0x02,
+  0x0C, 0x03, 0x1C, 0x03, 0x0B, 0x02, 0x1E, 0x02, 0x0A, 0x03, 0x0E, 0x05,
+  0x05, 0x02, 0x04, 0x02, 0x0A, 0x02, 0x0D, 0x04, 0x03, 0x01, 0x01, 0x04,
+  0x05, 0x03, 0x08, 0x03, 0x0C, 0x03, 0x06, 0x05, 0x06, 0x02, 0x08, 0x02,
+  0x0C, 0x03, 0x08, 0x04, 0x06, 0x02, 0x07, 0x03, 0x0B, 0x03, 0x09, 0x04,
+  0x06, 0x02, 0x07, 0x02, 0x0B, 0x03, 0x0A, 0x03, 0x07, 0x02, 0x07, 0x02,
+  0x0A, 0x04, 0x0A, 0x03, 0x07, 0x02, 0x07, 0x02, 0x09, 0x04, 0x0A, 0x04,
+  0x07, 0x02, 0x06, 0x03, 0x09, 0x04, 0x0A, 0x03, 0x08, 0x02, 0x06, 0x02,
+  0x09, 0x04, 0x0B, 0x03, 0x08, 0x02, 0x06, 0x02, 0x09, 0x04, 0x0A, 0x04,
+  0x07, 0x02, 0x07, 0x02, 0x08, 0x04, 0x0B, 0x04, 0x07, 0x02, 0x07, 0x02,
+  0x08, 0x04, 0x0A, 0x04, 0x08, 0x02, 0x07, 0x02, 0x08, 0x04, 0x0A, 0x04,
+  0x08, 0x02, 0x07, 0x02, 0x07, 0x04, 0x0A, 0x05, 0x07, 0x02, 0x08, 0x02,
+  0x07, 0x04, 0x09, 0x06, 0x07, 0x02, 0x08, 0x02, 0x07, 0x04, 0x09, 0x05,
+  0x07, 0x02, 0x09, 0x02, 0x07, 0x04, 0x08, 0x01, 0x01, 0x04, 0x07, 0x02,
+  0x0A, 0x01, 0x07, 0x05, 0x06, 0x01, 0x02, 0x04, 0x06, 0x02, 0x0B, 0x02,
+  0x06, 0x05, 0x04, 0x02, 0x03, 0x04, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02,
+  0x07, 0x09, 0x04, 0x04, 0x03, 0x03, 0x06, 0x01, 0x06, 0x02, 0x07, 0x08,
+  0x05, 0x09, 0x06, 0x02, 0x07, 0x02, 0x08, 0x04, 0x08, 0x06, 0x08, 0x01,
+  0x08, 0x02, 0x21, 0x02, 0x09, 0x02, 0x20, 0x01, 0x0A, 0x02, 0x1F, 0x02,
+  0x0B, 0x02, 0x1D, 0x02, 0x0D, 0x02, 0x1B, 0x02, 0x0F, 0x02, 0x19, 0x02,
+  0x10, 0x03, 0x17, 0x02, 0x13, 0x03, 0x13, 0x03, 0x15, 0x04, 0x0F, 0x04,
+  0x18, 0x05, 0x09, 0x05, 0x1C, 0x0F, 0x21, 0x09, 0x45, 0x01, 0x2B, 0x02,
+  0x2B, 0x03, 0x29, 0x04, 0x29, 0x05, 0x27, 0x06, 0x27, 0x06, 0x26, 0x02,
+  0x01, 0x05, 0x25, 0x02, 0x01, 0x05, 0x25, 0x02, 0x01, 0x05, 0x24, 0x02,
+  0x03, 0x05, 0x23, 0x02, 0x03, 0x05, 0x22, 0x02, 0x04, 0x06, 0x21, 0x02,
+  0x05, 0x05, 0x20, 0x02, 0x06, 0x05, 0x20, 0x02, 0x06, 0x06, 0x1F, 0x02,
+  0x07, 0x05, 0x1E, 0x02, 0x08, 0x05, 0x1E, 0x02, 0x09, 0x05, 0x1C, 0x02,
+  0x0A, 0x05, 0x1C, 0x12, 0x1A, 0x13, 0x1A, 0x02, 0x0C, 0x05, 0x1A, 0x02,
+  0x0C, 0x06, 0x18, 0x02, 0x0E, 0x05, 0x18, 0x02, 0x0E, 0x05, 0x17, 0x02,
+  0x10, 0x05, 0x16, 0x02, 0x10, 0x05, 0x15, 0x03, 0x10, 0x06, 0x14, 0x02,
+  0x12, 0x05, 0x13, 0x03, 0x12, 0x06, 0x11, 0x05, 0x10, 0x08, 0x0E, 0x0A,
+  0x0B, 0x0C, 0x61, 0x14, 0x1D, 0x13, 0x1B, 0x05, 0x08, 0x06, 0x1A, 0x05,
+  0x0A, 0x05, 0x19, 0x05, 0x0B, 0x05, 0x18, 0x05, 0x0B, 0x05, 0x18, 0x05,
+  0x0C, 0x05, 0x17, 0x05, 0x0C, 0x05, 0x17, 0x05, 0x0C, 0x05, 0x17, 0x05,
+  0x0C, 0x05, 0x17, 0x05, 0x0C, 0x05, 0x17, 0x05, 0x0B, 0x05, 0x18, 0x05,
+  0x0B, 0x05, 0x18, 0x05, 0x09, 0x06, 0x19, 0x12, 0x1B, 0x12, 0x1B, 0x05,
+  0x08, 0x07, 0x19, 0x05, 0x0A, 0x07, 0x17, 0x05, 0x0C, 0x06, 0x16, 0x05,
+  0x0C, 0x06, 0x16, 0x05, 0x0D, 0x06, 0x15, 0x05, 0x0D, 0x06, 0x15, 0x05,
+  0x0D, 0x06, 0x15, 0x05, 0x0D, 0x06, 0x15, 0x05, 0x0D, 0x06, 0x15, 0x05,
+  0x0D, 0x06, 0x15, 0x05, 0x0C, 0x06, 0x16, 0x05, 0x0B, 0x07, 0x16, 0x05,
+  0x0A, 0x07, 0x17, 0x06, 0x07, 0x08, 0x16, 0x15, 0x15, 0x15, 0x42, 0x07,
+  0x06, 0x01, 0x1C, 0x0D, 0x02, 0x02, 0x1A, 0x06, 0x06, 0x07, 0x19, 0x05,
+  0x0A, 0x05, 0x18, 0x05, 0x0D, 0x03, 0x17, 0x05, 0x0F, 0x03, 0x15, 0x05,
+  0x10, 0x03, 0x15, 0x05, 0x11, 0x02, 0x14, 0x05, 0x12, 0x02, 0x14, 0x05,
+  0x13, 0x01, 0x13, 0x06, 0x13, 0x01, 0x13, 0x06, 0x27, 0x05, 0x27, 0x06,
+  0x27, 0x06, 0x27, 0x06, 0x27, 0x06, 0x27, 0x06, 0x27, 0x06, 0x27, 0x06,
+  0x27, 0x06, 0x27, 0x06, 0x28, 0x05, 0x28, 0x06, 0x27, 0x06, 0x28, 0x05,
+  0x28, 0x06, 0x13, 0x01, 0x14, 0x05, 0x12, 0x01, 0x16, 0x05, 0x10, 0x01,
+  0x17, 0x06, 0x0E, 0x02, 0x18, 0x07, 0x0B, 0x02, 0x1B, 0x07, 0x07, 0x02,
+  0x1E, 0x0E, 0x22, 0x08, 0x5F, 0x14, 0x1D, 0x14, 0x1A, 0x06, 0x07, 0x08,
+  0x18, 0x05, 0x0B, 0x07, 0x16, 0x05, 0x0C, 0x07, 0x15, 0x05, 0x0D, 0x07,
+  0x14, 0x05, 0x0E, 0x06, 0x14, 0x05, 0x0F, 0x06, 0x13, 0x05, 0x0F, 0x06,
+  0x13, 0x05, 0x10, 0x06, 0x12, 0x05, 0x10, 0x06, 0x12, 0x05, 0x11, 0x06,
+  0x11, 0x05, 0x11, 0x06, 0x11, 0x05, 0x11, 0x06, 0x11, 0x05, 0x11, 0x06,
+  0x11, 0x05, 0x11, 0x06, 0x11, 0x05, 0x11, 0x06, 0x11, 0x05, 0x11, 0x06,
+  0x11, 0x05, 0x11, 0x06, 0x11, 0x05, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05,
+  0x12, 0x05, 0x10, 0x06, 0x12, 0x05, 0x10, 0x06, 0x12, 0x05, 0x0F, 0x06,
+  0x13, 0x05, 0x0F, 0x06, 0x13, 0x05, 0x0E, 0x06, 0x14, 0x05, 0x0D, 0x06,
+  0x15, 0x05, 0x0C, 0x06, 0x16, 0x05, 0x0B, 0x06, 0x17, 0x06, 0x07, 0x08,
+  0x17, 0x14, 0x15, 0x14, 0x62, 0x1A, 0x17, 0x16, 0x18, 0x05, 0x0C, 0x04,
+  0x18, 0x05, 0x0E, 0x02, 0x18, 0x05, 0x0E, 0x02, 0x18, 0x05, 0x0F, 0x01,
+  0x18, 0x05, 0x0F, 0x01, 0x18, 0x05, 0x28, 0x05, 0x28, 0x05, 0x0C, 0x01,
+  0x1B, 0x05, 0x0C, 0x01, 0x1B, 0x05, 0x0C, 0x01, 0x1B, 0x05, 0x0B, 0x02,
+  0x1B, 0x05, 0x0A, 0x03, 0x1B, 0x12, 0x1B, 0x12, 0x1B, 0x05, 0x0A, 0x03,
+  0x1B, 0x05, 0x0B, 0x02, 0x1B, 0x05, 0x0C, 0x01, 0x1B, 0x05, 0x0C, 0x01,
+  0x1B, 0x05, 0x0C, 0x01, 0x1B, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05,
+  0x11, 0x01, 0x16, 0x05, 0x10, 0x01, 0x17, 0x05, 0x0F, 0x02, 0x17, 0x05,
+  0x0F, 0x02, 0x17, 0x05, 0x0E, 0x02, 0x18, 0x06, 0x0B, 0x04, 0x16, 0x17,
+  0x13, 0x19, 0x63, 0x19, 0x17, 0x16, 0x19, 0x05, 0x0B, 0x04, 0x19, 0x05,
+  0x0C, 0x03, 0x19, 0x05, 0x0D, 0x02, 0x19, 0x05, 0x0D, 0x02, 0x19, 0x05,
+  0x0E, 0x01, 0x19, 0x05, 0x28, 0x05, 0x28, 0x05, 0x0A, 0x01, 0x1D, 0x05,
+  0x0A, 0x01, 0x1D, 0x05, 0x0A, 0x01, 0x1D, 0x05, 0x09, 0x02, 0x1D, 0x05,
+  0x08, 0x03, 0x1D, 0x10, 0x1D, 0x10, 0x1D, 0x05, 0x08, 0x03, 0x1D, 0x05,
+  0x09, 0x02, 0x1D, 0x05, 0x0A, 0x01, 0x1D, 0x05, 0x0A, 0x01, 0x1D, 0x05,
+  0x0A, 0x01, 0x1D, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05,
+  0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x27, 0x08, 0x21, 0x0F,
+  0x41, 0x09, 0x06, 0x01, 0x1A, 0x0F, 0x03, 0x01, 0x18, 0x06, 0x08, 0x07,
+  0x17, 0x05, 0x0C, 0x05, 0x16, 0x05, 0x0F, 0x03, 0x15, 0x05, 0x11, 0x03,
+  0x13, 0x05, 0x12, 0x03, 0x12, 0x05, 0x14, 0x02, 0x12, 0x05, 0x14, 0x02,
+  0x11, 0x05, 0x16, 0x01, 0x10, 0x06, 0x27, 0x06, 0x27, 0x05, 0x27, 0x06,
+  0x27, 0x06, 0x27, 0x06, 0x27, 0x06, 0x0E, 0x0F, 0x0A, 0x06, 0x11, 0x09,
+  0x0D, 0x06, 0x12, 0x07, 0x0E, 0x06, 0x13, 0x05, 0x0F, 0x06, 0x13, 0x05,
+  0x0F, 0x07, 0x12, 0x05, 0x10, 0x06, 0x12, 0x05, 0x10, 0x06, 0x12, 0x05,
+  0x11, 0x06, 0x11, 0x05, 0x11, 0x06, 0x11, 0x05, 0x12, 0x06, 0x10, 0x05,
+  0x12, 0x06, 0x10, 0x05, 0x13, 0x06, 0x0F, 0x05, 0x14, 0x06, 0x0E, 0x05,
+  0x15, 0x07, 0x0C, 0x05, 0x17, 0x07, 0x07, 0x08, 0x19, 0x11, 0x1F, 0x0B,
+  0x5F, 0x0F, 0x05, 0x0F, 0x0D, 0x09, 0x0B, 0x09, 0x12, 0x05, 0x0F, 0x05,
+  0x14, 0x05, 0x0F, 0x05, 0x14, 0x05, 0x0F, 0x05, 0x14, 0x05, 0x0F, 0x05,
+  0x14, 0x05, 0x0F, 0x05, 0x14, 0x05, 0x0F, 0x05, 0x14, 0x05, 0x0F, 0x05,
+  0x14, 0x05, 0x0F, 0x05, 0x14, 0x05, 0x0F, 0x05, 0x14, 0x05, 0x0F, 0x05,
+  0x14, 0x05, 0x0F, 0x05, 0x14, 0x05, 0x0F, 0x05, 0x14, 0x05, 0x0F, 0x05,
+  0x14, 0x19, 0x14, 0x19, 0x14, 0x05, 0x0F, 0x05, 0x14, 0x05, 0x0F, 0x05,
+  0x14, 0x05, 0x0F, 0x05, 0x14, 0x05, 0x0F, 0x05, 0x14, 0x05, 0x0F, 0x05,
+  0x14, 0x05, 0x0F, 0x05, 0x14, 0x05, 0x0F, 0x05, 0x14, 0x05, 0x0F, 0x05,
+  0x14, 0x05, 0x0F, 0x05, 0x14, 0x05, 0x0F, 0x05, 0x14, 0x05, 0x0F, 0x05,
+  0x14, 0x05, 0x0F, 0x05, 0x14, 0x05, 0x0F, 0x05, 0x13, 0x08, 0x0C, 0x08,
+  0x0D, 0x0F, 0x05, 0x0F, 0x69, 0x0F, 0x21, 0x08, 0x27, 0x05, 0x28, 0x05,
+  0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05,
+  0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05,
+  0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05,
+  0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05,
+  0x28, 0x05, 0x28, 0x05, 0x27, 0x08, 0x21, 0x0F, 0x6B, 0x0F, 0x21, 0x08,
+  0x27, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05,
+  0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05,
+  0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05,
+  0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05,
+  0x28, 0x04, 0x22, 0x03, 0x04, 0x04, 0x21, 0x04, 0x04, 0x04, 0x21, 0x05,
+  0x03, 0x03, 0x22, 0x05, 0x02, 0x03, 0x24, 0x08, 0x26, 0x06, 0x5F, 0x0F,
+  0x05, 0x0B, 0x11, 0x09, 0x0A, 0x07, 0x15, 0x05, 0x0D, 0x04, 0x17, 0x05,
+  0x0C, 0x03, 0x19, 0x05, 0x0C, 0x02, 0x1A, 0x05, 0x0B, 0x02, 0x1B, 0x05,
+  0x0A, 0x02, 0x1C, 0x05, 0x09, 0x02, 0x1D, 0x05, 0x08, 0x02, 0x1E, 0x05,
+  0x07, 0x02, 0x1F, 0x05, 0x06, 0x02, 0x20, 0x05, 0x04, 0x03, 0x21, 0x05,
+  0x03, 0x03, 0x22, 0x05, 0x02, 0x03, 0x23, 0x05, 0x01, 0x04, 0x23, 0x0B,
+  0x22, 0x05, 0x01, 0x06, 0x21, 0x05, 0x02, 0x06, 0x20, 0x05, 0x03, 0x07,
+  0x1E, 0x05, 0x04, 0x07, 0x1D, 0x05, 0x05, 0x07, 0x1C, 0x05, 0x06, 0x07,
+  0x1B, 0x05, 0x07, 0x07, 0x1A, 0x05, 0x08, 0x07, 0x19, 0x05, 0x09, 0x07,
+  0x18, 0x05, 0x0A, 0x07, 0x17, 0x05, 0x0B, 0x07, 0x16, 0x05, 0x0C, 0x07,
+  0x15, 0x05, 0x0D, 0x07, 0x14, 0x05, 0x0D, 0x08, 0x12, 0x08, 0x0B, 0x0A,
+  0x0C, 0x0F, 0x06, 0x0E, 0x62, 0x0F, 0x22, 0x08, 0x26, 0x05, 0x28, 0x05,
+  0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05,
+  0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05,
+  0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05,
+  0x28, 0x05, 0x28, 0x05, 0x11, 0x01, 0x16, 0x05, 0x10, 0x02, 0x16, 0x05,
+  0x10, 0x01, 0x17, 0x05, 0x0F, 0x02, 0x17, 0x05, 0x0F, 0x02, 0x17, 0x05,
+  0x0E, 0x03, 0x17, 0x06, 0x0B, 0x05, 0x16, 0x16, 0x13, 0x1A, 0x5B, 0x0A,
+  0x17, 0x0A, 0x05, 0x08, 0x15, 0x07, 0x0A, 0x07, 0x15, 0x06, 0x0C, 0x07,
+  0x14, 0x06, 0x0C, 0x07, 0x13, 0x07, 0x0C, 0x08, 0x12, 0x07, 0x0C, 0x02,
+  0x01, 0x05, 0x11, 0x02, 0x01, 0x05, 0x0C, 0x02, 0x01, 0x06, 0x10, 0x02,
+  0x01, 0x05, 0x0C, 0x02, 0x02, 0x05, 0x0F, 0x02, 0x02, 0x05, 0x0C, 0x02,
+  0x02, 0x06, 0x0E, 0x02, 0x02, 0x05, 0x0C, 0x02, 0x03, 0x05, 0x0D, 0x03,
+  0x02, 0x05, 0x0C, 0x02, 0x03, 0x06, 0x0C, 0x02, 0x03, 0x05, 0x0C, 0x02,
+  0x04, 0x05, 0x0C, 0x02, 0x03, 0x05, 0x0C, 0x02, 0x04, 0x05, 0x0B, 0x02,
+  0x04, 0x05, 0x0C, 0x02, 0x05, 0x05, 0x0A, 0x02, 0x04, 0x05, 0x0C, 0x02,
+  0x05, 0x05, 0x09, 0x02, 0x05, 0x05, 0x0C, 0x02, 0x06, 0x05, 0x08, 0x02,
+  0x05, 0x05, 0x0C, 0x02, 0x06, 0x05, 0x07, 0x02, 0x06, 0x05, 0x0C, 0x02,
+  0x06, 0x06, 0x06, 0x02, 0x06, 0x05, 0x0C, 0x02, 0x07, 0x05, 0x05, 0x03,
+  0x06, 0x05, 0x0C, 0x02, 0x07, 0x06, 0x04, 0x02, 0x07, 0x05, 0x0C, 0x02,
+  0x08, 0x05, 0x04, 0x02, 0x07, 0x05, 0x0C, 0x02, 0x08, 0x06, 0x02, 0x02,
+  0x08, 0x05, 0x0C, 0x02, 0x09, 0x05, 0x02, 0x02, 0x08, 0x05, 0x0C, 0x02,
+  0x09, 0x08, 0x09, 0x05, 0x0C, 0x02, 0x0A, 0x07, 0x09, 0x05, 0x0C, 0x02,
+  0x0A, 0x06, 0x0A, 0x05, 0x0C, 0x02, 0x0B, 0x05, 0x0A, 0x05, 0x0C, 0x02,
+  0x0B, 0x05, 0x0A, 0x05, 0x0C, 0x02, 0x0C, 0x03, 0x0B, 0x05, 0x0B, 0x04,
+  0x0B, 0x03, 0x0A, 0x07, 0x06, 0x0C, 0x08, 0x01, 0x07, 0x0F, 0x5F, 0x09,
+  0x0E, 0x0C, 0x0D, 0x07, 0x11, 0x04, 0x12, 0x07, 0x11, 0x02, 0x15, 0x06,
+  0x10, 0x02, 0x15, 0x07, 0x0F, 0x02, 0x15, 0x07, 0x0F, 0x02, 0x15, 0x08,
+  0x0E, 0x02, 0x15, 0x02, 0x01, 0x06, 0x0D, 0x02, 0x15, 0x02, 0x02, 0x06,
+  0x0C, 0x02, 0x15, 0x02, 0x02, 0x06, 0x0C, 0x02, 0x15, 0x02, 0x03, 0x06,
+  0x0B, 0x02, 0x15, 0x02, 0x04, 0x06, 0x0A, 0x02, 0x15, 0x02, 0x05, 0x06,
+  0x09, 0x02, 0x15, 0x02, 0x06, 0x06, 0x08, 0x02, 0x15, 0x02, 0x07, 0x05,
+  0x08, 0x02, 0x15, 0x02, 0x07, 0x06, 0x07, 0x02, 0x15, 0x02, 0x08, 0x06,
+  0x06, 0x02, 0x15, 0x02, 0x09, 0x06, 0x05, 0x02, 0x15, 0x02, 0x0A, 0x06,
+  0x04, 0x02, 0x15, 0x02, 0x0B, 0x05, 0x04, 0x02, 0x15, 0x02, 0x0B, 0x06,
+  0x03, 0x02, 0x15, 0x02, 0x0C, 0x06, 0x02, 0x02, 0x15, 0x02, 0x0D, 0x06,
+  0x01, 0x02, 0x15, 0x02, 0x0E, 0x08, 0x15, 0x02, 0x0F, 0x07, 0x15, 0x02,
+  0x0F, 0x07, 0x15, 0x02, 0x10, 0x06, 0x15, 0x02, 0x11, 0x05, 0x15, 0x02,
+  0x12, 0x04, 0x15, 0x02, 0x13, 0x03, 0x14, 0x04, 0x13, 0x02, 0x10, 0x0C,
+  0x0F, 0x02, 0x2C, 0x01, 0x40, 0x08, 0x22, 0x0D, 0x1E, 0x05, 0x06, 0x06,
+  0x1B, 0x05, 0x09, 0x05, 0x19, 0x05, 0x0B, 0x05, 0x17, 0x05, 0x0D, 0x05,
+  0x15, 0x05, 0x0F, 0x05, 0x13, 0x06, 0x0F, 0x06, 0x12, 0x05, 0x11, 0x05,
+  0x11, 0x06, 0x11, 0x06, 0x10, 0x06, 0x11, 0x06, 0x10, 0x05, 0x13, 0x05,
+  0x0F, 0x06, 0x13, 0x06, 0x0E, 0x06, 0x13, 0x06, 0x0E, 0x06, 0x13, 0x06,
+  0x0E, 0x06, 0x13, 0x06, 0x0E, 0x06, 0x13, 0x06, 0x0E, 0x06, 0x13, 0x06,
+  0x0E, 0x06, 0x13, 0x06, 0x0E, 0x06, 0x13, 0x06, 0x0E, 0x06, 0x13, 0x06,
+  0x0E, 0x06, 0x13, 0x05, 0x10, 0x06, 0x12, 0x05, 0x10, 0x06, 0x11, 0x06,
+  0x10, 0x06, 0x11, 0x05, 0x12, 0x05, 0x11, 0x05, 0x12, 0x06, 0x0F, 0x05,
+  0x14, 0x05, 0x0F, 0x05, 0x15, 0x05, 0x0D, 0x05, 0x17, 0x05, 0x0B, 0x05,
+  0x19, 0x05, 0x09, 0x05, 0x1B, 0x06, 0x05, 0x06, 0x1E, 0x0D, 0x22, 0x08,
+  0x63, 0x12, 0x1F, 0x11, 0x1D, 0x05, 0x06, 0x07, 0x1B, 0x05, 0x08, 0x06,
+  0x1A, 0x05, 0x09, 0x06, 0x19, 0x05, 0x09, 0x06, 0x19, 0x05, 0x0A, 0x06,
+  0x18, 0x05, 0x0A, 0x06, 0x18, 0x05, 0x0A, 0x06, 0x18, 0x05, 0x0A, 0x06,
+  0x18, 0x05, 0x0A, 0x06, 0x18, 0x05, 0x0A, 0x06, 0x18, 0x05, 0x09, 0x06,
+  0x19, 0x05, 0x09, 0x06, 0x19, 0x05, 0x08, 0x06, 0x1A, 0x05, 0x06, 0x07,
+  0x1B, 0x11, 0x1C, 0x05, 0x02, 0x08, 0x1E, 0x05, 0x28, 0x05, 0x28, 0x05,
+  0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05,
+  0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x27, 0x07, 0x22, 0x0F, 0x40, 0x08,
+  0x22, 0x0D, 0x1E, 0x05, 0x06, 0x06, 0x1B, 0x05, 0x09, 0x05, 0x19, 0x05,
+  0x0B, 0x05, 0x17, 0x05, 0x0D, 0x05, 0x15, 0x05, 0x0F, 0x05, 0x13, 0x06,
+  0x0F, 0x06, 0x12, 0x05, 0x11, 0x05, 0x11, 0x06, 0x11, 0x06, 0x10, 0x06,
+  0x11, 0x06, 0x10, 0x05, 0x12, 0x06, 0x0F, 0x06, 0x13, 0x06, 0x0E, 0x06,
+  0x13, 0x06, 0x0E, 0x06, 0x13, 0x06, 0x0E, 0x06, 0x13, 0x06, 0x0E, 0x06,
+  0x13, 0x06, 0x0E, 0x06, 0x13, 0x06, 0x0E, 0x06, 0x13, 0x06, 0x0E, 0x06,
+  0x13, 0x06, 0x0E, 0x06, 0x13, 0x06, 0x0F, 0x05, 0x13, 0x05, 0x10, 0x06,
+  0x12, 0x05, 0x10, 0x06, 0x11, 0x06, 0x11, 0x05, 0x11, 0x05, 0x12, 0x05,
+  0x11, 0x05, 0x13, 0x05, 0x0F, 0x05, 0x14, 0x05, 0x0F, 0x04, 0x16, 0x05,
+  0x0D, 0x04, 0x18, 0x05, 0x0B, 0x04, 0x1A, 0x05, 0x09, 0x04, 0x1D, 0x05,
+  0x05, 0x05, 0x20, 0x0A, 0x25, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x28, 0x06, 0x29, 0x05, 0x2A, 0x05, 0x2A, 0x05, 0x2C, 0x04, 0x61, 0x13,
+  0x1E, 0x12, 0x1C, 0x05, 0x06, 0x07, 0x1B, 0x05, 0x08, 0x06, 0x1A, 0x05,
+  0x09, 0x06, 0x19, 0x05, 0x09, 0x07, 0x18, 0x05, 0x0A, 0x06, 0x18, 0x05,
+  0x0A, 0x06, 0x18, 0x05, 0x0A, 0x06, 0x18, 0x05, 0x0A, 0x06, 0x18, 0x05,
+  0x0A, 0x05, 0x19, 0x05, 0x09, 0x06, 0x19, 0x05, 0x08, 0x06, 0x1A, 0x05,
+  0x07, 0x06, 0x1B, 0x05, 0x05, 0x06, 0x1D, 0x0D, 0x20, 0x0E, 0x1F, 0x05,
+  0x03, 0x06, 0x1F, 0x05, 0x04, 0x06, 0x1E, 0x05, 0x05, 0x06, 0x1D, 0x05,
+  0x05, 0x07, 0x1C, 0x05, 0x06, 0x06, 0x1C, 0x05, 0x07, 0x06, 0x1B, 0x05,
+  0x08, 0x06, 0x1A, 0x05, 0x08, 0x07, 0x19, 0x05, 0x09, 0x06, 0x19, 0x05,
+  0x0A, 0x06, 0x18, 0x05, 0x0B, 0x06, 0x17, 0x05, 0x0B, 0x07, 0x16, 0x05,
+  0x0C, 0x07, 0x14, 0x07, 0x0C, 0x08, 0x0E, 0x0F, 0x09, 0x09, 0x3F, 0x06,
+  0x06, 0x01, 0x1E, 0x0B, 0x02, 0x02, 0x1D, 0x04, 0x05, 0x07, 0x1C, 0x04,
+  0x08, 0x05, 0x1B, 0x04, 0x0A, 0x04, 0x1B, 0x03, 0x0C, 0x03, 0x1A, 0x04,
+  0x0D, 0x02, 0x1A, 0x04, 0x0D, 0x02, 0x1A, 0x04, 0x0E, 0x01, 0x1A, 0x05,
+  0x0D, 0x01, 0x1A, 0x06, 0x0C, 0x01, 0x1A, 0x07, 0x27, 0x08, 0x25, 0x09,
+  0x25, 0x0A, 0x24, 0x0B, 0x23, 0x0B, 0x24, 0x0B, 0x23, 0x0B, 0x24, 0x0A,
+  0x25, 0x09, 0x25, 0x08, 0x27, 0x07, 0x18, 0x01, 0x0E, 0x06, 0x18, 0x01,
+  0x0F, 0x05, 0x18, 0x02, 0x0F, 0x04, 0x18, 0x02, 0x0F, 0x04, 0x18, 0x02,
+  0x0F, 0x04, 0x18, 0x03, 0x0E, 0x03, 0x19, 0x04, 0x0C, 0x04, 0x19, 0x05,
+  0x0A, 0x04, 0x1A, 0x07, 0x07, 0x04, 0x1B, 0x01, 0x03, 0x0D, 0x1C, 0x01,
+  0x06, 0x07, 0x63, 0x1B, 0x12, 0x1B, 0x12, 0x04, 0x07, 0x05, 0x07, 0x04,
+  0x12, 0x02, 0x09, 0x05, 0x09, 0x02, 0x12, 0x02, 0x09, 0x05, 0x09, 0x02,
+  0x12, 0x01, 0x0A, 0x05, 0x0A, 0x01, 0x12, 0x01, 0x0A, 0x05, 0x0A, 0x01,
+  0x1D, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05,
+  0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05,
+  0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05,
+  0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x27, 0x07,
+  0x22, 0x0F, 0x5F, 0x0F, 0x08, 0x0C, 0x0E, 0x08, 0x0F, 0x05, 0x11, 0x07,
+  0x11, 0x03, 0x13, 0x05, 0x12, 0x02, 0x14, 0x05, 0x12, 0x02, 0x14, 0x05,
+  0x12, 0x02, 0x14, 0x05, 0x12, 0x02, 0x14, 0x05, 0x12, 0x02, 0x14, 0x05,
+  0x12, 0x02, 0x14, 0x05, 0x12, 0x02, 0x14, 0x05, 0x12, 0x02, 0x14, 0x05,
+  0x12, 0x02, 0x14, 0x05, 0x12, 0x02, 0x14, 0x05, 0x12, 0x02, 0x14, 0x05,
+  0x12, 0x02, 0x14, 0x05, 0x12, 0x02, 0x14, 0x05, 0x12, 0x02, 0x14, 0x05,
+  0x12, 0x02, 0x14, 0x05, 0x12, 0x02, 0x14, 0x05, 0x12, 0x02, 0x14, 0x05,
+  0x12, 0x02, 0x14, 0x05, 0x12, 0x02, 0x14, 0x05, 0x12, 0x02, 0x14, 0x05,
+  0x12, 0x02, 0x14, 0x05, 0x12, 0x02, 0x15, 0x05, 0x10, 0x02, 0x16, 0x05,
+  0x10, 0x02, 0x16, 0x05, 0x0F, 0x03, 0x17, 0x05, 0x0D, 0x03, 0x19, 0x05,
+  0x0B, 0x03, 0x1B, 0x06, 0x07, 0x04, 0x1D, 0x0F, 0x21, 0x09, 0x5F, 0x0D,
+  0x0C, 0x09, 0x0D, 0x09, 0x10, 0x06, 0x0F, 0x07, 0x12, 0x03, 0x12, 0x06,
+  0x12, 0x03, 0x13, 0x05, 0x12, 0x02, 0x14, 0x05, 0x12, 0x02, 0x14, 0x06,
+  0x10, 0x02, 0x16, 0x05, 0x10, 0x02, 0x16, 0x06, 0x0E, 0x03, 0x17, 0x05,
+  0x0E, 0x02, 0x18, 0x06, 0x0D, 0x02, 0x19, 0x05, 0x0C, 0x02, 0x1A, 0x06,
+  0x0B, 0x02, 0x1B, 0x05, 0x0A, 0x03, 0x1B, 0x06, 0x09, 0x02, 0x1D, 0x05,
+  0x09, 0x02, 0x1D, 0x05, 0x08, 0x02, 0x1E, 0x06, 0x07, 0x02, 0x1F, 0x05,
+  0x06, 0x02, 0x20, 0x06, 0x05, 0x02, 0x21, 0x05, 0x05, 0x02, 0x21, 0x06,
+  0x03, 0x02, 0x23, 0x05, 0x03, 0x02, 0x23, 0x06, 0x01, 0x02, 0x25, 0x05,
+  0x01, 0x02, 0x25, 0x08, 0x26, 0x06, 0x27, 0x06, 0x27, 0x05, 0x29, 0x04,
+  0x29, 0x04, 0x2A, 0x02, 0x2B, 0x02, 0x5A, 0x0C, 0x04, 0x0C, 0x07, 0x0A,
+  0x02, 0x08, 0x08, 0x08, 0x0C, 0x05, 0x05, 0x06, 0x0A, 0x06, 0x0E, 0x03,
+  0x07, 0x05, 0x0B, 0x05, 0x0E, 0x02, 0x08, 0x05, 0x0B, 0x05, 0x0E, 0x02,
+  0x08, 0x05, 0x0B, 0x06, 0x0C, 0x03, 0x09, 0x05, 0x0B, 0x05, 0x0C, 0x02,
+  0x0A, 0x05, 0x0B, 0x05, 0x0C, 0x02, 0x0A, 0x05, 0x0B, 0x06, 0x0A, 0x03,
+  0x0B, 0x05, 0x0B, 0x05, 0x0A, 0x02, 0x0C, 0x05, 0x0B, 0x05, 0x0A, 0x02,
+  0x0C, 0x05, 0x0B, 0x06, 0x08, 0x02, 0x0E, 0x05, 0x09, 0x07, 0x08, 0x02,
+  0x0E, 0x05, 0x09, 0x07, 0x08, 0x02, 0x0F, 0x04, 0x09, 0x08, 0x06, 0x02,
+  0x10, 0x05, 0x07, 0x03, 0x01, 0x05, 0x06, 0x02, 0x10, 0x05, 0x07, 0x02,
+  0x02, 0x05, 0x06, 0x02, 0x11, 0x05, 0x06, 0x02, 0x02, 0x06, 0x04, 0x02,
+  0x12, 0x05, 0x05, 0x03, 0x03, 0x05, 0x04, 0x02, 0x12, 0x05, 0x05, 0x02,
+  0x04, 0x05, 0x04, 0x02, 0x13, 0x05, 0x03, 0x03, 0x04, 0x06, 0x02, 0x02,
+  0x14, 0x05, 0x03, 0x02, 0x06, 0x05, 0x02, 0x02, 0x14, 0x05, 0x03, 0x02,
+  0x06, 0x05, 0x02, 0x02, 0x15, 0x05, 0x01, 0x02, 0x07, 0x08, 0x16, 0x05,
+  0x01, 0x02, 0x08, 0x07, 0x17, 0x04, 0x01, 0x02, 0x08, 0x07, 0x17, 0x06,
+  0x09, 0x06, 0x18, 0x06, 0x0A, 0x05, 0x19, 0x04, 0x0B, 0x05, 0x19, 0x04,
+  0x0B, 0x04, 0x1A, 0x04, 0x0C, 0x03, 0x1B, 0x02, 0x0D, 0x03, 0x1B, 0x02,
+  0x0D, 0x02, 0x60, 0x0F, 0x06, 0x0B, 0x0F, 0x0A, 0x0C, 0x06, 0x13, 0x07,
+  0x0E, 0x03, 0x16, 0x07, 0x0D, 0x02, 0x18, 0x06, 0x0C, 0x02, 0x1A, 0x06,
+  0x0A, 0x03, 0x1A, 0x06, 0x0A, 0x02, 0x1C, 0x06, 0x08, 0x02, 0x1E, 0x06,
+  0x06, 0x02, 0x1F, 0x06, 0x05, 0x02, 0x21, 0x06, 0x03, 0x03, 0x22, 0x06,
+  0x02, 0x02, 0x23, 0x06, 0x01, 0x02, 0x25, 0x07, 0x27, 0x05, 0x28, 0x06,
+  0x28, 0x06, 0x27, 0x06, 0x26, 0x08, 0x24, 0x02, 0x02, 0x06, 0x22, 0x03,
+  0x03, 0x05, 0x21, 0x03, 0x04, 0x06, 0x20, 0x02, 0x06, 0x06, 0x1E, 0x02,
+  0x08, 0x05, 0x1D, 0x02, 0x09, 0x06, 0x1B, 0x03, 0x0A, 0x06, 0x19, 0x03,
+  0x0C, 0x05, 0x19, 0x02, 0x0D, 0x06, 0x16, 0x03, 0x0F, 0x06, 0x14, 0x04,
+  0x0F, 0x07, 0x11, 0x07, 0x0D, 0x09, 0x0E, 0x0B, 0x09, 0x0E, 0x5F, 0x0E,
+  0x09, 0x0B, 0x0D, 0x09, 0x0F, 0x06, 0x11, 0x07, 0x0F, 0x05, 0x12, 0x07,
+  0x10, 0x03, 0x14, 0x06, 0x0F, 0x03, 0x16, 0x06, 0x0E, 0x02, 0x17, 0x06,
+  0x0D, 0x02, 0x19, 0x06, 0x0B, 0x03, 0x1A, 0x05, 0x0B, 0x02, 0x1B, 0x06,
+  0x09, 0x02, 0x1D, 0x06, 0x07, 0x03, 0x1E, 0x05, 0x07, 0x02, 0x1F, 0x06,
+  0x05, 0x02, 0x21, 0x06, 0x03, 0x03, 0x22, 0x05, 0x03, 0x02, 0x23, 0x06,
+  0x01, 0x02, 0x25, 0x08, 0x26, 0x06, 0x27, 0x06, 0x28, 0x05, 0x28, 0x05,
+  0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05,
+  0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x27, 0x07, 0x22, 0x0F, 0x66, 0x17,
+  0x16, 0x16, 0x17, 0x03, 0x0D, 0x06, 0x17, 0x02, 0x0D, 0x06, 0x17, 0x02,
+  0x0E, 0x05, 0x18, 0x02, 0x0D, 0x06, 0x18, 0x01, 0x0D, 0x06, 0x19, 0x01,
+  0x0C, 0x06, 0x27, 0x06, 0x26, 0x06, 0x26, 0x06, 0x27, 0x06, 0x26, 0x06,
+  0x26, 0x06, 0x27, 0x05, 0x27, 0x06, 0x26, 0x06, 0x26, 0x06, 0x27, 0x06,
+  0x26, 0x06, 0x26, 0x06, 0x27, 0x06, 0x26, 0x06, 0x26, 0x06, 0x0F, 0x01,
+  0x17, 0x05, 0x10, 0x01, 0x16, 0x06, 0x0F, 0x02, 0x15, 0x06, 0x10, 0x01,
+  0x16, 0x05, 0x10, 0x02, 0x15, 0x06, 0x10, 0x02, 0x14, 0x06, 0x0F, 0x04,
+  0x13, 0x1A, 0x13, 0x1A, 0x3F, 0x0A, 0x23, 0x0A, 0x23, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x0A, 0x23, 0x0A, 0x10, 0x02, 0x2B, 0x03, 0x2B, 0x02,
+  0x2B, 0x02, 0x2B, 0x02, 0x2C, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2C, 0x02,
+  0x2B, 0x02, 0x2B, 0x02, 0x2C, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2C, 0x02,
+  0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x03, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02,
+  0x2C, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2C, 0x02, 0x2B, 0x02, 0x2B, 0x02,
+  0x2C, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2C, 0x02, 0x2B, 0x02, 0x2B, 0x02,
+  0x2C, 0x02, 0x2B, 0x02, 0x3D, 0x0A, 0x23, 0x0A, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x23, 0x0A, 0x23, 0x0A, 0x70, 0x02, 0x2A, 0x04, 0x29, 0x04,
+  0x28, 0x02, 0x02, 0x02, 0x26, 0x02, 0x04, 0x02, 0x25, 0x02, 0x04, 0x02,
+  0x24, 0x02, 0x06, 0x02, 0x23, 0x02, 0x06, 0x02, 0x22, 0x02, 0x08, 0x02,
+  0x20, 0x02, 0x0A, 0x02, 0x1F, 0x02, 0x0A, 0x02, 0x1E, 0x02, 0x0C, 0x02,
+  0x1D, 0x02, 0x0C, 0x02, 0x1C, 0x02, 0x0E, 0x02, 0x1A, 0x03, 0x0E, 0x03,
+  0x19, 0x02, 0x10, 0x02, 0x18, 0x02, 0x12, 0x02, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x74, 0x19,
+  0x14, 0x19, 0x3D, 0x04, 0x2A, 0x04, 0x2A, 0x03, 0x2B, 0x02, 0x2C, 0x02,
+  0x2B, 0x02, 0x2C, 0x01, 0x2D, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0x31, 0x07,
+  0x24, 0x0B, 0x21, 0x04, 0x04, 0x05, 0x20, 0x03, 0x06, 0x05, 0x1E, 0x04,
+  0x07, 0x04, 0x1E, 0x04, 0x07, 0x04, 0x1E, 0x04, 0x07, 0x04, 0x1F, 0x02,
+  0x08, 0x04, 0x28, 0x05, 0x25, 0x08, 0x23, 0x05, 0x01, 0x04, 0x21, 0x04,
+  0x04, 0x04, 0x20, 0x03, 0x06, 0x04, 0x1F, 0x03, 0x07, 0x04, 0x1E, 0x03,
+  0x08, 0x04, 0x1D, 0x04, 0x08, 0x04, 0x1D, 0x04, 0x08, 0x04, 0x1D, 0x04,
+  0x08, 0x04, 0x1D, 0x05, 0x06, 0x05, 0x03, 0x01, 0x19, 0x06, 0x03, 0x07,
+  0x02, 0x02, 0x1A, 0x09, 0x02, 0x07, 0x1C, 0x07, 0x03, 0x06, 0x1E, 0x05,
+  0x05, 0x04, 0x10, 0x02, 0x28, 0x05, 0x26, 0x07, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x04, 0x05, 0x20, 0x04, 0x03, 0x08, 0x1E, 0x04,
+  0x01, 0x0B, 0x1D, 0x07, 0x04, 0x06, 0x1C, 0x05, 0x07, 0x06, 0x1B, 0x04,
+  0x09, 0x05, 0x1B, 0x04, 0x0A, 0x04, 0x1B, 0x04, 0x0A, 0x05, 0x1A, 0x04,
+  0x0B, 0x04, 0x1A, 0x04, 0x0B, 0x04, 0x1A, 0x04, 0x0B, 0x04, 0x1A, 0x04,
+  0x0B, 0x04, 0x1A, 0x04, 0x0B, 0x04, 0x1A, 0x04, 0x0B, 0x04, 0x1A, 0x04,
+  0x0B, 0x04, 0x1A, 0x04, 0x0B, 0x03, 0x1B, 0x04, 0x0A, 0x04, 0x1B, 0x04,
+  0x0A, 0x03, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x05, 0x07, 0x04, 0x1E, 0x06,
+  0x04, 0x04, 0x20, 0x0B, 0x25, 0x06, 0xFF, 0x00, 0xFF, 0x00, 0x33, 0x06,
+  0x25, 0x0A, 0x22, 0x03, 0x04, 0x05, 0x20, 0x03, 0x06, 0x05, 0x1E, 0x03,
+  0x07, 0x05, 0x1D, 0x04, 0x08, 0x04, 0x1D, 0x03, 0x0A, 0x02, 0x1E, 0x03,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x05,
+  0x28, 0x05, 0x0C, 0x01, 0x1B, 0x05, 0x0B, 0x02, 0x1C, 0x05, 0x0A, 0x01,
+  0x1D, 0x06, 0x08, 0x02, 0x1E, 0x06, 0x06, 0x03, 0x1E, 0x0E, 0x20, 0x0C,
+  0x22, 0x0A, 0x25, 0x06, 0x1E, 0x02, 0x28, 0x05, 0x26, 0x07, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x21, 0x06, 0x02, 0x04, 0x1F, 0x09, 0x01, 0x04,
+  0x1E, 0x04, 0x04, 0x07, 0x1D, 0x03, 0x07, 0x06, 0x1C, 0x04, 0x08, 0x05,
+  0x1C, 0x03, 0x0A, 0x04, 0x1B, 0x04, 0x0A, 0x04, 0x1B, 0x03, 0x0B, 0x04,
+  0x1B, 0x03, 0x0B, 0x04, 0x1A, 0x04, 0x0B, 0x04, 0x1A, 0x04, 0x0B, 0x04,
+  0x1A, 0x04, 0x0B, 0x04, 0x1A, 0x04, 0x0B, 0x04, 0x1A, 0x04, 0x0B, 0x04,
+  0x1A, 0x04, 0x0B, 0x04, 0x1A, 0x05, 0x0A, 0x04, 0x1B, 0x04, 0x0A, 0x04,
+  0x1B, 0x05, 0x09, 0x04, 0x1C, 0x05, 0x07, 0x05, 0x1C, 0x07, 0x04, 0x06,
+  0x1D, 0x0B, 0x01, 0x07, 0x1B, 0x09, 0x02, 0x06, 0x1E, 0x05, 0x04, 0x03,
+  0xFF, 0x00, 0xFF, 0x00, 0x33, 0x06, 0x25, 0x09, 0x22, 0x03, 0x04, 0x06,
+  0x1F, 0x03, 0x07, 0x04, 0x1F, 0x02, 0x08, 0x05, 0x1D, 0x03, 0x09, 0x04,
+  0x1D, 0x02, 0x0A, 0x05, 0x1C, 0x02, 0x0A, 0x05, 0x1B, 0x12, 0x1B, 0x12,
+  0x1B, 0x03, 0x2A, 0x03, 0x2A, 0x03, 0x2A, 0x03, 0x2A, 0x04, 0x0D, 0x01,
+  0x1B, 0x04, 0x0C, 0x02, 0x1C, 0x04, 0x0B, 0x02, 0x1C, 0x05, 0x09, 0x02,
+  0x1E, 0x06, 0x06, 0x03, 0x1E, 0x0E, 0x20, 0x0C, 0x22, 0x0A, 0x25, 0x06,
+  0x1A, 0x06, 0x25, 0x09, 0x23, 0x03, 0x03, 0x05, 0x21, 0x03, 0x05, 0x05,
+  0x20, 0x02, 0x06, 0x05, 0x1F, 0x03, 0x07, 0x04, 0x1F, 0x03, 0x08, 0x02,
+  0x1F, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x25, 0x0E, 0x1F, 0x0E, 0x23, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x28, 0x06, 0x24, 0x0D, 0xFF, 0x00, 0xFF, 0x00, 0x31, 0x06,
+  0x25, 0x03, 0x04, 0x03, 0x22, 0x03, 0x06, 0x09, 0x1A, 0x04, 0x07, 0x08,
+  0x1A, 0x03, 0x08, 0x04, 0x1D, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04,
+  0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04,
+  0x1D, 0x04, 0x08, 0x04, 0x1D, 0x04, 0x08, 0x03, 0x1F, 0x04, 0x06, 0x03,
+  0x21, 0x04, 0x04, 0x03, 0x23, 0x08, 0x23, 0x02, 0x2A, 0x02, 0x2B, 0x02,
+  0x2A, 0x04, 0x29, 0x11, 0x1D, 0x12, 0x1C, 0x11, 0x1C, 0x01, 0x0D, 0x04,
+  0x1A, 0x01, 0x10, 0x02, 0x19, 0x01, 0x11, 0x02, 0x18, 0x02, 0x11, 0x02,
+  0x17, 0x03, 0x10, 0x02, 0x18, 0x04, 0x0E, 0x03, 0x18, 0x07, 0x09, 0x04,
+  0x1A, 0x11, 0x1E, 0x0E, 0x21, 0x09, 0x0F, 0x03, 0x27, 0x06, 0x26, 0x07,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x05, 0x05, 0x1F, 0x04,
+  0x03, 0x08, 0x1E, 0x04, 0x02, 0x0A, 0x1D, 0x04, 0x01, 0x02, 0x04, 0x05,
+  0x1D, 0x06, 0x06, 0x05, 0x1C, 0x05, 0x08, 0x04, 0x1C, 0x04, 0x09, 0x04,
+  0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04,
+  0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04,
+  0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04,
+  0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04,
+  0x1C, 0x04, 0x09, 0x04, 0x1B, 0x06, 0x07, 0x06, 0x18, 0x0A, 0x03, 0x0A,
+  0x16, 0x02, 0x2A, 0x04, 0x29, 0x04, 0x2A, 0x02, 0xFF, 0x00, 0x95, 0x02,
+  0x28, 0x05, 0x26, 0x07, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x28, 0x06, 0x25, 0x0A, 0x16, 0x02, 0x2A, 0x04, 0x29, 0x04,
+  0x2A, 0x02, 0xFF, 0x00, 0x95, 0x02, 0x28, 0x05, 0x26, 0x07, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x03, 0x2A, 0x03,
+  0x23, 0x03, 0x04, 0x02, 0x23, 0x05, 0x02, 0x03, 0x23, 0x09, 0x25, 0x06,
+  0x10, 0x03, 0x27, 0x06, 0x26, 0x07, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x06, 0x08, 0x1B, 0x04, 0x07, 0x04, 0x1E, 0x04,
+  0x07, 0x03, 0x1F, 0x04, 0x07, 0x02, 0x20, 0x04, 0x05, 0x03, 0x21, 0x04,
+  0x04, 0x03, 0x22, 0x04, 0x03, 0x02, 0x24, 0x04, 0x02, 0x02, 0x25, 0x04,
+  0x01, 0x03, 0x25, 0x09, 0x24, 0x04, 0x01, 0x05, 0x23, 0x04, 0x02, 0x04,
+  0x23, 0x04, 0x02, 0x05, 0x22, 0x04, 0x03, 0x05, 0x21, 0x04, 0x04, 0x05,
+  0x20, 0x04, 0x05, 0x05, 0x1F, 0x04, 0x06, 0x04, 0x1F, 0x04, 0x06, 0x05,
+  0x1E, 0x04, 0x07, 0x05, 0x1C, 0x06, 0x06, 0x06, 0x19, 0x0A, 0x03, 0x09,
+  0x17, 0x02, 0x28, 0x05, 0x26, 0x07, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x28, 0x06, 0x25, 0x0A, 0xFF, 0x00, 0xFF, 0x00,
+  0x28, 0x02, 0x05, 0x05, 0x08, 0x05, 0x11, 0x05, 0x03, 0x08, 0x05, 0x08,
+  0x0E, 0x07, 0x02, 0x0A, 0x03, 0x0A, 0x10, 0x04, 0x01, 0x02, 0x04, 0x06,
+  0x01, 0x02, 0x04, 0x05, 0x10, 0x06, 0x06, 0x07, 0x06, 0x05, 0x0F, 0x04,
+  0x09, 0x04, 0x09, 0x04, 0x0F, 0x04, 0x09, 0x04, 0x09, 0x04, 0x0F, 0x04,
+  0x09, 0x04, 0x09, 0x04, 0x0F, 0x04, 0x09, 0x04, 0x09, 0x04, 0x0F, 0x04,
+  0x09, 0x04, 0x09, 0x04, 0x0F, 0x04, 0x09, 0x04, 0x09, 0x04, 0x0F, 0x04,
+  0x09, 0x04, 0x09, 0x04, 0x0F, 0x04, 0x09, 0x04, 0x09, 0x04, 0x0F, 0x04,
+  0x09, 0x04, 0x09, 0x04, 0x0F, 0x04, 0x09, 0x04, 0x09, 0x04, 0x0F, 0x04,
+  0x09, 0x04, 0x09, 0x04, 0x0F, 0x04, 0x09, 0x04, 0x09, 0x04, 0x0F, 0x04,
+  0x09, 0x04, 0x09, 0x04, 0x0F, 0x04, 0x09, 0x04, 0x09, 0x04, 0x0F, 0x04,
+  0x09, 0x04, 0x09, 0x04, 0x0E, 0x06, 0x07, 0x06, 0x07, 0x06, 0x0B, 0x0A,
+  0x03, 0x0A, 0x03, 0x0A, 0xFF, 0x00, 0xFF, 0x00, 0x2E, 0x02, 0x05, 0x05,
+  0x1E, 0x05, 0x03, 0x08, 0x1B, 0x07, 0x02, 0x0A, 0x1D, 0x04, 0x01, 0x02,
+  0x05, 0x04, 0x1D, 0x06, 0x06, 0x05, 0x1C, 0x05, 0x08, 0x04, 0x1C, 0x04,
+  0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04,
+  0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04,
+  0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04,
+  0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04,
+  0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1B, 0x06, 0x07, 0x06, 0x18, 0x0A,
+  0x03, 0x0A, 0xFF, 0x00, 0xFF, 0x00, 0x31, 0x07, 0x24, 0x0B, 0x21, 0x04,
+  0x04, 0x05, 0x1F, 0x03, 0x08, 0x04, 0x1D, 0x04, 0x08, 0x05, 0x1C, 0x03,
+  0x0A, 0x05, 0x1A, 0x04, 0x0A, 0x05, 0x1A, 0x04, 0x0B, 0x04, 0x19, 0x04,
+  0x0C, 0x05, 0x18, 0x04, 0x0C, 0x05, 0x18, 0x04, 0x0C, 0x05, 0x18, 0x04,
+  0x0D, 0x04, 0x18, 0x05, 0x0C, 0x04, 0x18, 0x05, 0x0C, 0x04, 0x18, 0x05,
+  0x0C, 0x04, 0x19, 0x04, 0x0B, 0x04, 0x1A, 0x05, 0x0A, 0x04, 0x1A, 0x05,
+  0x0A, 0x03, 0x1C, 0x05, 0x09, 0x03, 0x1D, 0x05, 0x07, 0x03, 0x1F, 0x05,
+  0x04, 0x04, 0x21, 0x0B, 0x24, 0x07, 0xFF, 0x00, 0xFF, 0x00, 0x2E, 0x02,
+  0x04, 0x06, 0x1E, 0x05, 0x03, 0x08, 0x1B, 0x07, 0x02, 0x0A, 0x1D, 0x04,
+  0x01, 0x02, 0x04, 0x06, 0x1C, 0x06, 0x07, 0x05, 0x1B, 0x05, 0x08, 0x05,
+  0x1B, 0x04, 0x0A, 0x04, 0x1B, 0x04, 0x0A, 0x05, 0x1A, 0x04, 0x0B, 0x04,
+  0x1A, 0x04, 0x0B, 0x04, 0x1A, 0x04, 0x0B, 0x04, 0x1A, 0x04, 0x0B, 0x04,
+  0x1A, 0x04, 0x0B, 0x04, 0x1A, 0x04, 0x0B, 0x04, 0x1A, 0x04, 0x0B, 0x04,
+  0x1A, 0x04, 0x0B, 0x03, 0x1B, 0x04, 0x0A, 0x04, 0x1B, 0x04, 0x0A, 0x03,
+  0x1C, 0x05, 0x09, 0x03, 0x1C, 0x05, 0x08, 0x03, 0x1D, 0x07, 0x04, 0x04,
+  0x1E, 0x04, 0x01, 0x09, 0x1F, 0x04, 0x02, 0x06, 0x21, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x28, 0x06,
+  0x25, 0x0A, 0xFF, 0x00, 0xFF, 0x00, 0x33, 0x05, 0x04, 0x02, 0x1F, 0x0A,
+  0x01, 0x03, 0x1E, 0x04, 0x05, 0x06, 0x1D, 0x04, 0x07, 0x05, 0x1C, 0x04,
+  0x09, 0x04, 0x1C, 0x03, 0x0A, 0x04, 0x1B, 0x04, 0x0A, 0x04, 0x1B, 0x03,
+  0x0B, 0x04, 0x1A, 0x04, 0x0B, 0x04, 0x1A, 0x04, 0x0B, 0x04, 0x1A, 0x04,
+  0x0B, 0x04, 0x1A, 0x04, 0x0B, 0x04, 0x1A, 0x04, 0x0B, 0x04, 0x1A, 0x04,
+  0x0B, 0x04, 0x1A, 0x04, 0x0B, 0x04, 0x1A, 0x05, 0x0A, 0x04, 0x1B, 0x04,
+  0x0A, 0x04, 0x1B, 0x05, 0x09, 0x04, 0x1B, 0x06, 0x07, 0x05, 0x1C, 0x06,
+  0x05, 0x01, 0x01, 0x04, 0x1D, 0x0A, 0x02, 0x04, 0x1E, 0x08, 0x03, 0x04,
+  0x20, 0x05, 0x04, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x28, 0x06, 0x25, 0x0A, 0xFF, 0x00,
+  0xFF, 0x00, 0x32, 0x02, 0x03, 0x04, 0x21, 0x05, 0x02, 0x06, 0x1E, 0x07,
+  0x01, 0x07, 0x21, 0x06, 0x02, 0x03, 0x22, 0x05, 0x28, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x28, 0x06, 0x25, 0x0A, 0xFF, 0x00, 0xFF, 0x00, 0x31, 0x06,
+  0x03, 0x01, 0x21, 0x0C, 0x20, 0x04, 0x05, 0x04, 0x20, 0x02, 0x08, 0x03,
+  0x1F, 0x03, 0x09, 0x02, 0x1F, 0x03, 0x09, 0x02, 0x1F, 0x03, 0x0A, 0x01,
+  0x1F, 0x04, 0x29, 0x06, 0x28, 0x07, 0x27, 0x09, 0x26, 0x08, 0x26, 0x08,
+  0x28, 0x06, 0x28, 0x06, 0x29, 0x04, 0x1E, 0x01, 0x0B, 0x03, 0x1E, 0x02,
+  0x0A, 0x03, 0x1E, 0x02, 0x0A, 0x03, 0x1E, 0x03, 0x08, 0x03, 0x1F, 0x05,
+  0x05, 0x04, 0x1F, 0x0C, 0x21, 0x01, 0x03, 0x07, 0xFF, 0x00, 0x26, 0x01,
+  0x2B, 0x02, 0x2B, 0x02, 0x2A, 0x03, 0x2A, 0x03, 0x29, 0x04, 0x28, 0x05,
+  0x26, 0x0C, 0x20, 0x0D, 0x24, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x04, 0x01, 0x24, 0x05, 0x02, 0x01, 0x25, 0x08, 0x26, 0x06, 0x28, 0x04,
+  0xFF, 0x00, 0xFF, 0x00, 0x57, 0x07, 0x06, 0x07, 0x1B, 0x05, 0x08, 0x05,
+  0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04,
+  0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04,
+  0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04,
+  0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04,
+  0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x08, 0x05,
+  0x1C, 0x05, 0x06, 0x06, 0x1D, 0x05, 0x04, 0x02, 0x01, 0x04, 0x1D, 0x0A,
+  0x02, 0x07, 0x1B, 0x08, 0x03, 0x05, 0x1E, 0x05, 0x05, 0x02, 0xFF, 0x00,
+  0xFF, 0x00, 0x56, 0x0A, 0x07, 0x07, 0x17, 0x06, 0x0B, 0x03, 0x1A, 0x04,
+  0x0D, 0x02, 0x1A, 0x05, 0x0B, 0x02, 0x1C, 0x04, 0x0B, 0x02, 0x1C, 0x04,
+  0x0A, 0x02, 0x1E, 0x04, 0x09, 0x02, 0x1E, 0x04, 0x08, 0x02, 0x20, 0x04,
+  0x07, 0x02, 0x20, 0x04, 0x07, 0x01, 0x22, 0x04, 0x05, 0x02, 0x22, 0x04,
+  0x05, 0x02, 0x23, 0x04, 0x03, 0x02, 0x24, 0x04, 0x03, 0x02, 0x24, 0x05,
+  0x01, 0x02, 0x26, 0x04, 0x01, 0x02, 0x26, 0x06, 0x28, 0x05, 0x28, 0x04,
+  0x2A, 0x03, 0x2A, 0x03, 0x2B, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0x51, 0x09,
+  0x04, 0x09, 0x06, 0x07, 0x0B, 0x06, 0x08, 0x05, 0x0B, 0x03, 0x0D, 0x05,
+  0x09, 0x04, 0x0B, 0x02, 0x0F, 0x04, 0x09, 0x04, 0x0A, 0x02, 0x10, 0x04,
+  0x0A, 0x03, 0x0A, 0x02, 0x11, 0x04, 0x09, 0x04, 0x08, 0x02, 0x12, 0x04,
+  0x09, 0x04, 0x08, 0x02, 0x12, 0x04, 0x08, 0x06, 0x07, 0x02, 0x13, 0x04,
+  0x07, 0x06, 0x06, 0x02, 0x14, 0x04, 0x06, 0x02, 0x02, 0x04, 0x05, 0x02,
+  0x14, 0x05, 0x05, 0x02, 0x02, 0x04, 0x05, 0x02, 0x15, 0x04, 0x04, 0x02,
+  0x04, 0x04, 0x03, 0x02, 0x16, 0x04, 0x04, 0x02, 0x04, 0x04, 0x03, 0x02,
+  0x17, 0x04, 0x02, 0x02, 0x05, 0x05, 0x01, 0x02, 0x18, 0x04, 0x02, 0x02,
+  0x06, 0x04, 0x01, 0x02, 0x18, 0x04, 0x01, 0x02, 0x07, 0x04, 0x01, 0x02,
+  0x19, 0x06, 0x08, 0x05, 0x1A, 0x05, 0x09, 0x05, 0x1A, 0x05, 0x0A, 0x04,
+  0x1B, 0x03, 0x0B, 0x03, 0x1C, 0x03, 0x0B, 0x03, 0x1D, 0x01, 0x0D, 0x01,
+  0xFF, 0x00, 0xFF, 0x00, 0x56, 0x0A, 0x04, 0x09, 0x18, 0x06, 0x08, 0x05,
+  0x1B, 0x05, 0x08, 0x03, 0x1E, 0x05, 0x06, 0x03, 0x20, 0x05, 0x05, 0x02,
+  0x22, 0x05, 0x03, 0x02, 0x23, 0x05, 0x02, 0x02, 0x25, 0x07, 0x27, 0x05,
+  0x29, 0x05, 0x29, 0x05, 0x27, 0x06, 0x26, 0x02, 0x01, 0x05, 0x24, 0x02,
+  0x03, 0x05, 0x22, 0x02, 0x05, 0x05, 0x20, 0x03, 0x06, 0x05, 0x1F, 0x02,
+  0x07, 0x05, 0x1E, 0x02, 0x09, 0x05, 0x1C, 0x02, 0x0B, 0x05, 0x1A, 0x03,
+  0x0B, 0x06, 0x18, 0x06, 0x06, 0x0B, 0xFF, 0x00, 0xFF, 0x00, 0x56, 0x0A,
+  0x06, 0x07, 0x17, 0x07, 0x0A, 0x04, 0x19, 0x05, 0x0B, 0x03, 0x1B, 0x04,
+  0x0B, 0x02, 0x1C, 0x05, 0x0A, 0x02, 0x1D, 0x04, 0x09, 0x02, 0x1E, 0x05,
+  0x08, 0x02, 0x1F, 0x04, 0x08, 0x02, 0x1F, 0x05, 0x06, 0x02, 0x21, 0x04,
+  0x06, 0x02, 0x21, 0x05, 0x04, 0x02, 0x23, 0x04, 0x04, 0x02, 0x23, 0x05,
+  0x03, 0x02, 0x24, 0x04, 0x02, 0x02, 0x25, 0x05, 0x01, 0x02, 0x26, 0x06,
+  0x27, 0x06, 0x28, 0x05, 0x28, 0x04, 0x2A, 0x03, 0x2A, 0x02, 0x2B, 0x02,
+  0x2B, 0x02, 0x2A, 0x02, 0x2B, 0x02, 0x2A, 0x02, 0x2B, 0x02, 0x24, 0x03,
+  0x03, 0x02, 0x24, 0x08, 0x25, 0x07, 0x27, 0x04, 0xFF, 0x00, 0xFF, 0x00,
+  0x5A, 0x12, 0x1B, 0x12, 0x1B, 0x02, 0x0A, 0x05, 0x1C, 0x01, 0x0A, 0x05,
+  0x1D, 0x01, 0x09, 0x05, 0x28, 0x04, 0x28, 0x05, 0x27, 0x05, 0x27, 0x05,
+  0x27, 0x05, 0x28, 0x04, 0x28, 0x05, 0x27, 0x05, 0x27, 0x05, 0x27, 0x05,
+  0x0A, 0x01, 0x1D, 0x04, 0x0B, 0x01, 0x1C, 0x05, 0x0B, 0x01, 0x1B, 0x05,
+  0x0B, 0x02, 0x1A, 0x05, 0x0B, 0x03, 0x19, 0x14, 0x19, 0x14, 0x1C, 0x02,
+  0x29, 0x03, 0x28, 0x03, 0x29, 0x03, 0x2A, 0x02, 0x2A, 0x03, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x05, 0x28, 0x05, 0x28, 0x05,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x03, 0x2A, 0x03,
+  0x29, 0x03, 0x29, 0x03, 0x29, 0x02, 0x29, 0x02, 0x2D, 0x02, 0x2C, 0x03,
+  0x2B, 0x03, 0x2B, 0x03, 0x2A, 0x03, 0x2A, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x2A, 0x03, 0x2B, 0x02, 0x2B, 0x03, 0x2B, 0x03,
+  0x2C, 0x03, 0x2C, 0x02, 0x16, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02,
+  0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02,
+  0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02,
+  0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02,
+  0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02,
+  0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02,
+  0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02,
+  0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x0F, 0x02, 0x2C, 0x03,
+  0x2C, 0x03, 0x2B, 0x03, 0x2B, 0x02, 0x2B, 0x03, 0x2A, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x28, 0x05, 0x28, 0x05, 0x28, 0x05, 0x28, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x2A, 0x03, 0x2A, 0x03, 0x2B, 0x03,
+  0x2B, 0x03, 0x2C, 0x02, 0x2D, 0x02, 0x29, 0x02, 0x29, 0x03, 0x29, 0x03,
+  0x29, 0x03, 0x2A, 0x03, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x05, 0x28, 0x05, 0x28, 0x05, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x03, 0x2A, 0x02, 0x2A, 0x03, 0x29, 0x03, 0x28, 0x03,
+  0x29, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x3B, 0x05, 0x0F, 0x01,
+  0x17, 0x09, 0x0C, 0x01, 0x16, 0x02, 0x05, 0x06, 0x08, 0x02, 0x15, 0x02,
+  0x08, 0x06, 0x05, 0x02, 0x16, 0x01, 0x0C, 0x09, 0x17, 0x01, 0x0F, 0x05,
+  0x41, 0x04, 0x28, 0x02, 0x02, 0x03, 0x25, 0x02, 0x04, 0x03, 0x23, 0x03,
+  0x04, 0x03, 0x23, 0x02, 0x06, 0x03, 0x22, 0x02, 0x06, 0x03, 0x22, 0x03,
+  0x05, 0x03, 0x22, 0x03, 0x05, 0x03, 0x22, 0x03, 0x05, 0x02, 0x24, 0x03,
+  0x04, 0x02, 0x25, 0x03, 0x01, 0x03, 0x27, 0x04, 0xFF, 0x00, 0xFF, 0x00,
+  0x57, 0x07, 0x06, 0x07, 0x1B, 0x05, 0x08, 0x05, 0x1C, 0x04, 0x09, 0x04,
+  0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04,
+  0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04,
+  0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04,
+  0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04,
+  0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x08, 0x05, 0x1C, 0x05, 0x06, 0x06,
+  0x1D, 0x05, 0x04, 0x02, 0x01, 0x04, 0x1D, 0x0A, 0x02, 0x07, 0x1B, 0x08,
+  0x03, 0x05, 0x1E, 0x05, 0x05, 0x02, 0x1E, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x9C, 0x04, 0x2A, 0x04, 0x2A, 0x03, 0x2B, 0x02, 0x2C, 0x02, 0x2B, 0x02,
+  0x2C, 0x01, 0x2D, 0x01, 0x51, 0x07, 0x24, 0x0B, 0x21, 0x04, 0x04, 0x05,
+  0x20, 0x03, 0x06, 0x05, 0x1E, 0x04, 0x07, 0x04, 0x1E, 0x04, 0x07, 0x04,
+  0x1E, 0x04, 0x07, 0x04, 0x1F, 0x02, 0x08, 0x04, 0x28, 0x05, 0x25, 0x08,
+  0x23, 0x05, 0x01, 0x04, 0x21, 0x04, 0x04, 0x04, 0x20, 0x03, 0x06, 0x04,
+  0x1F, 0x03, 0x07, 0x04, 0x1E, 0x03, 0x08, 0x04, 0x1D, 0x04, 0x08, 0x04,
+  0x1D, 0x04, 0x08, 0x04, 0x1D, 0x04, 0x08, 0x04, 0x1D, 0x05, 0x06, 0x05,
+  0x03, 0x01, 0x19, 0x06, 0x03, 0x07, 0x02, 0x02, 0x1A, 0x09, 0x02, 0x07,
+  0x1C, 0x07, 0x03, 0x06, 0x1E, 0x05, 0x05, 0x04, 0x44, 0x02, 0x2A, 0x04,
+  0x28, 0x02, 0x02, 0x02, 0x26, 0x02, 0x04, 0x02, 0x24, 0x02, 0x06, 0x02,
+  0x22, 0x02, 0x08, 0x02, 0x20, 0x02, 0x0A, 0x02, 0x1E, 0x02, 0x0C, 0x02,
+  0x1C, 0x02, 0x0E, 0x02, 0x1A, 0x02, 0x10, 0x02, 0x4B, 0x07, 0x24, 0x0B,
+  0x21, 0x04, 0x04, 0x05, 0x20, 0x03, 0x06, 0x05, 0x1E, 0x04, 0x07, 0x04,
+  0x1E, 0x04, 0x07, 0x04, 0x1E, 0x04, 0x07, 0x04, 0x1F, 0x02, 0x08, 0x04,
+  0x28, 0x05, 0x25, 0x08, 0x23, 0x05, 0x01, 0x04, 0x21, 0x04, 0x04, 0x04,
+  0x20, 0x03, 0x06, 0x04, 0x1F, 0x03, 0x07, 0x04, 0x1E, 0x03, 0x08, 0x04,
+  0x1D, 0x04, 0x08, 0x04, 0x1D, 0x04, 0x08, 0x04, 0x1D, 0x04, 0x08, 0x04,
+  0x1D, 0x05, 0x06, 0x05, 0x03, 0x01, 0x19, 0x06, 0x03, 0x07, 0x02, 0x02,
+  0x1A, 0x09, 0x02, 0x07, 0x1C, 0x07, 0x03, 0x06, 0x1E, 0x05, 0x05, 0x04,
+  0xFF, 0x00, 0x4F, 0x02, 0x06, 0x02, 0x22, 0x04, 0x04, 0x04, 0x21, 0x04,
+  0x04, 0x04, 0x22, 0x02, 0x06, 0x02, 0x50, 0x07, 0x24, 0x0B, 0x21, 0x04,
+  0x04, 0x05, 0x20, 0x03, 0x06, 0x05, 0x1E, 0x04, 0x07, 0x04, 0x1E, 0x04,
+  0x07, 0x04, 0x1E, 0x04, 0x07, 0x04, 0x1F, 0x02, 0x08, 0x04, 0x28, 0x05,
+  0x25, 0x08, 0x23, 0x05, 0x01, 0x04, 0x21, 0x04, 0x04, 0x04, 0x20, 0x03,
+  0x06, 0x04, 0x1F, 0x03, 0x07, 0x04, 0x1E, 0x03, 0x08, 0x04, 0x1D, 0x04,
+  0x08, 0x04, 0x1D, 0x04, 0x08, 0x04, 0x1D, 0x04, 0x08, 0x04, 0x1D, 0x05,
+  0x06, 0x05, 0x03, 0x01, 0x19, 0x06, 0x03, 0x07, 0x02, 0x02, 0x1A, 0x09,
+  0x02, 0x07, 0x1C, 0x07, 0x03, 0x06, 0x1E, 0x05, 0x05, 0x04, 0xFF, 0x00,
+  0xFF, 0x00, 0x33, 0x06, 0x25, 0x0A, 0x22, 0x03, 0x04, 0x05, 0x20, 0x03,
+  0x06, 0x05, 0x1E, 0x03, 0x07, 0x05, 0x1D, 0x04, 0x08, 0x04, 0x1D, 0x03,
+  0x0A, 0x02, 0x1E, 0x03, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x05, 0x28, 0x05, 0x0C, 0x01, 0x1B, 0x05, 0x0B, 0x02,
+  0x1C, 0x05, 0x0A, 0x01, 0x1D, 0x06, 0x08, 0x02, 0x1E, 0x06, 0x06, 0x03,
+  0x1E, 0x0E, 0x20, 0x0C, 0x22, 0x0A, 0x25, 0x06, 0x28, 0x04, 0x28, 0x06,
+  0x27, 0x07, 0x27, 0x03, 0x01, 0x02, 0x2B, 0x02, 0x2B, 0x02, 0x2A, 0x02,
+  0x2B, 0x02, 0x2A, 0x02, 0x29, 0x03, 0x29, 0x02, 0x9B, 0x04, 0x2A, 0x04,
+  0x2A, 0x03, 0x2B, 0x02, 0x2C, 0x02, 0x2B, 0x02, 0x2C, 0x01, 0x2D, 0x01,
+  0x54, 0x06, 0x25, 0x09, 0x22, 0x03, 0x04, 0x06, 0x1F, 0x03, 0x07, 0x04,
+  0x1F, 0x02, 0x08, 0x05, 0x1D, 0x03, 0x09, 0x04, 0x1D, 0x02, 0x0A, 0x05,
+  0x1C, 0x02, 0x0A, 0x05, 0x1B, 0x12, 0x1B, 0x12, 0x1B, 0x03, 0x2A, 0x03,
+  0x2A, 0x03, 0x2A, 0x03, 0x2A, 0x04, 0x0D, 0x01, 0x1B, 0x04, 0x0C, 0x02,
+  0x1C, 0x04, 0x0B, 0x02, 0x1C, 0x05, 0x09, 0x02, 0x1E, 0x06, 0x06, 0x03,
+  0x1E, 0x0E, 0x20, 0x0C, 0x22, 0x0A, 0x25, 0x06, 0x9E, 0x04, 0x28, 0x04,
+  0x29, 0x03, 0x2A, 0x02, 0x2A, 0x02, 0x2B, 0x02, 0x2B, 0x01, 0x2B, 0x01,
+  0x5A, 0x06, 0x25, 0x09, 0x22, 0x03, 0x04, 0x06, 0x1F, 0x03, 0x07, 0x04,
+  0x1F, 0x02, 0x08, 0x05, 0x1D, 0x03, 0x09, 0x04, 0x1D, 0x02, 0x0A, 0x05,
+  0x1C, 0x02, 0x0A, 0x05, 0x1B, 0x12, 0x1B, 0x12, 0x1B, 0x03, 0x2A, 0x03,
+  0x2A, 0x03, 0x2A, 0x03, 0x2A, 0x04, 0x0D, 0x01, 0x1B, 0x04, 0x0C, 0x02,
+  0x1C, 0x04, 0x0B, 0x02, 0x1C, 0x05, 0x09, 0x02, 0x1E, 0x06, 0x06, 0x03,
+  0x1E, 0x0E, 0x20, 0x0C, 0x22, 0x0A, 0x25, 0x06, 0x43, 0x02, 0x2A, 0x04,
+  0x28, 0x02, 0x02, 0x02, 0x26, 0x02, 0x04, 0x02, 0x24, 0x02, 0x06, 0x02,
+  0x22, 0x02, 0x08, 0x02, 0x20, 0x02, 0x0A, 0x02, 0x1E, 0x02, 0x0C, 0x02,
+  0x1C, 0x02, 0x0E, 0x02, 0x1A, 0x02, 0x10, 0x02, 0x4E, 0x06, 0x25, 0x09,
+  0x22, 0x03, 0x04, 0x06, 0x1F, 0x03, 0x07, 0x04, 0x1F, 0x02, 0x08, 0x05,
+  0x1D, 0x03, 0x09, 0x04, 0x1D, 0x02, 0x0A, 0x05, 0x1C, 0x02, 0x0A, 0x05,
+  0x1B, 0x12, 0x1B, 0x12, 0x1B, 0x03, 0x2A, 0x03, 0x2A, 0x03, 0x2A, 0x03,
+  0x2A, 0x04, 0x0D, 0x01, 0x1B, 0x04, 0x0C, 0x02, 0x1C, 0x04, 0x0B, 0x02,
+  0x1C, 0x05, 0x09, 0x02, 0x1E, 0x06, 0x06, 0x03, 0x1E, 0x0E, 0x20, 0x0C,
+  0x22, 0x0A, 0x25, 0x06, 0xFF, 0x00, 0x4E, 0x02, 0x06, 0x02, 0x22, 0x04,
+  0x04, 0x04, 0x21, 0x04, 0x04, 0x04, 0x22, 0x02, 0x06, 0x02, 0x53, 0x06,
+  0x25, 0x09, 0x22, 0x03, 0x04, 0x06, 0x1F, 0x03, 0x07, 0x04, 0x1F, 0x02,
+  0x08, 0x05, 0x1D, 0x03, 0x09, 0x04, 0x1D, 0x02, 0x0A, 0x05, 0x1C, 0x02,
+  0x0A, 0x05, 0x1B, 0x12, 0x1B, 0x12, 0x1B, 0x03, 0x2A, 0x03, 0x2A, 0x03,
+  0x2A, 0x03, 0x2A, 0x04, 0x0D, 0x01, 0x1B, 0x04, 0x0C, 0x02, 0x1C, 0x04,
+  0x0B, 0x02, 0x1C, 0x05, 0x09, 0x02, 0x1E, 0x06, 0x06, 0x03, 0x1E, 0x0E,
+  0x20, 0x0C, 0x22, 0x0A, 0x25, 0x06, 0x43, 0x02, 0x2A, 0x04, 0x28, 0x02,
+  0x02, 0x02, 0x26, 0x02, 0x04, 0x02, 0x24, 0x02, 0x06, 0x02, 0x23, 0x02,
+  0x06, 0x02, 0x21, 0x02, 0x0A, 0x02, 0x1F, 0x02, 0x0A, 0x02, 0x1E, 0x02,
+  0x0C, 0x02, 0x1C, 0x02, 0x0E, 0x02, 0x1A, 0x02, 0x10, 0x02, 0x4D, 0x05,
+  0x26, 0x07, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x28, 0x06, 0x25, 0x0A, 0xFF, 0x00, 0x7B, 0x02, 0x06, 0x02, 0x22, 0x04,
+  0x04, 0x04, 0x21, 0x04, 0x04, 0x04, 0x22, 0x02, 0x06, 0x02, 0x52, 0x05,
+  0x26, 0x07, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04, 0x29, 0x04,
+  0x28, 0x06, 0x25, 0x0A, 0x42, 0x02, 0x2A, 0x04, 0x28, 0x02, 0x02, 0x02,
+  0x26, 0x02, 0x04, 0x02, 0x24, 0x02, 0x06, 0x02, 0x22, 0x02, 0x08, 0x02,
+  0x20, 0x02, 0x0A, 0x02, 0x1E, 0x02, 0x0C, 0x02, 0x1C, 0x02, 0x0E, 0x02,
+  0x1A, 0x02, 0x10, 0x02, 0x4D, 0x07, 0x24, 0x0B, 0x21, 0x04, 0x04, 0x05,
+  0x1F, 0x03, 0x08, 0x04, 0x1D, 0x04, 0x08, 0x05, 0x1C, 0x03, 0x0A, 0x05,
+  0x1A, 0x04, 0x0A, 0x05, 0x1A, 0x04, 0x0B, 0x04, 0x19, 0x04, 0x0C, 0x05,
+  0x18, 0x04, 0x0C, 0x05, 0x18, 0x04, 0x0C, 0x05, 0x18, 0x04, 0x0D, 0x04,
+  0x18, 0x05, 0x0C, 0x04, 0x18, 0x05, 0x0C, 0x04, 0x18, 0x05, 0x0C, 0x04,
+  0x19, 0x04, 0x0B, 0x04, 0x1A, 0x05, 0x0A, 0x04, 0x1A, 0x05, 0x0A, 0x03,
+  0x1C, 0x05, 0x09, 0x03, 0x1D, 0x05, 0x07, 0x03, 0x1F, 0x05, 0x04, 0x04,
+  0x21, 0x0B, 0x24, 0x07, 0xFF, 0x00, 0x4D, 0x02, 0x06, 0x02, 0x22, 0x04,
+  0x04, 0x04, 0x21, 0x04, 0x04, 0x04, 0x22, 0x02, 0x06, 0x02, 0x52, 0x07,
+  0x24, 0x0B, 0x21, 0x04, 0x04, 0x05, 0x1F, 0x03, 0x08, 0x04, 0x1D, 0x04,
+  0x08, 0x05, 0x1C, 0x03, 0x0A, 0x05, 0x1A, 0x04, 0x0A, 0x05, 0x1A, 0x04,
+  0x0B, 0x04, 0x19, 0x04, 0x0C, 0x05, 0x18, 0x04, 0x0C, 0x05, 0x18, 0x04,
+  0x0C, 0x05, 0x18, 0x04, 0x0D, 0x04, 0x18, 0x05, 0x0C, 0x04, 0x18, 0x05,
+  0x0C, 0x04, 0x18, 0x05, 0x0C, 0x04, 0x19, 0x04, 0x0B, 0x04, 0x1A, 0x05,
+  0x0A, 0x04, 0x1A, 0x05, 0x0A, 0x03, 0x1C, 0x05, 0x09, 0x03, 0x1D, 0x05,
+  0x07, 0x03, 0x1F, 0x05, 0x04, 0x04, 0x21, 0x0B, 0x24, 0x07, 0xC8, 0x04,
+  0x2A, 0x04, 0x2A, 0x03, 0x2B, 0x02, 0x2C, 0x02, 0x2B, 0x02, 0x2C, 0x01,
+  0x2D, 0x01, 0x4B, 0x07, 0x06, 0x07, 0x1B, 0x05, 0x08, 0x05, 0x1C, 0x04,
+  0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04,
+  0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04,
+  0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04,
+  0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04,
+  0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x08, 0x05, 0x1C, 0x05,
+  0x06, 0x06, 0x1D, 0x05, 0x04, 0x02, 0x01, 0x04, 0x1D, 0x0A, 0x02, 0x07,
+  0x1B, 0x08, 0x03, 0x05, 0x1E, 0x05, 0x05, 0x02, 0x43, 0x02, 0x2A, 0x04,
+  0x28, 0x02, 0x02, 0x02, 0x26, 0x02, 0x04, 0x02, 0x24, 0x02, 0x06, 0x02,
+  0x23, 0x02, 0x06, 0x02, 0x21, 0x02, 0x0A, 0x02, 0x1F, 0x02, 0x0A, 0x02,
+  0x1E, 0x02, 0x0C, 0x02, 0x1C, 0x02, 0x0E, 0x02, 0x1A, 0x02, 0x10, 0x02,
+  0x45, 0x07, 0x06, 0x07, 0x1B, 0x05, 0x08, 0x05, 0x1C, 0x04, 0x09, 0x04,
+  0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04,
+  0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04,
+  0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04,
+  0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04,
+  0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x08, 0x05, 0x1C, 0x05, 0x06, 0x06,
+  0x1D, 0x05, 0x04, 0x02, 0x01, 0x04, 0x1D, 0x0A, 0x02, 0x07, 0x1B, 0x08,
+  0x03, 0x05, 0x1E, 0x05, 0x05, 0x02, 0xFF, 0x00, 0x7B, 0x02, 0x06, 0x02,
+  0x22, 0x04, 0x04, 0x04, 0x21, 0x04, 0x04, 0x04, 0x22, 0x02, 0x06, 0x02,
+  0x4A, 0x07, 0x06, 0x07, 0x1B, 0x05, 0x08, 0x05, 0x1C, 0x04, 0x09, 0x04,
+  0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04,
+  0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04,
+  0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04,
+  0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x09, 0x04,
+  0x1C, 0x04, 0x09, 0x04, 0x1C, 0x04, 0x08, 0x05, 0x1C, 0x05, 0x06, 0x06,
+  0x1D, 0x05, 0x04, 0x02, 0x01, 0x04, 0x1D, 0x0A, 0x02, 0x07, 0x1B, 0x08,
+  0x03, 0x05, 0x1E, 0x05, 0x05, 0x02,
+};
+
+const uint16_t Font36Rle_Offsets[] = {
+      0,     0,    60,   112,   240,   382,   570,   726,
+    752,   842,   932,  1002,  1054,  1088,  1102,  1120,
+   1190,  1310,  1376,  1456,  1532,  1626,  1694,  1794,
+   1866,  1980,  2080,  2104,  2142,  2190,  2204,  2252,
+   2332,  2612,  2726,  2842,  2944,  3064,  3170,  3264,
+   3384,  3508,  3572,  3646,  3772,  3850,  4066,  4228,
+   4356,  4450,  4594,  4714,  4826,  4910,  5038,  5154,
+   5354,  5470,  5566,  5656,  5742,  5812,  5898,  5960,
+   5978,  5994,  6086,  6198,  6268,  6384,  6456,  6534,
+   6642,  6756,  6810,  6888,  6996,  7064,  7204,  7298,
+   7386,  7502,  7618,  7674,  7748,  7812,  7906,  7986,
+   8124,  8202,  8300,  8362,  8452,  8540,  8630,  8664,
+   8708,  8820,  8924,  9048,  9154,  9248,  9332,  9416,
+   9520,  9606,  9688,  9748,  9868,  9970, 10076, 10206,
+  10314,
+};
+
+const uint16_t Font36Rle_CodePoints[] = {
+  0x00B0,  // '°'
+  0x00B5,  // 'µ'
+  0x00E0,  // 'à'
+  0x00E2,  // 'â'
+  0x00E4,  // 'ä'
+  0x00E7,  // 'ç'
+  0x00E8,  // 'è'
+  0x00E9,  // 'é'
+  0x00EA,  // 'ê'
+  0x00EB,  // 'ë'
+  0x00EE,  // 'î'
+  0x00EF,  // 'ï'
+  0x00F4,  // 'ô'
+  0x00F6,  // 'ö'
+  0x00F9,  // 'ù'
+  0x00FB,  // 'û'
+  0x00FC,  // 'ü'
+};
+// clang-format on
+
+constexpr Font kFont36Rle = {Font36Rle_Table,
+                             45,
+                             46,
+                             FontFormat::Rle1,
+                             Font36Rle_CodePoints,
+                             17,
+                             Font36Rle_Offsets};
+
+}  // namespace disco
@@ -4397,12 +4397,795 @@ const uint8_t Font36b_Table[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @25080 '°' (46 pixels wide)
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,  //                     #######
+  0x00, 0x00, 0x1C, 0xE0, 0x00, 0x00,  //                    ###  ###
+  0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00,  //                   ####  ####
+  0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00,  //                   ####  ####
+  0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00,  //                   ####  ####
+  0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00,  //                   ####  ####
+  0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00,  //                   ####  ####
+  0x00, 0x00, 0x3C, 0xF0, 0x00, 0x00,  //                   ####  ####
+  0x00, 0x00, 0x1C, 0xE0, 0x00, 0x00,  //                    ###  ###
+  0x00, 0x00, 0x1F, 0xE0, 0x00, 0x00,  //                    ########
+  0x00, 0x00, 0x07, 0x80, 0x00, 0x00,  //                      ####
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @25344 'µ' (46 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x0F, 0xF8, 0x7F, 0xC0, 0x00,  //             #########    #########
+  0x00, 0x07, 0xF8, 0x3F, 0xC0, 0x00,  //              ########     ########
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00,  //               #######     ########
+  0x00, 0x01, 0xFC, 0x7F, 0xC0, 0x00,  //                #######   #########
+  0x00, 0x01, 0xFF, 0xDF, 0xE0, 0x00,  //                ########### ########
+  0x00, 0x00, 0xFF, 0x1F, 0xF0, 0x00,  //                 ########   #########
+  0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,  //                   #####
+  0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,  //               #######
+  0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,  //               #######
+  0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,  //               #######
+  0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,  //               #######
+  0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,  //               #######
+  0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,  //               #######
+  0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,  //               #######
+  0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,  //               #######
+  0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,  //               #######
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @25608 'à' (46 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,  //                     #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,  //                       ######
+  0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,  //                        #####
+  0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,  //                         #####
+  0x00, 0x00, 0x00, 0x78, 0x00, 0x00,  //                          ####
+  0x00, 0x00, 0x00, 0x38, 0x00, 0x00,  //                           ###
+  0x00, 0x00, 0x00, 0x1C, 0x00, 0x00,  //                            ###
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,  //                      ########
+  0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,  //                   ############
+  0x00, 0x00, 0x78, 0x7F, 0x00, 0x00,  //                  ####    #######
+  0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00,  //                 ####      ######
+  0x00, 0x01, 0xF8, 0x3F, 0x80, 0x00,  //                ######     #######
+  0x00, 0x01, 0xF8, 0x3F, 0x80, 0x00,  //                ######     #######
+  0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00,  //                #######    #######
+  0x00, 0x01, 0xF8, 0x3F, 0x80, 0x00,  //                ######     #######
+  0x00, 0x00, 0x70, 0x3F, 0x80, 0x00,  //                  ###      #######
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,  //                         #########
+  0x00, 0x00, 0x03, 0xBF, 0x80, 0x00,  //                       ### #######
+  0x00, 0x00, 0x0F, 0x3F, 0x80, 0x00,  //                     ####  #######
+  0x00, 0x00, 0x3E, 0x3F, 0x80, 0x00,  //                   #####   #######
+  0x00, 0x00, 0x7C, 0x3F, 0x80, 0x00,  //                  #####    #######
+  0x00, 0x00, 0xFC, 0x3F, 0x80, 0x00,  //                 ######    #######
+  0x00, 0x01, 0xF8, 0x3F, 0x80, 0x00,  //                ######     #######
+  0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00,  //               #######     #######
+  0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00,  //               #######     #######
+  0x00, 0x03, 0xF8, 0x7F, 0x80, 0x00,  //               #######    ########
+  0x00, 0x03, 0xFC, 0xBF, 0x80, 0x00,  //               ########  # #######
+  0x00, 0x03, 0xFF, 0x3F, 0xF0, 0x00,  //               ##########  ##########
+  0x00, 0x01, 0xFE, 0x1F, 0xE0, 0x00,  //                ########    ########
+  0x00, 0x00, 0xF8, 0x0F, 0x80, 0x00,  //                 #####       #####
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @25872 'â' (46 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0xC0, 0x00, 0x00,  //                         ##
+  0x00, 0x00, 0x01, 0xE0, 0x00, 0x00,  //                        ####
+  0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,  //                       ######
+  0x00, 0x00, 0x07, 0x38, 0x00, 0x00,  //                      ###  ###
+  0x00, 0x00, 0x0C, 0x0C, 0x00, 0x00,  //                     ##      ##
+  0x00, 0x00, 0x38, 0x07, 0x00, 0x00,  //                   ###        ###
+  0x00, 0x00, 0x70, 0x03, 0x80, 0x00,  //                  ###          ###
+  0x00, 0x00, 0xE0, 0x01, 0xC0, 0x00,  //                 ###            ###
+  0x00, 0x01, 0xC0, 0x00, 0xE0, 0x00,  //                ###              ###
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,  //                      ########
+  0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,  //                   ############
+  0x00, 0x00, 0x78, 0x7F, 0x00, 0x00,  //                  ####    #######
+  0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00,  //                 ####      ######
+  0x00, 0x01, 0xF8, 0x3F, 0x80, 0x00,  //                ######     #######
+  0x00, 0x01, 0xF8, 0x3F, 0x80, 0x00,  //                ######     #######
+  0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00,  //                #######    #######
+  0x00, 0x01, 0xF8, 0x3F, 0x80, 0x00,  //                ######     #######
+  0x00, 0x00, 0x70, 0x3F, 0x80, 0x00,  //                  ###      #######
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,  //                         #########
+  0x00, 0x00, 0x03, 0xBF, 0x80, 0x00,  //                       ### #######
+  0x00, 0x00, 0x0F, 0x3F, 0x80, 0x00,  //                     ####  #######
+  0x00, 0x00, 0x3E, 0x3F, 0x80, 0x00,  //                   #####   #######
+  0x00, 0x00, 0x7C, 0x3F, 0x80, 0x00,  //                  #####    #######
+  0x00, 0x00, 0xFC, 0x3F, 0x80, 0x00,  //                 ######    #######
+  0x00, 0x01, 0xF8, 0x3F, 0x80, 0x00,  //                ######     #######
+  0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00,  //               #######     #######
+  0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00,  //               #######     #######
+  0x00, 0x03, 0xF8, 0x7F, 0x80, 0x00,  //               #######    ########
+  0x00, 0x03, 0xFC, 0xBF, 0x80, 0x00,  //               ########  # #######
+  0x00, 0x03, 0xFF, 0x3F, 0xF0, 0x00,  //               ##########  ##########
+  0x00, 0x01, 0xFE, 0x1F, 0xE0, 0x00,  //                ########    ########
+  0x00, 0x00, 0xF8, 0x0F, 0x80, 0x00,  //                 #####       #####
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @26136 'ä' (46 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x01, 0xE0, 0x01, 0xE0, 0x00,  //                ####            ####
+  0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00,  //               ######          ######
+  0x00, 0x07, 0xF8, 0x07, 0xF8, 0x00,  //              ########        ########
+  0x00, 0x07, 0xF8, 0x07, 0xF8, 0x00,  //              ########        ########
+  0x00, 0x07, 0xF8, 0x07, 0xF8, 0x00,  //              ########        ########
+  0x00, 0x07, 0xF8, 0x07, 0xF8, 0x00,  //              ########        ########
+  0x00, 0x03, 0xF0, 0x03, 0xF0, 0x00,  //               ######          ######
+  0x00, 0x01, 0xE0, 0x01, 0xE0, 0x00,  //                ####            ####
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x07, 0xF8, 0x00, 0x00,  //                      ########
+  0x00, 0x00, 0x3F, 0xFC, 0x00, 0x00,  //                   ############
+  0x00, 0x00, 0x78, 0x7F, 0x00, 0x00,  //                  ####    #######
+  0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00,  //                 ####      ######
+  0x00, 0x01, 0xF8, 0x3F, 0x80, 0x00,  //                ######     #######
+  0x00, 0x01, 0xF8, 0x3F, 0x80, 0x00,  //                ######     #######
+  0x00, 0x01, 0xFC, 0x3F, 0x80, 0x00,  //                #######    #######
+  0x00, 0x01, 0xF8, 0x3F, 0x80, 0x00,  //                ######     #######
+  0x00, 0x00, 0x70, 0x3F, 0x80, 0x00,  //                  ###      #######
+  0x00, 0x00, 0x00, 0xFF, 0x80, 0x00,  //                         #########
+  0x00, 0x00, 0x03, 0xBF, 0x80, 0x00,  //                       ### #######
+  0x00, 0x00, 0x0F, 0x3F, 0x80, 0x00,  //                     ####  #######
+  0x00, 0x00, 0x3E, 0x3F, 0x80, 0x00,  //                   #####   #######
+  0x00, 0x00, 0x7C, 0x3F, 0x80, 0x00,  //                  #####    #######
+  0x00, 0x00, 0xFC, 0x3F, 0x80, 0x00,  //                 ######    #######
+  0x00, 0x01, 0xF8, 0x3F, 0x80, 0x00,  //                ######     #######
+  0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00,  //               #######     #######
+  0x00, 0x03, 0xF8, 0x3F, 0x80, 0x00,  //               #######     #######
+  0x00, 0x03, 0xF8, 0x7F, 0x80, 0x00,  //               #######    ########
+  0x00, 0x03, 0xFC, 0xBF, 0x80, 0x00,  //               ########  # #######
+  0x00, 0x03, 0xFF, 0x3F, 0xF0, 0x00,  //               ##########  ##########
+  0x00, 0x01, 0xFE, 0x1F, 0xE0, 0x00,  //                ########    ########
+  0x00, 0x00, 0xF8, 0x0F, 0x80, 0x00,  //                 #####       #####
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @26400 'ç' (46 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x01, 0xF8, 0x00, 0x00,  //                        ######
+  0x00, 0x00, 0x07, 0xFE, 0x00, 0x00,  //                      ##########
+  0x00, 0x00, 0x0F, 0x9F, 0x00, 0x00,  //                     #####  #####
+  0x00, 0x00, 0x1F, 0x1F, 0x80, 0x00,  //                    #####   ######
+  0x00, 0x00, 0x3F, 0x1F, 0x80, 0x00,  //                   ######   ######
+  0x00, 0x00, 0x7E, 0x0F, 0x80, 0x00,  //                  ######     #####
+  0x00, 0x00, 0x7E, 0x0F, 0x80, 0x00,  //                  ######     #####
+  0x00, 0x00, 0x7E, 0x07, 0x00, 0x00,  //                  ######      ###
+  0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,  //                 #######
+  0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,  //                 #######
+  0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,  //                 #######
+  0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,  //                 #######
+  0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,  //                 #######
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,  //                 ########
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,  //                 ########
+  0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,  //                 ########
+  0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,  //                  ########
+  0x00, 0x00, 0x7F, 0x80, 0x00, 0x00,  //                  ########
+  0x00, 0x00, 0x3F, 0xC0, 0xC0, 0x00,  //                   ########      ##
+  0x00, 0x00, 0x3F, 0xE1, 0x80, 0x00,  //                   #########    ##
+  0x00, 0x00, 0x1F, 0xFF, 0x00, 0x00,  //                    #############
+  0x00, 0x00, 0x0F, 0xFE, 0x00, 0x00,  //                     ###########
+  0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,  //                       ######
+  0x00, 0x00, 0x01, 0xE0, 0x00, 0x00,  //                        ####
+  0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,  //                       ######
+  0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,  //                      #########
+  0x00, 0x00, 0x07, 0xFC, 0x00, 0x00,  //                      #########
+  0x00, 0x00, 0x03, 0xFC, 0x00, 0x00,  //                       ########
+  0x00, 0x00, 0x00, 0x1C, 0x00, 0x00,  //                            ###
+  0x00, 0x00, 0x00, 0x18, 0x00, 0x00,  //                            ##
+  0x00, 0x00, 0x00, 0x30, 0x00, 0x00,  //                           ##
+  0x00, 0x00, 0x00, 0x70, 0x00, 0x00,  //                          ###
+  0x00, 0x00, 0x01, 0x80, 0x00, 0x00,  //                        ##
+  // @26664 'è' (46 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,  //                    #######
+  0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,  //                     #######
+  0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,  //                      ######
+  0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,  //                       #####
+  0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,  //                        #####
+  0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,  //                         ####
+  0x00, 0x00, 0x00, 0x70, 0x00, 0x00,  //                          ###
+  0x00, 0x00, 0x00, 0x38, 0x00, 0x00,  //                           ###
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,  //                       ######
+  0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,  //                     ##########
+  0x00, 0x00, 0x1F, 0x3E, 0x00, 0x00,  //                    #####  #####
+  0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00,  //                   #####   ######
+  0x00, 0x00, 0x7C, 0x1F, 0x00, 0x00,  //                  #####     #####
+  0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00,  //                 ######     ######
+  0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00,  //                 ######     ######
+  0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00,  //                 ######     #######
+  0x00, 0x01, 0xFC, 0x1F, 0xC0, 0x00,  //                #######     #######
+  0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,  //                ###################
+  0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,  //                ###################
+  0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,  //                #######
+  0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,  //                #######
+  0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,  //                #######
+  0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,  //                ########
+  0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,  //                ########
+  0x00, 0x00, 0xFE, 0x00, 0x40, 0x00,  //                 #######          #
+  0x00, 0x00, 0xFF, 0x00, 0xC0, 0x00,  //                 ########        ##
+  0x00, 0x00, 0x7F, 0x81, 0x80, 0x00,  //                  ########      ##
+  0x00, 0x00, 0x7F, 0xC3, 0x00, 0x00,  //                  #########    ##
+  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,  //                   #############
+  0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,  //                    ###########
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @26928 'é' (46 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x03, 0xF8, 0x00, 0x00,  //                       #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,  //                      ######
+  0x00, 0x00, 0x07, 0xC0, 0x00, 0x00,  //                      #####
+  0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,  //                     #####
+  0x00, 0x00, 0x0F, 0x00, 0x00, 0x00,  //                     ####
+  0x00, 0x00, 0x0E, 0x00, 0x00, 0x00,  //                     ###
+  0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,  //                    ###
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,  //                       ######
+  0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,  //                     ##########
+  0x00, 0x00, 0x1F, 0x3E, 0x00, 0x00,  //                    #####  #####
+  0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00,  //                   #####   ######
+  0x00, 0x00, 0x7C, 0x1F, 0x00, 0x00,  //                  #####     #####
+  0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00,  //                 ######     ######
+  0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00,  //                 ######     ######
+  0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00,  //                 ######     #######
+  0x00, 0x01, 0xFC, 0x1F, 0xC0, 0x00,  //                #######     #######
+  0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,  //                ###################
+  0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,  //                ###################
+  0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,  //                #######
+  0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,  //                #######
+  0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,  //                #######
+  0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,  //                ########
+  0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,  //                ########
+  0x00, 0x00, 0xFE, 0x00, 0x40, 0x00,  //                 #######          #
+  0x00, 0x00, 0xFF, 0x00, 0xC0, 0x00,  //                 ########        ##
+  0x00, 0x00, 0x7F, 0x81, 0x80, 0x00,  //                  ########      ##
+  0x00, 0x00, 0x7F, 0xC3, 0x00, 0x00,  //                  #########    ##
+  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,  //                   #############
+  0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,  //                    ###########
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @27192 'ê' (46 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x01, 0x80, 0x00, 0x00,  //                        ##
+  0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,  //                       ####
+  0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,  //                      ######
+  0x00, 0x00, 0x0E, 0x70, 0x00, 0x00,  //                     ###  ###
+  0x00, 0x00, 0x18, 0x18, 0x00, 0x00,  //                    ##      ##
+  0x00, 0x00, 0x70, 0x0E, 0x00, 0x00,  //                  ###        ###
+  0x00, 0x00, 0xE0, 0x07, 0x00, 0x00,  //                 ###          ###
+  0x00, 0x01, 0xC0, 0x03, 0x80, 0x00,  //                ###            ###
+  0x00, 0x03, 0x80, 0x01, 0xC0, 0x00,  //               ###              ###
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,  //                       ######
+  0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,  //                     ##########
+  0x00, 0x00, 0x1F, 0x3E, 0x00, 0x00,  //                    #####  #####
+  0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00,  //                   #####   ######
+  0x00, 0x00, 0x7C, 0x1F, 0x00, 0x00,  //                  #####     #####
+  0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00,  //                 ######     ######
+  0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00,  //                 ######     ######
+  0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00,  //                 ######     #######
+  0x00, 0x01, 0xFC, 0x1F, 0xC0, 0x00,  //                #######     #######
+  0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,  //                ###################
+  0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,  //                ###################
+  0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,  //                #######
+  0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,  //                #######
+  0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,  //                #######
+  0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,  //                ########
+  0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,  //                ########
+  0x00, 0x00, 0xFE, 0x00, 0x40, 0x00,  //                 #######          #
+  0x00, 0x00, 0xFF, 0x00, 0xC0, 0x00,  //                 ########        ##
+  0x00, 0x00, 0x7F, 0x81, 0x80, 0x00,  //                  ########      ##
+  0x00, 0x00, 0x7F, 0xC3, 0x00, 0x00,  //                  #########    ##
+  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,  //                   #############
+  0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,  //                    ###########
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @27456 'ë' (46 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x03, 0xC0, 0x03, 0xC0, 0x00,  //               ####            ####
+  0x00, 0x07, 0xE0, 0x07, 0xE0, 0x00,  //              ######          ######
+  0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00,  //             ########        ########
+  0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00,  //             ########        ########
+  0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00,  //             ########        ########
+  0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00,  //             ########        ########
+  0x00, 0x07, 0xE0, 0x07, 0xE0, 0x00,  //              ######          ######
+  0x00, 0x03, 0xC0, 0x03, 0xC0, 0x00,  //               ####            ####
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x03, 0xF0, 0x00, 0x00,  //                       ######
+  0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00,  //                     ##########
+  0x00, 0x00, 0x1F, 0x3E, 0x00, 0x00,  //                    #####  #####
+  0x00, 0x00, 0x3E, 0x3F, 0x00, 0x00,  //                   #####   ######
+  0x00, 0x00, 0x7C, 0x1F, 0x00, 0x00,  //                  #####     #####
+  0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00,  //                 ######     ######
+  0x00, 0x00, 0xFC, 0x1F, 0x80, 0x00,  //                 ######     ######
+  0x00, 0x00, 0xFC, 0x1F, 0xC0, 0x00,  //                 ######     #######
+  0x00, 0x01, 0xFC, 0x1F, 0xC0, 0x00,  //                #######     #######
+  0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,  //                ###################
+  0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,  //                ###################
+  0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,  //                #######
+  0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,  //                #######
+  0x00, 0x01, 0xFC, 0x00, 0x00, 0x00,  //                #######
+  0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,  //                ########
+  0x00, 0x01, 0xFE, 0x00, 0x00, 0x00,  //                ########
+  0x00, 0x00, 0xFE, 0x00, 0x40, 0x00,  //                 #######          #
+  0x00, 0x00, 0xFF, 0x00, 0xC0, 0x00,  //                 ########        ##
+  0x00, 0x00, 0x7F, 0x81, 0x80, 0x00,  //                  ########      ##
+  0x00, 0x00, 0x7F, 0xC3, 0x00, 0x00,  //                  #########    ##
+  0x00, 0x00, 0x3F, 0xFE, 0x00, 0x00,  //                   #############
+  0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,  //                    ###########
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @27720 'î' (46 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x01, 0x80, 0x00, 0x00,  //                        ##
+  0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,  //                       ####
+  0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,  //                      ######
+  0x00, 0x00, 0x0E, 0x70, 0x00, 0x00,  //                     ###  ###
+  0x00, 0x00, 0x1C, 0x38, 0x00, 0x00,  //                    ###    ###
+  0x00, 0x00, 0x38, 0x1C, 0x00, 0x00,  //                   ###      ###
+  0x00, 0x00, 0x70, 0x0E, 0x00, 0x00,  //                  ###        ###
+  0x00, 0x00, 0xE0, 0x07, 0x00, 0x00,  //                 ###          ###
+  0x00, 0x01, 0xC0, 0x03, 0x80, 0x00,  //                ###            ###
+  0x00, 0x03, 0x80, 0x01, 0xC0, 0x00,  //               ###              ###
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,  //                    #########
+  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,  //                     ########
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,  //                     #########
+  0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,  //                    ###########
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @27984 'ï' (46 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x03, 0xC0, 0x03, 0xC0, 0x00,  //               ####            ####
+  0x00, 0x07, 0xE0, 0x07, 0xE0, 0x00,  //              ######          ######
+  0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00,  //             ########        ########
+  0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00,  //             ########        ########
+  0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00,  //             ########        ########
+  0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00,  //             ########        ########
+  0x00, 0x07, 0xE0, 0x07, 0xE0, 0x00,  //              ######          ######
+  0x00, 0x03, 0xC0, 0x03, 0xC0, 0x00,  //               ####            ####
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x1F, 0xF0, 0x00, 0x00,  //                    #########
+  0x00, 0x00, 0x0F, 0xF0, 0x00, 0x00,  //                     ########
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x07, 0xF0, 0x00, 0x00,  //                      #######
+  0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00,  //                     #########
+  0x00, 0x00, 0x1F, 0xFC, 0x00, 0x00,  //                    ###########
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @28248 'ô' (46 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x01, 0x80, 0x00, 0x00,  //                        ##
+  0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,  //                       ####
+  0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,  //                      ######
+  0x00, 0x00, 0x0E, 0x70, 0x00, 0x00,  //                     ###  ###
+  0x00, 0x00, 0x18, 0x18, 0x00, 0x00,  //                    ##      ##
+  0x00, 0x00, 0x70, 0x0E, 0x00, 0x00,  //                  ###        ###
+  0x00, 0x00, 0xE0, 0x07, 0x00, 0x00,  //                 ###          ###
+  0x00, 0x01, 0xC0, 0x03, 0x80, 0x00,  //                ###            ###
+  0x00, 0x03, 0x80, 0x01, 0xC0, 0x00,  //               ###              ###
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,  //                      ######
+  0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,  //                    ##########
+  0x00, 0x00, 0x3E, 0x7E, 0x00, 0x00,  //                   #####  ######
+  0x00, 0x00, 0x7C, 0x3E, 0x00, 0x00,  //                  #####    #####
+  0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00,  //                 ######     #####
+  0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00,  //                ######      ######
+  0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00,  //                ######      ######
+  0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00,  //                ######      ######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00,  //                ######      ######
+  0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00,  //                ######      ######
+  0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00,  //                ######      ######
+  0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00,  //                 #####      #####
+  0x00, 0x00, 0x7C, 0x3F, 0x00, 0x00,  //                  #####    ######
+  0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00,  //                  ######  ######
+  0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,  //                    ##########
+  0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,  //                      ######
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @28512 'ö' (46 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x03, 0xC0, 0x03, 0xC0, 0x00,  //               ####            ####
+  0x00, 0x07, 0xE0, 0x07, 0xE0, 0x00,  //              ######          ######
+  0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00,  //             ########        ########
+  0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00,  //             ########        ########
+  0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00,  //             ########        ########
+  0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00,  //             ########        ########
+  0x00, 0x07, 0xE0, 0x07, 0xE0, 0x00,  //              ######          ######
+  0x00, 0x03, 0xC0, 0x03, 0xC0, 0x00,  //               ####            ####
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,  //                      ######
+  0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,  //                    ##########
+  0x00, 0x00, 0x3E, 0x7E, 0x00, 0x00,  //                   #####  ######
+  0x00, 0x00, 0x7C, 0x3E, 0x00, 0x00,  //                  #####    #####
+  0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00,  //                 ######     #####
+  0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00,  //                ######      ######
+  0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00,  //                ######      ######
+  0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00,  //                ######      ######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00,  //                ######      ######
+  0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00,  //                ######      ######
+  0x00, 0x01, 0xF8, 0x1F, 0x80, 0x00,  //                ######      ######
+  0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00,  //                 #####      #####
+  0x00, 0x00, 0x7C, 0x3F, 0x00, 0x00,  //                  #####    ######
+  0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00,  //                  ######  ######
+  0x00, 0x00, 0x1F, 0xF8, 0x00, 0x00,  //                    ##########
+  0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,  //                      ######
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @28776 'ù' (46 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x1F, 0xC0, 0x00, 0x00,  //                    #######
+  0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00,  //                     #######
+  0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,  //                      ######
+  0x00, 0x00, 0x03, 0xE0, 0x00, 0x00,  //                       #####
+  0x00, 0x00, 0x01, 0xF0, 0x00, 0x00,  //                        #####
+  0x00, 0x00, 0x00, 0xF0, 0x00, 0x00,  //                         ####
+  0x00, 0x00, 0x00, 0x70, 0x00, 0x00,  //                          ###
+  0x00, 0x00, 0x00, 0x38, 0x00, 0x00,  //                           ###
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x0F, 0xF8, 0x7F, 0xC0, 0x00,  //             #########    #########
+  0x00, 0x07, 0xF8, 0x3F, 0xC0, 0x00,  //              ########     ########
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00,  //               #######     ########
+  0x00, 0x01, 0xFC, 0x7F, 0xC0, 0x00,  //                #######   #########
+  0x00, 0x01, 0xFF, 0xDF, 0xE0, 0x00,  //                ########### ########
+  0x00, 0x00, 0xFF, 0x1F, 0xF0, 0x00,  //                 ########   #########
+  0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,  //                   #####
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @29040 'û' (46 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x01, 0x80, 0x00, 0x00,  //                        ##
+  0x00, 0x00, 0x03, 0xC0, 0x00, 0x00,  //                       ####
+  0x00, 0x00, 0x07, 0xE0, 0x00, 0x00,  //                      ######
+  0x00, 0x00, 0x0E, 0x70, 0x00, 0x00,  //                     ###  ###
+  0x00, 0x00, 0x1C, 0x38, 0x00, 0x00,  //                    ###    ###
+  0x00, 0x00, 0x38, 0x1C, 0x00, 0x00,  //                   ###      ###
+  0x00, 0x00, 0x70, 0x0E, 0x00, 0x00,  //                  ###        ###
+  0x00, 0x00, 0xE0, 0x07, 0x00, 0x00,  //                 ###          ###
+  0x00, 0x01, 0xC0, 0x03, 0x80, 0x00,  //                ###            ###
+  0x00, 0x03, 0x80, 0x01, 0xC0, 0x00,  //               ###              ###
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x0F, 0xF8, 0x7F, 0xC0, 0x00,  //             #########    #########
+  0x00, 0x07, 0xF8, 0x3F, 0xC0, 0x00,  //              ########     ########
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00,  //               #######     ########
+  0x00, 0x01, 0xFC, 0x7F, 0xC0, 0x00,  //                #######   #########
+  0x00, 0x01, 0xFF, 0xDF, 0xE0, 0x00,  //                ########### ########
+  0x00, 0x00, 0xFF, 0x1F, 0xF0, 0x00,  //                 ########   #########
+  0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,  //                   #####
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  // @29304 'ü' (46 pixels wide)
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x03, 0xC0, 0x03, 0xC0, 0x00,  //               ####            ####
+  0x00, 0x07, 0xE0, 0x07, 0xE0, 0x00,  //              ######          ######
+  0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00,  //             ########        ########
+  0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00,  //             ########        ########
+  0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00,  //             ########        ########
+  0x00, 0x0F, 0xF0, 0x0F, 0xF0, 0x00,  //             ########        ########
+  0x00, 0x07, 0xE0, 0x07, 0xE0, 0x00,  //              ######          ######
+  0x00, 0x03, 0xC0, 0x03, 0xC0, 0x00,  //               ####            ####
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x0F, 0xF8, 0x7F, 0xC0, 0x00,  //             #########    #########
+  0x00, 0x07, 0xF8, 0x3F, 0xC0, 0x00,  //              ########     ########
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x1F, 0xC0, 0x00,  //               #######      #######
+  0x00, 0x03, 0xF8, 0x3F, 0xC0, 0x00,  //               #######     ########
+  0x00, 0x01, 0xFC, 0x7F, 0xC0, 0x00,  //                #######   #########
+  0x00, 0x01, 0xFF, 0xDF, 0xE0, 0x00,  //                ########### ########
+  0x00, 0x00, 0xFF, 0x1F, 0xF0, 0x00,  //                 ########   #########
+  0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,  //                   #####
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  //
+};
+
+const uint16_t Font36b_CodePoints[] = {
+  0x00B0,  // '°'
+  0x00B5,  // 'µ'
+  0x00E0,  // 'à'
+  0x00E2,  // 'â'
+  0x00E4,  // 'ä'
+  0x00E7,  // 'ç'
+  0x00E8,  // 'è'
+  0x00E9,  // 'é'
+  0x00EA,  // 'ê'
+  0x00EB,  // 'ë'
+  0x00EE,  // 'î'
+  0x00EF,  // 'ï'
+  0x00F4,  // 'ô'
+  0x00F6,  // 'ö'
+  0x00F9,  // 'ù'
+  0x00FB,  // 'û'
+  0x00FC,  // 'ü'
 };
 // clang-format on
 
-Font* createFont36b() {
-    static Font* pFont36b = new Font{Font36b_Table, 46, 44};
-    return pFont36b;
-}
+constexpr Font kFont36b = {
+    Font36b_Table, 46, 44, FontFormat::Mono1, Font36b_CodePoints, 17};
 
 }  // namespace disco
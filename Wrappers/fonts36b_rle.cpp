@@ -0,0 +1,935 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file fonts36b_rle.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Run-length compressed font (size 36b), generated from fonts36b.cpp
+ *        by tools/font_rle.py
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "fonts.hpp"
+
+namespace disco {
+// clang-format off
+const uint8_t Font36bRle_Table[] = {
+  0x16, 0x04, 0x29, 0x06, 0x27, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08,
+  0x26, 0x08, 0x26, 0x07, 0x28, 0x06, 0x28, 0x06, 0x28, 0x06, 0x28, 0x05,
+  0x29, 0x05, 0x2A, 0x04, 0x2A, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03,
+  0x2C, 0x01, 0x2D, 0x01, 0x2D, 0x01, 0x2D, 0x01, 0xE4, 0x04, 0x29, 0x06,
+  0x27, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x27, 0x06, 0x29, 0x04,
+  0x10, 0x03, 0x09, 0x04, 0x1D, 0x05, 0x07, 0x05, 0x1C, 0x07, 0x05, 0x07,
+  0x1B, 0x07, 0x05, 0x07, 0x1B, 0x07, 0x05, 0x07, 0x1B, 0x07, 0x05, 0x07,
+  0x1C, 0x05, 0x07, 0x05, 0x1D, 0x05, 0x07, 0x05, 0x1D, 0x05, 0x07, 0x05,
+  0x1D, 0x05, 0x07, 0x05, 0x1E, 0x03, 0x09, 0x03, 0x1F, 0x03, 0x09, 0x03,
+  0x1F, 0x03, 0x09, 0x03, 0x20, 0x02, 0x0A, 0x02, 0x20, 0x01, 0x0B, 0x01,
+  0x42, 0x03, 0x08, 0x03, 0x20, 0x03, 0x08, 0x03, 0x20, 0x03, 0x07, 0x04,
+  0x1F, 0x03, 0x08, 0x03, 0x20, 0x03, 0x08, 0x03, 0x20, 0x03, 0x08, 0x03,
+  0x20, 0x03, 0x08, 0x03, 0x20, 0x03, 0x08, 0x03, 0x1F, 0x03, 0x08, 0x03,
+  0x20, 0x03, 0x08, 0x03, 0x20, 0x03, 0x08, 0x03, 0x1B, 0x16, 0x18, 0x16,
+  0x18, 0x16, 0x1C, 0x03, 0x08, 0x03, 0x20, 0x03, 0x08, 0x03, 0x20, 0x03,
+  0x08, 0x03, 0x20, 0x03, 0x08, 0x03, 0x20, 0x03, 0x07, 0x04, 0x1F, 0x03,
+  0x08, 0x03, 0x1D, 0x16, 0x18, 0x16, 0x18, 0x16, 0x1B, 0x03, 0x08, 0x03,
+  0x1F, 0x03, 0x08, 0x03, 0x20, 0x03, 0x08, 0x03, 0x20, 0x03, 0x08, 0x03,
+  0x20, 0x03, 0x08, 0x03, 0x20, 0x03, 0x08, 0x03, 0x1F, 0x04, 0x07, 0x03,
+  0x20, 0x03, 0x08, 0x03, 0x20, 0x03, 0x08, 0x03, 0x17, 0x02, 0x2A, 0x08,
+  0x23, 0x0E, 0x1F, 0x04, 0x02, 0x02, 0x02, 0x06, 0x1D, 0x04, 0x03, 0x02,
+  0x03, 0x05, 0x1C, 0x04, 0x04, 0x02, 0x05, 0x03, 0x1C, 0x04, 0x04, 0x02,
+  0x05, 0x03, 0x1B, 0x05, 0x04, 0x02, 0x06, 0x02, 0x1B, 0x06, 0x03, 0x02,
+  0x06, 0x02, 0x1B, 0x06, 0x03, 0x02, 0x07, 0x01, 0x1B, 0x07, 0x02, 0x02,
+  0x23, 0x0B, 0x24, 0x0A, 0x24, 0x0B, 0x24, 0x0B, 0x24, 0x0C, 0x23, 0x0C,
+  0x24, 0x0B, 0x24, 0x0B, 0x24, 0x0B, 0x24, 0x0A, 0x24, 0x0B, 0x23, 0x02,
+  0x02, 0x07, 0x23, 0x02, 0x03, 0x06, 0x1A, 0x01, 0x08, 0x02, 0x03, 0x06,
+  0x1A, 0x01, 0x08, 0x02, 0x04, 0x05, 0x1A, 0x02, 0x07, 0x02, 0x04, 0x05,
+  0x1A, 0x02, 0x07, 0x02, 0x04, 0x04, 0x1B, 0x03, 0x06, 0x02, 0x04, 0x04,
+  0x1B, 0x04, 0x05, 0x02, 0x03, 0x04, 0x1C, 0x06, 0x03, 0x02, 0x02, 0x04,
+  0x1E, 0x0F, 0x22, 0x0A, 0x29, 0x02, 0x2C, 0x02, 0x37, 0x06, 0x13, 0x03,
+  0x10, 0x04, 0x02, 0x04, 0x10, 0x03, 0x10, 0x04, 0x04, 0x04, 0x0E, 0x04,
+  0x0F, 0x05, 0x04, 0x05, 0x0D, 0x03, 0x10, 0x05, 0x04, 0x05, 0x0C, 0x03,
+  0x10, 0x06, 0x04, 0x06, 0x0A, 0x04, 0x10, 0x06, 0x04, 0x06, 0x0A, 0x03,
+  0x11, 0x06, 0x04, 0x06, 0x09, 0x03, 0x12, 0x06, 0x04, 0x06, 0x08, 0x04,
+  0x12, 0x06, 0x04, 0x06, 0x07, 0x04, 0x13, 0x06, 0x04, 0x06, 0x07, 0x03,
+  0x15, 0x05, 0x04, 0x05, 0x07, 0x04, 0x15, 0x05, 0x04, 0x05, 0x06, 0x04,
+  0x17, 0x04, 0x04, 0x04, 0x07, 0x03, 0x19, 0x04, 0x02, 0x04, 0x07, 0x03,
+  0x1C, 0x06, 0x08, 0x04, 0x2A, 0x03, 0x08, 0x06, 0x1C, 0x03, 0x07, 0x04,
+  0x02, 0x04, 0x19, 0x04, 0x06, 0x04, 0x04, 0x04, 0x18, 0x03, 0x06, 0x05,
+  0x04, 0x05, 0x16, 0x03, 0x07, 0x05, 0x04, 0x05, 0x15, 0x04, 0x06, 0x06,
+  0x04, 0x06, 0x14, 0x03, 0x07, 0x06, 0x04, 0x06, 0x13, 0x03, 0x08, 0x06,
+  0x04, 0x06, 0x12, 0x04, 0x08, 0x06, 0x04, 0x06, 0x11, 0x04, 0x09, 0x06,
+  0x04, 0x06, 0x11, 0x03, 0x0A, 0x06, 0x04, 0x06, 0x10, 0x04, 0x0B, 0x05,
+  0x04, 0x05, 0x10, 0x04, 0x0C, 0x05, 0x04, 0x05, 0x10, 0x03, 0x0E, 0x04,
+  0x03, 0x05, 0x10, 0x03, 0x10, 0x04, 0x02, 0x04, 0x10, 0x04, 0x12, 0x06,
+  0x15, 0x07, 0x25, 0x0B, 0x22, 0x03, 0x04, 0x06, 0x20, 0x03, 0x06, 0x06,
+  0x1E, 0x04, 0x06, 0x06, 0x1E, 0x04, 0x07, 0x05, 0x1D, 0x05, 0x07, 0x05,
+  0x1D, 0x06, 0x06, 0x05, 0x1D, 0x06, 0x06, 0x04, 0x1E, 0x07, 0x04, 0x04,
+  0x1F, 0x08, 0x02, 0x04, 0x20, 0x0C, 0x22, 0x0A, 0x25, 0x09, 0x25, 0x09,
+  0x06, 0x0A, 0x13, 0x0C, 0x07, 0x06, 0x13, 0x04, 0x01, 0x09, 0x08, 0x04,
+  0x13, 0x04, 0x02, 0x0A, 0x07, 0x03, 0x13, 0x04, 0x04, 0x0A, 0x06, 0x03,
+  0x11, 0x05, 0x05, 0x0B, 0x04, 0x03, 0x12, 0x05, 0x06, 0x0A, 0x04, 0x03,
+  0x11, 0x06, 0x07, 0x0A, 0x03, 0x02, 0x12, 0x06, 0x07, 0x0B, 0x01, 0x02,
+  0x12, 0x07, 0x08, 0x0D, 0x12, 0x08, 0x08, 0x0B, 0x13, 0x08, 0x09, 0x0A,
+  0x13, 0x09, 0x08, 0x0B, 0x12, 0x0A, 0x08, 0x0B, 0x05, 0x02, 0x0B, 0x0A,
+  0x08, 0x0B, 0x04, 0x01, 0x0C, 0x0C, 0x04, 0x12, 0x0D, 0x12, 0x01, 0x0D,
+  0x0F, 0x0F, 0x04, 0x0B, 0x11, 0x0C, 0x08, 0x08, 0x14, 0x08, 0x0B, 0x06,
+  0x17, 0x03, 0x2A, 0x05, 0x28, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x28, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x2A, 0x03, 0x2B, 0x03,
+  0x2B, 0x03, 0x2C, 0x02, 0x2C, 0x01, 0x1E, 0x01, 0x2B, 0x02, 0x2B, 0x02,
+  0x2A, 0x03, 0x2A, 0x03, 0x2B, 0x03, 0x2A, 0x03, 0x2A, 0x04, 0x29, 0x05,
+  0x29, 0x04, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x28, 0x05, 0x29, 0x05,
+  0x29, 0x05, 0x28, 0x06, 0x28, 0x06, 0x28, 0x06, 0x28, 0x06, 0x28, 0x06,
+  0x28, 0x06, 0x28, 0x06, 0x28, 0x06, 0x28, 0x06, 0x28, 0x06, 0x28, 0x06,
+  0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x2A, 0x05, 0x29, 0x05,
+  0x29, 0x05, 0x2A, 0x04, 0x2B, 0x04, 0x2A, 0x04, 0x2B, 0x03, 0x2C, 0x03,
+  0x2B, 0x03, 0x2C, 0x03, 0x2D, 0x02, 0x2D, 0x02, 0x2E, 0x01, 0x11, 0x01,
+  0x2E, 0x02, 0x2D, 0x02, 0x2D, 0x03, 0x2C, 0x03, 0x2B, 0x03, 0x2C, 0x03,
+  0x2B, 0x04, 0x2A, 0x04, 0x2B, 0x04, 0x2A, 0x05, 0x29, 0x05, 0x29, 0x05,
+  0x2A, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x06, 0x28, 0x06,
+  0x28, 0x06, 0x28, 0x06, 0x28, 0x06, 0x28, 0x06, 0x28, 0x06, 0x28, 0x06,
+  0x28, 0x06, 0x28, 0x06, 0x28, 0x06, 0x28, 0x05, 0x29, 0x05, 0x29, 0x05,
+  0x28, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x04, 0x29, 0x05, 0x29, 0x04,
+  0x2A, 0x03, 0x2A, 0x03, 0x2B, 0x03, 0x2A, 0x03, 0x2A, 0x02, 0x2B, 0x02,
+  0x2B, 0x01, 0x73, 0x03, 0x2A, 0x05, 0x29, 0x05, 0x29, 0x05, 0x2A, 0x03,
+  0x25, 0x03, 0x03, 0x03, 0x03, 0x03, 0x1E, 0x05, 0x03, 0x01, 0x03, 0x05,
+  0x1D, 0x07, 0x01, 0x01, 0x01, 0x07, 0x1E, 0x0F, 0x25, 0x03, 0x2A, 0x02,
+  0x01, 0x02, 0x27, 0x03, 0x03, 0x03, 0x23, 0x05, 0x03, 0x05, 0x20, 0x06,
+  0x03, 0x06, 0x1F, 0x06, 0x03, 0x06, 0x1F, 0x05, 0x05, 0x05, 0x20, 0x03,
+  0x07, 0x03, 0xFC, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03,
+  0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03,
+  0x20, 0x19, 0x15, 0x19, 0x15, 0x19, 0x20, 0x03, 0x2B, 0x03, 0x2B, 0x03,
+  0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03,
+  0x2B, 0x03, 0x2B, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0x98, 0x04, 0x29, 0x06, 0x27, 0x08, 0x26, 0x09, 0x25, 0x09, 0x25, 0x09,
+  0x26, 0x08, 0x27, 0x03, 0x01, 0x03, 0x2B, 0x03, 0x2B, 0x02, 0x2C, 0x02,
+  0x2B, 0x02, 0x2B, 0x03, 0x2A, 0x03, 0x2A, 0x02, 0x2B, 0x01, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0x7E, 0x0D, 0x21, 0x0D, 0x21, 0x0D, 0x21, 0x0D,
+  0x21, 0x0D, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xC6, 0x04,
+  0x29, 0x06, 0x27, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x27, 0x06,
+  0x29, 0x04, 0x1D, 0x03, 0x2B, 0x03, 0x2A, 0x03, 0x2B, 0x03, 0x2B, 0x03,
+  0x2A, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2A, 0x03, 0x2B, 0x03, 0x2B, 0x03,
+  0x2A, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2A, 0x03, 0x2B, 0x03, 0x2B, 0x03,
+  0x2A, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2A, 0x03, 0x2B, 0x03, 0x2B, 0x03,
+  0x2A, 0x04, 0x2A, 0x03, 0x2B, 0x03, 0x2A, 0x04, 0x2A, 0x03, 0x2B, 0x03,
+  0x2A, 0x04, 0x2A, 0x03, 0x2B, 0x03, 0x2A, 0x04, 0x2A, 0x03, 0x43, 0x05,
+  0x27, 0x09, 0x23, 0x05, 0x03, 0x05, 0x20, 0x05, 0x05, 0x05, 0x1F, 0x05,
+  0x06, 0x04, 0x1E, 0x05, 0x07, 0x05, 0x1D, 0x05, 0x07, 0x05, 0x1C, 0x06,
+  0x07, 0x06, 0x1B, 0x06, 0x07, 0x06, 0x1B, 0x06, 0x07, 0x06, 0x1B, 0x06,
+  0x07, 0x06, 0x1A, 0x07, 0x07, 0x07, 0x19, 0x07, 0x07, 0x07, 0x19, 0x07,
+  0x07, 0x07, 0x19, 0x07, 0x07, 0x07, 0x19, 0x07, 0x07, 0x07, 0x19, 0x07,
+  0x07, 0x07, 0x19, 0x07, 0x07, 0x07, 0x19, 0x07, 0x07, 0x07, 0x19, 0x07,
+  0x07, 0x07, 0x19, 0x07, 0x07, 0x07, 0x1A, 0x06, 0x07, 0x06, 0x1B, 0x06,
+  0x07, 0x06, 0x1B, 0x06, 0x07, 0x06, 0x1B, 0x06, 0x07, 0x06, 0x1C, 0x05,
+  0x07, 0x05, 0x1D, 0x05, 0x07, 0x05, 0x1E, 0x05, 0x06, 0x04, 0x20, 0x04,
+  0x05, 0x05, 0x20, 0x05, 0x03, 0x05, 0x23, 0x09, 0x27, 0x05, 0x48, 0x02,
+  0x2A, 0x04, 0x28, 0x06, 0x25, 0x09, 0x23, 0x0B, 0x22, 0x02, 0x02, 0x08,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x26, 0x09, 0x21, 0x11, 0x42, 0x06, 0x26, 0x0A, 0x23, 0x0D, 0x20, 0x0E,
+  0x1F, 0x10, 0x1E, 0x11, 0x1C, 0x04, 0x04, 0x0A, 0x1C, 0x02, 0x07, 0x09,
+  0x1C, 0x01, 0x09, 0x08, 0x27, 0x07, 0x27, 0x07, 0x27, 0x06, 0x28, 0x06,
+  0x28, 0x06, 0x28, 0x05, 0x28, 0x05, 0x29, 0x05, 0x28, 0x05, 0x29, 0x04,
+  0x29, 0x04, 0x29, 0x04, 0x2A, 0x04, 0x29, 0x04, 0x29, 0x04, 0x0A, 0x01,
+  0x1F, 0x03, 0x0A, 0x02, 0x1E, 0x03, 0x0A, 0x02, 0x1E, 0x10, 0x1D, 0x11,
+  0x1C, 0x12, 0x1C, 0x11, 0x1C, 0x12, 0x1B, 0x13, 0x43, 0x07, 0x24, 0x0B,
+  0x22, 0x0E, 0x1F, 0x02, 0x04, 0x09, 0x1E, 0x02, 0x07, 0x08, 0x1C, 0x02,
+  0x08, 0x08, 0x27, 0x07, 0x27, 0x07, 0x27, 0x06, 0x28, 0x05, 0x28, 0x05,
+  0x29, 0x03, 0x2A, 0x06, 0x26, 0x0A, 0x22, 0x0D, 0x23, 0x0C, 0x24, 0x0A,
+  0x25, 0x0A, 0x25, 0x09, 0x26, 0x08, 0x26, 0x08, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x06, 0x28, 0x06, 0x1B, 0x03, 0x0A, 0x06, 0x1A, 0x05, 0x09, 0x05,
+  0x1B, 0x06, 0x07, 0x05, 0x1C, 0x08, 0x04, 0x05, 0x1D, 0x10, 0x1F, 0x0D,
+  0x23, 0x09, 0x4A, 0x03, 0x2A, 0x04, 0x29, 0x05, 0x28, 0x06, 0x28, 0x06,
+  0x27, 0x07, 0x26, 0x08, 0x25, 0x09, 0x25, 0x09, 0x24, 0x02, 0x01, 0x07,
+  0x23, 0x02, 0x02, 0x07, 0x22, 0x02, 0x03, 0x07, 0x22, 0x02, 0x03, 0x07,
+  0x21, 0x02, 0x04, 0x07, 0x20, 0x02, 0x05, 0x07, 0x1F, 0x02, 0x06, 0x07,
+  0x1F, 0x02, 0x06, 0x07, 0x1E, 0x02, 0x07, 0x07, 0x1D, 0x02, 0x08, 0x07,
+  0x1C, 0x02, 0x09, 0x07, 0x1C, 0x15, 0x19, 0x15, 0x19, 0x15, 0x19, 0x15,
+  0x19, 0x15, 0x24, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x41, 0x0F, 0x1E, 0x10, 0x1E, 0x0F, 0x1F, 0x0F,
+  0x1E, 0x10, 0x1E, 0x0F, 0x1F, 0x02, 0x2B, 0x02, 0x2C, 0x02, 0x2B, 0x07,
+  0x27, 0x0B, 0x23, 0x0D, 0x20, 0x10, 0x1E, 0x11, 0x1D, 0x12, 0x1B, 0x14,
+  0x22, 0x0C, 0x25, 0x09, 0x27, 0x08, 0x28, 0x06, 0x29, 0x05, 0x2A, 0x04,
+  0x2A, 0x04, 0x2B, 0x03, 0x2B, 0x03, 0x1A, 0x04, 0x0D, 0x02, 0x1A, 0x06,
+  0x0C, 0x02, 0x1A, 0x08, 0x09, 0x02, 0x1B, 0x09, 0x08, 0x02, 0x1C, 0x0A,
+  0x04, 0x03, 0x1E, 0x0E, 0x22, 0x09, 0x4B, 0x05, 0x26, 0x06, 0x26, 0x05,
+  0x27, 0x05, 0x28, 0x05, 0x27, 0x05, 0x28, 0x05, 0x28, 0x06, 0x28, 0x05,
+  0x28, 0x06, 0x27, 0x06, 0x28, 0x06, 0x28, 0x05, 0x02, 0x06, 0x20, 0x10,
+  0x1E, 0x07, 0x03, 0x08, 0x1C, 0x06, 0x05, 0x07, 0x1B, 0x07, 0x06, 0x07,
+  0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x07, 0x07, 0x19, 0x07, 0x07, 0x07,
+  0x19, 0x07, 0x07, 0x07, 0x19, 0x07, 0x07, 0x07, 0x19, 0x07, 0x07, 0x07,
+  0x19, 0x07, 0x07, 0x07, 0x1A, 0x06, 0x07, 0x07, 0x1A, 0x07, 0x06, 0x06,
+  0x1C, 0x06, 0x06, 0x06, 0x1C, 0x06, 0x06, 0x05, 0x1E, 0x06, 0x04, 0x06,
+  0x1F, 0x06, 0x03, 0x05, 0x21, 0x0B, 0x26, 0x06, 0x3E, 0x12, 0x1C, 0x12,
+  0x1C, 0x12, 0x1B, 0x12, 0x1C, 0x12, 0x1C, 0x12, 0x1C, 0x04, 0x0A, 0x03,
+  0x1D, 0x02, 0x0C, 0x03, 0x1C, 0x02, 0x0D, 0x03, 0x1C, 0x01, 0x0D, 0x03,
+  0x2B, 0x03, 0x2B, 0x03, 0x2A, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2A, 0x03,
+  0x2B, 0x03, 0x2B, 0x03, 0x2A, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2A, 0x03,
+  0x2B, 0x03, 0x2B, 0x03, 0x2A, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2A, 0x03,
+  0x2B, 0x03, 0x2B, 0x03, 0x2A, 0x03, 0x2B, 0x03, 0x42, 0x08, 0x24, 0x0C,
+  0x20, 0x07, 0x03, 0x05, 0x1F, 0x06, 0x05, 0x05, 0x1D, 0x06, 0x07, 0x04,
+  0x1C, 0x07, 0x07, 0x05, 0x1B, 0x07, 0x07, 0x05, 0x1B, 0x07, 0x07, 0x05,
+  0x1B, 0x08, 0x06, 0x05, 0x1B, 0x09, 0x05, 0x05, 0x1B, 0x0A, 0x03, 0x05,
+  0x1D, 0x0A, 0x02, 0x04, 0x1E, 0x0F, 0x20, 0x0D, 0x22, 0x0C, 0x24, 0x0B,
+  0x24, 0x0B, 0x22, 0x0D, 0x1F, 0x04, 0x02, 0x0A, 0x1C, 0x05, 0x04, 0x09,
+  0x1B, 0x05, 0x06, 0x09, 0x1A, 0x04, 0x08, 0x08, 0x19, 0x05, 0x08, 0x08,
+  0x19, 0x05, 0x09, 0x07, 0x19, 0x05, 0x09, 0x07, 0x19, 0x05, 0x09, 0x07,
+  0x19, 0x05, 0x09, 0x06, 0x1B, 0x05, 0x08, 0x06, 0x1B, 0x05, 0x07, 0x06,
+  0x1D, 0x06, 0x04, 0x06, 0x20, 0x0D, 0x23, 0x08, 0x42, 0x06, 0x26, 0x0A,
+  0x22, 0x05, 0x03, 0x06, 0x1F, 0x06, 0x04, 0x06, 0x1E, 0x05, 0x06, 0x06,
+  0x1C, 0x06, 0x06, 0x06, 0x1C, 0x06, 0x06, 0x07, 0x1A, 0x07, 0x07, 0x06,
+  0x1A, 0x07, 0x07, 0x06, 0x1A, 0x07, 0x07, 0x07, 0x19, 0x07, 0x07, 0x07,
+  0x19, 0x07, 0x07, 0x07, 0x19, 0x07, 0x07, 0x07, 0x19, 0x07, 0x07, 0x07,
+  0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1B, 0x07, 0x05, 0x07,
+  0x1B, 0x08, 0x03, 0x07, 0x1E, 0x10, 0x20, 0x06, 0x02, 0x06, 0x27, 0x06,
+  0x28, 0x06, 0x27, 0x06, 0x28, 0x06, 0x27, 0x06, 0x28, 0x05, 0x28, 0x05,
+  0x27, 0x06, 0x27, 0x05, 0x27, 0x06, 0x25, 0x06, 0x26, 0x05, 0xFF, 0x00,
+  0xFF, 0x00, 0x12, 0x04, 0x29, 0x06, 0x27, 0x08, 0x26, 0x08, 0x26, 0x08,
+  0x26, 0x08, 0x27, 0x06, 0x29, 0x04, 0xFF, 0x00, 0x6D, 0x04, 0x29, 0x06,
+  0x27, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x27, 0x06, 0x29, 0x04,
+  0xFF, 0x00, 0xFF, 0x00, 0x12, 0x04, 0x29, 0x06, 0x27, 0x08, 0x26, 0x08,
+  0x26, 0x08, 0x26, 0x08, 0x27, 0x06, 0x29, 0x04, 0xFF, 0x00, 0x3E, 0x04,
+  0x29, 0x06, 0x27, 0x08, 0x26, 0x09, 0x25, 0x09, 0x25, 0x09, 0x26, 0x08,
+  0x27, 0x07, 0x2B, 0x03, 0x2B, 0x02, 0x2C, 0x02, 0x2B, 0x02, 0x2B, 0x03,
+  0x2B, 0x02, 0x2A, 0x02, 0x2B, 0x01, 0xFF, 0x00, 0x38, 0x01, 0x2B, 0x03,
+  0x28, 0x06, 0x26, 0x07, 0x25, 0x07, 0x24, 0x08, 0x24, 0x08, 0x24, 0x07,
+  0x25, 0x07, 0x24, 0x08, 0x24, 0x07, 0x26, 0x06, 0x29, 0x07, 0x29, 0x08,
+  0x29, 0x07, 0x29, 0x07, 0x29, 0x07, 0x29, 0x08, 0x29, 0x07, 0x29, 0x07,
+  0x29, 0x06, 0x2B, 0x03, 0x2D, 0x01, 0xFF, 0x00, 0xFF, 0x00, 0x35, 0x19,
+  0x15, 0x19, 0x15, 0x19, 0xFB, 0x19, 0x15, 0x19, 0x15, 0x19, 0xFF, 0x00,
+  0x20, 0x01, 0x2D, 0x03, 0x2B, 0x06, 0x29, 0x07, 0x29, 0x07, 0x29, 0x08,
+  0x28, 0x08, 0x29, 0x07, 0x29, 0x07, 0x29, 0x08, 0x29, 0x07, 0x29, 0x06,
+  0x26, 0x07, 0x24, 0x08, 0x24, 0x07, 0x25, 0x07, 0x24, 0x08, 0x24, 0x08,
+  0x24, 0x07, 0x25, 0x07, 0x26, 0x06, 0x28, 0x03, 0x2B, 0x01, 0x14, 0x08,
+  0x24, 0x0C, 0x21, 0x05, 0x02, 0x07, 0x1F, 0x05, 0x03, 0x08, 0x1E, 0x05,
+  0x04, 0x07, 0x1D, 0x06, 0x04, 0x08, 0x1C, 0x06, 0x04, 0x08, 0x1C, 0x07,
+  0x03, 0x08, 0x1C, 0x07, 0x03, 0x08, 0x1C, 0x07, 0x03, 0x08, 0x1D, 0x06,
+  0x03, 0x07, 0x1F, 0x04, 0x04, 0x07, 0x26, 0x07, 0x27, 0x06, 0x28, 0x05,
+  0x28, 0x04, 0x2A, 0x03, 0x2A, 0x03, 0x2B, 0x02, 0x2C, 0x01, 0x2D, 0x01,
+  0x2D, 0x01, 0xE4, 0x04, 0x29, 0x06, 0x27, 0x08, 0x26, 0x08, 0x26, 0x08,
+  0x26, 0x08, 0x27, 0x06, 0x29, 0x04, 0x16, 0x0A, 0x20, 0x11, 0x1B, 0x06,
+  0x09, 0x06, 0x17, 0x05, 0x0F, 0x04, 0x15, 0x04, 0x13, 0x03, 0x12, 0x04,
+  0x16, 0x03, 0x10, 0x04, 0x18, 0x03, 0x0E, 0x04, 0x1A, 0x03, 0x0D, 0x03,
+  0x1C, 0x02, 0x0C, 0x03, 0x1D, 0x03, 0x0A, 0x03, 0x1F, 0x02, 0x0A, 0x02,
+  0x0E, 0x05, 0x0D, 0x02, 0x09, 0x03, 0x0D, 0x0D, 0x07, 0x02, 0x08, 0x02,
+  0x0C, 0x05, 0x02, 0x08, 0x07, 0x02, 0x07, 0x03, 0x0B, 0x05, 0x04, 0x06,
+  0x08, 0x02, 0x07, 0x02, 0x0B, 0x06, 0x04, 0x06, 0x08, 0x02, 0x07, 0x02,
+  0x0A, 0x06, 0x05, 0x06, 0x08, 0x02, 0x06, 0x03, 0x0A, 0x06, 0x05, 0x05,
+  0x09, 0x02, 0x06, 0x03, 0x09, 0x06, 0x06, 0x05, 0x09, 0x02, 0x06, 0x02,
+  0x09, 0x07, 0x06, 0x05, 0x09, 0x02, 0x06, 0x02, 0x09, 0x06, 0x06, 0x05,
+  0x0A, 0x02, 0x06, 0x02, 0x08, 0x07, 0x06, 0x05, 0x09, 0x02, 0x07, 0x02,
+  0x08, 0x07, 0x06, 0x05, 0x09, 0x02, 0x07, 0x02, 0x08, 0x06, 0x06, 0x05,
+  0x0A, 0x02, 0x07, 0x02, 0x07, 0x07, 0x06, 0x05, 0x09, 0x02, 0x08, 0x02,
+  0x07, 0x07, 0x05, 0x06, 0x08, 0x03, 0x08, 0x02, 0x07, 0x07, 0x05, 0x06,
+  0x08, 0x02, 0x0A, 0x01, 0x07, 0x07, 0x04, 0x06, 0x08, 0x02, 0x0B, 0x02,
+  0x06, 0x08, 0x02, 0x01, 0x01, 0x05, 0x07, 0x03, 0x0B, 0x02, 0x06, 0x0B,
+  0x01, 0x05, 0x06, 0x03, 0x05, 0x02, 0x05, 0x02, 0x06, 0x0A, 0x02, 0x06,
+  0x03, 0x03, 0x07, 0x01, 0x07, 0x02, 0x06, 0x08, 0x04, 0x0A, 0x07, 0x02,
+  0x07, 0x02, 0x07, 0x05, 0x07, 0x06, 0x0A, 0x01, 0x09, 0x02, 0x21, 0x02,
+  0x0A, 0x01, 0x20, 0x02, 0x0B, 0x02, 0x1E, 0x02, 0x0D, 0x02, 0x1C, 0x02,
+  0x0F, 0x02, 0x1A, 0x02, 0x11, 0x02, 0x18, 0x02, 0x14, 0x02, 0x14, 0x03,
+  0x16, 0x03, 0x10, 0x03, 0x1B, 0x03, 0x0A, 0x04, 0x20, 0x0A, 0x18, 0x01,
+  0x2C, 0x03, 0x2B, 0x03, 0x2A, 0x05, 0x29, 0x05, 0x29, 0x05, 0x28, 0x07,
+  0x27, 0x07, 0x26, 0x09, 0x25, 0x09, 0x24, 0x0B, 0x23, 0x0B, 0x22, 0x02,
+  0x02, 0x08, 0x22, 0x02, 0x02, 0x09, 0x21, 0x01, 0x04, 0x08, 0x20, 0x02,
+  0x04, 0x09, 0x1F, 0x02, 0x04, 0x09, 0x1E, 0x02, 0x06, 0x09, 0x1D, 0x02,
+  0x06, 0x09, 0x1C, 0x02, 0x08, 0x08, 0x1C, 0x02, 0x08, 0x09, 0x1A, 0x14,
+  0x1A, 0x15, 0x18, 0x02, 0x0B, 0x09, 0x18, 0x02, 0x0C, 0x08, 0x18, 0x02,
+  0x0C, 0x09, 0x16, 0x02, 0x0E, 0x08, 0x16, 0x02, 0x0E, 0x09, 0x14, 0x03,
+  0x0F, 0x08, 0x14, 0x03, 0x0F, 0x09, 0x12, 0x04, 0x0F, 0x09, 0x11, 0x06,
+  0x0D, 0x0B, 0x0E, 0x0B, 0x07, 0x10, 0x38, 0x16, 0x1B, 0x15, 0x1A, 0x08,
+  0x04, 0x0A, 0x18, 0x08, 0x06, 0x08, 0x18, 0x08, 0x07, 0x08, 0x17, 0x08,
+  0x08, 0x08, 0x16, 0x08, 0x08, 0x08, 0x16, 0x08, 0x08, 0x08, 0x16, 0x08,
+  0x08, 0x08, 0x16, 0x08, 0x08, 0x08, 0x16, 0x08, 0x08, 0x07, 0x17, 0x08,
+  0x07, 0x08, 0x17, 0x08, 0x06, 0x08, 0x18, 0x08, 0x04, 0x08, 0x1A, 0x11,
+  0x1D, 0x13, 0x1B, 0x08, 0x04, 0x09, 0x19, 0x08, 0x06, 0x09, 0x17, 0x08,
+  0x07, 0x09, 0x16, 0x08, 0x08, 0x08, 0x16, 0x08, 0x08, 0x09, 0x15, 0x08,
+  0x08, 0x09, 0x15, 0x08, 0x08, 0x09, 0x15, 0x08, 0x08, 0x09, 0x15, 0x08,
+  0x08, 0x09, 0x15, 0x08, 0x08, 0x09, 0x15, 0x08, 0x07, 0x09, 0x16, 0x08,
+  0x07, 0x09, 0x16, 0x08, 0x06, 0x09, 0x17, 0x09, 0x04, 0x09, 0x17, 0x15,
+  0x16, 0x15, 0x17, 0x08, 0x08, 0x01, 0x1A, 0x0F, 0x03, 0x02, 0x18, 0x08,
+  0x06, 0x08, 0x16, 0x08, 0x0A, 0x06, 0x15, 0x07, 0x0D, 0x05, 0x14, 0x07,
+  0x0F, 0x04, 0x13, 0x07, 0x11, 0x03, 0x12, 0x08, 0x12, 0x02, 0x12, 0x07,
+  0x13, 0x02, 0x11, 0x08, 0x14, 0x01, 0x11, 0x08, 0x14, 0x01, 0x10, 0x09,
+  0x25, 0x08, 0x25, 0x09, 0x25, 0x09, 0x25, 0x09, 0x25, 0x09, 0x25, 0x09,
+  0x25, 0x09, 0x25, 0x09, 0x25, 0x09, 0x25, 0x09, 0x26, 0x09, 0x25, 0x09,
+  0x25, 0x09, 0x26, 0x08, 0x27, 0x08, 0x26, 0x08, 0x12, 0x01, 0x14, 0x08,
+  0x10, 0x02, 0x15, 0x08, 0x0E, 0x02, 0x17, 0x08, 0x0B, 0x03, 0x1A, 0x08,
+  0x07, 0x04, 0x1D, 0x0F, 0x22, 0x09, 0x36, 0x14, 0x1D, 0x14, 0x1B, 0x08,
+  0x05, 0x08, 0x19, 0x08, 0x07, 0x08, 0x17, 0x08, 0x08, 0x08, 0x16, 0x08,
+  0x09, 0x08, 0x15, 0x08, 0x09, 0x08, 0x15, 0x08, 0x0A, 0x08, 0x14, 0x08,
+  0x0A, 0x08, 0x14, 0x08, 0x0A, 0x09, 0x13, 0x08, 0x0A, 0x09, 0x13, 0x08,
+  0x0B, 0x08, 0x13, 0x08, 0x0B, 0x09, 0x12, 0x08, 0x0B, 0x09, 0x12, 0x08,
+  0x0B, 0x09, 0x12, 0x08, 0x0B, 0x09, 0x12, 0x08, 0x0B, 0x09, 0x12, 0x08,
+  0x0B, 0x09, 0x12, 0x08, 0x0B, 0x09, 0x12, 0x08, 0x0B, 0x09, 0x12, 0x08,
+  0x0B, 0x08, 0x13, 0x08, 0x0B, 0x08, 0x13, 0x08, 0x0A, 0x09, 0x13, 0x08,
+  0x0A, 0x08, 0x14, 0x08, 0x0A, 0x08, 0x14, 0x08, 0x09, 0x08, 0x15, 0x08,
+  0x09, 0x08, 0x15, 0x08, 0x08, 0x08, 0x16, 0x08, 0x07, 0x08, 0x17, 0x09,
+  0x04, 0x08, 0x18, 0x14, 0x17, 0x14, 0x38, 0x1A, 0x17, 0x17, 0x18, 0x08,
+  0x08, 0x06, 0x18, 0x08, 0x0A, 0x04, 0x18, 0x08, 0x0B, 0x03, 0x18, 0x08,
+  0x0C, 0x02, 0x18, 0x08, 0x0C, 0x02, 0x18, 0x08, 0x06, 0x01, 0x05, 0x02,
+  0x18, 0x08, 0x06, 0x01, 0x06, 0x01, 0x18, 0x08, 0x06, 0x01, 0x06, 0x01,
+  0x18, 0x08, 0x05, 0x02, 0x1F, 0x08, 0x05, 0x02, 0x1F, 0x08, 0x05, 0x02,
+  0x1F, 0x08, 0x04, 0x03, 0x1F, 0x08, 0x03, 0x04, 0x1F, 0x0F, 0x1F, 0x0F,
+  0x1F, 0x08, 0x03, 0x04, 0x1F, 0x08, 0x04, 0x03, 0x1F, 0x08, 0x05, 0x02,
+  0x1F, 0x08, 0x05, 0x02, 0x1F, 0x08, 0x05, 0x02, 0x1F, 0x08, 0x06, 0x01,
+  0x08, 0x01, 0x16, 0x08, 0x06, 0x01, 0x08, 0x01, 0x16, 0x08, 0x06, 0x01,
+  0x07, 0x02, 0x16, 0x08, 0x0E, 0x02, 0x16, 0x08, 0x0D, 0x02, 0x17, 0x08,
+  0x0C, 0x03, 0x17, 0x08, 0x0B, 0x04, 0x17, 0x09, 0x08, 0x06, 0x16, 0x18,
+  0x13, 0x1B, 0x39, 0x1A, 0x17, 0x17, 0x18, 0x08, 0x08, 0x06, 0x18, 0x08,
+  0x0A, 0x04, 0x18, 0x08, 0x0B, 0x03, 0x18, 0x08, 0x0C, 0x02, 0x18, 0x08,
+  0x0C, 0x02, 0x18, 0x08, 0x07, 0x01, 0x05, 0x01, 0x18, 0x08, 0x07, 0x01,
+  0x05, 0x01, 0x18, 0x08, 0x07, 0x01, 0x05, 0x01, 0x18, 0x08, 0x06, 0x02,
+  0x1E, 0x08, 0x06, 0x02, 0x1E, 0x08, 0x05, 0x03, 0x1E, 0x08, 0x05, 0x03,
+  0x1E, 0x08, 0x03, 0x05, 0x1E, 0x10, 0x1E, 0x10, 0x1E, 0x08, 0x03, 0x05,
+  0x1E, 0x08, 0x04, 0x04, 0x1E, 0x08, 0x05, 0x03, 0x1E, 0x08, 0x06, 0x02,
+  0x1E, 0x08, 0x06, 0x02, 0x1E, 0x08, 0x07, 0x01, 0x1E, 0x08, 0x07, 0x01,
+  0x1E, 0x08, 0x07, 0x01, 0x1E, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08,
+  0x26, 0x08, 0x25, 0x0A, 0x21, 0x10, 0x14, 0x09, 0x07, 0x01, 0x1A, 0x0F,
+  0x03, 0x02, 0x18, 0x07, 0x06, 0x09, 0x17, 0x07, 0x0A, 0x06, 0x15, 0x08,
+  0x0C, 0x05, 0x14, 0x08, 0x0E, 0x04, 0x14, 0x07, 0x10, 0x03, 0x13, 0x08,
+  0x10, 0x03, 0x12, 0x08, 0x12, 0x02, 0x12, 0x08, 0x12, 0x02, 0x11, 0x09,
+  0x13, 0x01, 0x11, 0x09, 0x25, 0x08, 0x25, 0x09, 0x25, 0x09, 0x25, 0x09,
+  0x25, 0x09, 0x25, 0x09, 0x25, 0x09, 0x25, 0x09, 0x25, 0x09, 0x09, 0x10,
+  0x0C, 0x09, 0x0C, 0x0A, 0x10, 0x08, 0x0D, 0x08, 0x11, 0x09, 0x0C, 0x08,
+  0x11, 0x09, 0x0C, 0x08, 0x12, 0x08, 0x0C, 0x08, 0x13, 0x07, 0x0C, 0x08,
+  0x13, 0x08, 0x0B, 0x08, 0x14, 0x07, 0x0B, 0x08, 0x15, 0x07, 0x0A, 0x08,
+  0x16, 0x07, 0x09, 0x08, 0x18, 0x07, 0x06, 0x08, 0x1B, 0x11, 0x1F, 0x0B,
+  0x34, 0x10, 0x03, 0x10, 0x0E, 0x0A, 0x09, 0x0A, 0x12, 0x08, 0x0B, 0x08,
+  0x13, 0x08, 0x0B, 0x08, 0x13, 0x08, 0x0B, 0x08, 0x13, 0x08, 0x0B, 0x08,
+  0x13, 0x08, 0x0B, 0x08, 0x13, 0x08, 0x0B, 0x08, 0x13, 0x08, 0x0B, 0x08,
+  0x13, 0x08, 0x0B, 0x08, 0x13, 0x08, 0x0B, 0x08, 0x13, 0x08, 0x0B, 0x08,
+  0x13, 0x08, 0x0B, 0x08, 0x13, 0x08, 0x0B, 0x08, 0x13, 0x08, 0x0B, 0x08,
+  0x13, 0x1B, 0x13, 0x1B, 0x13, 0x08, 0x0B, 0x08, 0x13, 0x08, 0x0B, 0x08,
+  0x13, 0x08, 0x0B, 0x08, 0x13, 0x08, 0x0B, 0x08, 0x13, 0x08, 0x0B, 0x08,
+  0x13, 0x08, 0x0B, 0x08, 0x13, 0x08, 0x0B, 0x08, 0x13, 0x08, 0x0B, 0x08,
+  0x13, 0x08, 0x0B, 0x08, 0x13, 0x08, 0x0B, 0x08, 0x13, 0x08, 0x0B, 0x08,
+  0x13, 0x08, 0x0B, 0x08, 0x13, 0x08, 0x0B, 0x08, 0x12, 0x0A, 0x09, 0x0A,
+  0x0E, 0x10, 0x03, 0x10, 0x3E, 0x10, 0x21, 0x0A, 0x25, 0x08, 0x26, 0x08,
+  0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08,
+  0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08,
+  0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08,
+  0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08,
+  0x26, 0x08, 0x26, 0x08, 0x25, 0x0A, 0x21, 0x10, 0x41, 0x11, 0x21, 0x0A,
+  0x25, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08,
+  0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08,
+  0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08,
+  0x26, 0x08, 0x26, 0x08, 0x1D, 0x03, 0x06, 0x08, 0x1C, 0x05, 0x05, 0x08,
+  0x1B, 0x07, 0x04, 0x08, 0x1B, 0x07, 0x04, 0x08, 0x1B, 0x07, 0x04, 0x08,
+  0x1B, 0x06, 0x05, 0x07, 0x1D, 0x04, 0x06, 0x07, 0x1D, 0x04, 0x05, 0x07,
+  0x1F, 0x04, 0x04, 0x06, 0x21, 0x0C, 0x25, 0x07, 0x35, 0x10, 0x07, 0x0C,
+  0x0E, 0x0A, 0x0D, 0x07, 0x11, 0x08, 0x0E, 0x05, 0x13, 0x08, 0x0E, 0x04,
+  0x14, 0x08, 0x0E, 0x02, 0x16, 0x08, 0x0D, 0x02, 0x17, 0x08, 0x0B, 0x03,
+  0x18, 0x08, 0x0A, 0x03, 0x19, 0x08, 0x09, 0x02, 0x1B, 0x08, 0x08, 0x02,
+  0x1C, 0x08, 0x06, 0x03, 0x1D, 0x08, 0x05, 0x03, 0x1E, 0x08, 0x04, 0x04,
+  0x1E, 0x08, 0x03, 0x05, 0x1E, 0x08, 0x02, 0x07, 0x1D, 0x12, 0x1C, 0x13,
+  0x1B, 0x08, 0x02, 0x0A, 0x1A, 0x08, 0x02, 0x0A, 0x1A, 0x08, 0x03, 0x0A,
+  0x19, 0x08, 0x04, 0x0A, 0x18, 0x08, 0x05, 0x0A, 0x17, 0x08, 0x06, 0x0A,
+  0x16, 0x08, 0x06, 0x0A, 0x16, 0x08, 0x07, 0x0A, 0x15, 0x08, 0x08, 0x0A,
+  0x14, 0x08, 0x09, 0x0A, 0x13, 0x08, 0x0A, 0x09, 0x13, 0x08, 0x0A, 0x0A,
+  0x12, 0x08, 0x0B, 0x0A, 0x10, 0x0A, 0x09, 0x0D, 0x0B, 0x10, 0x04, 0x11,
+  0x38, 0x10, 0x21, 0x0A, 0x25, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08,
+  0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08,
+  0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08,
+  0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x10, 0x01, 0x15, 0x08,
+  0x10, 0x01, 0x15, 0x08, 0x0F, 0x02, 0x15, 0x08, 0x0F, 0x02, 0x15, 0x08,
+  0x0E, 0x03, 0x15, 0x08, 0x0E, 0x03, 0x15, 0x08, 0x0D, 0x03, 0x16, 0x08,
+  0x0C, 0x04, 0x16, 0x09, 0x09, 0x06, 0x15, 0x19, 0x12, 0x1C, 0x31, 0x0D,
+  0x11, 0x0D, 0x06, 0x0B, 0x10, 0x0A, 0x0A, 0x0A, 0x0F, 0x0A, 0x0B, 0x0B,
+  0x0E, 0x0A, 0x0B, 0x0B, 0x0D, 0x0B, 0x0B, 0x0C, 0x0C, 0x02, 0x01, 0x08,
+  0x0B, 0x02, 0x01, 0x09, 0x0C, 0x02, 0x01, 0x08, 0x0B, 0x02, 0x01, 0x0A,
+  0x0A, 0x02, 0x02, 0x08, 0x0B, 0x02, 0x02, 0x09, 0x0A, 0x02, 0x02, 0x08,
+  0x0B, 0x02, 0x02, 0x09, 0x09, 0x03, 0x02, 0x08, 0x0B, 0x02, 0x03, 0x09,
+  0x08, 0x02, 0x03, 0x08, 0x0B, 0x02, 0x03, 0x09, 0x08, 0x02, 0x03, 0x08,
+  0x0B, 0x02, 0x04, 0x09, 0x06, 0x02, 0x04, 0x08, 0x0B, 0x02, 0x04, 0x09,
+  0x06, 0x02, 0x04, 0x08, 0x0B, 0x02, 0x05, 0x09, 0x05, 0x02, 0x04, 0x08,
+  0x0B, 0x02, 0x05, 0x09, 0x04, 0x02, 0x05, 0x08, 0x0B, 0x02, 0x06, 0x09,
+  0x03, 0x02, 0x05, 0x08, 0x0B, 0x02, 0x06, 0x09, 0x02, 0x02, 0x06, 0x08,
+  0x0B, 0x02, 0x06, 0x09, 0x02, 0x02, 0x06, 0x08, 0x0B, 0x02, 0x07, 0x09,
+  0x01, 0x02, 0x06, 0x08, 0x0B, 0x02, 0x07, 0x0B, 0x07, 0x08, 0x0B, 0x02,
+  0x08, 0x0A, 0x07, 0x08, 0x0B, 0x02, 0x08, 0x0A, 0x07, 0x08, 0x0B, 0x02,
+  0x09, 0x08, 0x08, 0x08, 0x0B, 0x02, 0x09, 0x08, 0x08, 0x08, 0x0B, 0x02,
+  0x0A, 0x06, 0x09, 0x08, 0x0B, 0x02, 0x0A, 0x06, 0x09, 0x08, 0x0B, 0x02,
+  0x0B, 0x05, 0x09, 0x08, 0x0B, 0x02, 0x0B, 0x04, 0x0A, 0x08, 0x0B, 0x02,
+  0x0C, 0x03, 0x0A, 0x08, 0x0A, 0x04, 0x0B, 0x02, 0x0A, 0x0A, 0x06, 0x0A,
+  0x09, 0x01, 0x07, 0x10, 0x35, 0x0C, 0x0C, 0x0A, 0x0F, 0x0A, 0x0E, 0x04,
+  0x13, 0x0A, 0x0E, 0x02, 0x15, 0x0A, 0x0D, 0x02, 0x15, 0x0B, 0x0C, 0x02,
+  0x15, 0x0C, 0x0B, 0x02, 0x15, 0x0C, 0x0B, 0x02, 0x15, 0x02, 0x01, 0x0A,
+  0x0A, 0x02, 0x15, 0x02, 0x02, 0x0A, 0x09, 0x02, 0x15, 0x02, 0x03, 0x0A,
+  0x08, 0x02, 0x15, 0x02, 0x04, 0x0A, 0x07, 0x02, 0x15, 0x02, 0x04, 0x0A,
+  0x07, 0x02, 0x15, 0x02, 0x05, 0x0A, 0x06, 0x02, 0x15, 0x02, 0x06, 0x0A,
+  0x05, 0x02, 0x15, 0x02, 0x07, 0x0A, 0x04, 0x02, 0x15, 0x02, 0x08, 0x0A,
+  0x03, 0x02, 0x15, 0x02, 0x09, 0x0A, 0x02, 0x02, 0x15, 0x02, 0x09, 0x0A,
+  0x02, 0x02, 0x15, 0x02, 0x0A, 0x0A, 0x01, 0x02, 0x15, 0x02, 0x0B, 0x0C,
+  0x15, 0x02, 0x0C, 0x0B, 0x15, 0x02, 0x0D, 0x0A, 0x15, 0x02, 0x0D, 0x0A,
+  0x15, 0x02, 0x0E, 0x09, 0x15, 0x02, 0x0F, 0x08, 0x15, 0x02, 0x10, 0x07,
+  0x15, 0x02, 0x11, 0x06, 0x15, 0x02, 0x12, 0x05, 0x15, 0x02, 0x12, 0x05,
+  0x15, 0x02, 0x13, 0x04, 0x14, 0x05, 0x12, 0x03, 0x11, 0x0A, 0x11, 0x02,
+  0x2D, 0x01, 0x12, 0x0A, 0x22, 0x0F, 0x1D, 0x07, 0x05, 0x07, 0x1A, 0x07,
+  0x08, 0x06, 0x18, 0x07, 0x09, 0x07, 0x16, 0x07, 0x0B, 0x07, 0x14, 0x08,
+  0x0B, 0x08, 0x12, 0x08, 0x0D, 0x08, 0x11, 0x08, 0x0D, 0x08, 0x10, 0x09,
+  0x0D, 0x09, 0x0F, 0x08, 0x0F, 0x08, 0x0F, 0x08, 0x0F, 0x08, 0x0E, 0x09,
+  0x0F, 0x09, 0x0D, 0x09, 0x0F, 0x09, 0x0D, 0x09, 0x0F, 0x09, 0x0D, 0x09,
+  0x0F, 0x09, 0x0D, 0x09, 0x0F, 0x09, 0x0D, 0x09, 0x0F, 0x09, 0x0D, 0x09,
+  0x0F, 0x09, 0x0D, 0x09, 0x0F, 0x09, 0x0D, 0x09, 0x0F, 0x09, 0x0E, 0x08,
+  0x0F, 0x08, 0x0F, 0x08, 0x0F, 0x08, 0x0F, 0x08, 0x0F, 0x08, 0x10, 0x08,
+  0x0D, 0x08, 0x11, 0x08, 0x0D, 0x08, 0x12, 0x07, 0x0D, 0x07, 0x13, 0x08,
+  0x0B, 0x08, 0x14, 0x07, 0x0B, 0x07, 0x16, 0x07, 0x09, 0x07, 0x18, 0x07,
+  0x07, 0x07, 0x1A, 0x07, 0x05, 0x07, 0x1D, 0x0F, 0x22, 0x09, 0x38, 0x13,
+  0x1E, 0x13, 0x1C, 0x08, 0x04, 0x08, 0x1A, 0x08, 0x05, 0x08, 0x19, 0x08,
+  0x06, 0x08, 0x18, 0x08, 0x07, 0x07, 0x18, 0x08, 0x07, 0x08, 0x17, 0x08,
+  0x07, 0x08, 0x17, 0x08, 0x07, 0x08, 0x17, 0x08, 0x07, 0x08, 0x17, 0x08,
+  0x07, 0x08, 0x17, 0x08, 0x07, 0x08, 0x17, 0x08, 0x06, 0x08, 0x18, 0x08,
+  0x06, 0x08, 0x18, 0x08, 0x05, 0x08, 0x19, 0x08, 0x04, 0x08, 0x1A, 0x12,
+  0x1C, 0x0F, 0x1F, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08,
+  0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08,
+  0x26, 0x08, 0x25, 0x0A, 0x21, 0x10, 0x13, 0x0A, 0x22, 0x0F, 0x1D, 0x07,
+  0x05, 0x06, 0x1A, 0x07, 0x08, 0x07, 0x17, 0x07, 0x0A, 0x07, 0x15, 0x07,
+  0x0C, 0x07, 0x13, 0x08, 0x0C, 0x08, 0x12, 0x07, 0x0E, 0x07, 0x11, 0x08,
+  0x0E, 0x08, 0x0F, 0x09, 0x0E, 0x09, 0x0E, 0x09, 0x0F, 0x08, 0x0E, 0x08,
+  0x10, 0x08, 0x0D, 0x09, 0x10, 0x09, 0x0C, 0x09, 0x10, 0x09, 0x0C, 0x09,
+  0x10, 0x09, 0x0C, 0x09, 0x10, 0x09, 0x0C, 0x09, 0x10, 0x09, 0x0C, 0x09,
+  0x10, 0x09, 0x0C, 0x09, 0x10, 0x09, 0x0C, 0x09, 0x10, 0x09, 0x0C, 0x09,
+  0x10, 0x09, 0x0D, 0x08, 0x10, 0x08, 0x0E, 0x08, 0x10, 0x08, 0x0E, 0x09,
+  0x0F, 0x08, 0x0F, 0x08, 0x0E, 0x08, 0x10, 0x08, 0x0E, 0x08, 0x11, 0x07,
+  0x0E, 0x07, 0x13, 0x07, 0x0C, 0x07, 0x15, 0x06, 0x0C, 0x06, 0x17, 0x06,
+  0x0A, 0x06, 0x19, 0x06, 0x08, 0x06, 0x1C, 0x05, 0x06, 0x05, 0x20, 0x0C,
+  0x24, 0x08, 0x27, 0x08, 0x27, 0x07, 0x27, 0x08, 0x27, 0x08, 0x27, 0x09,
+  0x27, 0x0D, 0x24, 0x0A, 0x36, 0x16, 0x1B, 0x16, 0x19, 0x08, 0x06, 0x08,
+  0x18, 0x08, 0x07, 0x08, 0x17, 0x08, 0x08, 0x08, 0x16, 0x08, 0x09, 0x08,
+  0x15, 0x08, 0x09, 0x08, 0x15, 0x08, 0x09, 0x08, 0x15, 0x08, 0x09, 0x08,
+  0x15, 0x08, 0x09, 0x08, 0x15, 0x08, 0x09, 0x08, 0x15, 0x08, 0x09, 0x07,
+  0x16, 0x08, 0x08, 0x08, 0x16, 0x08, 0x07, 0x08, 0x17, 0x08, 0x06, 0x07,
+  0x19, 0x13, 0x1B, 0x13, 0x1B, 0x08, 0x02, 0x0A, 0x1A, 0x08, 0x03, 0x09,
+  0x1A, 0x08, 0x04, 0x09, 0x19, 0x08, 0x04, 0x0A, 0x18, 0x08, 0x05, 0x09,
+  0x18, 0x08, 0x06, 0x09, 0x17, 0x08, 0x06, 0x0A, 0x16, 0x08, 0x07, 0x09,
+  0x16, 0x08, 0x07, 0x0A, 0x15, 0x08, 0x08, 0x0A, 0x14, 0x08, 0x09, 0x09,
+  0x14, 0x08, 0x09, 0x0A, 0x13, 0x08, 0x0A, 0x09, 0x12, 0x0A, 0x0A, 0x09,
+  0x0E, 0x10, 0x07, 0x0B, 0x13, 0x07, 0x06, 0x01, 0x1D, 0x0D, 0x02, 0x02,
+  0x1C, 0x05, 0x05, 0x08, 0x1B, 0x04, 0x09, 0x06, 0x1A, 0x04, 0x0C, 0x04,
+  0x1A, 0x04, 0x0D, 0x03, 0x19, 0x05, 0x0D, 0x03, 0x19, 0x05, 0x0E, 0x02,
+  0x19, 0x06, 0x0D, 0x02, 0x19, 0x07, 0x0D, 0x01, 0x19, 0x08, 0x0C, 0x01,
+  0x19, 0x0A, 0x25, 0x0B, 0x23, 0x0D, 0x22, 0x0E, 0x20, 0x10, 0x20, 0x10,
+  0x1F, 0x10, 0x1F, 0x0F, 0x21, 0x0E, 0x23, 0x0B, 0x25, 0x0A, 0x17, 0x01,
+  0x0E, 0x08, 0x17, 0x01, 0x0F, 0x07, 0x17, 0x02, 0x0F, 0x06, 0x17, 0x02,
+  0x10, 0x05, 0x17, 0x03, 0x0F, 0x05, 0x17, 0x03, 0x0F, 0x04, 0x18, 0x04,
+  0x0E, 0x04, 0x18, 0x05, 0x0C, 0x04, 0x19, 0x07, 0x09, 0x04, 0x1A, 0x09,
+  0x06, 0x04, 0x1B, 0x02, 0x03, 0x0D, 0x1C, 0x01, 0x07, 0x07, 0x37, 0x1E,
+  0x10, 0x1E, 0x10, 0x05, 0x06, 0x08, 0x06, 0x05, 0x10, 0x03, 0x08, 0x08,
+  0x08, 0x03, 0x10, 0x03, 0x08, 0x08, 0x08, 0x03, 0x10, 0x02, 0x09, 0x08,
+  0x09, 0x02, 0x10, 0x02, 0x09, 0x08, 0x09, 0x02, 0x10, 0x01, 0x0A, 0x08,
+  0x0A, 0x01, 0x10, 0x01, 0x0A, 0x08, 0x0A, 0x01, 0x1B, 0x08, 0x26, 0x08,
+  0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08,
+  0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08,
+  0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08,
+  0x26, 0x08, 0x25, 0x0A, 0x21, 0x10, 0x36, 0x10, 0x07, 0x0A, 0x10, 0x0A,
+  0x0D, 0x04, 0x14, 0x08, 0x0F, 0x02, 0x15, 0x08, 0x0F, 0x02, 0x15, 0x08,
+  0x0F, 0x02, 0x15, 0x08, 0x0F, 0x02, 0x15, 0x08, 0x0F, 0x02, 0x15, 0x08,
+  0x0F, 0x02, 0x15, 0x08, 0x0F, 0x02, 0x15, 0x08, 0x0F, 0x02, 0x15, 0x08,
+  0x0F, 0x02, 0x15, 0x08, 0x0F, 0x02, 0x15, 0x08, 0x0F, 0x02, 0x15, 0x08,
+  0x0F, 0x02, 0x15, 0x08, 0x0F, 0x02, 0x15, 0x08, 0x0F, 0x02, 0x15, 0x08,
+  0x0F, 0x02, 0x15, 0x08, 0x0F, 0x02, 0x15, 0x08, 0x0F, 0x02, 0x15, 0x08,
+  0x0F, 0x02, 0x15, 0x08, 0x0F, 0x02, 0x15, 0x08, 0x0F, 0x02, 0x15, 0x08,
+  0x0F, 0x02, 0x15, 0x08, 0x0F, 0x02, 0x15, 0x08, 0x0F, 0x02, 0x15, 0x08,
+  0x0E, 0x02, 0x17, 0x07, 0x0E, 0x02, 0x17, 0x08, 0x0C, 0x03, 0x18, 0x07,
+  0x0C, 0x02, 0x1A, 0x07, 0x0A, 0x02, 0x1C, 0x08, 0x06, 0x03, 0x1E, 0x0E,
+  0x23, 0x09, 0x35, 0x10, 0x08, 0x0B, 0x0D, 0x0B, 0x0E, 0x06, 0x10, 0x09,
+  0x10, 0x04, 0x12, 0x09, 0x10, 0x02, 0x13, 0x09, 0x0F, 0x03, 0x14, 0x08,
+  0x0F, 0x02, 0x15, 0x09, 0x0E, 0x02, 0x16, 0x08, 0x0D, 0x02, 0x17, 0x09,
+  0x0C, 0x02, 0x17, 0x09, 0x0B, 0x02, 0x19, 0x08, 0x0B, 0x02, 0x19, 0x09,
+  0x09, 0x03, 0x1A, 0x08, 0x09, 0x02, 0x1B, 0x09, 0x08, 0x02, 0x1B, 0x09,
+  0x07, 0x02, 0x1D, 0x08, 0x07, 0x02, 0x1D, 0x09, 0x05, 0x02, 0x1F, 0x08,
+  0x05, 0x02, 0x1F, 0x09, 0x03, 0x02, 0x21, 0x08, 0x03, 0x02, 0x21, 0x09,
+  0x01, 0x02, 0x22, 0x09, 0x01, 0x02, 0x23, 0x08, 0x01, 0x02, 0x23, 0x0A,
+  0x25, 0x09, 0x25, 0x08, 0x27, 0x07, 0x27, 0x06, 0x28, 0x06, 0x29, 0x04,
+  0x2A, 0x04, 0x2B, 0x03, 0x2B, 0x02, 0x2E, 0x0E, 0x02, 0x10, 0x07, 0x07,
+  0x01, 0x0B, 0x07, 0x0A, 0x0C, 0x04, 0x03, 0x09, 0x09, 0x09, 0x0D, 0x02,
+  0x04, 0x09, 0x09, 0x09, 0x0D, 0x02, 0x05, 0x09, 0x09, 0x08, 0x0D, 0x02,
+  0x05, 0x09, 0x09, 0x09, 0x0B, 0x02, 0x07, 0x08, 0x0A, 0x08, 0x0B, 0x02,
+  0x07, 0x09, 0x09, 0x08, 0x0B, 0x02, 0x08, 0x08, 0x09, 0x09, 0x09, 0x02,
+  0x09, 0x08, 0x0A, 0x08, 0x09, 0x02, 0x09, 0x09, 0x09, 0x09, 0x08, 0x02,
+  0x0A, 0x08, 0x09, 0x09, 0x07, 0x02, 0x0B, 0x09, 0x07, 0x0A, 0x07, 0x02,
+  0x0C, 0x08, 0x07, 0x0B, 0x05, 0x02, 0x0D, 0x08, 0x07, 0x02, 0x01, 0x08,
+  0x05, 0x02, 0x0D, 0x09, 0x05, 0x02, 0x02, 0x08, 0x05, 0x02, 0x0E, 0x08,
+  0x05, 0x02, 0x02, 0x09, 0x03, 0x02, 0x0F, 0x09, 0x03, 0x02, 0x04, 0x08,
+  0x03, 0x02, 0x10, 0x08, 0x03, 0x02, 0x04, 0x08, 0x03, 0x02, 0x10, 0x08,
+  0x03, 0x02, 0x04, 0x09, 0x01, 0x02, 0x11, 0x09, 0x01, 0x02, 0x06, 0x08,
+  0x01, 0x02, 0x12, 0x08, 0x01, 0x02, 0x06, 0x0A, 0x13, 0x0A, 0x08, 0x09,
+  0x14, 0x09, 0x08, 0x09, 0x14, 0x09, 0x08, 0x08, 0x15, 0x08, 0x0A, 0x07,
+  0x16, 0x07, 0x0A, 0x07, 0x16, 0x06, 0x0B, 0x06, 0x18, 0x05, 0x0C, 0x05,
+  0x18, 0x05, 0x0C, 0x04, 0x19, 0x04, 0x0E, 0x03, 0x1A, 0x03, 0x0E, 0x03,
+  0x1A, 0x02, 0x0F, 0x02, 0x36, 0x10, 0x04, 0x0C, 0x0F, 0x0C, 0x0A, 0x06,
+  0x14, 0x09, 0x0C, 0x04, 0x15, 0x0A, 0x0B, 0x03, 0x17, 0x09, 0x0A, 0x03,
+  0x19, 0x09, 0x09, 0x02, 0x1A, 0x0A, 0x07, 0x02, 0x1C, 0x09, 0x06, 0x02,
+  0x1E, 0x09, 0x05, 0x02, 0x1E, 0x0A, 0x03, 0x02, 0x20, 0x0A, 0x01, 0x02,
+  0x22, 0x0B, 0x23, 0x0A, 0x25, 0x0A, 0x25, 0x09, 0x25, 0x0A, 0x25, 0x0A,
+  0x25, 0x09, 0x24, 0x0B, 0x23, 0x0C, 0x21, 0x02, 0x02, 0x09, 0x20, 0x02,
+  0x04, 0x09, 0x1E, 0x02, 0x05, 0x0A, 0x1C, 0x02, 0x07, 0x09, 0x1B, 0x02,
+  0x09, 0x09, 0x1A, 0x02, 0x09, 0x0A, 0x18, 0x02, 0x0B, 0x09, 0x17, 0x02,
+  0x0D, 0x09, 0x15, 0x03, 0x0D, 0x0A, 0x13, 0x04, 0x0D, 0x0B, 0x10, 0x07,
+  0x0C, 0x0C, 0x0D, 0x0C, 0x07, 0x0F, 0x35, 0x10, 0x08, 0x0A, 0x0F, 0x0A,
+  0x0E, 0x05, 0x12, 0x09, 0x0F, 0x03, 0x13, 0x09, 0x0F, 0x02, 0x15, 0x09,
+  0x0E, 0x02, 0x15, 0x09, 0x0D, 0x02, 0x17, 0x09, 0x0B, 0x02, 0x19, 0x08,
+  0x0B, 0x02, 0x19, 0x09, 0x09, 0x02, 0x1B, 0x08, 0x09, 0x02, 0x1B, 0x09,
+  0x07, 0x02, 0x1D, 0x08, 0x06, 0x02, 0x1E, 0x09, 0x05, 0x02, 0x1F, 0x08,
+  0x04, 0x02, 0x20, 0x09, 0x03, 0x02, 0x21, 0x08, 0x02, 0x02, 0x22, 0x0B,
+  0x24, 0x0A, 0x24, 0x09, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08,
+  0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08, 0x26, 0x08,
+  0x26, 0x08, 0x25, 0x0A, 0x21, 0x10, 0x3A, 0x19, 0x15, 0x18, 0x16, 0x05,
+  0x09, 0x0A, 0x16, 0x03, 0x0B, 0x09, 0x17, 0x02, 0x0B, 0x09, 0x17, 0x03,
+  0x0A, 0x0A, 0x17, 0x02, 0x0B, 0x09, 0x18, 0x02, 0x0A, 0x0A, 0x18, 0x01,
+  0x0B, 0x09, 0x19, 0x01, 0x0A, 0x0A, 0x23, 0x0A, 0x24, 0x09, 0x24, 0x0A,
+  0x24, 0x09, 0x24, 0x0A, 0x24, 0x09, 0x24, 0x09, 0x24, 0x0A, 0x24, 0x09,
+  0x24, 0x0A, 0x24, 0x09, 0x0D, 0x01, 0x16, 0x0A, 0x0D, 0x01, 0x16, 0x09,
+  0x0D, 0x02, 0x15, 0x09, 0x0E, 0x02, 0x14, 0x0A, 0x0E, 0x02, 0x14, 0x09,
+  0x0E, 0x02, 0x14, 0x0A, 0x0D, 0x03, 0x14, 0x09, 0x0D, 0x04, 0x13, 0x0A,
+  0x0C, 0x05, 0x12, 0x0A, 0x0B, 0x07, 0x12, 0x1C, 0x11, 0x1D, 0x43, 0x09,
+  0x25, 0x06, 0x28, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05,
+  0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05,
+  0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05,
+  0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05,
+  0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05,
+  0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05,
+  0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x06, 0x28, 0x09, 0x12, 0x03,
+  0x2B, 0x04, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2C, 0x03, 0x2B, 0x03,
+  0x2B, 0x03, 0x2B, 0x04, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2C, 0x03,
+  0x2B, 0x03, 0x2B, 0x03, 0x2C, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03,
+  0x2C, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2C, 0x03, 0x2B, 0x03, 0x2B, 0x03,
+  0x2B, 0x04, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2C, 0x03, 0x2B, 0x03,
+  0x2B, 0x03, 0x2B, 0x04, 0x2B, 0x03, 0x40, 0x09, 0x28, 0x06, 0x29, 0x05,
+  0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05,
+  0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05,
+  0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05,
+  0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05,
+  0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05,
+  0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05,
+  0x29, 0x05, 0x28, 0x06, 0x25, 0x09, 0x45, 0x02, 0x2B, 0x04, 0x2A, 0x04,
+  0x29, 0x06, 0x27, 0x03, 0x02, 0x03, 0x26, 0x03, 0x02, 0x03, 0x25, 0x03,
+  0x04, 0x03, 0x24, 0x02, 0x06, 0x02, 0x23, 0x03, 0x06, 0x03, 0x21, 0x03,
+  0x08, 0x03, 0x20, 0x03, 0x08, 0x03, 0x1F, 0x03, 0x0A, 0x03, 0x1E, 0x03,
+  0x0A, 0x03, 0x1D, 0x03, 0x0C, 0x03, 0x1B, 0x03, 0x0E, 0x03, 0x1A, 0x03,
+  0x0E, 0x03, 0x19, 0x03, 0x10, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+  0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x42, 0x19, 0x15, 0x19,
+  0x15, 0x19, 0x12, 0x07, 0x28, 0x07, 0x28, 0x06, 0x29, 0x05, 0x2A, 0x05,
+  0x2A, 0x04, 0x2B, 0x03, 0x2C, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0x11, 0x08,
+  0x23, 0x0C, 0x21, 0x04, 0x04, 0x07, 0x1E, 0x04, 0x06, 0x06, 0x1D, 0x06,
+  0x05, 0x07, 0x1C, 0x06, 0x05, 0x07, 0x1C, 0x07, 0x04, 0x07, 0x1C, 0x06,
+  0x05, 0x07, 0x1E, 0x03, 0x06, 0x07, 0x25, 0x09, 0x23, 0x03, 0x01, 0x07,
+  0x21, 0x04, 0x02, 0x07, 0x1F, 0x05, 0x03, 0x07, 0x1E, 0x05, 0x04, 0x07,
+  0x1D, 0x06, 0x04, 0x07, 0x1C, 0x06, 0x05, 0x07, 0x1B, 0x07, 0x05, 0x07,
+  0x1B, 0x07, 0x05, 0x07, 0x1B, 0x07, 0x04, 0x08, 0x1B, 0x08, 0x02, 0x01,
+  0x01, 0x07, 0x1B, 0x0A, 0x02, 0x0A, 0x19, 0x08, 0x04, 0x08, 0x1B, 0x05,
+  0x07, 0x05, 0x3A, 0x09, 0x26, 0x08, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x03, 0x05, 0x1F, 0x07, 0x02, 0x08, 0x1D, 0x12, 0x1C, 0x09, 0x03, 0x07,
+  0x1B, 0x08, 0x05, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x07, 0x06,
+  0x1A, 0x07, 0x07, 0x07, 0x19, 0x07, 0x07, 0x07, 0x19, 0x07, 0x07, 0x07,
+  0x19, 0x07, 0x07, 0x07, 0x19, 0x07, 0x07, 0x07, 0x19, 0x07, 0x07, 0x07,
+  0x19, 0x07, 0x07, 0x07, 0x19, 0x07, 0x07, 0x07, 0x19, 0x07, 0x07, 0x06,
+  0x1A, 0x07, 0x07, 0x06, 0x1A, 0x07, 0x07, 0x05, 0x1B, 0x07, 0x06, 0x06,
+  0x1B, 0x08, 0x05, 0x05, 0x1C, 0x09, 0x03, 0x05, 0x1D, 0x04, 0x02, 0x0A,
+  0x1E, 0x02, 0x06, 0x06, 0xFF, 0x00, 0xFF, 0x00, 0x13, 0x06, 0x26, 0x0A,
+  0x23, 0x05, 0x02, 0x05, 0x21, 0x05, 0x03, 0x06, 0x1F, 0x06, 0x03, 0x06,
+  0x1E, 0x06, 0x05, 0x05, 0x1E, 0x06, 0x05, 0x05, 0x1E, 0x06, 0x06, 0x03,
+  0x1E, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x08,
+  0x26, 0x08, 0x26, 0x08, 0x27, 0x08, 0x26, 0x08, 0x27, 0x08, 0x06, 0x02,
+  0x1E, 0x09, 0x04, 0x02, 0x20, 0x0D, 0x22, 0x0B, 0x25, 0x06, 0x46, 0x09,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x1F, 0x05, 0x03, 0x07, 0x1D, 0x09,
+  0x01, 0x07, 0x1C, 0x06, 0x03, 0x09, 0x1B, 0x06, 0x05, 0x08, 0x1B, 0x06,
+  0x05, 0x08, 0x1A, 0x06, 0x07, 0x07, 0x1A, 0x06, 0x07, 0x07, 0x1A, 0x06,
+  0x07, 0x07, 0x19, 0x07, 0x07, 0x07, 0x19, 0x07, 0x07, 0x07, 0x19, 0x07,
+  0x07, 0x07, 0x19, 0x07, 0x07, 0x07, 0x19, 0x07, 0x07, 0x07, 0x19, 0x07,
+  0x07, 0x07, 0x19, 0x07, 0x07, 0x07, 0x19, 0x07, 0x07, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x05, 0x08, 0x1B, 0x07,
+  0x03, 0x0A, 0x1B, 0x0A, 0x01, 0x09, 0x1B, 0x08, 0x02, 0x07, 0x1F, 0x05,
+  0x03, 0x02, 0xFF, 0x00, 0xFF, 0x00, 0x12, 0x06, 0x26, 0x0A, 0x23, 0x05,
+  0x02, 0x05, 0x21, 0x05, 0x03, 0x06, 0x1F, 0x05, 0x05, 0x05, 0x1E, 0x06,
+  0x05, 0x06, 0x1D, 0x06, 0x05, 0x06, 0x1D, 0x06, 0x05, 0x07, 0x1B, 0x07,
+  0x05, 0x07, 0x1B, 0x13, 0x1B, 0x13, 0x1B, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x08, 0x26, 0x08, 0x27, 0x07, 0x0A, 0x01, 0x1C, 0x08, 0x08, 0x02,
+  0x1D, 0x08, 0x06, 0x02, 0x1E, 0x09, 0x04, 0x02, 0x20, 0x0D, 0x22, 0x0B,
+  0x25, 0x07, 0x1A, 0x07, 0x25, 0x0B, 0x22, 0x05, 0x02, 0x05, 0x21, 0x05,
+  0x03, 0x06, 0x1F, 0x06, 0x03, 0x06, 0x1F, 0x06, 0x03, 0x05, 0x1F, 0x07,
+  0x04, 0x03, 0x20, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x24, 0x0D, 0x21, 0x0D, 0x24, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x26, 0x09, 0x24, 0x0B, 0xFF, 0x00, 0xFF, 0x00, 0x10, 0x06,
+  0x26, 0x11, 0x1B, 0x06, 0x03, 0x0A, 0x1A, 0x07, 0x03, 0x06, 0x1E, 0x06,
+  0x05, 0x06, 0x1C, 0x07, 0x05, 0x07, 0x1B, 0x07, 0x05, 0x07, 0x1B, 0x07,
+  0x05, 0x07, 0x1B, 0x07, 0x05, 0x07, 0x1B, 0x07, 0x05, 0x07, 0x1B, 0x07,
+  0x05, 0x07, 0x1C, 0x06, 0x05, 0x06, 0x1E, 0x06, 0x03, 0x06, 0x20, 0x05,
+  0x03, 0x06, 0x21, 0x0B, 0x24, 0x08, 0x25, 0x02, 0x2B, 0x02, 0x2B, 0x03,
+  0x2A, 0x05, 0x29, 0x10, 0x1E, 0x12, 0x1C, 0x13, 0x1B, 0x14, 0x1B, 0x13,
+  0x1C, 0x12, 0x1A, 0x03, 0x0D, 0x04, 0x19, 0x03, 0x0F, 0x03, 0x19, 0x03,
+  0x0F, 0x02, 0x1A, 0x05, 0x0A, 0x04, 0x1D, 0x10, 0x20, 0x0B, 0x3A, 0x09,
+  0x26, 0x08, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x04, 0x05, 0x1E, 0x07,
+  0x02, 0x09, 0x1C, 0x07, 0x01, 0x0B, 0x1B, 0x09, 0x03, 0x07, 0x1B, 0x08,
+  0x05, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x19, 0x09, 0x04, 0x09, 0x17, 0x0B, 0x02, 0x0B, 0x17, 0x03,
+  0x2A, 0x05, 0x28, 0x07, 0x27, 0x07, 0x27, 0x07, 0x28, 0x05, 0x2A, 0x03,
+  0xFF, 0x00, 0x0E, 0x09, 0x26, 0x08, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x26, 0x09, 0x24, 0x0B, 0x17, 0x03, 0x2A, 0x05,
+  0x28, 0x07, 0x27, 0x07, 0x27, 0x07, 0x28, 0x05, 0x2A, 0x03, 0xFF, 0x00,
+  0x0E, 0x09, 0x26, 0x08, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x22, 0x03, 0x02, 0x07, 0x21, 0x04, 0x03, 0x06, 0x21, 0x04, 0x03, 0x06,
+  0x21, 0x04, 0x03, 0x05, 0x22, 0x04, 0x03, 0x05, 0x23, 0x0A, 0x26, 0x06,
+  0x3A, 0x09, 0x26, 0x08, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x05, 0x0A, 0x18, 0x07, 0x07, 0x06, 0x1A, 0x07, 0x08, 0x03, 0x1C, 0x07,
+  0x08, 0x02, 0x1D, 0x07, 0x07, 0x02, 0x1E, 0x07, 0x06, 0x02, 0x1F, 0x07,
+  0x05, 0x02, 0x20, 0x07, 0x04, 0x03, 0x20, 0x07, 0x02, 0x06, 0x1F, 0x07,
+  0x01, 0x08, 0x1E, 0x10, 0x1E, 0x08, 0x01, 0x08, 0x1D, 0x07, 0x02, 0x09,
+  0x1C, 0x07, 0x03, 0x08, 0x1C, 0x07, 0x04, 0x08, 0x1B, 0x07, 0x04, 0x09,
+  0x1A, 0x07, 0x05, 0x08, 0x1A, 0x07, 0x06, 0x08, 0x19, 0x07, 0x06, 0x09,
+  0x17, 0x09, 0x06, 0x09, 0x15, 0x0B, 0x03, 0x0C, 0x41, 0x09, 0x26, 0x08,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x26, 0x09, 0x24, 0x0B,
+  0xFF, 0x00, 0xFF, 0x00, 0x0E, 0x06, 0x07, 0x06, 0x0E, 0x09, 0x02, 0x09,
+  0x04, 0x09, 0x0E, 0x08, 0x01, 0x0B, 0x02, 0x0B, 0x0E, 0x09, 0x03, 0x07,
+  0x01, 0x02, 0x03, 0x07, 0x0E, 0x08, 0x05, 0x08, 0x05, 0x07, 0x0D, 0x07,
+  0x06, 0x07, 0x06, 0x07, 0x0D, 0x07, 0x06, 0x07, 0x06, 0x07, 0x0D, 0x07,
+  0x06, 0x07, 0x06, 0x07, 0x0D, 0x07, 0x06, 0x07, 0x06, 0x07, 0x0D, 0x07,
+  0x06, 0x07, 0x06, 0x07, 0x0D, 0x07, 0x06, 0x07, 0x06, 0x07, 0x0D, 0x07,
+  0x06, 0x07, 0x06, 0x07, 0x0D, 0x07, 0x06, 0x07, 0x06, 0x07, 0x0D, 0x07,
+  0x06, 0x07, 0x06, 0x07, 0x0D, 0x07, 0x06, 0x07, 0x06, 0x07, 0x0D, 0x07,
+  0x06, 0x07, 0x06, 0x07, 0x0D, 0x07, 0x06, 0x07, 0x06, 0x07, 0x0D, 0x07,
+  0x06, 0x07, 0x06, 0x07, 0x0D, 0x07, 0x06, 0x07, 0x06, 0x07, 0x0D, 0x07,
+  0x06, 0x07, 0x06, 0x07, 0x0C, 0x09, 0x04, 0x09, 0x04, 0x09, 0x0A, 0x0B,
+  0x02, 0x0B, 0x02, 0x0B, 0xFF, 0x00, 0xFF, 0x00, 0x15, 0x06, 0x1B, 0x09,
+  0x03, 0x08, 0x1B, 0x08, 0x01, 0x0B, 0x1B, 0x09, 0x03, 0x07, 0x1B, 0x08,
+  0x05, 0x07, 0x1A, 0x08, 0x05, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x19, 0x09, 0x04, 0x09, 0x17, 0x0B, 0x02, 0x0B, 0xFF, 0x00,
+  0xFF, 0x00, 0x11, 0x06, 0x26, 0x0A, 0x23, 0x05, 0x02, 0x06, 0x20, 0x05,
+  0x04, 0x05, 0x1F, 0x06, 0x05, 0x05, 0x1D, 0x06, 0x06, 0x06, 0x1C, 0x06,
+  0x06, 0x06, 0x1C, 0x06, 0x06, 0x06, 0x1B, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1B, 0x06,
+  0x06, 0x06, 0x1C, 0x06, 0x06, 0x06, 0x1C, 0x06, 0x06, 0x06, 0x1D, 0x05,
+  0x06, 0x05, 0x1F, 0x05, 0x04, 0x06, 0x1F, 0x06, 0x02, 0x06, 0x22, 0x0A,
+  0x26, 0x06, 0xFF, 0x00, 0xFF, 0x00, 0x15, 0x04, 0x1D, 0x09, 0x02, 0x08,
+  0x1C, 0x08, 0x01, 0x0A, 0x1C, 0x09, 0x03, 0x07, 0x1B, 0x08, 0x05, 0x07,
+  0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x07, 0x06, 0x1A, 0x07, 0x07, 0x07,
+  0x19, 0x07, 0x07, 0x07, 0x19, 0x07, 0x07, 0x07, 0x19, 0x07, 0x07, 0x07,
+  0x19, 0x07, 0x07, 0x07, 0x19, 0x07, 0x07, 0x07, 0x19, 0x07, 0x07, 0x07,
+  0x19, 0x07, 0x07, 0x07, 0x19, 0x07, 0x07, 0x07, 0x19, 0x07, 0x07, 0x06,
+  0x1A, 0x07, 0x07, 0x06, 0x1A, 0x07, 0x06, 0x06, 0x1B, 0x08, 0x05, 0x06,
+  0x1B, 0x09, 0x03, 0x06, 0x1C, 0x07, 0x01, 0x09, 0x1D, 0x07, 0x03, 0x05,
+  0x1F, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x26, 0x09, 0x24, 0x0B, 0xFF, 0x00, 0xFF, 0x00, 0x0F, 0x07,
+  0x05, 0x02, 0x1E, 0x0A, 0x02, 0x04, 0x1D, 0x05, 0x03, 0x09, 0x1C, 0x05,
+  0x05, 0x08, 0x1B, 0x06, 0x06, 0x07, 0x1B, 0x06, 0x06, 0x07, 0x1A, 0x06,
+  0x07, 0x07, 0x1A, 0x06, 0x07, 0x07, 0x1A, 0x06, 0x07, 0x07, 0x19, 0x07,
+  0x07, 0x07, 0x19, 0x07, 0x07, 0x07, 0x19, 0x07, 0x07, 0x07, 0x19, 0x07,
+  0x07, 0x07, 0x19, 0x07, 0x07, 0x07, 0x19, 0x07, 0x07, 0x07, 0x19, 0x07,
+  0x07, 0x07, 0x1A, 0x06, 0x07, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x05, 0x08, 0x1B, 0x07, 0x03, 0x09, 0x1C, 0x12, 0x1D, 0x08, 0x02, 0x07,
+  0x1E, 0x06, 0x03, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x26, 0x09, 0x24, 0x0B, 0xFF, 0x00,
+  0xFF, 0x00, 0x1A, 0x04, 0x1C, 0x09, 0x04, 0x06, 0x1C, 0x08, 0x03, 0x07,
+  0x1D, 0x07, 0x02, 0x08, 0x1D, 0x07, 0x01, 0x01, 0x03, 0x05, 0x1D, 0x08,
+  0x04, 0x05, 0x1D, 0x08, 0x05, 0x03, 0x1E, 0x08, 0x26, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x26, 0x09, 0x24, 0x0B,
+  0xFF, 0x00, 0xFF, 0x00, 0x10, 0x06, 0x03, 0x01, 0x22, 0x0C, 0x21, 0x04,
+  0x04, 0x05, 0x21, 0x03, 0x06, 0x04, 0x20, 0x04, 0x07, 0x03, 0x20, 0x05,
+  0x07, 0x02, 0x20, 0x06, 0x06, 0x02, 0x20, 0x07, 0x06, 0x01, 0x20, 0x09,
+  0x26, 0x0A, 0x25, 0x0A, 0x25, 0x0A, 0x25, 0x0A, 0x25, 0x09, 0x27, 0x08,
+  0x1F, 0x01, 0x08, 0x06, 0x1F, 0x02, 0x08, 0x05, 0x1F, 0x02, 0x09, 0x04,
+  0x1F, 0x03, 0x08, 0x04, 0x1F, 0x04, 0x07, 0x03, 0x20, 0x06, 0x04, 0x03,
+  0x21, 0x0C, 0x22, 0x01, 0x03, 0x06, 0xD2, 0x01, 0x2C, 0x02, 0x2B, 0x03,
+  0x2B, 0x03, 0x2A, 0x04, 0x29, 0x05, 0x28, 0x06, 0x26, 0x08, 0x25, 0x0E,
+  0x1F, 0x0F, 0x22, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x03, 0x01,
+  0x23, 0x07, 0x02, 0x02, 0x24, 0x09, 0x26, 0x07, 0x28, 0x05, 0xFF, 0x00,
+  0xFF, 0x00, 0x36, 0x09, 0x04, 0x09, 0x19, 0x08, 0x05, 0x08, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x05, 0x08, 0x1B, 0x07, 0x03, 0x09, 0x1B, 0x0B, 0x01, 0x08, 0x1B, 0x08,
+  0x03, 0x09, 0x1C, 0x05, 0xFF, 0x00, 0xFF, 0x00, 0x36, 0x0C, 0x04, 0x08,
+  0x17, 0x09, 0x08, 0x04, 0x1A, 0x08, 0x09, 0x02, 0x1B, 0x08, 0x09, 0x02,
+  0x1C, 0x07, 0x08, 0x02, 0x1D, 0x08, 0x07, 0x02, 0x1E, 0x07, 0x07, 0x02,
+  0x1E, 0x08, 0x05, 0x02, 0x20, 0x07, 0x05, 0x02, 0x20, 0x08, 0x03, 0x02,
+  0x22, 0x07, 0x03, 0x02, 0x22, 0x08, 0x01, 0x02, 0x23, 0x08, 0x01, 0x02,
+  0x24, 0x07, 0x01, 0x02, 0x24, 0x09, 0x26, 0x08, 0x26, 0x07, 0x28, 0x06,
+  0x28, 0x05, 0x2A, 0x04, 0x2A, 0x04, 0x2A, 0x03, 0xFF, 0x00, 0xFF, 0x00,
+  0x30, 0x0C, 0x01, 0x0C, 0x03, 0x07, 0x0C, 0x09, 0x04, 0x09, 0x06, 0x04,
+  0x0F, 0x08, 0x05, 0x08, 0x07, 0x02, 0x11, 0x07, 0x06, 0x07, 0x07, 0x02,
+  0x11, 0x08, 0x05, 0x08, 0x05, 0x02, 0x13, 0x07, 0x05, 0x08, 0x05, 0x02,
+  0x13, 0x07, 0x05, 0x08, 0x05, 0x02, 0x13, 0x08, 0x03, 0x0A, 0x03, 0x02,
+  0x15, 0x07, 0x03, 0x02, 0x01, 0x07, 0x03, 0x02, 0x15, 0x07, 0x03, 0x02,
+  0x01, 0x07, 0x03, 0x02, 0x15, 0x08, 0x01, 0x02, 0x02, 0x08, 0x01, 0x02,
+  0x17, 0x07, 0x01, 0x02, 0x03, 0x07, 0x01, 0x02, 0x17, 0x07, 0x01, 0x02,
+  0x03, 0x07, 0x01, 0x02, 0x17, 0x09, 0x04, 0x09, 0x19, 0x08, 0x05, 0x08,
+  0x19, 0x07, 0x06, 0x07, 0x1B, 0x06, 0x07, 0x06, 0x1B, 0x06, 0x07, 0x06,
+  0x1B, 0x05, 0x08, 0x05, 0x1D, 0x04, 0x09, 0x04, 0x1D, 0x04, 0x09, 0x04,
+  0x1D, 0x03, 0x0A, 0x03, 0xFF, 0x00, 0xFF, 0x00, 0x37, 0x0C, 0x01, 0x08,
+  0x1B, 0x09, 0x04, 0x04, 0x1E, 0x08, 0x04, 0x03, 0x20, 0x07, 0x04, 0x02,
+  0x21, 0x08, 0x02, 0x02, 0x23, 0x0A, 0x24, 0x09, 0x26, 0x08, 0x26, 0x08,
+  0x27, 0x08, 0x27, 0x07, 0x27, 0x08, 0x26, 0x08, 0x26, 0x09, 0x24, 0x02,
+  0x01, 0x08, 0x22, 0x02, 0x02, 0x08, 0x21, 0x02, 0x04, 0x08, 0x20, 0x02,
+  0x04, 0x08, 0x1F, 0x02, 0x06, 0x08, 0x1C, 0x05, 0x05, 0x09, 0x19, 0x0A,
+  0x01, 0x0C, 0xFF, 0x00, 0xFF, 0x00, 0x36, 0x0D, 0x03, 0x07, 0x18, 0x0A,
+  0x07, 0x04, 0x1B, 0x08, 0x07, 0x03, 0x1C, 0x08, 0x07, 0x02, 0x1E, 0x07,
+  0x07, 0x02, 0x1E, 0x08, 0x05, 0x02, 0x20, 0x07, 0x05, 0x02, 0x20, 0x08,
+  0x04, 0x02, 0x21, 0x07, 0x03, 0x02, 0x22, 0x08, 0x02, 0x02, 0x22, 0x08,
+  0x02, 0x02, 0x23, 0x07, 0x01, 0x02, 0x24, 0x0A, 0x25, 0x08, 0x26, 0x08,
+  0x27, 0x07, 0x27, 0x06, 0x29, 0x05, 0x29, 0x04, 0x2A, 0x04, 0x2B, 0x03,
+  0x2B, 0x02, 0x2C, 0x02, 0x2C, 0x02, 0x23, 0x04, 0x04, 0x02, 0x23, 0x06,
+  0x03, 0x02, 0x23, 0x06, 0x02, 0x02, 0x24, 0x06, 0x02, 0x02, 0x24, 0x09,
+  0x26, 0x07, 0x28, 0x05, 0xFF, 0x00, 0xFF, 0x00, 0x39, 0x13, 0x1B, 0x12,
+  0x1C, 0x04, 0x06, 0x08, 0x1C, 0x02, 0x07, 0x08, 0x1D, 0x02, 0x07, 0x08,
+  0x1D, 0x01, 0x07, 0x08, 0x1E, 0x01, 0x06, 0x08, 0x26, 0x08, 0x25, 0x08,
+  0x26, 0x07, 0x26, 0x08, 0x25, 0x08, 0x26, 0x08, 0x25, 0x08, 0x26, 0x07,
+  0x08, 0x01, 0x1D, 0x08, 0x07, 0x02, 0x1C, 0x08, 0x08, 0x02, 0x1C, 0x07,
+  0x08, 0x03, 0x1B, 0x08, 0x06, 0x04, 0x1C, 0x12, 0x1B, 0x13, 0x1B, 0x04,
+  0x28, 0x04, 0x29, 0x03, 0x2A, 0x04, 0x29, 0x04, 0x29, 0x05, 0x29, 0x05,
+  0x29, 0x05, 0x29, 0x05, 0x29, 0x06, 0x28, 0x06, 0x28, 0x06, 0x29, 0x05,
+  0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x04, 0x2A, 0x04, 0x29, 0x04,
+  0x2A, 0x03, 0x29, 0x04, 0x29, 0x02, 0x2D, 0x03, 0x2D, 0x03, 0x2B, 0x04,
+  0x2B, 0x04, 0x2A, 0x04, 0x2A, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05,
+  0x28, 0x06, 0x28, 0x06, 0x28, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05,
+  0x29, 0x05, 0x2A, 0x04, 0x2B, 0x04, 0x2A, 0x04, 0x2C, 0x04, 0x2C, 0x04,
+  0x17, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03,
+  0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03,
+  0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03,
+  0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03,
+  0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03,
+  0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03,
+  0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x03,
+  0x2B, 0x03, 0x10, 0x04, 0x2C, 0x04, 0x2C, 0x04, 0x2A, 0x04, 0x2B, 0x04,
+  0x2A, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x28, 0x06,
+  0x28, 0x06, 0x28, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x2A, 0x04,
+  0x2A, 0x04, 0x2B, 0x04, 0x2B, 0x03, 0x2D, 0x02, 0x2E, 0x02, 0x29, 0x04,
+  0x29, 0x03, 0x2A, 0x04, 0x29, 0x04, 0x2A, 0x04, 0x29, 0x05, 0x29, 0x05,
+  0x29, 0x05, 0x29, 0x05, 0x29, 0x06, 0x28, 0x06, 0x28, 0x06, 0x29, 0x05,
+  0x29, 0x05, 0x29, 0x05, 0x29, 0x05, 0x29, 0x04, 0x29, 0x04, 0x2A, 0x03,
+  0x29, 0x04, 0x28, 0x04, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x20, 0x06,
+  0x0E, 0x02, 0x17, 0x0A, 0x0B, 0x02, 0x16, 0x0D, 0x08, 0x03, 0x16, 0x03,
+  0x04, 0x09, 0x04, 0x03, 0x16, 0x03, 0x08, 0x0D, 0x16, 0x02, 0x0B, 0x0A,
+  0x17, 0x02, 0x0E, 0x05, 0x15, 0x04, 0x29, 0x07, 0x26, 0x03, 0x02, 0x03,
+  0x25, 0x04, 0x02, 0x04, 0x24, 0x04, 0x02, 0x04, 0x24, 0x04, 0x02, 0x04,
+  0x24, 0x04, 0x02, 0x04, 0x24, 0x04, 0x02, 0x04, 0x24, 0x04, 0x02, 0x04,
+  0x25, 0x03, 0x02, 0x03, 0x26, 0x08, 0x28, 0x04, 0xFF, 0x00, 0xFF, 0x00,
+  0x36, 0x09, 0x04, 0x09, 0x19, 0x08, 0x05, 0x08, 0x1A, 0x07, 0x06, 0x07,
+  0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07,
+  0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07,
+  0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07,
+  0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07,
+  0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x05, 0x08,
+  0x1B, 0x07, 0x03, 0x09, 0x1B, 0x0B, 0x01, 0x08, 0x1B, 0x08, 0x03, 0x09,
+  0x1C, 0x05, 0x25, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x70, 0x07, 0x28, 0x07,
+  0x28, 0x06, 0x29, 0x05, 0x2A, 0x05, 0x2A, 0x04, 0x2B, 0x03, 0x2C, 0x03,
+  0x53, 0x08, 0x23, 0x0C, 0x21, 0x04, 0x04, 0x07, 0x1E, 0x04, 0x06, 0x06,
+  0x1D, 0x06, 0x05, 0x07, 0x1C, 0x06, 0x05, 0x07, 0x1C, 0x07, 0x04, 0x07,
+  0x1C, 0x06, 0x05, 0x07, 0x1E, 0x03, 0x06, 0x07, 0x25, 0x09, 0x23, 0x03,
+  0x01, 0x07, 0x21, 0x04, 0x02, 0x07, 0x1F, 0x05, 0x03, 0x07, 0x1E, 0x05,
+  0x04, 0x07, 0x1D, 0x06, 0x04, 0x07, 0x1C, 0x06, 0x05, 0x07, 0x1B, 0x07,
+  0x05, 0x07, 0x1B, 0x07, 0x05, 0x07, 0x1B, 0x07, 0x04, 0x08, 0x1B, 0x08,
+  0x02, 0x01, 0x01, 0x07, 0x1B, 0x0A, 0x02, 0x0A, 0x19, 0x08, 0x04, 0x08,
+  0x1B, 0x05, 0x07, 0x05, 0x46, 0x02, 0x2B, 0x04, 0x29, 0x06, 0x27, 0x03,
+  0x02, 0x03, 0x25, 0x02, 0x06, 0x02, 0x22, 0x03, 0x08, 0x03, 0x1F, 0x03,
+  0x0A, 0x03, 0x1D, 0x03, 0x0C, 0x03, 0x1B, 0x03, 0x0E, 0x03, 0x4E, 0x08,
+  0x23, 0x0C, 0x21, 0x04, 0x04, 0x07, 0x1E, 0x04, 0x06, 0x06, 0x1D, 0x06,
+  0x05, 0x07, 0x1C, 0x06, 0x05, 0x07, 0x1C, 0x07, 0x04, 0x07, 0x1C, 0x06,
+  0x05, 0x07, 0x1E, 0x03, 0x06, 0x07, 0x25, 0x09, 0x23, 0x03, 0x01, 0x07,
+  0x21, 0x04, 0x02, 0x07, 0x1F, 0x05, 0x03, 0x07, 0x1E, 0x05, 0x04, 0x07,
+  0x1D, 0x06, 0x04, 0x07, 0x1C, 0x06, 0x05, 0x07, 0x1B, 0x07, 0x05, 0x07,
+  0x1B, 0x07, 0x05, 0x07, 0x1B, 0x07, 0x04, 0x08, 0x1B, 0x08, 0x02, 0x01,
+  0x01, 0x07, 0x1B, 0x0A, 0x02, 0x0A, 0x19, 0x08, 0x04, 0x08, 0x1B, 0x05,
+  0x07, 0x05, 0x6B, 0x04, 0x0C, 0x04, 0x19, 0x06, 0x0A, 0x06, 0x17, 0x08,
+  0x08, 0x08, 0x16, 0x08, 0x08, 0x08, 0x16, 0x08, 0x08, 0x08, 0x16, 0x08,
+  0x08, 0x08, 0x17, 0x06, 0x0A, 0x06, 0x19, 0x04, 0x0C, 0x04, 0x4E, 0x08,
+  0x23, 0x0C, 0x21, 0x04, 0x04, 0x07, 0x1E, 0x04, 0x06, 0x06, 0x1D, 0x06,
+  0x05, 0x07, 0x1C, 0x06, 0x05, 0x07, 0x1C, 0x07, 0x04, 0x07, 0x1C, 0x06,
+  0x05, 0x07, 0x1E, 0x03, 0x06, 0x07, 0x25, 0x09, 0x23, 0x03, 0x01, 0x07,
+  0x21, 0x04, 0x02, 0x07, 0x1F, 0x05, 0x03, 0x07, 0x1E, 0x05, 0x04, 0x07,
+  0x1D, 0x06, 0x04, 0x07, 0x1C, 0x06, 0x05, 0x07, 0x1B, 0x07, 0x05, 0x07,
+  0x1B, 0x07, 0x05, 0x07, 0x1B, 0x07, 0x04, 0x08, 0x1B, 0x08, 0x02, 0x01,
+  0x01, 0x07, 0x1B, 0x0A, 0x02, 0x0A, 0x19, 0x08, 0x04, 0x08, 0x1B, 0x05,
+  0x07, 0x05, 0xFF, 0x00, 0xFF, 0x00, 0x13, 0x06, 0x26, 0x0A, 0x23, 0x05,
+  0x02, 0x05, 0x21, 0x05, 0x03, 0x06, 0x1F, 0x06, 0x03, 0x06, 0x1E, 0x06,
+  0x05, 0x05, 0x1E, 0x06, 0x05, 0x05, 0x1E, 0x06, 0x06, 0x03, 0x1E, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x08, 0x26, 0x08,
+  0x26, 0x08, 0x27, 0x08, 0x26, 0x08, 0x27, 0x08, 0x06, 0x02, 0x1E, 0x09,
+  0x04, 0x02, 0x20, 0x0D, 0x22, 0x0B, 0x25, 0x06, 0x29, 0x04, 0x29, 0x06,
+  0x27, 0x09, 0x25, 0x09, 0x26, 0x08, 0x2B, 0x03, 0x2B, 0x02, 0x2B, 0x02,
+  0x2B, 0x03, 0x29, 0x02, 0x6F, 0x07, 0x28, 0x07, 0x28, 0x06, 0x29, 0x05,
+  0x2A, 0x05, 0x2A, 0x04, 0x2B, 0x03, 0x2C, 0x03, 0x55, 0x06, 0x26, 0x0A,
+  0x23, 0x05, 0x02, 0x05, 0x21, 0x05, 0x03, 0x06, 0x1F, 0x05, 0x05, 0x05,
+  0x1E, 0x06, 0x05, 0x06, 0x1D, 0x06, 0x05, 0x06, 0x1D, 0x06, 0x05, 0x07,
+  0x1B, 0x07, 0x05, 0x07, 0x1B, 0x13, 0x1B, 0x13, 0x1B, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x08, 0x26, 0x08, 0x27, 0x07, 0x0A, 0x01, 0x1C, 0x08,
+  0x08, 0x02, 0x1D, 0x08, 0x06, 0x02, 0x1E, 0x09, 0x04, 0x02, 0x20, 0x0D,
+  0x22, 0x0B, 0x25, 0x07, 0x72, 0x07, 0x26, 0x07, 0x27, 0x06, 0x28, 0x05,
+  0x28, 0x05, 0x29, 0x04, 0x2A, 0x03, 0x2A, 0x03, 0x5C, 0x06, 0x26, 0x0A,
+  0x23, 0x05, 0x02, 0x05, 0x21, 0x05, 0x03, 0x06, 0x1F, 0x05, 0x05, 0x05,
+  0x1E, 0x06, 0x05, 0x06, 0x1D, 0x06, 0x05, 0x06, 0x1D, 0x06, 0x05, 0x07,
+  0x1B, 0x07, 0x05, 0x07, 0x1B, 0x13, 0x1B, 0x13, 0x1B, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x08, 0x26, 0x08, 0x27, 0x07, 0x0A, 0x01, 0x1C, 0x08,
+  0x08, 0x02, 0x1D, 0x08, 0x06, 0x02, 0x1E, 0x09, 0x04, 0x02, 0x20, 0x0D,
+  0x22, 0x0B, 0x25, 0x07, 0x45, 0x02, 0x2B, 0x04, 0x29, 0x06, 0x27, 0x03,
+  0x02, 0x03, 0x25, 0x02, 0x06, 0x02, 0x22, 0x03, 0x08, 0x03, 0x1F, 0x03,
+  0x0A, 0x03, 0x1D, 0x03, 0x0C, 0x03, 0x1B, 0x03, 0x0E, 0x03, 0x50, 0x06,
+  0x26, 0x0A, 0x23, 0x05, 0x02, 0x05, 0x21, 0x05, 0x03, 0x06, 0x1F, 0x05,
+  0x05, 0x05, 0x1E, 0x06, 0x05, 0x06, 0x1D, 0x06, 0x05, 0x06, 0x1D, 0x06,
+  0x05, 0x07, 0x1B, 0x07, 0x05, 0x07, 0x1B, 0x13, 0x1B, 0x13, 0x1B, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x08, 0x26, 0x08, 0x27, 0x07, 0x0A, 0x01,
+  0x1C, 0x08, 0x08, 0x02, 0x1D, 0x08, 0x06, 0x02, 0x1E, 0x09, 0x04, 0x02,
+  0x20, 0x0D, 0x22, 0x0B, 0x25, 0x07, 0x6A, 0x04, 0x0C, 0x04, 0x19, 0x06,
+  0x0A, 0x06, 0x17, 0x08, 0x08, 0x08, 0x16, 0x08, 0x08, 0x08, 0x16, 0x08,
+  0x08, 0x08, 0x16, 0x08, 0x08, 0x08, 0x17, 0x06, 0x0A, 0x06, 0x19, 0x04,
+  0x0C, 0x04, 0x50, 0x06, 0x26, 0x0A, 0x23, 0x05, 0x02, 0x05, 0x21, 0x05,
+  0x03, 0x06, 0x1F, 0x05, 0x05, 0x05, 0x1E, 0x06, 0x05, 0x06, 0x1D, 0x06,
+  0x05, 0x06, 0x1D, 0x06, 0x05, 0x07, 0x1B, 0x07, 0x05, 0x07, 0x1B, 0x13,
+  0x1B, 0x13, 0x1B, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x08, 0x26, 0x08,
+  0x27, 0x07, 0x0A, 0x01, 0x1C, 0x08, 0x08, 0x02, 0x1D, 0x08, 0x06, 0x02,
+  0x1E, 0x09, 0x04, 0x02, 0x20, 0x0D, 0x22, 0x0B, 0x25, 0x07, 0x45, 0x02,
+  0x2B, 0x04, 0x29, 0x06, 0x27, 0x03, 0x02, 0x03, 0x25, 0x03, 0x04, 0x03,
+  0x23, 0x03, 0x06, 0x03, 0x21, 0x03, 0x08, 0x03, 0x1F, 0x03, 0x0A, 0x03,
+  0x1D, 0x03, 0x0C, 0x03, 0x1B, 0x03, 0x0E, 0x03, 0x4D, 0x09, 0x26, 0x08,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x26, 0x09,
+  0x24, 0x0B, 0x98, 0x04, 0x0C, 0x04, 0x19, 0x06, 0x0A, 0x06, 0x17, 0x08,
+  0x08, 0x08, 0x16, 0x08, 0x08, 0x08, 0x16, 0x08, 0x08, 0x08, 0x16, 0x08,
+  0x08, 0x08, 0x17, 0x06, 0x0A, 0x06, 0x19, 0x04, 0x0C, 0x04, 0x4D, 0x09,
+  0x26, 0x08, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07, 0x27, 0x07,
+  0x26, 0x09, 0x24, 0x0B, 0x45, 0x02, 0x2B, 0x04, 0x29, 0x06, 0x27, 0x03,
+  0x02, 0x03, 0x25, 0x02, 0x06, 0x02, 0x22, 0x03, 0x08, 0x03, 0x1F, 0x03,
+  0x0A, 0x03, 0x1D, 0x03, 0x0C, 0x03, 0x1B, 0x03, 0x0E, 0x03, 0x4F, 0x06,
+  0x26, 0x0A, 0x23, 0x05, 0x02, 0x06, 0x20, 0x05, 0x04, 0x05, 0x1F, 0x06,
+  0x05, 0x05, 0x1D, 0x06, 0x06, 0x06, 0x1C, 0x06, 0x06, 0x06, 0x1C, 0x06,
+  0x06, 0x06, 0x1B, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1B, 0x06, 0x06, 0x06, 0x1C, 0x06,
+  0x06, 0x06, 0x1C, 0x06, 0x06, 0x06, 0x1D, 0x05, 0x06, 0x05, 0x1F, 0x05,
+  0x04, 0x06, 0x1F, 0x06, 0x02, 0x06, 0x22, 0x0A, 0x26, 0x06, 0x6A, 0x04,
+  0x0C, 0x04, 0x19, 0x06, 0x0A, 0x06, 0x17, 0x08, 0x08, 0x08, 0x16, 0x08,
+  0x08, 0x08, 0x16, 0x08, 0x08, 0x08, 0x16, 0x08, 0x08, 0x08, 0x17, 0x06,
+  0x0A, 0x06, 0x19, 0x04, 0x0C, 0x04, 0x4F, 0x06, 0x26, 0x0A, 0x23, 0x05,
+  0x02, 0x06, 0x20, 0x05, 0x04, 0x05, 0x1F, 0x06, 0x05, 0x05, 0x1D, 0x06,
+  0x06, 0x06, 0x1C, 0x06, 0x06, 0x06, 0x1C, 0x06, 0x06, 0x06, 0x1B, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1B, 0x06, 0x06, 0x06, 0x1C, 0x06, 0x06, 0x06, 0x1C, 0x06,
+  0x06, 0x06, 0x1D, 0x05, 0x06, 0x05, 0x1F, 0x05, 0x04, 0x06, 0x1F, 0x06,
+  0x02, 0x06, 0x22, 0x0A, 0x26, 0x06, 0x9D, 0x07, 0x28, 0x07, 0x28, 0x06,
+  0x29, 0x05, 0x2A, 0x05, 0x2A, 0x04, 0x2B, 0x03, 0x2C, 0x03, 0x4B, 0x09,
+  0x04, 0x09, 0x19, 0x08, 0x05, 0x08, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x05, 0x08, 0x1B, 0x07,
+  0x03, 0x09, 0x1B, 0x0B, 0x01, 0x08, 0x1B, 0x08, 0x03, 0x09, 0x1C, 0x05,
+  0x45, 0x02, 0x2B, 0x04, 0x29, 0x06, 0x27, 0x03, 0x02, 0x03, 0x25, 0x03,
+  0x04, 0x03, 0x23, 0x03, 0x06, 0x03, 0x21, 0x03, 0x08, 0x03, 0x1F, 0x03,
+  0x0A, 0x03, 0x1D, 0x03, 0x0C, 0x03, 0x1B, 0x03, 0x0E, 0x03, 0x46, 0x09,
+  0x04, 0x09, 0x19, 0x08, 0x05, 0x08, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07,
+  0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x05, 0x08, 0x1B, 0x07,
+  0x03, 0x09, 0x1B, 0x0B, 0x01, 0x08, 0x1B, 0x08, 0x03, 0x09, 0x1C, 0x05,
+  0x98, 0x04, 0x0C, 0x04, 0x19, 0x06, 0x0A, 0x06, 0x17, 0x08, 0x08, 0x08,
+  0x16, 0x08, 0x08, 0x08, 0x16, 0x08, 0x08, 0x08, 0x16, 0x08, 0x08, 0x08,
+  0x17, 0x06, 0x0A, 0x06, 0x19, 0x04, 0x0C, 0x04, 0x46, 0x09, 0x04, 0x09,
+  0x19, 0x08, 0x05, 0x08, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07,
+  0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07,
+  0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07,
+  0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07,
+  0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x06, 0x07,
+  0x1A, 0x07, 0x06, 0x07, 0x1A, 0x07, 0x05, 0x08, 0x1B, 0x07, 0x03, 0x09,
+  0x1B, 0x0B, 0x01, 0x08, 0x1B, 0x08, 0x03, 0x09, 0x1C, 0x05,
+};
+
+const uint16_t Font36bRle_Offsets[] = {
+      0,     0,    60,   120,   236,   368,   552,   696,
+    726,   814,   902,   962,  1012,  1054,  1070,  1094,
+   1162,  1282,  1348,  1424,  1502,  1588,  1662,  1760,
+   1832,  1940,  2038,  2076,  2130,  2178,  2194,  2242,
+   2322,  2578,  2682,  2798,  2898,  3018,  3146,  3258,
+   3372,  3496,  3560,  3644,  3768,  3850,  4060,  4214,
+   4342,  4434,  4576,  4696,  4810,  4902,  5030,  5142,
+   5332,  5442,  5538,  5638,  5722,  5790,  5874,  5934,
+   5954,  5970,  6062,  6172,  6238,  6350,  6422,  6498,
+   6598,  6706,  6764,  6852,  6956,  7020,  7156,  7246,
+   7334,  7446,  7558,  7620,  7698,  7762,  7852,  7928,
+   8056,  8126,  8224,  8290,  8376,  8462,  8548,  8584,
+   8624,  8732,  8836,  8954,  9074,  9160,  9244,  9328,
+   9426,  9526,  9602,  9676,  9790,  9906, 10008, 10128,
+  10246,
+};
+
+const uint16_t Font36bRle_CodePoints[] = {
+  0x00B0,  // '°'
+  0x00B5,  // 'µ'
+  0x00E0,  // 'à'
+  0x00E2,  // 'â'
+  0x00E4,  // 'ä'
+  0x00E7,  // 'ç'
+  0x00E8,  // 'è'
+  0x00E9,  // 'é'
+  0x00EA,  // 'ê'
+  0x00EB,  // 'ë'
+  0x00EE,  // 'î'
+  0x00EF,  // 'ï'
+  0x00F4,  // 'ô'
+  0x00F6,  // 'ö'
+  0x00F9,  // 'ù'
+  0x00FB,  // 'û'
+  0x00FC,  // 'ü'
+};
+// clang-format on
+
+constexpr Font kFont36bRle = {Font36bRle_Table,
+                              46,
+                              44,
+                              FontFormat::Rle1,
+                              Font36bRle_CodePoints,
+                              17,
+                              Font36bRle_Offsets};
+
+}  // namespace disco
@@ -0,0 +1,175 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file glyph_cache.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Cache of pre-expanded glyphs stored in SDRAM
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#include "glyph_cache.hpp"
+
+#include "glyph_expander.hpp"
+
+namespace disco {
+
+/**
+ * @brief  Tells whether the glyphs of a font can be cached: monospaced 1-bpp
+ *         glyphs fitting in a slot.
+ * @param  pFont  Font to check
+ * @retval true if getGlyph() accepts the glyphs of the font
+ */
+bool GlyphCache::canCache(const Font* pFont) {
+    return !isCoverageFont(pFont) && pFont->metrics == nullptr &&
+           pFont->width <= kMaxGlyphWidth && pFont->height <= kMaxGlyphHeight;
+}
+
+/**
+ * @brief  Attaches the cache to its reserved SDRAM region.
+ * @note   The SDRAM is configured as write-through by the MPU, so glyphs expanded
+ *         by the CPU are visible to the DMA2D without explicit cache maintenance.
+ * @param  baseAddress    Start of the reserved region (kRegionSize bytes)
+ * @param  bytesPerPixel  1 for L8, 2 for RGB565, 4 for ARGB8888
+ */
+void GlyphCache::init(uintptr_t baseAddress, uint32_t bytesPerPixel) {
+    pSlots_        = reinterpret_cast<uint8_t*>(baseAddress);  // NOLINT
+    bytesPerPixel_ = bytesPerPixel;
+    invalidate();
+    resetStats();
+}
+
+/**
+ * @brief  Drops all cached glyphs, e.g. after a pixel format change.
+ */
+void GlyphCache::invalidate() {
+    for (uint32_t i = 0; i < kNbrOfSlots; i++) {
+        entries_[i].isValid = false;
+    }
+}
+
+/**
+ * @brief  Tells whether a glyph is cached. On a miss, getGlyph() overwrites the
+ *         pixels of the slot, which must no longer be read.
+ * @param  pFont       Font the glyph belongs to
+ * @param  glyphIndex  Index of the glyph in the font table
+ * @param  textColor   Foreground color (ARGB8888, palette index for L8)
+ * @param  backColor   Background color (ARGB8888, palette index for L8)
+ * @retval true if getGlyph() returns the pixels without expanding the glyph
+ */
+bool GlyphCache::isCached(const Font* pFont,
+                          uint32_t glyphIndex,
+                          uint32_t textColor,
+                          uint32_t backColor) const {
+    const Entry& entry = entries_[getSlot(pFont, glyphIndex, textColor, backColor)];
+    return entry.isValid && entry.pFont == pFont && entry.glyphIndex == glyphIndex &&
+           entry.textColor == textColor && entry.backColor == backColor;
+}
+
+/**
+ * @brief  Returns the expanded pixels of a glyph, expanding it on a miss.
+ * @param  pFont       Font the glyph belongs to
+ * @param  glyphIndex  Index of the glyph in the font table
+ * @param  textColor   Foreground color (ARGB8888, palette index for L8)
+ * @param  backColor   Background color (ARGB8888, palette index for L8)
+ * @retval Pointer to width x height pixels in the framebuffer format
+ */
+const uint8_t* GlyphCache::getGlyph(const Font* pFont,
+                                    uint32_t glyphIndex,
+                                    uint32_t textColor,
+                                    uint32_t backColor) {
+    uint32_t slot  = getSlot(pFont, glyphIndex, textColor, backColor);
+    Entry& entry   = entries_[slot];
+    uint8_t* pData = pSlots_ + slot * kSlotSize;
+
+    if (entry.isValid && entry.pFont == pFont && entry.glyphIndex == glyphIndex &&
+        entry.textColor == textColor && entry.backColor == backColor) {
+        stats_.hits++;
+        return pData;
+    }
+
+    stats_.misses++;
+    if (entry.isValid) {
+        stats_.evictions++;
+    }
+    expandGlyph(
+        pData, pFont->width, pFont, glyphIndex, textColor, backColor, bytesPerPixel_);
+    entry.pFont      = pFont;
+    entry.textColor  = textColor;
+    entry.backColor  = backColor;
+    entry.glyphIndex = static_cast<uint16_t>(glyphIndex);
+    entry.isValid    = true;
+
+    return pData;
+}
+
+/**
+ * @brief  Gets the hit/miss counters.
+ * @retval Cache statistics
+ */
+const GlyphCache::Stats& GlyphCache::getStats() const { return stats_; }
+
+/**
+ * @brief  Resets the hit/miss counters.
+ */
+void GlyphCache::resetStats() { stats_ = {.hits = 0, .misses = 0, .evictions = 0}; }
+
+/**
+ * @brief  Maps a glyph key onto a slot of the direct-mapped cache.
+ * @param  pFont       Font the glyph belongs to
+ * @param  glyphIndex  Index of the glyph in the font table
+ * @param  textColor   Foreground color (ARGB8888, palette index for L8)
+ * @param  backColor   Background color (ARGB8888, palette index for L8)
+ * @retval Slot holding the glyph, or that getGlyph() expands it into
+ */
+uint32_t GlyphCache::getSlot(const Font* pFont,
+                             uint32_t glyphIndex,
+                             uint32_t textColor,
+                             uint32_t backColor) const {
+    // FNV-1a over the key words
+    uint32_t hash        = 2166136261U;
+    const uint32_t key[] = {
+        static_cast<uint32_t>(reinterpret_cast<uintptr_t>(pFont)),  // NOLINT
+        glyphIndex,
+        textColor,
+        backColor};
+    for (uint32_t word : key) {
+        hash = (hash ^ word) * 16777619U;
+    }
+    return (hash ^ (hash >> 16)) % kNbrOfSlots;
+}
+
+/**
+ * @brief  Gets the last DMA2D job reading a slot, which must be done before
+ *         getGlyph() expands another glyph into it.
+ * @param  slot  Slot returned by getSlot()
+ * @retval Job identifier, 0 if the slot was never read
+ */
+uint32_t GlyphCache::getReaderJobId(uint32_t slot) const {
+    return entries_[slot].readerJobId;
+}
+
+/**
+ * @brief  Records the DMA2D job reading the pixels of a slot.
+ * @param  slot   Slot returned by getSlot()
+ * @param  jobId  Identifier of the job
+ */
+void GlyphCache::setReaderJobId(uint32_t slot, uint32_t jobId) {
+    entries_[slot].readerJobId = jobId;
+}
+
+}  // namespace disco
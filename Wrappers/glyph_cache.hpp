@@ -0,0 +1,101 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file glyph_cache.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Cache of pre-expanded glyphs stored in SDRAM
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+#include "fonts.hpp"
+
+namespace disco {
+
+class GlyphCache {
+   public:
+    GlyphCache() = default;
+
+    // the cache owns a fixed SDRAM region and cannot be copied
+    GlyphCache(const GlyphCache&)            = delete;
+    GlyphCache& operator=(const GlyphCache&) = delete;
+
+    struct Stats {
+        // cppcheck-suppress unusedStructMember
+        uint32_t hits;
+        // cppcheck-suppress unusedStructMember
+        uint32_t misses;
+        // cppcheck-suppress unusedStructMember
+        uint32_t evictions;
+    };
+
+    static bool canCache(const Font* pFont);
+
+    void init(uintptr_t baseAddress, uint32_t bytesPerPixel);
+    void invalidate();
+    bool isCached(const Font* pFont,
+                  uint32_t glyphIndex,
+                  uint32_t textColor,
+                  uint32_t backColor) const;
+    const uint8_t* getGlyph(const Font* pFont,
+                            uint32_t glyphIndex,
+                            uint32_t textColor,
+                            uint32_t backColor);
+    uint32_t getSlot(const Font* pFont,
+                     uint32_t glyphIndex,
+                     uint32_t textColor,
+                     uint32_t backColor) const;
+    uint32_t getReaderJobId(uint32_t slot) const;
+    void setReaderJobId(uint32_t slot, uint32_t jobId);
+    const Stats& getStats() const;
+    void resetStats();
+
+    // largest glyph that fits in one cache slot
+    static constexpr uint32_t kMaxGlyphWidth  = 48;
+    static constexpr uint32_t kMaxGlyphHeight = 48;
+    // number of slots and resulting size of the reserved SDRAM region
+    static constexpr uint32_t kNbrOfSlots = 256;
+    static constexpr uint32_t kSlotSize   = kMaxGlyphWidth * kMaxGlyphHeight * 4;
+    static constexpr uint32_t kRegionSize = kNbrOfSlots * kSlotSize;
+
+   private:
+    struct Entry {
+        // cppcheck-suppress unusedStructMember
+        const Font* pFont;
+        // cppcheck-suppress unusedStructMember
+        uint32_t textColor;
+        // cppcheck-suppress unusedStructMember
+        uint32_t backColor;
+        // cppcheck-suppress unusedStructMember
+        uint16_t glyphIndex;
+        // cppcheck-suppress unusedStructMember
+        bool isValid;
+        // last DMA2D job reading the slot, kept when the slot is invalidated
+        // cppcheck-suppress unusedStructMember
+        uint32_t readerJobId;
+    };
+    Entry entries_[kNbrOfSlots] = {};
+    uint8_t* pSlots_            = nullptr;
+    uint32_t bytesPerPixel_     = 4;
+    Stats stats_                = {.hits = 0, .misses = 0, .evictions = 0};
+};
+
+}  // namespace disco
@@ -0,0 +1,113 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file glyph_expander.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Expansion of 1-bpp glyphs into RGB565/ARGB8888 pixels
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#include "glyph_expander.hpp"
+
+#include "color.hpp"
+#include "glyph_row_reader.hpp"
+#include "pixel_kernels.hpp"
+
+namespace disco {
+
+/**
+ * @brief  Expands a 1-bpp glyph (Mono1 or Rle1) into pixels of the framebuffer
+ *         format.
+ * @param  pDst           Destination of the top-left pixel
+ * @param  dstPitch       Distance between two destination rows (in pixels)
+ * @param  pFont          Font the glyph belongs to
+ * @param  glyphIndex     Index of the glyph in the font table
+ * @param  textColor      Foreground color (ARGB8888, palette index for L8)
+ * @param  backColor      Background color (ARGB8888, palette index for L8)
+ * @param  bytesPerPixel  1 for L8, 2 for RGB565, 4 for ARGB8888
+ */
+void expandGlyph(uint8_t* pDst,
+                 uint32_t dstPitch,
+                 const Font* pFont,
+                 uint32_t glyphIndex,
+                 uint32_t textColor,
+                 uint32_t backColor,
+                 uint32_t bytesPerPixel) {
+    GlyphMetrics cell = {.advance   = static_cast<uint8_t>(pFont->width),
+                         .bearingX  = 0,
+                         .boxX      = 0,
+                         .boxY      = 0,
+                         .boxWidth  = static_cast<uint8_t>(pFont->width),
+                         .boxHeight = static_cast<uint8_t>(pFont->height)};
+    expandGlyphBox(
+        pDst, dstPitch, pFont, glyphIndex, cell, textColor, backColor, bytesPerPixel);
+}
+
+/**
+ * @brief  Expands the inked box of a 1-bpp glyph (Mono1 or Rle1) into pixels of
+ *         the framebuffer format. Pixels outside the box are not written.
+ * @param  pDst           Destination of the top-left pixel of the box
+ * @param  dstPitch       Distance between two destination rows (in pixels)
+ * @param  pFont          Font the glyph belongs to
+ * @param  glyphIndex     Index of the glyph in the font table
+ * @param  box            Inked box of the glyph in its bitmap
+ * @param  textColor      Foreground color (ARGB8888, palette index for L8)
+ * @param  backColor      Background color (ARGB8888, palette index for L8)
+ * @param  bytesPerPixel  1 for L8, 2 for RGB565, 4 for ARGB8888
+ */
+void expandGlyphBox(uint8_t* pDst,
+                    uint32_t dstPitch,
+                    const Font* pFont,
+                    uint32_t glyphIndex,
+                    const GlyphMetrics& box,
+                    uint32_t textColor,
+                    uint32_t backColor,
+                    uint32_t bytesPerPixel) {
+    GlyphRowReader reader(pFont, glyphIndex);
+
+    // rows above the box still have to be read, compressed rows are sequential
+    for (uint32_t i = 0; i < box.boxY; i++) {
+        reader.nextRow();
+    }
+
+    // colors are converted once per glyph rather than once per pixel
+    uint16_t text565 = CONVERTARGB88882RGB565(textColor);
+    uint16_t back565 = CONVERTARGB88882RGB565(backColor);
+
+    for (uint32_t i = 0; i < box.boxHeight; i++) {
+        const uint8_t* pchar = reader.nextRow();
+        uint8_t* pRow        = pDst + i * dstPitch * bytesPerPixel;
+        if (bytesPerPixel == 1) {
+            expandMaskRow8(pRow,
+                           pchar,
+                           box.boxX,
+                           box.boxWidth,
+                           static_cast<uint8_t>(textColor),
+                           static_cast<uint8_t>(backColor));
+        } else if (bytesPerPixel == 2) {
+            uint16_t* pRow565 = reinterpret_cast<uint16_t*>(pRow);  // NOLINT
+            expandMaskRow565(pRow565, pchar, box.boxX, box.boxWidth, text565, back565);
+        } else {
+            uint32_t* pRow8888 = reinterpret_cast<uint32_t*>(pRow);  // NOLINT
+            expandMaskRow8888(
+                pRow8888, pchar, box.boxX, box.boxWidth, textColor, backColor);
+        }
+    }
+}
+
+}  // namespace disco
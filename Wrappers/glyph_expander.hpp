@@ -0,0 +1,49 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file glyph_expander.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Expansion of 1-bpp glyphs into RGB565/ARGB8888 pixels
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+#include "fonts.hpp"
+
+namespace disco {
+
+void expandGlyph(uint8_t* pDst,
+                 uint32_t dstPitch,
+                 const Font* pFont,
+                 uint32_t glyphIndex,
+                 uint32_t textColor,
+                 uint32_t backColor,
+                 uint32_t bytesPerPixel);
+void expandGlyphBox(uint8_t* pDst,
+                    uint32_t dstPitch,
+                    const Font* pFont,
+                    uint32_t glyphIndex,
+                    const GlyphMetrics& box,
+                    uint32_t textColor,
+                    uint32_t backColor,
+                    uint32_t bytesPerPixel);
+
+}  // namespace disco
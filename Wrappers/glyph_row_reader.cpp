@@ -0,0 +1,96 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file glyph_row_reader.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Row by row access to 1-bpp glyphs, plain or run-length compressed
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#include "glyph_row_reader.hpp"
+
+namespace disco {
+
+/**
+ * @brief  Prepares the reading of a glyph, starting at its top row.
+ * @param  pFont       Mono1 or Rle1 font
+ * @param  glyphIndex  Index of the glyph in the font
+ */
+GlyphRowReader::GlyphRowReader(const Font* pFont, uint32_t glyphIndex)
+    : pFont_(pFont), bytesPerRow_(getBytesPerRow(pFont)) {
+    if (pFont->format == FontFormat::Rle1) {
+        pData_ = &pFont->table[pFont->glyphOffsets[glyphIndex]];
+        pEnd_  = &pFont->table[pFont->glyphOffsets[glyphIndex + 1]];
+    } else {
+        pData_ = &pFont->table[glyphIndex * getBytesPerGlyph(pFont)];
+    }
+}
+
+/**
+ * @brief  Gets the next row of the glyph in the Mono1 layout (MSB first).
+ * @note   For Rle1 fonts the row is decoded on the fly and the returned buffer is
+ *         overwritten by the next call.
+ * @retval Pointer to the row bits
+ */
+const uint8_t* GlyphRowReader::nextRow() {
+    if (pFont_->format != FontFormat::Rle1) {
+        const uint8_t* pRow = pData_;
+        pData_ += bytesPerRow_;
+        return pRow;
+    }
+
+    for (uint32_t i = 0; i < bytesPerRow_; i++) {
+        row_[i] = 0;
+    }
+
+    uint32_t x = 0;
+    while (x < pFont_->width) {
+        if (remainingInRun_ == 0) {
+            if (pData_ == pEnd_) {
+                // trailing background is not stored
+                break;
+            }
+            // runs alternate between background and foreground
+            remainingInRun_ = *pData_++;
+            isForeground_   = !isForeground_;
+            continue;
+        }
+        uint32_t length = pFont_->width - x;
+        if (remainingInRun_ < length) {
+            length = remainingInRun_;
+        }
+        if (isForeground_) {
+            fillRun(x, length);
+        }
+        x += length;
+        remainingInRun_ -= length;
+    }
+
+    return row_;
+}
+
+/**
+ * @brief  Sets length bits of the row buffer, starting at bit start.
+ */
+void GlyphRowReader::fillRun(uint32_t start, uint32_t length) {
+    for (uint32_t j = start; j < start + length; j++) {
+        row_[j / 8] |= static_cast<uint8_t>(0x80U >> (j % 8));
+    }
+}
+
+}  // namespace disco
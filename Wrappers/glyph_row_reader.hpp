@@ -0,0 +1,54 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file glyph_row_reader.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Row by row access to 1-bpp glyphs, plain or run-length compressed
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+#include "fonts.hpp"
+
+namespace disco {
+
+class GlyphRowReader {
+   public:
+    GlyphRowReader(const Font* pFont, uint32_t glyphIndex);
+
+    const uint8_t* nextRow();
+
+    // widest row that can be decoded (in bytes)
+    static constexpr uint32_t kMaxBytesPerRow = 8;
+
+   private:
+    void fillRun(uint32_t start, uint32_t length);
+
+    const Font* pFont_;
+    const uint8_t* pData_;
+    const uint8_t* pEnd_          = nullptr;
+    uint32_t bytesPerRow_         = 0;
+    uint32_t remainingInRun_      = 0;
+    bool isForeground_            = true;
+    uint8_t row_[kMaxBytesPerRow] = {0};
+};
+
+}  // namespace disco
@@ -24,10 +24,20 @@
 
 #include "lcd_display.hpp"
 
+#include "color.hpp"
+#include "font_metrics.hpp"
+#include "glyph_row_reader.hpp"
+#include "pixel_kernels.hpp"
+
+#include <string.h>
+
 // from DISCO_H747I/Drivers/BSP/STM32H747I-DISCO
 #include "stm32h747i_discovery_bus.h"
 #include "stm32h747i_discovery_sdram.h"
 
+// from DISCO_H747I/Utilities/lcd
+#include "stm32_lcd.h"
+
 // from DISCO_H747I/Drivers/STM32H7xx_HAL_Driver
 #include "mbed_trace.h"
 #include "stdio.h"
@@ -47,18 +57,10 @@ namespace disco {
 static constexpr uint8_t pCol_[]  = {0x00, 0x00, 0x03, 0x1F}; /*   0 -> 799 */
 static constexpr uint8_t pPage_[] = {
     0x00, 0x00, 0x03, 0x1F};  //= {0x00, 0x00, 0x01, 0xDF}; /*   0 -> 479 */
-static constexpr uint8_t pSyncLeft_[] = {0x02, 0x15}; /* Scan @ 533 */
-static constexpr uint32_t HACT        = 800; /* !!!! SCREEN DIVIDED INTO 2 AREAS !!!! */
-
-#define CONVERTARGB88882RGB565(Color)                   \
-    ((((Color & 0xFFU) >> 3) & 0x1FU) |                 \
-     (((((Color & 0xFF00U) >> 8) >> 2) & 0x3FU) << 5) | \
-     (((((Color & 0xFF0000U) >> 16) >> 3) & 0x1FU) << 11))
+static constexpr uint32_t HACT = 800; /* !!!! SCREEN DIVIDED INTO 2 AREAS !!!! */
 
-#define CONVERTRGB5652ARGB8888(Color)                        \
-    (((((((Color >> 11) & 0x1FU) * 527) + 23) >> 6) << 16) | \
-     ((((((Color >> 5) & 0x3FU) * 259) + 33) >> 6) << 8) |   \
-     ((((Color & 0x1FU) * 527) + 23) >> 6) | 0xFF000000)
+// display whose buffers are flipped from the DSI interrupt callbacks
+static LCDDisplay* pInterruptDisplay = nullptr;
 
 /**
  * @brief  Configure the MPU attributes as Write Through for External SDRAM.
@@ -114,10 +116,20 @@ static void MPU_Config(void) {
  *     - DSI ititialization
  *     - LTDC ititialization
  *     - OTM8009A LCD Display IC Driver ititialization
- * @param  None
+ * @param  bufferingMode  SINGLE_BUFFER draws in the buffer read by the display,
+ *                        DOUBLE_BUFFER draws in a back buffer that is swapped
+ *                        with the displayed one on refresh
+ * @param  pixelFormat    Format of the frame buffers, also used on the DSI link
+ *                        and in the panel memory (RGB888 for ARGB8888 and L8,
+ *                        whose indices are looked up in the palette by the LTDC)
  * @retval LCD state
  */
-ReturnCode LCDDisplay::init() {
+ReturnCode LCDDisplay::init(BufferingMode bufferingMode, PixelFormat pixelFormat) {
+    bufferingMode_    = bufferingMode;
+    pInterruptDisplay = this;
+    bool isRGB565     = (pixelFormat == PixelFormat::RGB565);
+    bool isL8         = (pixelFormat == PixelFormat::L8);
+
     /* Configure the MPU attributes as Write Through for SDRAM*/
     MPU_Config();
 
@@ -173,7 +185,7 @@ ReturnCode LCDDisplay::init() {
     cmdCfg_.HSPolarity            = DSI_HSYNC_ACTIVE_HIGH;
     cmdCfg_.VSPolarity            = DSI_VSYNC_ACTIVE_HIGH;
     cmdCfg_.DEPolarity            = DSI_DATA_ENABLE_ACTIVE_HIGH;
-    cmdCfg_.ColorCoding           = DSI_RGB888;
+    cmdCfg_.ColorCoding           = isRGB565 ? DSI_RGB565 : DSI_RGB888;
     cmdCfg_.CommandSize           = HACT;
     cmdCfg_.TearingEffectSource   = DSI_TE_DSILINK;
     cmdCfg_.TearingEffectPolarity = DSI_TE_RISING_EDGE;
@@ -219,7 +231,9 @@ ReturnCode LCDDisplay::init() {
     ioCtx.ReadReg       = DSI_IO_Read;
     OTM8009A_RegisterBusIO(&otm8009AObj_, &ioCtx);
     lcd_CompObj_ = (&otm8009AObj_);
-    OTM8009A_Init(lcd_CompObj_, OTM8009A_COLMOD_RGB888, LCD_ORIENTATION_LANDSCAPE);
+    OTM8009A_Init(lcd_CompObj_,
+                  isRGB565 ? OTM8009A_FORMAT_RBG565 : OTM8009A_FORMAT_RGB888,
+                  LCD_ORIENTATION_LANDSCAPE);
 
     lpCmd_.LPGenShortWriteNoP  = DSI_LP_GSW0P_DISABLE;
     lpCmd_.LPGenShortWriteOneP = DSI_LP_GSW1P_DISABLE;
@@ -241,25 +255,54 @@ ReturnCode LCDDisplay::init() {
     // Lcd_Ctx is declared in "stm32h747i_discovery_lcd.h"
     Lcd_Ctx[0].ActiveLayer = currentLCDLayer_;
     Lcd_Ctx[0].PixelFormat = LCD_PIXEL_FORMAT_ARGB8888;
-    Lcd_Ctx[0].BppFactor   = 4; /* 4 Bytes Per Pixel for ARGB8888 */
-    Lcd_Ctx[0].XSize       = 800;
-    Lcd_Ctx[0].YSize       = 480;
+    Lcd_Ctx[0].BppFactor   = 4; /* Bytes Per Pixel */
+    if (isRGB565) {
+        Lcd_Ctx[0].PixelFormat = LCD_PIXEL_FORMAT_RGB565;
+        Lcd_Ctx[0].BppFactor   = 2;
+    } else if (isL8) {
+        Lcd_Ctx[0].PixelFormat = LCD_PIXEL_FORMAT_L8;
+        Lcd_Ctx[0].BppFactor   = 1;
+    }
+    Lcd_Ctx[0].XSize = 800;
+    Lcd_Ctx[0].YSize = 480;
 
     /* Disable DSI Wrapper in order to access and configure the LTDC */
     __HAL_DSI_WRAPPER_DISABLE(&hlcd_dsi);
 
     /* Initialize LTDC layer 0 iused for Hint */
-    LCD_LayerInit(currentLCDLayer_, LCD_FRAME_BUFFER);
+    LCD_LayerInit(LCD_BACKGROUND_LAYER, frontBuffer_[LCD_BACKGROUND_LAYER]);
     funcDriver_.GetXSize(0, &lcdXsize_);
     funcDriver_.GetYSize(0, &lcdYsize_);
     funcDriver_.GetFormat(0, &lcdPixelFormat_);
 
+    /* Expanded glyphs are stored in the framebuffer pixel format */
+    glyphCache_.init(GLYPH_CACHE_ADDRESS, Lcd_Ctx[0].BppFactor);
+
+    /* Areas drawn with the UTIL_LCD functions are refreshed like the others */
+    UTIL_LCD_SetDrawHook(&LCDDisplay::onExternalDraw, this);
+
     /* Update pitch : the draw is done on the whole physical X Size */
-    HAL_LTDC_SetPitch(&hlcd_ltdc, Lcd_Ctx[0].XSize, currentLCDLayer_);
+    HAL_LTDC_SetPitch(&hlcd_ltdc, Lcd_Ctx[0].XSize, LCD_BACKGROUND_LAYER);
+
+    /* In double-buffered mode, drawing goes to the back buffers. The overlay
+       layer is only enabled by enableOverlay() */
+    for (uint32_t i = 0; i < kMaxNbrOfLayers; i++) {
+        setDrawBuffer(i,
+                      (bufferingMode_ == BufferingMode::DOUBLE_BUFFER) ? backBuffer_[i]
+                                                                       : frontBuffer_[i]);
+    }
 
     /* Enable DSI Wrapper so DSI IP will drive the LTDC */
     __HAL_DSI_WRAPPER_ENABLE(&hlcd_dsi);
 
+    /* Load the default palette in the CLUT of the L8 layer */
+    updatePalette();
+
+    /* Measure from which size fills are faster on the DMA2D than on the CPU, in
+       the draw buffer of the background, which is cleared below */
+    DrawDispatcher::getInstance().calibrate(
+        hlcd_ltdc.LayerCfg[LCD_BACKGROUND_LAYER].FBStartAdress);
+
     HAL_DSI_LongWrite(&hlcd_dsi,
                       0,
                       DSI_DCS_LONG_PKT_WRITE,
@@ -277,7 +320,9 @@ ReturnCode LCDDisplay::init() {
                       // NOLINTNEXTLINE(readability/casting)
                       (uint8_t*)pPage_);
 
-    setFont(createFont36());
+    for (uint32_t i = 0; i < kMaxNbrOfLayers; i++) {
+        drawProp_[i].pFont = selectFont<36>();
+    }
 
     fillDisplay(LCD_COLOR_WHITE);
 
@@ -285,10 +330,138 @@ ReturnCode LCDDisplay::init() {
 }
 
 void LCDDisplay::fillDisplay(uint32_t color) {
-    fillRectangle(0, 0, lcdXsize_, lcdYsize_, color);
+    fillRect(0, 0, lcdXsize_, lcdYsize_, color);
+    refreshLCD();
+}
+
+/**
+ * @brief  Replaces the palette of the L8 framebuffer. The whole display is
+ *         refreshed, as pixels keep their index and take the new colors.
+ * @note   In the other pixel formats, the palette is only kept for a later use.
+ * @param  pColors      Colors (ARGB8888), the alpha is ignored
+ * @param  nbrOfColors  Number of colors, at most 256
+ */
+void LCDDisplay::setPalette(const uint32_t* pColors, uint32_t nbrOfColors) {
+    palette_.setColors(pColors, nbrOfColors);
+    updatePalette();
+}
+
+/**
+ * @brief  Changes one color of the palette of the L8 framebuffer. Rewriting
+ *         only the CLUT animates every pixel using the index, without drawing.
+ * @note   Changes done in a frame (see beginFrame()) are refreshed together.
+ * @param  index  Palette index
+ * @param  color  New color (ARGB8888), the alpha is ignored
+ */
+void LCDDisplay::setPaletteColor(uint8_t index, uint32_t color) {
+    palette_.setColor(index, color);
+    updatePalette();
+}
+
+/**
+ * @brief  Enables the overlay layer, composed over the background layer by the
+ *         LTDC on each transfer: values drawn on the overlay are redrawn without
+ *         repainting what is behind them. The overlay starts transparent.
+ * @note   Per-pixel alpha needs ARGB8888 frame buffers, the overlay of RGB565 and
+ *         L8 frame buffers uses COLOR_KEY transparency. Keying compares the
+ *         displayed colors: in L8, the key color must be in the palette.
+ * @param  transparency  ALPHA blends the overlay pixels by their alpha, COLOR_KEY
+ *                       shows the background behind the pixels of the key color
+ * @param  colorKey      Key color (ARGB8888), unused with ALPHA
+ */
+void LCDDisplay::enableOverlay(Transparency transparency, uint32_t colorKey) {
+    if (lcdPixelFormat_ != LCD_PIXEL_FORMAT_ARGB8888) {
+        transparency = Transparency::COLOR_KEY;
+    }
+    transparentColor_ =
+        (transparency == Transparency::ALPHA) ? LCD_COLOR_TRANSPARENT : colorKey;
+
+    /* Clear the overlay buffers, fillRect() draws in the active layer */
+    uint32_t activeLayer = currentLCDLayer_;
+    currentLCDLayer_     = LCD_OVERLAY_LAYER;
+    setDrawBuffer(LCD_OVERLAY_LAYER, frontBuffer_[LCD_OVERLAY_LAYER]);
+    fillRect(0, 0, lcdXsize_, lcdYsize_, transparentColor_);
+    if (bufferingMode_ == BufferingMode::DOUBLE_BUFFER) {
+        setDrawBuffer(LCD_OVERLAY_LAYER, backBuffer_[LCD_OVERLAY_LAYER]);
+        fillRect(0, 0, lcdXsize_, lcdYsize_, transparentColor_);
+    }
+    currentLCDLayer_ = activeLayer;
+    waitForDrawing();
+    waitForRefresh();
+
+    /* Disable DSI Wrapper in order to access and configure the LTDC */
+    __HAL_DSI_WRAPPER_DISABLE(&hlcd_dsi);
+    LCD_LayerInit(LCD_OVERLAY_LAYER, frontBuffer_[LCD_OVERLAY_LAYER]);
+    HAL_LTDC_SetPitch(&hlcd_ltdc, Lcd_Ctx[0].XSize, LCD_OVERLAY_LAYER);
+    if (transparency == Transparency::COLOR_KEY) {
+        HAL_LTDC_ConfigColorKeying(&hlcd_ltdc, colorKey & 0x00FFFFFFU, LCD_OVERLAY_LAYER);
+        HAL_LTDC_EnableColorKeying(&hlcd_ltdc, LCD_OVERLAY_LAYER);
+    } else {
+        HAL_LTDC_DisableColorKeying(&hlcd_ltdc, LCD_OVERLAY_LAYER);
+    }
+    __HAL_DSI_WRAPPER_ENABLE(&hlcd_dsi);
+    isOverlayEnabled_ = true;
+
+    if (lcdPixelFormat_ == LCD_PIXEL_FORMAT_L8) {
+        loadPalette(LCD_OVERLAY_LAYER);
+    }
+
+    /* Configuring the layer pointed the handle at the front buffer */
+    if (bufferingMode_ == BufferingMode::DOUBLE_BUFFER) {
+        setDrawBuffer(LCD_OVERLAY_LAYER, backBuffer_[LCD_OVERLAY_LAYER]);
+    }
+}
+
+/**
+ * @brief  Disables the overlay layer, whose content is removed from the display.
+ *         Drawing goes back to the background layer.
+ */
+void LCDDisplay::disableOverlay() {
+    if (!isOverlayEnabled_) {
+        return;
+    }
+    waitForDrawing();
+    waitForRefresh();
+
+    /* Disable DSI Wrapper in order to access and configure the LTDC */
+    __HAL_DSI_WRAPPER_DISABLE(&hlcd_dsi);
+    __HAL_LTDC_LAYER_DISABLE(&hlcd_ltdc, LCD_OVERLAY_LAYER);
+    __HAL_LTDC_RELOAD_IMMEDIATE_CONFIG(&hlcd_ltdc);
+    __HAL_DSI_WRAPPER_ENABLE(&hlcd_dsi);
+    isOverlayEnabled_ = false;
+
+    textSlots_[LCD_OVERLAY_LAYER].invalidate();
+    setActiveLayer(LCD_BACKGROUND_LAYER);
+    damage_.add({.x = 0, .y = 0, .width = lcdXsize_, .height = lcdYsize_});
     refreshLCD();
 }
 
+/**
+ * @brief  Selects the layer drawing functions write to. Each layer has its own
+ *         font, text and background colors.
+ * @param  layerIndex  LCD_BACKGROUND_LAYER or LCD_OVERLAY_LAYER
+ */
+void LCDDisplay::setActiveLayer(uint32_t layerIndex) {
+    if (layerIndex >= kMaxNbrOfLayers) {
+        return;
+    }
+    currentLCDLayer_ = layerIndex;
+    funcDriver_.SetLayer(lcdDevice_, layerIndex);
+}
+
+/**
+ * @brief  Gets the layer drawing functions write to.
+ * @retval LCD_BACKGROUND_LAYER or LCD_OVERLAY_LAYER
+ */
+uint32_t LCDDisplay::getActiveLayer() const { return currentLCDLayer_; }
+
+/**
+ * @brief  Gets the color that shows the background through the overlay, e.g. to
+ *         erase a value or as background color of overlay text.
+ * @retval LCD_COLOR_TRANSPARENT, or the key color in COLOR_KEY transparency
+ */
+uint32_t LCDDisplay::getTransparentColor() const { return transparentColor_; }
+
 void LCDDisplay::fillRectangle(
     uint32_t xPos, uint32_t yPos, uint32_t width, uint32_t height, uint32_t color) {
     fillRect(xPos, yPos, width, height, color);
@@ -297,56 +470,742 @@ void LCDDisplay::fillRectangle(
 
 void LCDDisplay::displayPicture(
     const uint32_t* pSrc, uint16_t x, uint16_t y, uint16_t xsize, uint16_t ysize) {
-    uint32_t destination = (uint32_t)LCD_FRAME_BUFFER + (y * 800 + x) * 4;
+    uint32_t destination = hlcd_ltdc.LayerCfg[currentLCDLayer_].FBStartAdress +
+                           Lcd_Ctx[0].BppFactor * (lcdXsize_ * y + x);
     uint32_t source      = (uint32_t)pSrc;
 
-    /*##-1- Configure the DMA2D Mode, Color Mode and output offset #############*/
-    hdma2d_.Init.Mode          = DMA2D_M2M;
-    hdma2d_.Init.ColorMode     = DMA2D_OUTPUT_ARGB8888;
-    hdma2d_.Init.OutputOffset  = 800 - xsize;
-    hdma2d_.Init.AlphaInverted = DMA2D_REGULAR_ALPHA; /* No Output Alpha Inversion*/
-    hdma2d_.Init.RedBlueSwap   = DMA2D_RB_REGULAR;    /* No Output Red & Blue swap */
-
-    /*##-2- DMA2D Callbacks Configuration ######################################*/
-    hdma2d_.XferCpltCallback = NULL;
-
-    /*##-3- Foreground Configuration ###########################################*/
-    hdma2d_.LayerCfg[currentLCDLayer_].AlphaMode      = DMA2D_REPLACE_ALPHA;
-    hdma2d_.LayerCfg[currentLCDLayer_].InputAlpha     = 0x00;
-    hdma2d_.LayerCfg[currentLCDLayer_].InputColorMode = DMA2D_INPUT_ARGB8888;
-    hdma2d_.LayerCfg[currentLCDLayer_].InputOffset    = 0xFF;
-    hdma2d_.LayerCfg[currentLCDLayer_].RedBlueSwap =
-        DMA2D_RB_REGULAR; /* No ForeGround Red/Blue swap */
-    hdma2d_.LayerCfg[currentLCDLayer_].AlphaInverted =
-        DMA2D_INVERTED_ALPHA; /* No ForeGround Alpha inversion */
-
-    hdma2d_.Instance = DMA2D;
-
-    /* DMA2D Initialization */
-    if (HAL_DMA2D_Init(&hdma2d_) == HAL_OK) {
-        if (HAL_DMA2D_ConfigLayer(&hdma2d_, 1) == HAL_OK) {
-            if (HAL_DMA2D_Start(&hdma2d_, source, destination, xsize, ysize) == HAL_OK) {
-                /* Polling For DMA transfer */
-                HAL_DMA2D_PollForTransfer(&hdma2d_, 100);
+    invalidate({.x = x, .y = y, .width = xsize, .height = ysize});
+
+    if (lcdPixelFormat_ == LCD_PIXEL_FORMAT_L8) {
+        // the DMA2D cannot write L8 pixels, each color is replaced by its nearest
+        // palette index
+        waitForDrawing();
+        uint8_t* pRow = reinterpret_cast<uint8_t*>(destination);  // NOLINT
+        for (uint32_t i = 0; i < ysize; i++) {
+            for (uint32_t j = 0; j < xsize; j++) {
+                pRow[j] = palette_.findIndex(*pSrc++);
             }
+            pRow += lcdXsize_;
         }
+        refreshLCD();
+        return;
     }
 
-    /* set the refresh area to LCD left half */
-    HAL_DSI_LongWrite(&hlcd_dsi,
-                      0,
-                      DSI_DCS_LONG_PKT_WRITE,
-                      2,
-                      OTM8009A_CMD_WRTESCN,
-                      // cppcheck-suppress cstyleCast
-                      // NOLINTNEXTLINE(readability/casting)
-                      (uint8_t*)pSyncLeft_);
+    /* Queue the copy, the picture is read while the next drawings are issued.
+       ARGB8888 pictures are converted by the DMA2D for an RGB565 framebuffer */
+    Dma2dJob job          = {};
+    job.sourceMode        = Dma2dColorMode::ARGB8888;
+    job.destinationMode   = getFrameBufferMode();
+    job.operation         = (job.destinationMode == Dma2dColorMode::ARGB8888)
+                                ? Dma2dOperation::Copy
+                                : Dma2dOperation::Convert;
+    job.source            = source;
+    job.destination       = destination;
+    job.width             = xsize;
+    job.height            = ysize;
+    job.destinationOffset = lcdXsize_ - xsize;
+    submit(job);
 
     /* Refresh the LCD */
-    HAL_DSI_Refresh(&hlcd_dsi);
+    refreshLCD();
+}
+
+/**
+ * @brief  Transfers the areas drawn since the last refresh to the display. In
+ *         double-buffered mode, the back buffer is swapped with the displayed one.
+ */
+void LCDDisplay::refreshLCD() {
+    if (frameDepth_ > 0) {
+        // deferred to endFrame()
+        return;
+    }
+    if (bufferingMode_ == BufferingMode::DOUBLE_BUFFER) {
+        swapBuffers();
+        return;
+    }
+
+    waitForFrameSlot();
+    waitForDrawing();
+    waitForRefresh();
+    takeDamage();
+    if (nbrOfRefreshRects_ > 0) {
+        isRefreshing_ = true;
+        refreshNextArea();
+    }
+}
+
+/**
+ * @brief  Starts a frame: until the matching endFrame(), drawing functions only
+ *         update the frame buffer and refreshes are deferred. Frames may be
+ *         nested, only the outermost one refreshes.
+ */
+void LCDDisplay::beginFrame() { frameDepth_++; }
+
+/**
+ * @brief  Ends a frame started with beginFrame(). Ending the outermost frame
+ *         refreshes everything drawn in it at once.
+ */
+void LCDDisplay::endFrame() {
+    if (frameDepth_ == 0) {
+        return;
+    }
+    frameDepth_--;
+    if (frameDepth_ == 0) {
+        refreshLCD();
+    }
+}
+
+/**
+ * @brief  Waits until the DMA2D completed all queued drawing operations. Drawing
+ *         functions return as soon as their transfer is queued: a picture given
+ *         to displayPicture() must not be changed before this returns. Pending
+ *         fills are queued first.
+ */
+void LCDDisplay::waitForDrawing() {
+    flushFills();
+    dma2dQueue_.waitAll();
+}
+
+/**
+ * @brief  Tells whether all drawing operations are done, after which the CPU may
+ *         write the framebuffer.
+ * @retval true if no fill is pending and no DMA2D job is queued
+ */
+bool LCDDisplay::isDrawingDone() const {
+    return fillBatcher_.getNbrOfFills() == 0 && dma2dQueue_.getNbrOfPendingJobs() == 0;
+}
+
+/**
+ * @brief  Tells whether a frame is being transferred to the display, or waits
+ *         for the tearing effect signal to be transferred.
+ * @retval true until the end of the transfer of the last refreshed frame
+ */
+bool LCDDisplay::isRefreshing() const { return isFlipPending_ || isRefreshing_; }
+
+/**
+ * @brief  Sets the function called when a frame was transferred to the display.
+ * @note   The callback runs in the DSI interrupt.
+ * @param  callback  Function to call, nullptr for none
+ */
+void LCDDisplay::setRefreshCallback(RefreshCallback callback) {
+    refreshCallback_ = callback;
+}
+
+/**
+ * @brief  Sets how refreshes are paced. With CAP_RATE, a refresh waits until a
+ *         frame period elapsed since the start of the previous transfer. With
+ *         FIXED_RATE, refreshes wait for the next slot of a regular grid of
+ *         frame periods, so that the frame rate does not drift; a refresh
+ *         issued more than one period late skips the missed slots.
+ * @param  framePacing      Pacing mode
+ * @param  framesPerSecond  Frame rate capped or targeted, unused with NO_PACING
+ */
+void LCDDisplay::setFramePacing(FramePacing framePacing, uint32_t framesPerSecond) {
+    if (framePacing == FramePacing::NO_PACING || framesPerSecond == 0) {
+        framePacing_ = FramePacing::NO_PACING;
+        return;
+    }
+    framePacing_   = framePacing;
+    framePeriod_   = 1000000 / framesPerSecond;
+    nextFrameSlot_ = us_ticker_read();
+}
+
+/**
+ * @brief  Gets the frame counters, updated at the end of each transfer.
+ * @retval Frame statistics
+ */
+const LCDDisplay::FrameStats& LCDDisplay::getFrameStats() const { return frameStats_; }
+
+/**
+ * @brief  Resets the frame counters.
+ */
+void LCDDisplay::resetFrameStats() {
+    frameStats_ = {.nbrOfFrames       = 0,
+                   .lastFrameTime     = 0,
+                   .maxFrameTime      = 0,
+                   .lastTransferTime  = 0,
+                   .nbrOfMissedSlots  = 0,
+                   .lastScanline      = 0,
+                   .nbrOfLeadingSwaps = 0,
+                   .nbrOfTornSwaps    = 0,
+                   .lastLatency       = 0,
+                   .maxLatency        = 0};
 }
 
-void LCDDisplay::refreshLCD() { HAL_DSI_Refresh(&hlcd_dsi); }
+/**
+ * @brief  Presents the back buffer: the LTDC layer is pointed at it and its
+ *         transfer over DSI starts on the next tearing effect of the panel, so
+ *         that the panel never shows a partly updated frame. The frame is then
+ *         copied to the former front buffer, which becomes the new back buffer,
+ *         and drawing can go on while the transfer is in progress.
+ * @note   Waits for the transfer of the previous frame, whose buffer is reused.
+ */
+void LCDDisplay::swapBuffers() {
+    if (bufferingMode_ == BufferingMode::SINGLE_BUFFER) {
+        refreshLCD();
+        return;
+    }
+    if (frameDepth_ > 0 || damage_.getNbrOfRects() == 0) {
+        // deferred to endFrame(), or nothing to present
+        return;
+    }
+
+    waitForFrameSlot();
+    waitForDrawing();
+    waitForRefresh();
+
+    /* Point the layers at the drawn frame, the wrapper must be off to access LTDC */
+    __HAL_DSI_WRAPPER_DISABLE(&hlcd_dsi);
+    for (uint32_t i = 0; i < getNbrOfLayers(); i++) {
+        HAL_LTDC_SetAddress(&hlcd_ltdc, backBuffer_[i], i);
+    }
+    __HAL_DSI_WRAPPER_ENABLE(&hlcd_dsi);
+
+    for (uint32_t i = 0; i < getNbrOfLayers(); i++) {
+        uint32_t drawnBuffer = backBuffer_[i];
+        backBuffer_[i]       = frontBuffer_[i];
+        frontBuffer_[i]      = drawnBuffer;
+    }
+    takeDamage();
+    scheduleScanline();
+
+    /* The refresh is started by onTearingEffect() */
+    swapTime_      = us_ticker_read();
+    isFlipPending_ = true;
+    HAL_DSI_ShortWrite(
+        &hlcd_dsi, 0, DSI_DCS_SHORT_PKT_WRITE_P1, OTM8009A_CMD_TEEON, 0x00);
+
+    /* Next frames are drawn incrementally, on top of a copy of this one: only
+       the areas drawn in this frame differ between the two buffers. copyRect()
+       draws in the active layer, which is restored afterwards */
+    uint32_t activeLayer = currentLCDLayer_;
+    for (uint32_t layer = 0; layer < getNbrOfLayers(); layer++) {
+        setDrawBuffer(layer, backBuffer_[layer]);
+        currentLCDLayer_ = layer;
+        for (uint32_t i = 0; i < nbrOfRefreshRects_; i++) {
+            const Rect& area = refreshRects_[i];
+            if (layer == scrollLayer_ && isInScrollArea(area)) {
+                // drawn in the virtual buffer, shared by both frames
+                continue;
+            }
+            uint32_t source = frontBuffer_[layer] +
+                              Lcd_Ctx[0].BppFactor * (lcdXsize_ * area.y + area.x);
+            // cppcheck-suppress cstyleCast
+            // NOLINTNEXTLINE(readability/casting)
+            copyRect(area.x,
+                     area.y,
+                     (const uint8_t*)source,
+                     area.width,
+                     area.height,
+                     lcdXsize_ - area.width);
+        }
+    }
+    currentLCDLayer_ = activeLayer;
+}
+
+/**
+ * @brief  Starts the transfer of a swapped frame, on the tearing effect signal
+ *         of the panel.
+ */
+void LCDDisplay::onTearingEffect() {
+    if (!isFlipPending_) {
+        return;
+    }
+
+    /* Mask the tearing effect until the next swap */
+    HAL_DSI_ShortWrite(
+        &hlcd_dsi, 0, DSI_DCS_SHORT_PKT_WRITE_P1, OTM8009A_CMD_TEOFF, 0x00);
+    isFlipPending_ = false;
+    isRefreshing_  = true;
+    refreshNextArea();
+
+    uint32_t latency        = us_ticker_read() - swapTime_ + scanDelayNs_ / 1000;
+    frameStats_.lastLatency = latency;
+    if (latency > frameStats_.maxLatency) {
+        frameStats_.maxLatency = latency;
+    }
+}
+
+/**
+ * @brief  Goes on with the next damaged area once the transfer of an area is
+ *         done. The displayed buffer is released after the last one.
+ */
+void LCDDisplay::onEndOfRefresh() {
+    if (isRefreshing_) {
+        refreshNextArea();
+    }
+}
+
+/**
+ * @brief  Records an area about to be drawn in the current buffer: the next
+ *         refreshLCD() or swapBuffers() transfers it and the strings remembered
+ *         under it are forgotten. Drawing done with the UTIL_LCD functions is
+ *         recorded automatically, direct BSP_LCD drawing must be reported with
+ *         this call and wait for waitForDrawing(), as the queued jobs and the
+ *         pending fills may still write the framebuffer.
+ * @param  area  Area about to be drawn, clipped to the display
+ */
+void LCDDisplay::invalidate(const Rect& area) {
+    textSlots_[currentLCDLayer_].invalidate(area);
+    if (area.x >= lcdXsize_ || area.y >= lcdYsize_) {
+        return;
+    }
+    Rect clipped = area;
+    if (clipped.x + clipped.width > lcdXsize_) {
+        clipped.width = lcdXsize_ - clipped.x;
+    }
+    if (clipped.y + clipped.height > lcdYsize_) {
+        clipped.height = lcdYsize_ - clipped.y;
+    }
+    waitForRefreshOf(clipped);
+    damage_.add(clipped);
+}
+
+/**
+ * @brief  Waits until the previous frame was transferred to the display.
+ */
+void LCDDisplay::waitForRefresh() {
+    while (isFlipPending_ || isRefreshing_) {
+    }
+}
+
+/**
+ * @brief  In single-buffered mode, waits until the running refresh no longer
+ *         reads an area before it is drawn over. Drawing elsewhere overlaps the
+ *         transfer.
+ * @param  area  Area about to be drawn
+ */
+void LCDDisplay::waitForRefreshOf(const Rect& area) {
+    if (bufferingMode_ == BufferingMode::DOUBLE_BUFFER) {
+        // drawing goes to the back buffer, never transferred
+        return;
+    }
+    for (uint32_t i = 0; i < nbrOfRefreshRects_ && isRefreshing_; i++) {
+        if (intersects(refreshRects_[i], area)) {
+            // area i is transferred until area i + 1 (or the display window) is set
+            while (isRefreshing_ && refreshIndex_ <= i + 1) {
+            }
+        }
+    }
+}
+
+/**
+ * @brief  Waits for the time slot of the next frame, as set by setFramePacing().
+ */
+void LCDDisplay::waitForFrameSlot() {
+    if (framePacing_ == FramePacing::CAP_RATE) {
+        while (us_ticker_read() - lastTransferStart_ < framePeriod_) {
+        }
+    } else if (framePacing_ == FramePacing::FIXED_RATE) {
+        // tick differences are signed as slots may be ahead of or behind the time
+        int32_t lateness = static_cast<int32_t>(us_ticker_read() - nextFrameSlot_);
+        if (lateness > static_cast<int32_t>(framePeriod_)) {
+            frameStats_.nbrOfMissedSlots += lateness / framePeriod_;
+            nextFrameSlot_ += (lateness / framePeriod_) * framePeriod_;
+        }
+        while (static_cast<int32_t>(us_ticker_read() - nextFrameSlot_) < 0) {
+        }
+        nextFrameSlot_ += framePeriod_;
+    }
+}
+
+/**
+ * @brief  Chooses the panel scan line that triggers the transfer of a swapped
+ *         frame. The areas are transferred in the order of the panel scan. If
+ *         the transfer keeps ahead of the scan, it starts just before the scan
+ *         reaches the first area and is shown in the current panel frame.
+ *         Otherwise it starts just after the scan left the last area and is
+ *         shown in the next panel frame.
+ */
+void LCDDisplay::scheduleScanline() {
+    // sort the areas along the scan direction
+    for (uint32_t i = 1; i < nbrOfRefreshRects_; i++) {
+        Rect area  = refreshRects_[i];
+        uint32_t j = i;
+        while (j > 0 && refreshRects_[j - 1].x > area.x) {
+            refreshRects_[j] = refreshRects_[j - 1];
+            j--;
+        }
+        refreshRects_[j] = area;
+    }
+
+    uint32_t firstColumn = refreshRects_[0].x;
+    uint32_t lastColumn  = 0;
+    for (uint32_t i = 0; i < nbrOfRefreshRects_; i++) {
+        const Rect& area = refreshRects_[i];
+        if (area.x + area.width - 1 > lastColumn) {
+            lastColumn = area.x + area.width - 1;
+        }
+    }
+
+    uint32_t scanline =
+        (firstColumn + kPanelScanLines - kScanlineMargin) % kPanelScanLines;
+    if (isClearOfScan(scanline)) {
+        frameStats_.nbrOfLeadingSwaps++;
+    } else {
+        scanline = lastColumn + kScanlineMargin;
+        if (scanline >= kPanelScanLines) {
+            scanline = kPanelScanLines - 1;
+        }
+        if (!isClearOfScan(scanline)) {
+            // too much to transfer in a panel frame
+            frameStats_.nbrOfTornSwaps++;
+        }
+    }
+    frameStats_.lastScanline = scanline;
+    scanDelayNs_             = getScanDelay(lastColumn, scanline);
+
+    uint8_t scanlineBytes[2] = {static_cast<uint8_t>(scanline >> 8),
+                                static_cast<uint8_t>(scanline & 0xFF)};
+    HAL_DSI_LongWrite(
+        &hlcd_dsi, 0, DSI_DCS_LONG_PKT_WRITE, 2, OTM8009A_CMD_WRTESCN, scanlineBytes);
+}
+
+/**
+ * @brief  Checks that a transfer started when the panel scans a line writes
+ *         every column of the areas before the scan reads it again. The time
+ *         to write the areas is estimated from the transfer time per pixel.
+ * @param  scanline  Line of the tearing effect
+ * @retval true if the transfer does not tear
+ */
+bool LCDDisplay::isClearOfScan(uint32_t scanline) const {
+    uint32_t timeNs = 0;
+    for (uint32_t i = 0; i < nbrOfRefreshRects_; i++) {
+        const Rect& area      = refreshRects_[i];
+        uint32_t areaTimeNs   = kAreaSetupTimeNs + getArea(area) * pixelTimeNs_;
+        uint32_t columnTimeNs = areaTimeNs / area.width;
+        // columns are written at a constant pace, checking both ends is enough
+        if (timeNs + kAreaSetupTimeNs + columnTimeNs > getScanDelay(area.x, scanline) ||
+            timeNs + areaTimeNs > getScanDelay(area.x + area.width - 1, scanline)) {
+            return false;
+        }
+        timeNs += areaTimeNs;
+    }
+    return true;
+}
+
+/**
+ * @brief  Gets the time the panel scan takes from a line to a column.
+ * @param  column    Display column
+ * @param  scanline  Line scanned at time 0
+ * @retval Time in ns
+ */
+uint32_t LCDDisplay::getScanDelay(uint32_t column, uint32_t scanline) const {
+    return ((column + kPanelScanLines - scanline) % kPanelScanLines) * kPanelLineTimeNs;
+}
+
+/**
+ * @brief  Moves the damaged areas to the list of areas to refresh. Areas are
+ *         split at the bounds of the scroll area, whose rows are read from the
+ *         virtual buffer.
+ */
+void LCDDisplay::takeDamage() {
+    nbrOfRefreshRects_  = 0;
+    nbrOfRefreshPixels_ = 0;
+    for (uint32_t i = 0; i < damage_.getNbrOfRects(); i++) {
+        Rect area = damage_.getRect(i);
+        if (scrollHeight_ > 0) {
+            uint32_t bounds[2] = {scrollTop_, scrollTop_ + scrollHeight_};
+            for (uint32_t bound : bounds) {
+                if (area.y < bound && area.y + area.height > bound) {
+                    addRefreshRect({.x      = area.x,
+                                    .y      = area.y,
+                                    .width  = area.width,
+                                    .height = bound - area.y});
+                    area.height -= bound - area.y;
+                    area.y       = bound;
+                }
+            }
+        }
+        addRefreshRect(area);
+    }
+    refreshIndex_ = 0;
+    damage_.clear();
+}
+
+/**
+ * @brief  Appends an area to the list of areas to refresh.
+ * @param  area  Area to transfer
+ */
+void LCDDisplay::addRefreshRect(const Rect& area) {
+    refreshRects_[nbrOfRefreshRects_++]  = area;
+    nbrOfRefreshPixels_                 += getArea(area);
+}
+
+/**
+ * @brief  Starts the transfer of the next area to refresh, or restores the full
+ *         display window once all areas were transferred.
+ */
+void LCDDisplay::refreshNextArea() {
+    if (refreshIndex_ == 0) {
+        uint32_t now              = us_ticker_read();
+        frameStats_.lastFrameTime = now - lastTransferStart_;
+        lastTransferStart_        = now;
+        if (frameStats_.nbrOfFrames > 0 &&
+            frameStats_.lastFrameTime > frameStats_.maxFrameTime) {
+            frameStats_.maxFrameTime = frameStats_.lastFrameTime;
+        }
+    }
+    if (refreshIndex_ < nbrOfRefreshRects_) {
+        setRefreshWindow(refreshRects_[refreshIndex_]);
+        refreshIndex_ = refreshIndex_ + 1;
+        HAL_DSI_Refresh(&hlcd_dsi);
+        return;
+    }
+
+    Rect display = {.x = 0, .y = 0, .width = lcdXsize_, .height = lcdYsize_};
+    setRefreshWindow(display);
+    frameStats_.lastTransferTime = us_ticker_read() - lastTransferStart_;
+    frameStats_.nbrOfFrames++;
+    isRefreshing_ = false;
+
+    // refine the transfer time per pixel used to schedule the tearing effect
+    uint32_t transferTimeNs = frameStats_.lastTransferTime * 1000;
+    uint32_t setupTimeNs    = nbrOfRefreshRects_ * kAreaSetupTimeNs;
+    if (nbrOfRefreshPixels_ > 0 && transferTimeNs > setupTimeNs) {
+        uint32_t pixelTimeNs = (transferTimeNs - setupTimeNs) / nbrOfRefreshPixels_;
+        // bounded so that the transfer time of a whole frame fits in 32 bits
+        if (pixelTimeNs > kMaxPixelTimeNs) {
+            pixelTimeNs = kMaxPixelTimeNs;
+        }
+        pixelTimeNs_ = (3 * pixelTimeNs_ + pixelTimeNs + 3) / 4;
+    }
+
+    if (refreshCallback_) {
+        refreshCallback_();
+    }
+}
+
+/**
+ * @brief  Restricts the next DSI refresh to an area: the panel column and page
+ *         addresses select the area in its memory, and the LTDC active area and
+ *         layer windows are reduced to the area, read from the front buffers.
+ * @note   LTDC registers are written directly, leaving the layer configuration
+ *         of the handle (used to draw) untouched, as this also runs in the DSI
+ *         interrupt.
+ * @param  area  Area to transfer
+ */
+void LCDDisplay::setRefreshWindow(const Rect& area) {
+    uint32_t x1        = area.x + area.width - 1;
+    uint32_t y1        = area.y + area.height - 1;
+    uint8_t columns[4] = {static_cast<uint8_t>(area.x >> 8),
+                          static_cast<uint8_t>(area.x & 0xFF),
+                          static_cast<uint8_t>(x1 >> 8),
+                          static_cast<uint8_t>(x1 & 0xFF)};
+    uint8_t pages[4]   = {static_cast<uint8_t>(area.y >> 8),
+                          static_cast<uint8_t>(area.y & 0xFF),
+                          static_cast<uint8_t>(y1 >> 8),
+                          static_cast<uint8_t>(y1 & 0xFF)};
+    HAL_DSI_LongWrite(
+        &hlcd_dsi, 0, DSI_DCS_LONG_PKT_WRITE, 4, OTM8009A_CMD_CASET, columns);
+    HAL_DSI_LongWrite(&hlcd_dsi, 0, DSI_DCS_LONG_PKT_WRITE, 4, OTM8009A_CMD_PASET, pages);
+
+    /* Disable DSI Wrapper in order to access and configure the LTDC */
+    __HAL_DSI_WRAPPER_DISABLE(&hlcd_dsi);
+
+    /* The LTDC active area is the size of the transferred frame */
+    uint32_t activeWidth  = HSYNC + HBP + area.width;
+    uint32_t activeHeight = VSYNC + VBP + area.height;
+    LTDC_TypeDef* pLtdc   = hlcd_ltdc.Instance;
+    pLtdc->AWCR           = (activeWidth << 16) | activeHeight;
+    pLtdc->TWCR           = ((activeWidth + HFP) << 16) | (activeHeight + VFP);
+
+    /* The layer windows cover the active area, starting at the top-left pixel of
+       the area and keeping the pitch of the frame buffers */
+    uint32_t bpp    = Lcd_Ctx[0].BppFactor;
+    uint32_t hbp    = (pLtdc->BPCR & LTDC_BPCR_AHBP) >> 16;
+    uint32_t vbp    = pLtdc->BPCR & LTDC_BPCR_AVBP;
+    uint32_t offset = bpp * (lcdXsize_ * area.y + area.x);
+    for (uint32_t i = 0; i < getNbrOfLayers(); i++) {
+        LTDC_Layer_TypeDef* pLayer = LTDC_LAYER(&hlcd_ltdc, i);
+        pLayer->WHPCR              = ((area.width + hbp) << 16) | (hbp + 1);
+        pLayer->WVPCR              = ((area.height + vbp) << 16) | (vbp + 1);
+        pLayer->CFBLR              = ((lcdXsize_ * bpp) << 16) | (area.width * bpp + 7);
+        pLayer->CFBLNR             = area.height;
+        pLayer->CFBAR              = frontBuffer_[i] + offset;
+        if (i == scrollLayer_ && isInScrollArea(area)) {
+            pLayer->CFBAR = getScrollRowAddress(scrollOffset_ + area.y - scrollTop_) +
+                            bpp * area.x;
+        }
+    }
+    pLtdc->SRCR = LTDC_SRCR_IMR;
+
+    /* Enable DSI Wrapper so DSI IP will drive the LTDC */
+    __HAL_DSI_WRAPPER_ENABLE(&hlcd_dsi);
+}
+
+/**
+ * @brief  Gets the number of layers composed by the LTDC.
+ * @retval 2 if the overlay is enabled, 1 otherwise
+ */
+uint32_t LCDDisplay::getNbrOfLayers() const {
+    return isOverlayEnabled_ ? kMaxNbrOfLayers : 1;
+}
+
+/**
+ * @brief  Checks whether an area lies in the scroll area.
+ * @param  area  Area to check, not crossing the bounds of the scroll area
+ * @retval true if the area is read from the virtual buffer
+ */
+bool LCDDisplay::isInScrollArea(const Rect& area) const {
+    return scrollHeight_ > 0 && area.y >= scrollTop_ &&
+           area.y + area.height <= scrollTop_ + scrollHeight_;
+}
+
+/**
+ * @brief  Gets the address of a row of the virtual buffer of the scroll area.
+ * @param  row  Row, from 0 to twice the height of the scroll area
+ * @retval Address of the first pixel of the row
+ */
+uint32_t LCDDisplay::getScrollRowAddress(uint32_t row) const {
+    return SCROLL_BUFFER + Lcd_Ctx[0].BppFactor * lcdXsize_ * row;
+}
+
+/**
+ * @brief  Scrolls the scroll area up, drawing only the exposed lines. The draw
+ *         buffer of the layer is moved so that the lines of the band are drawn in
+ *         the virtual buffer, then the lines are copied to the other copy.
+ * @param  nbrOfLines  Number of lines to scroll by
+ * @param  text        Text drawn in the exposed lines, may be null
+ * @param  alignMode   Alignment of the text
+ */
+void LCDDisplay::scrollBy(uint32_t nbrOfLines, const char* text, AlignMode alignMode) {
+    if (scrollHeight_ == 0 || nbrOfLines == 0) {
+        return;
+    }
+    if (nbrOfLines > scrollHeight_) {
+        nbrOfLines = scrollHeight_;
+    }
+
+    /* Transfers read the band with the current offset */
+    waitForRefresh();
+    scrollOffset_ = (scrollOffset_ + nbrOfLines) % scrollHeight_;
+
+    /* The whole band moved on the display, strings drawn in it are forgotten */
+    uint32_t activeLayer = currentLCDLayer_;
+    uint32_t drawBuffer  = hlcd_ltdc.LayerCfg[scrollLayer_].FBStartAdress;
+    setActiveLayer(scrollLayer_);
+    invalidate({.x = 0, .y = scrollTop_, .width = lcdXsize_, .height = scrollHeight_});
+
+    /* Line scrollTop_ of the display is drawn at row scrollOffset_ */
+    uint32_t rowSize = Lcd_Ctx[0].BppFactor * lcdXsize_;
+    uint32_t origin  = getScrollRowAddress(scrollOffset_) - rowSize * scrollTop_;
+    setDrawBuffer(scrollLayer_, origin);
+    uint32_t yPos = scrollTop_ + scrollHeight_ - nbrOfLines;
+    fillRect(0, yPos, lcdXsize_, nbrOfLines, drawProp_[scrollLayer_].backColor);
+    if (text != nullptr) {
+        displayStringAt(10, yPos, text, alignMode);
+    }
+    mirrorScrollRows(scrollOffset_ + scrollHeight_ - nbrOfLines, nbrOfLines);
+
+    setDrawBuffer(scrollLayer_, drawBuffer);
+    setActiveLayer(activeLayer);
+    refreshLCD();
+}
+
+/**
+ * @brief  Copies rows of the virtual buffer to the other copy of the band.
+ * @param  firstRow   First row, from 0 to twice the height of the scroll area
+ * @param  nbrOfRows  Number of rows
+ */
+void LCDDisplay::mirrorScrollRows(uint32_t firstRow, uint32_t nbrOfRows) {
+    while (nbrOfRows > 0) {
+        uint32_t count = nbrOfRows;
+        uint32_t twin  = 0;
+        if (firstRow < scrollHeight_) {
+            twin = firstRow + scrollHeight_;
+            if (firstRow + count > scrollHeight_) {
+                count = scrollHeight_ - firstRow;
+            }
+        } else {
+            twin = firstRow - scrollHeight_;
+        }
+        copyRows(getScrollRowAddress(twin), getScrollRowAddress(firstRow), count);
+        firstRow  += count;
+        nbrOfRows -= count;
+    }
+}
+
+/**
+ * @brief  Queues the copy of whole display rows. Rows are a multiple of 4 bytes
+ *         in every pixel format and are copied as ARGB8888 pixels.
+ * @param  destination  Address of the first destination row
+ * @param  source       Address of the first source row
+ * @param  nbrOfRows    Number of rows
+ */
+void LCDDisplay::copyRows(uint32_t destination, uint32_t source, uint32_t nbrOfRows) {
+    Dma2dJob job        = {};
+    job.operation       = Dma2dOperation::Copy;
+    job.sourceMode      = Dma2dColorMode::ARGB8888;
+    job.destinationMode = Dma2dColorMode::ARGB8888;
+    job.source          = source;
+    job.destination     = destination;
+    job.width           = Lcd_Ctx[0].BppFactor * lcdXsize_ / 4;
+    job.height          = nbrOfRows;
+    submit(job);
+}
+
+/**
+ * @brief  Gets the DMA2D color mode of the framebuffer.
+ * @note   L8 has no DMA2D output mode, L8 pixels are moved by words of four.
+ * @retval RGB565 or ARGB8888
+ */
+Dma2dColorMode LCDDisplay::getFrameBufferMode() const {
+    return (lcdPixelFormat_ == LCD_PIXEL_FORMAT_RGB565) ? Dma2dColorMode::RGB565
+                                                        : Dma2dColorMode::ARGB8888;
+}
+
+/**
+ * @brief  Loads the palette in the CLUT of the L8 layer and refreshes the whole
+ *         display with the new colors.
+ */
+void LCDDisplay::updatePalette() {
+    if (lcdPixelFormat_ != LCD_PIXEL_FORMAT_L8) {
+        return;
+    }
+
+    /* The CLUT is read during transfers, which must not mix two palettes */
+    waitForRefresh();
+    for (uint32_t i = 0; i < getNbrOfLayers(); i++) {
+        loadPalette(i);
+    }
+
+    /* The panel memory holds colors, every pixel must be transferred again */
+    damage_.add({.x = 0, .y = 0, .width = lcdXsize_, .height = lcdYsize_});
+    refreshLCD();
+}
+
+/**
+ * @brief  Loads the palette in the CLUT of a layer.
+ * @param  layerIndex  Layer in L8 format
+ */
+void LCDDisplay::loadPalette(uint32_t layerIndex) {
+    /* Disable DSI Wrapper in order to access and configure the LTDC */
+    __HAL_DSI_WRAPPER_DISABLE(&hlcd_dsi);
+    HAL_LTDC_ConfigCLUT(&hlcd_ltdc,
+                        const_cast<uint32_t*>(palette_.getColors()),
+                        palette_.getNbrOfColors(),
+                        layerIndex);
+    HAL_LTDC_EnableCLUT(&hlcd_ltdc, layerIndex);
+    __HAL_DSI_WRAPPER_ENABLE(&hlcd_dsi);
+}
+
+/**
+ * @brief  Gets the value written to the framebuffer for a color.
+ * @param  color  Color (ARGB8888)
+ * @retval Nearest palette index for L8, the color otherwise
+ */
+uint32_t LCDDisplay::toDrawColor(uint32_t color) {
+    return (lcdPixelFormat_ == LCD_PIXEL_FORMAT_L8) ? palette_.findIndex(color) : color;
+}
+
+/**
+ * @brief  Gets the glyph cache hit/miss counters.
+ * @retval Glyph cache statistics
+ */
+const GlyphCache::Stats& LCDDisplay::getGlyphCacheStats() const {
+    return glyphCache_.getStats();
+}
 
 void LCDDisplay::mspInit() {
     /** @brief Enable the LTDC clock */
@@ -362,6 +1221,7 @@ void LCDDisplay::mspInit() {
     /** @brief Toggle Sw reset of DMA2D IP */
     __HAL_RCC_DMA2D_FORCE_RESET();
     __HAL_RCC_DMA2D_RELEASE_RESET();
+    Dma2dDriver::getInstance().invalidate();
 
     /** @brief Enable DSI Host and wrapper clocks */
     __HAL_RCC_DSI_CLK_ENABLE();
@@ -494,6 +1354,11 @@ void LCDDisplay::LCD_LayerInit(uint16_t layerIndex, uint32_t address) {
     layercfg.WindowY0        = 0;
     layercfg.WindowY1        = Lcd_Ctx[0].YSize;
     layercfg.PixelFormat     = LTDC_PIXEL_FORMAT_ARGB8888;
+    if (Lcd_Ctx[0].PixelFormat == LCD_PIXEL_FORMAT_RGB565) {
+        layercfg.PixelFormat = LTDC_PIXEL_FORMAT_RGB565;
+    } else if (Lcd_Ctx[0].PixelFormat == LCD_PIXEL_FORMAT_L8) {
+        layercfg.PixelFormat = LTDC_PIXEL_FORMAT_L8;
+    }
     layercfg.FBStartAdress   = address;
     layercfg.Alpha           = 255;
     layercfg.Alpha0          = 0;
@@ -508,37 +1373,42 @@ void LCDDisplay::LCD_LayerInit(uint16_t layerIndex, uint32_t address) {
     HAL_LTDC_ConfigLayer(&hlcd_ltdc, &layercfg, layerIndex);
 }
 
+/**
+ * @brief  Selects the buffer that drawing functions write to.
+ * @note   Only the layer configuration of the LTDC handle is updated, which is
+ *         what the BSP drawing functions use. The LTDC keeps reading the
+ *         displayed buffer until swapBuffers() reprograms it.
+ * @param  layerIndex  Layer drawn in
+ * @param  address     Address of the buffer to draw in
+ */
+void LCDDisplay::setDrawBuffer(uint32_t layerIndex, uint32_t address) {
+    hlcd_ltdc.LayerCfg[layerIndex].FBStartAdress = address;
+}
+
 /**
  * @brief  Display Welcome Message
  * @param  None
  * @retval None
  */
 void LCDDisplay::displayWelcome(const char* text, AlignMode alignMode) {
+    Frame frame(*this);
     fillDisplay(LCD_COLOR_WHITE);
     setTextColor(LCD_COLOR_BLUE);
     fillRect(0, 0, lcdXsize_, kTitleHeight, LCD_COLOR_BLUE);
     setTextColor(LCD_COLOR_WHITE);
     fillRect(0, kTitleHeight, lcdXsize_, lcdYsize_ - kTitleHeight, LCD_COLOR_WHITE);
     setBackColor(LCD_COLOR_BLUE);
-    setFont(createFont36b());
+    setFont(selectFont<36, FontWeight::Bold>());
     displayStringAtLine(1, "Welcome", alignMode);
     setTextColor(LCD_COLOR_BLUE);
     setBackColor(LCD_COLOR_WHITE);
-    setFont(createFont36());
+    setFont(selectFont<36>());
     displayStringAtLine(3, "to", alignMode);
     displayStringAtLine(5, text, alignMode);
 
-    HAL_DSI_LongWrite(&hlcd_dsi,
-                      0,
-                      DSI_DCS_LONG_PKT_WRITE,
-                      2,
-                      OTM8009A_CMD_WRTESCN,
-                      // cppcheck-suppress cstyleCast
-                      // NOLINTNEXTLINE(readability/casting)
-                      (uint8_t*)pSyncLeft_);
 
     /* Refresh the LCD */
-    HAL_DSI_Refresh(&hlcd_dsi);
+    refreshLCD();
 }
 
 /**
@@ -547,25 +1417,18 @@ void LCDDisplay::displayWelcome(const char* text, AlignMode alignMode) {
  * @retval None
  */
 void LCDDisplay::displayTitle(const char* text, AlignMode alignMode) {
+    Frame frame(*this);
     fillDisplay(LCD_COLOR_WHITE);
     setTextColor(LCD_COLOR_BLUE);
     fillRect(0, 0, lcdXsize_, kTitleHeight, LCD_COLOR_BLUE);
     setBackColor(LCD_COLOR_BLUE);
     setTextColor(LCD_COLOR_WHITE);
-    setFont(createFont36b());
+    setFont(selectFont<36, FontWeight::Bold>());
     displayStringAtLine(1, text, alignMode);
 
-    HAL_DSI_LongWrite(&hlcd_dsi,
-                      0,
-                      DSI_DCS_LONG_PKT_WRITE,
-                      2,
-                      OTM8009A_CMD_WRTESCN,
-                      // cppcheck-suppress cstyleCast
-                      // NOLINTNEXTLINE(readability/casting)
-                      (uint8_t*)pSyncLeft_);
 
     // Refresh the LCD
-    HAL_DSI_Refresh(&hlcd_dsi);
+    refreshLCD();
 
     // restore back and text colors
     setBackColor(LCD_COLOR_WHITE);
@@ -577,13 +1440,13 @@ void LCDDisplay::displayTitle(const char* text, AlignMode alignMode) {
  * @brief  Sets the LCD text font.
  * @param  fonts  Layer font to be used
  */
-void LCDDisplay::setFont(Font* pFont) { drawProp_[currentLCDLayer_].pFont = pFont; }
+void LCDDisplay::setFont(const Font* pFont) { drawProp_[currentLCDLayer_].pFont = pFont; }
 
 /**
  * @brief  Gets the LCD text font.
  * @retval Used layer font
  */
-Font* LCDDisplay::getFont() { return drawProp_[currentLCDLayer_].pFont; }
+const Font* LCDDisplay::getFont() { return drawProp_[currentLCDLayer_].pFont; }
 
 /**
  * @brief  Gets the LCD width.
@@ -637,14 +1500,142 @@ void LCDDisplay::setBackColor(uint32_t color) {
  */
 void LCDDisplay::fillRect(
     uint32_t xPos, uint32_t yPos, uint32_t width, uint32_t height, uint32_t color) {
-    /* Fill the rectangle */
-    if (lcdPixelFormat_ == LCD_PIXEL_FORMAT_RGB565) {
-        funcDriver_.FillRect(
-            lcdDevice_, xPos, yPos, width, height, CONVERTARGB88882RGB565(color));
-    } else {
-        funcDriver_.FillRect(lcdDevice_, xPos, yPos, width, height, color);
+    Rect area = {.x = xPos, .y = yPos, .width = width, .height = height};
+    invalidate(area);
+    if (isEmpty(area)) {
+        return;
+    }
+
+    /* The fill is queued by the next operation that needs it drawn, adjacent
+       fills of the same color being merged meanwhile */
+    uint32_t drawColor   = toDrawColor(color);
+    uint32_t frameBuffer = hlcd_ltdc.LayerCfg[currentLCDLayer_].FBStartAdress;
+    if (!fillBatcher_.add(area, drawColor, frameBuffer)) {
+        flushFills();
+        fillBatcher_.add(area, drawColor, frameBuffer);
+    }
+}
+
+/**
+ * @brief  Queues the pending fills, in the order they were drawn.
+ */
+void LCDDisplay::flushFills() {
+    uint32_t nbrOfFills = fillBatcher_.getNbrOfFills();
+    for (uint32_t i = 0; i < nbrOfFills; i++) {
+        drawFill(fillBatcher_.getFill(i));
     }
+    fillBatcher_.clear();
 }
+
+/**
+ * @brief  Draws a fill, with the CPU if it is small and nothing is queued, with
+ *         the DMA2D otherwise.
+ * @param  fill  Area, color in the framebuffer format and buffer to fill
+ */
+void LCDDisplay::drawFill(const PendingFill& fill) {
+    const Rect& area     = fill.area;
+    uint32_t destination = fill.frameBuffer +
+                           Lcd_Ctx[0].BppFactor * (lcdXsize_ * area.y + area.x);
+    if (lcdPixelFormat_ == LCD_PIXEL_FORMAT_L8) {
+        fillIndexedRect(
+            destination, area.width, area.height, static_cast<uint8_t>(fill.color));
+        return;
+    }
+
+    /* Small fills are stored by the CPU, unless queued jobs may still write the
+       same pixels */
+    uint32_t nbrOfBytes = Lcd_Ctx[0].BppFactor * getArea(area);
+    bool isQueueEmpty   = (dma2dQueue_.getNbrOfPendingJobs() == 0);
+    if (DrawDispatcher::getInstance().choose(nbrOfBytes, isQueueEmpty) ==
+        DrawPath::CPU) {
+        uint32_t value = (lcdPixelFormat_ == LCD_PIXEL_FORMAT_RGB565)
+                             ? CONVERTARGB88882RGB565(fill.color)
+                             : fill.color;
+        DrawDispatcher::fillByCpu(destination,
+                                  area.width,
+                                  area.height,
+                                  lcdXsize_ - area.width,
+                                  Lcd_Ctx[0].BppFactor,
+                                  value);
+        return;
+    }
+
+    /* Queue the fill, the DMA2D converts the color to the framebuffer format */
+    Dma2dJob job          = {};
+    job.operation         = Dma2dOperation::Fill;
+    job.destinationMode   = getFrameBufferMode();
+    job.destination       = destination;
+    job.width             = area.width;
+    job.height            = area.height;
+    job.destinationOffset = lcdXsize_ - area.width;
+    job.color             = fill.color;
+    dma2dQueue_.submit(job);
+}
+
+/**
+ * @brief  Queues a DMA2D job after the pending fills, which it may draw over or
+ *         read.
+ * @param  job  Job to queue
+ * @retval Identifier of the job
+ */
+uint32_t LCDDisplay::submit(const Dma2dJob& job) {
+    flushFills();
+    return dma2dQueue_.submit(job);
+}
+
+/**
+ * @brief  Fills a rectangle of the L8 framebuffer with a palette index. The
+ *         DMA2D has no L8 output: the word-aligned part of the rows is queued as
+ *         an ARGB8888 fill of four indices per pixel, the CPU fills the edges.
+ * @param  destination  Address of the top-left pixel
+ * @param  width        Rectangle width
+ * @param  height       Rectangle height
+ * @param  index        Palette index
+ */
+void LCDDisplay::fillIndexedRect(uint32_t destination,
+                                 uint32_t width,
+                                 uint32_t height,
+                                 uint8_t index) {
+    bool isQueueEmpty = (dma2dQueue_.getNbrOfPendingJobs() == 0);
+    if (DrawDispatcher::getInstance().choose(width * height, isQueueEmpty) ==
+        DrawPath::CPU) {
+        uint32_t offset = lcdXsize_ - width;
+        DrawDispatcher::fillByCpu(destination, width, height, offset, 1, index);
+        return;
+    }
+
+    uint32_t head = (4 - (destination & 3)) & 3;
+    if (head > width) {
+        head = width;
+    }
+    uint32_t nbrOfWords = (width - head) / 4;
+    uint32_t tail       = width - head - 4 * nbrOfWords;
+
+    if (head > 0 || tail > 0) {
+        // queued jobs may still write next to the edges
+        dma2dQueue_.waitAll();
+        uint8_t* pRow = reinterpret_cast<uint8_t*>(destination);  // NOLINT
+        for (uint32_t i = 0; i < height; i++) {
+            fillRow8(pRow, head, index);
+            fillRow8(pRow + head + 4 * nbrOfWords, tail, index);
+            pRow += lcdXsize_;
+        }
+    }
+    if (nbrOfWords == 0) {
+        return;
+    }
+
+    Dma2dJob job          = {};
+    job.operation         = Dma2dOperation::Fill;
+    job.destinationMode   = Dma2dColorMode::ARGB8888;
+    job.destination       = destination + head;
+    job.width             = nbrOfWords;
+    job.height            = height;
+    job.destinationOffset = lcdXsize_ / 4 - nbrOfWords;
+    job.color             = index * 0x01010101U;
+    dma2dQueue_.submit(job);
+}
+
 /**
  * @brief  Draws a RGB rectangle in currently active layer.
  * @param  pData   Pointer to RGB rectangle data
@@ -654,17 +1645,113 @@ void LCDDisplay::fillRect(
  */
 void LCDDisplay::fillRGBRect(
     uint32_t xPos, uint32_t yPos, uint8_t* pData, uint32_t width, uint32_t height) {
+    /* The BSP copies each row with the CPU or a polled DMA2D transfer, neither
+       of which may overlap queued jobs */
+    waitForDrawing();
+
     /* Write RGB rectangle data */
     funcDriver_.FillRGBRect(lcdDevice_, xPos, yPos, pData, width, height);
 }
 
+/**
+ * @brief  Queues the copy of a block of pixels already in the framebuffer format,
+ *         done with a single DMA2D memory-to-memory transfer. Small blocks with
+ *         contiguous rows are copied by the CPU when no job is queued.
+ * @param  xPos         X position
+ * @param  yPos         Y position
+ * @param  pData        Pointer to the first pixel of the block
+ * @param  width        Block width
+ * @param  height       Block height
+ * @param  inputOffset  Pixels skipped after each source row, 0 if the rows are
+ *                      contiguous
+ * @note   L8 blocks are copied by words of four pixels, or by the CPU if they
+ *         are not word-aligned.
+ * @retval Identifier of the DMA2D job, the block is read until it is done (0 if
+ *         it was copied by the CPU)
+ */
+uint32_t LCDDisplay::copyRect(uint32_t xPos,
+                              uint32_t yPos,
+                              const uint8_t* pData,
+                              uint32_t width,
+                              uint32_t height,
+                              uint32_t inputOffset) {
+    uint32_t destination = hlcd_ltdc.LayerCfg[currentLCDLayer_].FBStartAdress +
+                           Lcd_Ctx[0].BppFactor * (lcdXsize_ * yPos + xPos);
+    uintptr_t source     = reinterpret_cast<uintptr_t>(pData);  // NOLINT
+
+    // the pending fills are queued first, they may draw under the block
+    flushFills();
+    uint32_t bytesPerRow = Lcd_Ctx[0].BppFactor * width;
+    bool isQueueEmpty    = (dma2dQueue_.getNbrOfPendingJobs() == 0);
+    if (inputOffset == 0 && DrawDispatcher::getInstance().choose(
+                                bytesPerRow * height, isQueueEmpty) == DrawPath::CPU) {
+        DrawDispatcher::copyByCpu(
+            destination, pData, bytesPerRow, height, Lcd_Ctx[0].BppFactor * lcdXsize_);
+        return 0;
+    }
+
+    if (lcdPixelFormat_ == LCD_PIXEL_FORMAT_L8 &&
+        ((destination | source | width | inputOffset) & 3) != 0) {
+        // queued jobs may still write the block or its destination
+        waitForDrawing();
+        uint8_t* pRow = reinterpret_cast<uint8_t*>(destination);  // NOLINT
+        for (uint32_t i = 0; i < height; i++) {
+            memcpy(pRow, pData, width);
+            pData += width + inputOffset;
+            pRow  += lcdXsize_;
+        }
+        return 0;
+    }
+
+    return queueCopy(source, destination, width, height, inputOffset, lcdXsize_ - width);
+}
+
+/**
+ * @brief  Queues a DMA2D memory-to-memory copy of a block of pixels in the
+ *         framebuffer format.
+ * @param  source             Address of the first pixel of the block
+ * @param  destination        Address the first pixel is copied to
+ * @param  width              Block width
+ * @param  height             Block height
+ * @param  sourceOffset       Pixels skipped after each source row
+ * @param  destinationOffset  Pixels skipped after each destination row
+ * @note   L8 blocks are copied by words of four pixels: the addresses, width and
+ *         offsets must be multiples of four.
+ * @retval Identifier of the DMA2D job
+ */
+uint32_t LCDDisplay::queueCopy(uintptr_t source,
+                               uintptr_t destination,
+                               uint32_t width,
+                               uint32_t height,
+                               uint32_t sourceOffset,
+                               uint32_t destinationOffset) {
+    if (lcdPixelFormat_ == LCD_PIXEL_FORMAT_L8) {
+        width             /= 4;
+        sourceOffset      /= 4;
+        destinationOffset /= 4;
+    }
+
+    Dma2dJob job          = {};
+    job.operation         = Dma2dOperation::Copy;
+    job.sourceMode        = getFrameBufferMode();
+    job.destinationMode   = job.sourceMode;
+    job.source            = source;
+    job.destination       = destination;
+    job.width             = width;
+    job.height            = height;
+    job.sourceOffset      = sourceOffset;
+    job.destinationOffset = destinationOffset;
+    return submit(job);
+}
+
 /**
  * @brief  Displays a maximum of 60 characters on the LCD.
  * @param  line: Line where to display the character shape
  * @param  ptr: Pointer to string to display on LCD
+ * @retval Area actually redrawn
  */
-void LCDDisplay::displayStringAtLine(uint32_t line, const char* text, AlignMode mode) {
-    displayStringAt(10, computeDisplayLineNumber(line), text, mode);
+Rect LCDDisplay::displayStringAtLine(uint32_t line, const char* text, AlignMode mode) {
+    return displayStringAt(10, computeDisplayLineNumber(line), text, mode);
 }
 
 void LCDDisplay::displayVerticalLine(uint32_t xPos, uint32_t width) {
@@ -677,36 +1764,106 @@ void LCDDisplay::displayHorizontalLine(uint32_t yPos, uint32_t width) {
     fillRect(0, yPos, lcdXsize_, width, LCD_COLOR_BLUE);
 }
 
+/**
+ * @brief  Sets the band of the active layer scrolled by scroll() and scrollText().
+ *         The band is kept in a virtual buffer and scrolled by moving the address
+ *         the LTDC reads it from, so that only the exposed rows are drawn.
+ * @note   While the scroll area is set, its rows are only drawn by scrolling.
+ *         Its content is copied back to the layer when it is reset.
+ * @param  yPos    Top line of the band
+ * @param  height  Number of lines of the band, 0 to reset the scroll area
+ */
+void LCDDisplay::setScrollArea(uint32_t yPos, uint32_t height) {
+    /* Transfers read the band with the current offset */
+    waitForDrawing();
+    waitForRefresh();
+
+    uint32_t rowSize = Lcd_Ctx[0].BppFactor * lcdXsize_;
+    if (scrollHeight_ > 0) {
+        // the scrolled band becomes part of the layer again
+        uint32_t window     = getScrollRowAddress(scrollOffset_);
+        uint32_t bandOffset = rowSize * scrollTop_;
+        copyRows(frontBuffer_[scrollLayer_] + bandOffset, window, scrollHeight_);
+        if (bufferingMode_ == BufferingMode::DOUBLE_BUFFER) {
+            copyRows(backBuffer_[scrollLayer_] + bandOffset, window, scrollHeight_);
+        }
+    }
+
+    if (yPos >= lcdYsize_) {
+        height = 0;
+    } else if (yPos + height > lcdYsize_) {
+        height = lcdYsize_ - yPos;
+    }
+    scrollLayer_  = currentLCDLayer_;
+    scrollTop_    = yPos;
+    scrollHeight_ = height;
+    scrollOffset_ = 0;
+    if (scrollHeight_ == 0) {
+        return;
+    }
+
+    /* Both copies of the band start with the drawn content */
+    uint32_t band = hlcd_ltdc.LayerCfg[scrollLayer_].FBStartAdress + rowSize * scrollTop_;
+    copyRows(getScrollRowAddress(0), band, scrollHeight_);
+    copyRows(getScrollRowAddress(scrollHeight_), band, scrollHeight_);
+}
+
+/**
+ * @brief  Scrolls the scroll area up. The exposed lines at the bottom are filled
+ *         with the background color of its layer.
+ * @param  nbrOfLines  Number of lines to scroll by
+ */
+void LCDDisplay::scroll(uint32_t nbrOfLines) {
+    scrollBy(nbrOfLines, nullptr, AlignMode::LEFT_MODE);
+}
+
+/**
+ * @brief  Scrolls the scroll area up by one line of text and draws the text in
+ *         the exposed line, e.g. to append a line to a log.
+ * @param  text       Null-terminated UTF-8 string
+ * @param  alignMode  Alignment of the text in the line
+ */
+void LCDDisplay::scrollText(const char* text, AlignMode alignMode) {
+    const Font* pFont = drawProp_[scrollLayer_].pFont;
+    if (pFont->height > scrollHeight_) {
+        return;
+    }
+    scrollBy(pFont->height, text, alignMode);
+}
+
 /**
  * @brief  Displays characters in currently active layer.
  * @param  xPos X position (in pixel)
  * @param  yPos Y position (in pixel)
- * @param  Text Pointer to string to display on LCD
+ * @param  Text Pointer to the UTF-8 string to display on LCD
  * @param  Mode Display mode
  *          This parameter can be one of the following values:
  *            @arg  CENTER_MODE
  *            @arg  RIGHT_MODE
  *            @arg  LEFT_MODE
+ * @retval Area actually redrawn: only the characters that differ from the string
+ *         last drawn at the same position with the same font and colors
  */
-void LCDDisplay::displayStringAt(uint32_t xPos,
+Rect LCDDisplay::displayStringAt(uint32_t xPos,
                                  uint32_t yPos,
                                  const char* text,
                                  AlignMode mode) {
-    /* Get the text size */
-    uint32_t nbrOfChars = 0;
-    char* ptr           = const_cast<char*>(text);
-    while (*ptr++) {
-        nbrOfChars++;
-    }
+    /* Decode the UTF-8 text into glyphs of the current font */
+    const Font* pFont = drawProp_[currentLCDLayer_].pFont;
+    textRun_.assign(pFont, text);
+    const uint16_t* glyphs = textRun_.getGlyphs();
+    uint32_t nbrOfChars    = textRun_.getNbrOfGlyphs();
 
     /* Characters number per line */
-    uint32_t nbrOfCharPerLine = (lcdXsize_ / drawProp_[currentLCDLayer_].pFont->width);
-    uint32_t refcolumn        = 1;
+    uint32_t nbrOfCharPerLine = (lcdXsize_ / pFont->width);
+    // alignment is computed on the measured width, which is nbrOfChars * width for
+    // monospaced fonts
+    uint32_t lineWidth = nbrOfCharPerLine * pFont->width;
+    uint32_t textWidth = measureGlyphs(pFont, glyphs, nbrOfChars);
+    uint32_t refcolumn = 1;
     switch (mode) {
         case AlignMode::CENTER_MODE: {
-            refcolumn = xPos + ((nbrOfCharPerLine - nbrOfChars) *
-                                drawProp_[currentLCDLayer_].pFont->width) /
-                                   2;
+            refcolumn = xPos + (lineWidth - textWidth) / 2;
             break;
         }
         case AlignMode::LEFT_MODE: {
@@ -714,8 +1871,7 @@ void LCDDisplay::displayStringAt(uint32_t xPos,
             break;
         }
         case AlignMode::RIGHT_MODE: {
-            refcolumn = -xPos + ((nbrOfCharPerLine - nbrOfChars) *
-                                 drawProp_[currentLCDLayer_].pFont->width);
+            refcolumn = -xPos + (lineWidth - textWidth);
             break;
         }
         default: {
@@ -729,91 +1885,458 @@ void LCDDisplay::displayStringAt(uint32_t xPos,
         refcolumn = 1;
     }
 
+    /* Draw the characters that fit on the display */
+    uint32_t nbrOfDrawable = 0;
+    if (pFont->metrics == nullptr && pFont->kerning == nullptr) {
+        nbrOfDrawable = (nbrOfChars < nbrOfCharPerLine) ? nbrOfChars : nbrOfCharPerLine;
+    } else {
+        nbrOfDrawable = countFittingGlyphs(pFont, glyphs, nbrOfChars, lcdXsize_);
+    }
+
+    /* Only redraw the characters that differ from the string last drawn here */
+    uint32_t textColor           = drawProp_[currentLCDLayer_].textColor;
+    uint32_t backColor           = drawProp_[currentLCDLayer_].backColor;
+    TextSlotCache::Range changes = textSlots_[currentLCDLayer_].findChanges(
+        pFont, refcolumn, yPos, textColor, backColor, glyphs, nbrOfDrawable);
+    const uint16_t* changed      = &glyphs[changes.first];
+    uint32_t nbrOfChanged        = changes.end - changes.first;
+    uint32_t dirtyColumn         = refcolumn;
+    for (uint32_t i = 0; i < changes.first; i++) {
+        dirtyColumn += getPenAdvance(pFont, glyphs, nbrOfDrawable, i);
+    }
+    Rect dirtyRect = {.x      = dirtyColumn,
+                      .y      = yPos,
+                      .width  = measureGlyphs(pFont, changed, nbrOfChanged),
+                      .height = (nbrOfChanged > 0) ? pFont->height : 0U};
+    if (!isEmpty(dirtyRect)) {
+        drawGlyphRun(dirtyColumn, yPos, changed, nbrOfChanged);
+    }
+
+    Rect area = {.x      = refcolumn,
+                 .y      = yPos,
+                 .width  = measureGlyphs(pFont, glyphs, nbrOfDrawable),
+                 .height = pFont->height};
+    textSlots_[currentLCDLayer_].store(
+        pFont, refcolumn, yPos, textColor, backColor, glyphs, nbrOfDrawable, area);
+    return dirtyRect;
+}
+
+/**
+ * @brief  Lays out a UTF-8 text in a box with word wrapping and draws it. The text
+ *         is ellipsized if it does not fit. Layouts are cached, so redrawing the
+ *         same text in the same box does not lay it out again.
+ * @param  xPos    Left of the box (in pixel)
+ * @param  yPos    Top of the box (in pixel)
+ * @param  width   Width of the box (in pixel), clipped to the display
+ * @param  height  Height of the box (in pixel), clipped to the display
+ * @param  text    Null-terminated UTF-8 string, '\n' starts a new line
+ * @param  mode    Alignment of each line in the box
+ */
+void LCDDisplay::displayTextBox(uint32_t xPos,
+                                uint32_t yPos,
+                                uint32_t width,
+                                uint32_t height,
+                                const char* text,
+                                AlignMode mode) {
+    // the lines are laid out inside the box, which must not leave the display
+    if (xPos >= lcdXsize_ || yPos >= lcdYsize_) {
+        return;
+    }
+    if (width > lcdXsize_ - xPos) {
+        width = lcdXsize_ - xPos;
+    }
+    if (height > lcdYsize_ - yPos) {
+        height = lcdYsize_ - yPos;
+    }
+
+    TextAlign align = TextAlign::Left;
+    if (mode == AlignMode::CENTER_MODE) {
+        align = TextAlign::Center;
+    } else if (mode == AlignMode::RIGHT_MODE) {
+        align = TextAlign::Right;
+    }
+    TextBox box = {.x      = static_cast<uint16_t>(xPos),
+                   .y      = static_cast<uint16_t>(yPos),
+                   .width  = static_cast<uint16_t>(width),
+                   .height = static_cast<uint16_t>(height)};
+
+    const TextLayout& layout =
+        textLayoutCache_.getLayout(drawProp_[currentLCDLayer_].pFont, text, box, align);
+    for (uint32_t i = 0; i < layout.getNbrOfLines(); i++) {
+        const TextLine& line = layout.getLine(i);
+        drawGlyphRun(line.x,
+                     line.y,
+                     &layout.getGlyphs()[line.firstGlyph],
+                     line.nbrOfGlyphs);
+    }
+}
+
+/**
+ * @brief  Gets the hit/miss counters of the text layout cache.
+ * @retval Cache statistics
+ */
+const TextLayoutCache::Stats& LCDDisplay::getTextLayoutStats() const {
+    return textLayoutCache_.getStats();
+}
+
+/**
+ * @brief  Gets the DMA2D register write and setup time counters, shared by the
+ *         queued drawing operations and the BSP transfers.
+ * @retval DMA2D driver statistics
+ */
+const Dma2dDriver::Stats& LCDDisplay::getDma2dStats() const {
+    return Dma2dDriver::getInstance().getStats();
+}
+
+/**
+ * @brief  Gets the number of fills and copies done by the CPU and by the DMA2D.
+ * @retval Dispatcher statistics
+ */
+const DrawDispatcher::Stats& LCDDisplay::getDispatchStats() const {
+    return DrawDispatcher::getInstance().getStats();
+}
+
+/**
+ * @brief  Gets the number of fills drawn and of fills merged with a pending one.
+ * @retval Fill batcher statistics
+ */
+const FillBatcher::Stats& LCDDisplay::getFillBatchStats() const {
+    return fillBatcher_.getStats();
+}
+
+/**
+ * @brief  Draws a run of glyphs of the current font on one line.
+ * @param  xPos         Start column of the run
+ * @param  yPos         Top line of the run
+ * @param  glyphs       Glyph indices of the run
+ * @param  nbrOfGlyphs  Number of glyphs, all fitting on the display
+ */
+void LCDDisplay::drawGlyphRun(uint32_t xPos,
+                              uint32_t yPos,
+                              const uint16_t* glyphs,
+                              uint32_t nbrOfGlyphs) {
+    const Font* pFont = drawProp_[currentLCDLayer_].pFont;
+
+    invalidate({.x      = xPos,
+                .y      = yPos,
+                .width  = measureGlyphs(pFont, glyphs, nbrOfGlyphs),
+                .height = pFont->height});
+
+    /* Render the whole run with a single DMA2D transfer when it fits the strip,
+       from the glyph cache or expanded once the previous copy of the strip is done */
+    uint32_t textColor = toDrawColor(drawProp_[currentLCDLayer_].textColor);
+    uint32_t backColor = toDrawColor(drawProp_[currentLCDLayer_].backColor);
+    if (drawCachedGlyphRun(xPos, yPos, glyphs, nbrOfGlyphs, textColor, backColor)) {
+        return;
+    }
+    dma2dQueue_.wait(stripJobId_);
+    if (textStrip_.rasterize(pFont,
+                             glyphs,
+                             nbrOfGlyphs,
+                             textColor,
+                             backColor,
+                             Lcd_Ctx[0].BppFactor)) {
+        // the strip is in cacheable AXI SRAM and must be written back for the DMA2D
+        SCB_CleanDCache_by_Addr(
+            reinterpret_cast<uint32_t*>(const_cast<uint8_t*>(textStrip_.getData())),
+            textStrip_.getSizeInBytes());
+        stripJobId_ = copyRect(xPos,
+                               yPos,
+                               textStrip_.getData(),
+                               textStrip_.getWidth(),
+                               textStrip_.getHeight());
+        return;
+    }
+
+    if (pFont->metrics != nullptr && !isCoverageFont(pFont)) {
+        // proportional glyphs only draw their inked box, clear the run beforehand
+        uint32_t runWidth = measureGlyphs(pFont, glyphs, nbrOfGlyphs);
+        if (xPos + runWidth > lcdXsize_) {
+            runWidth = lcdXsize_ - xPos;
+        }
+        fillRect(xPos,
+                 yPos,
+                 runWidth,
+                 pFont->height,
+                 drawProp_[currentLCDLayer_].backColor);
+    }
+
     /* Send the string character by character on LCD */
-    uint32_t i = 0;
-    while ((*text != 0) & (((lcdXsize_ - (i * drawProp_[currentLCDLayer_].pFont->width)) &
-                            0xFFFF) >= drawProp_[currentLCDLayer_].pFont->width)) {
+    for (uint32_t i = 0; i < nbrOfGlyphs; i++) {
         // Display one character on LCD
-        displayChar(refcolumn, yPos, *text);
-        // Inclrement the column position by the width
-        refcolumn += drawProp_[currentLCDLayer_].pFont->width;
+        displayChar(xPos, yPos, glyphs[i]);
+        // Increment the column position by the advance of the character
+        xPos += getPenAdvance(pFont, glyphs, nbrOfGlyphs, i);
+    }
+}
 
-        // Point on the next character
-        text++;
-        i++;
+/**
+ * @brief  Measures the width of a string drawn with the current font.
+ * @param  text  Null-terminated UTF-8 string
+ * @retval Width in pixels
+ */
+uint32_t LCDDisplay::getStringWidth(const char* text) {
+    const Font* pFont = drawProp_[currentLCDLayer_].pFont;
+    textRun_.assign(pFont, text);
+    return measureGlyphs(pFont, textRun_.getGlyphs(), textRun_.getNbrOfGlyphs());
+}
+
+/**
+ * @brief  Draws a run of cached glyphs of the current font on one line. The
+ *         DMA2D copies each glyph from its cache slot into the strip, then the
+ *         strip to the framebuffer. The jobs run in order, the previous copy of
+ *         the strip is done before it is overwritten and the CPU only waits for
+ *         the copies reading the slots it expands glyphs into.
+ * @param  xPos         Start column of the run
+ * @param  yPos         Top line of the run
+ * @param  glyphs       Glyph indices of the run
+ * @param  nbrOfGlyphs  Number of glyphs, all fitting on the display
+ * @param  textColor    Foreground color in the framebuffer format
+ * @param  backColor    Background color in the framebuffer format
+ * @retval false if the glyphs of the current font are not cached, in which case
+ *         nothing is drawn
+ */
+bool LCDDisplay::drawCachedGlyphRun(uint32_t xPos,
+                                    uint32_t yPos,
+                                    const uint16_t* glyphs,
+                                    uint32_t nbrOfGlyphs,
+                                    uint32_t textColor,
+                                    uint32_t backColor) {
+    const Font* pFont      = drawProp_[currentLCDLayer_].pFont;
+    uint32_t bytesPerPixel = Lcd_Ctx[0].BppFactor;
+    // L8 glyphs are copied by words of four pixels
+    if (!GlyphCache::canCache(pFont) || (bytesPerPixel == 1 && (pFont->width & 3) != 0) ||
+        !textStrip_.resize(pFont, glyphs, nbrOfGlyphs, bytesPerPixel)) {
+        return false;
     }
+
+    uintptr_t strip     = reinterpret_cast<uintptr_t>(textStrip_.getData());  // NOLINT
+    uint32_t stripWidth = textStrip_.getWidth();
+    for (uint32_t i = 0; i < nbrOfGlyphs; i++) {
+        uint32_t slot = glyphCache_.getSlot(pFont, glyphs[i], textColor, backColor);
+        if (!glyphCache_.isCached(pFont, glyphs[i], textColor, backColor)) {
+            // the glyph is expanded over a slot that a queued copy may still read
+            dma2dQueue_.wait(glyphCache_.getReaderJobId(slot));
+        }
+        const uint8_t* pPixels =
+            glyphCache_.getGlyph(pFont, glyphs[i], textColor, backColor);
+        uint32_t jobId = queueCopy(reinterpret_cast<uintptr_t>(pPixels),  // NOLINT
+                                   strip + i * pFont->width * bytesPerPixel,
+                                   pFont->width,
+                                   pFont->height,
+                                   0,
+                                   stripWidth - pFont->width);
+        glyphCache_.setReaderJobId(slot, jobId);
+    }
+
+    uint32_t destination = hlcd_ltdc.LayerCfg[currentLCDLayer_].FBStartAdress +
+                           bytesPerPixel * (lcdXsize_ * yPos + xPos);
+    stripJobId_          = queueCopy(
+        strip, destination, stripWidth, pFont->height, 0, lcdXsize_ - stripWidth);
+    return true;
 }
 
 /**
  * @brief  Displays one character in currently active layer.
  * @param  xPos Start column address
  * @param  yPos Line where to display the character shape.
- * @param  ascii Character ascii code
- *           This parameter must be a number between Min_Data = 0x20 and Max_Data = 0x7E
+ * @param  glyphIndex Index of the glyph in the current font (see getGlyphIndex)
+ */
+void LCDDisplay::displayChar(uint32_t xPos, uint32_t yPos, uint32_t glyphIndex) {
+    const Font* pFont = drawProp_[currentLCDLayer_].pFont;
+    if (isCoverageFont(pFont)) {
+        // coverage glyph blended over the framebuffer content, the whole cell is
+        // blended so that A4 rows stay byte aligned
+        GlyphMetrics box = getGlyphMetrics(pFont, glyphIndex);
+        int32_t xCell    = static_cast<int32_t>(xPos) + box.bearingX - box.boxX;
+        blendGlyph((xCell > 0) ? xCell : 0,
+                   yPos,
+                   &pFont->table[glyphIndex * getBytesPerGlyph(pFont)]);
+        return;
+    }
+
+    drawChar(xPos, yPos, glyphIndex);
+}
+
+/**
+ * @brief  Blends an A4/A8 glyph over the framebuffer in the text color, leaving
+ *         the background untouched.
+ * @param  xPos   X position
+ * @param  yPos   Y position
+ * @param  pData  Pointer to the coverage values of the glyph
  */
-void LCDDisplay::displayChar(uint32_t xPos, uint32_t yPos, uint8_t ascii) {
-    uint32_t offsetInTable = (ascii - ' ') * drawProp_[currentLCDLayer_].pFont->height *
-                             ((drawProp_[currentLCDLayer_].pFont->width + 7) / 8);
-    drawChar(xPos, yPos, &drawProp_[currentLCDLayer_].pFont->table[offsetInTable]);
+void LCDDisplay::blendGlyph(uint32_t xPos, uint32_t yPos, const uint8_t* pData) {
+    const Font* pFont    = drawProp_[currentLCDLayer_].pFont;
+    uint32_t width       = pFont->width;
+    uint32_t height      = pFont->height;
+    uint32_t destination = hlcd_ltdc.LayerCfg[currentLCDLayer_].FBStartAdress +
+                           Lcd_Ctx[0].BppFactor * (lcdXsize_ * yPos + xPos);
+    bool isA4            = (pFont->format == FontFormat::A4);
+
+    if (lcdPixelFormat_ == LCD_PIXEL_FORMAT_L8) {
+        // the DMA2D cannot blend into L8 pixels, pixels at least half covered
+        // take the text color
+        waitForDrawing();
+        uint8_t textIndex = palette_.findIndex(drawProp_[currentLCDLayer_].textColor);
+        uint8_t* pRow     = reinterpret_cast<uint8_t*>(destination);  // NOLINT
+        for (uint32_t i = 0; i < height; i++) {
+            for (uint32_t j = 0; j < width; j++) {
+                uint32_t coverage =
+                    isA4 ? ((pData[j / 2] >> (4 * (j & 1))) & 0x0F) * 17 : pData[j];
+                if (coverage >= 128) {
+                    pRow[j] = textIndex;
+                }
+            }
+            pData += getBytesPerRow(pFont);
+            pRow  += lcdXsize_;
+        }
+        return;
+    }
+
+    // A4 rows are padded to a whole byte
+    uint32_t inputOffset = isA4 ? (getBytesPerRow(pFont) * 2 - width) : 0;
+
+    // the glyph table may live in cacheable memory
+    SCB_CleanDCache_by_Addr(
+        const_cast<uint32_t*>(reinterpret_cast<const uint32_t*>(pData)),  // NOLINT
+        getBytesPerGlyph(pFont));
+
+    // coverage as alpha of the text color, blended over the framebuffer area
+    Dma2dJob job          = {};
+    job.operation         = Dma2dOperation::Blend;
+    job.sourceMode        = isA4 ? Dma2dColorMode::A4 : Dma2dColorMode::A8;
+    job.destinationMode   = getFrameBufferMode();
+    job.source            = reinterpret_cast<uintptr_t>(pData);  // NOLINT
+    job.background        = destination;
+    job.destination       = destination;
+    job.width             = width;
+    job.height            = height;
+    job.sourceOffset      = inputOffset;
+    job.backgroundOffset  = lcdXsize_ - width;
+    job.destinationOffset = lcdXsize_ - width;
+    job.color             = drawProp_[currentLCDLayer_].textColor;
+    submit(job);
 }
 
 /**
  * @brief  Draws a character on LCD.
  * @param  xPos  Line where to display the character shape
  * @param  yPos  Start column address
- * @param  pData Pointer to the character data
+ * @param  glyphIndex Index of the character in the font
  */
-void LCDDisplay::drawChar(uint32_t xPos, uint32_t yPos, const uint8_t* pData) {
-    uint32_t height = drawProp_[currentLCDLayer_].pFont->height;
-    uint32_t width  = drawProp_[currentLCDLayer_].pFont->width;
+void LCDDisplay::drawChar(uint32_t xPos, uint32_t yPos, uint32_t glyphIndex) {
+    const Font* pFont = drawProp_[currentLCDLayer_].pFont;
+
+    // only the inked box is drawn, which is the whole cell of monospaced fonts
+    GlyphMetrics box = getGlyphMetrics(pFont, glyphIndex);
+    xPos += box.bearingX;
+    yPos += box.boxY;
+
+    // rows are read in sequence, which also decodes compressed fonts
+    GlyphRowReader reader(pFont, glyphIndex);
+    for (uint32_t i = 0; i < box.boxY; i++) {
+        reader.nextRow();
+    }
 
-    // compute the bit offset in each line
-    uint32_t offset            = 8 * ((width + 7) / 8) - width;
-    uint32_t nbrOfBytesPerLine = (width + 7) / 8;
+    // colors are converted once per character rather than once per pixel
+    uint32_t textColor = drawProp_[currentLCDLayer_].textColor;
+    uint32_t backColor = drawProp_[currentLCDLayer_].backColor;
+    uint16_t text565   = CONVERTARGB88882RGB565(textColor);
+    uint16_t back565   = CONVERTARGB88882RGB565(backColor);
+    uint8_t textIndex  = static_cast<uint8_t>(toDrawColor(textColor));
+    uint8_t backIndex  = static_cast<uint8_t>(toDrawColor(backColor));
 
     // draw each line of the char stored in table
-    for (uint32_t i = 0; i < height; i++) {
+    for (uint32_t i = 0; i < box.boxHeight; i++) {
         // get the start address of the line
-        uint8_t* pchar = (const_cast<uint8_t*>(pData) + nbrOfBytesPerLine * i);
-
-        uint64_t line = 0;
-        for (uint32_t j = 0; j < nbrOfBytesPerLine; j++) {
-            line <<= 8;
-            line |= pchar[j];
-        }
-
-        if (lcdPixelFormat_ == LCD_PIXEL_FORMAT_RGB565) {
+        const uint8_t* pchar = reader.nextRow();
+
+        if (lcdPixelFormat_ == LCD_PIXEL_FORMAT_L8) {
+            // the BSP cannot write L8 pixels, the row is expanded in place
+            waitForDrawing();
+            uint32_t destination = hlcd_ltdc.LayerCfg[currentLCDLayer_].FBStartAdress +
+                                   lcdXsize_ * yPos++ + xPos;
+            expandMaskRow8(reinterpret_cast<uint8_t*>(destination),  // NOLINT
+                           pchar,
+                           box.boxX,
+                           box.boxWidth,
+                           textIndex,
+                           backIndex);
+        } else if (lcdPixelFormat_ == LCD_PIXEL_FORMAT_RGB565) {
             uint16_t rgb565[48] = {0};
-            for (uint32_t j = 0; j < width; j++) {
-                // check whether the j^th bit in line is on or off
-                uint64_t bitInPixel = (uint64_t)1 << (uint64_t)(width - j + offset - 1);
-                if (line & bitInPixel) {
-                    rgb565[j] =
-                        CONVERTARGB88882RGB565(drawProp_[currentLCDLayer_].textColor);
-                } else {
-                    rgb565[j] =
-                        CONVERTARGB88882RGB565(drawProp_[currentLCDLayer_].backColor);
-                }
-            }
+            expandMaskRow565(rgb565, pchar, box.boxX, box.boxWidth, text565, back565);
 
-            fillRGBRect(xPos, yPos++, (uint8_t*)(&rgb565[0]), width, 1);  // NOLINT
+            uint8_t* pData = (uint8_t*)(&rgb565[0]);  // NOLINT
+            fillRGBRect(xPos, yPos++, pData, box.boxWidth, 1);
         } else {
             uint32_t argb8888[48] = {0};
-            for (uint32_t j = 0; j < width; j++) {
-                // check whether the j^th bit in line is on or off
-                uint64_t bitInPixel = (uint64_t)1 << (uint64_t)(width - j + offset - 1);
-                if (line & bitInPixel) {
-                    argb8888[j] = drawProp_[currentLCDLayer_].textColor;
-                } else {
-                    argb8888[j] = drawProp_[currentLCDLayer_].backColor;
-                }
-            }
+            expandMaskRow8888(
+                argb8888, pchar, box.boxX, box.boxWidth, textColor, backColor);
 
-            fillRGBRect(xPos, yPos++, (uint8_t*)(&argb8888[0]), width, 1);  // NOLINT
+            uint8_t* pData = (uint8_t*)(&argb8888[0]);  // NOLINT
+            fillRGBRect(xPos, yPos++, pData, box.boxWidth, 1);
         }
     }
 }
 
+/**
+ * @brief  Records the whole current buffer as drawn, e.g. after drawing with
+ *         BSP_LCD functions over an unknown area.
+ */
+void LCDDisplay::invalidateAll() {
+    invalidate({.x = 0, .y = 0, .width = lcdXsize_, .height = lcdYsize_});
+}
+
+/**
+ * @brief  Drops the data cache lines of an area of the current buffer, so that the
+ *         CPU reads the pixels written by the DMA2D. The SDRAM is write-through,
+ *         no pending write is lost.
+ * @param  area  Area inside the display
+ */
+void LCDDisplay::invalidateCachedArea(const Rect& area) {
+    static constexpr uintptr_t kCacheLineMask = 31;
+
+    uint32_t bytesPerPixel = Lcd_Ctx[0].BppFactor;
+    uint32_t pitch         = lcdXsize_ * bytesPerPixel;
+    uintptr_t start        = hlcd_ltdc.LayerCfg[currentLCDLayer_].FBStartAdress +
+                             pitch * area.y + bytesPerPixel * area.x;
+    uint32_t size          = bytesPerPixel * area.width;
+    uint32_t nbrOfRows     = area.height;
+    if (area.width == lcdXsize_) {
+        // whole rows are contiguous
+        size      = pitch * area.height;
+        nbrOfRows = 1;
+    }
+
+    for (uint32_t i = 0; i < nbrOfRows; i++) {
+        uintptr_t first = start & ~kCacheLineMask;
+        uintptr_t last  = (start + size + kCacheLineMask) & ~kCacheLineMask;
+        SCB_InvalidateDCache_by_Addr(reinterpret_cast<void*>(first),  // NOLINT
+                                     static_cast<int32_t>(last - first));
+        start += pitch;
+    }
+}
+
+/**
+ * @brief  Draw hook of the UTIL_LCD functions, called before they draw. The
+ *         pending fills and the queued jobs are completed first: the functions
+ *         draw with the CPU or polled transfers, which must come after them. Some
+ *         of them read the pixels, whose cached copy is dropped.
+ * @param  pContext  Display the functions draw to
+ * @param  xPos      Left of the area about to be drawn
+ * @param  yPos      Top of the area about to be drawn
+ * @param  width     Width of the area
+ * @param  height    Height of the area
+ */
+void LCDDisplay::onExternalDraw(
+    void* pContext, uint32_t xPos, uint32_t yPos, uint32_t width, uint32_t height) {
+    LCDDisplay* pDisplay = static_cast<LCDDisplay*>(pContext);
+    Rect area = {.x = xPos, .y = yPos, .width = width, .height = height};
+    pDisplay->waitForDrawing();
+    pDisplay->invalidateCachedArea(area);
+    pDisplay->invalidate(area);
+}
+
 /**
  * @brief  Gets the LCD X size.
  * @param  Instance  LCD Instance
@@ -839,3 +2362,23 @@ int32_t LCDDisplay::getYSize(uint32_t instance, uint32_t* ySize) {
 }
 
 }  // namespace disco
+
+/**
+ * @brief  Tearing effect callback of the DSI host (HAL weak function override).
+ * @param  hdsi  DSI handle
+ */
+extern "C" void HAL_DSI_TearingEffectCallback(DSI_HandleTypeDef* hdsi) {
+    if (disco::pInterruptDisplay != nullptr) {
+        disco::pInterruptDisplay->onTearingEffect();
+    }
+}
+
+/**
+ * @brief  End of refresh callback of the DSI host (HAL weak function override).
+ * @param  hdsi  DSI handle
+ */
+extern "C" void HAL_DSI_EndOfRefreshCallback(DSI_HandleTypeDef* hdsi) {
+    if (disco::pInterruptDisplay != nullptr) {
+        disco::pInterruptDisplay->onEndOfRefresh();
+    }
+}
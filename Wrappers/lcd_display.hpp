@@ -24,8 +24,22 @@
 
 #pragma once
 
+#include "dirty_region.hpp"
+#include "dma2d_driver.hpp"
+#include "dma2d_hal_backend.hpp"
+#include "dma2d_queue.hpp"
+#include "draw_dispatcher.hpp"
+#include "fill_batcher.hpp"
 #include "fonts.hpp"
+#include "glyph_cache.hpp"
+#include "mbed.h"
+#include "palette.hpp"
+#include "rect.hpp"
 #include "return_code.hpp"
+#include "text_layout.hpp"
+#include "text_run.hpp"
+#include "text_slots.hpp"
+#include "text_strip.hpp"
 
 // from DISCO_H747I/Drivers/STM32H7xx_HAL_Driver
 #include "stm32h7xx_hal.h"
@@ -49,12 +63,34 @@ namespace disco {
 class LCDDisplay {
    public:
     LCDDisplay() = default;
-    ReturnCode init();
+    enum class BufferingMode {
+        SINGLE_BUFFER = 0x01, /*!< Draws in the buffer transferred to the display */
+        DOUBLE_BUFFER = 0x02  /*!< Draws in a back buffer, swapped on refresh    */
+    };
+    enum class PixelFormat {
+        ARGB8888 = 0x01, /*!< 4 bytes per pixel, RGB888 on the display  */
+        RGB565   = 0x02, /*!< 2 bytes per pixel, halving memory traffic */
+        L8       = 0x03  /*!< 1 byte per pixel, index in the palette    */
+    };
+    ReturnCode init(BufferingMode bufferingMode = BufferingMode::SINGLE_BUFFER,
+                    PixelFormat pixelFormat     = PixelFormat::ARGB8888);
     void fillDisplay(uint32_t color);
+    void setPalette(const uint32_t* pColors, uint32_t nbrOfColors);
+    void setPaletteColor(uint8_t index, uint32_t color);
+    enum class Transparency {
+        ALPHA     = 0x01, /*!< Overlay pixels are blended by their alpha        */
+        COLOR_KEY = 0x02  /*!< Overlay pixels of the key color are transparent */
+    };
+    void enableOverlay(Transparency transparency = Transparency::ALPHA,
+                       uint32_t colorKey         = LCD_COLOR_TRANSPARENT);
+    void disableOverlay();
+    void setActiveLayer(uint32_t layerIndex);
+    uint32_t getActiveLayer() const;
+    uint32_t getTransparentColor() const;
     void fillRectangle(
         uint32_t xPos, uint32_t yPos, uint32_t width, uint32_t height, uint32_t color);
-    void setFont(Font* pFont);
-    Font* getFont();
+    void setFont(const Font* pFont);
+    const Font* getFont();
     uint32_t getWidth() const;
     uint32_t getHeight() const;
     uint32_t getTitleHeight() const;
@@ -67,21 +103,128 @@ class LCDDisplay {
     void displayTitle(const char* text, AlignMode alignMode);
     void displayPicture(
         const uint32_t* pSrc, uint16_t x, uint16_t y, uint16_t xsize, uint16_t ysize);
-    void displayStringAtLine(uint32_t line, const char* text, AlignMode alignMode);
-    void displayStringAt(uint32_t xPos, uint32_t yPos, const char* text, AlignMode mode);
+    Rect displayStringAtLine(uint32_t line, const char* text, AlignMode alignMode);
+    Rect displayStringAt(uint32_t xPos, uint32_t yPos, const char* text, AlignMode mode);
+    uint32_t getStringWidth(const char* text);
+    void displayTextBox(uint32_t xPos,
+                        uint32_t yPos,
+                        uint32_t width,
+                        uint32_t height,
+                        const char* text,
+                        AlignMode mode);
     void displayVerticalLine(uint32_t xPos, uint32_t width);
     void displayHorizontalLine(uint32_t yPos, uint32_t width);
+    void setScrollArea(uint32_t yPos, uint32_t height);
+    void scroll(uint32_t nbrOfLines);
+    void scrollText(const char* text, AlignMode alignMode = AlignMode::LEFT_MODE);
     void refreshLCD();
+    void swapBuffers();
+    void invalidate(const Rect& area);
+    void invalidateAll();
+    void beginFrame();
+    void endFrame();
+    void waitForDrawing();
+    bool isDrawingDone() const;
+    bool isRefreshing() const;
+    using RefreshCallback = mbed::Callback<void()>;
+    void setRefreshCallback(RefreshCallback callback);
+    enum class FramePacing {
+        NO_PACING  = 0x01, /*!< Refreshes as soon as requested             */
+        CAP_RATE   = 0x02, /*!< Refreshes at most once per frame period    */
+        FIXED_RATE = 0x03  /*!< Refreshes on a regular grid of frame slots */
+    };
+    void setFramePacing(FramePacing framePacing, uint32_t framesPerSecond = 0);
+    struct FrameStats {
+        // cppcheck-suppress unusedStructMember
+        uint32_t nbrOfFrames;
+        // time between the starts of the last two transfers, in us
+        // cppcheck-suppress unusedStructMember
+        uint32_t lastFrameTime;
+        // cppcheck-suppress unusedStructMember
+        uint32_t maxFrameTime;
+        // duration of the last transfer to the display, in us
+        // cppcheck-suppress unusedStructMember
+        uint32_t lastTransferTime;
+        // frame slots skipped by late refreshes in FIXED_RATE pacing
+        // cppcheck-suppress unusedStructMember
+        uint32_t nbrOfMissedSlots;
+        // tearing effect scan line of the last swap (double-buffered mode)
+        // cppcheck-suppress unusedStructMember
+        uint32_t lastScanline;
+        // swaps transferred ahead of the panel scan, shown in the current scan
+        // cppcheck-suppress unusedStructMember
+        uint32_t nbrOfLeadingSwaps;
+        // swaps whose transfer could not be kept clear of the panel scan
+        // cppcheck-suppress unusedStructMember
+        uint32_t nbrOfTornSwaps;
+        // time from swapBuffers() until the panel scanned the swapped areas, in us
+        // cppcheck-suppress unusedStructMember
+        uint32_t lastLatency;
+        // cppcheck-suppress unusedStructMember
+        uint32_t maxLatency;
+    };
+    const FrameStats& getFrameStats() const;
+    void resetFrameStats();
+
+    // Scoped frame: refreshes issued while it lives are replaced by a single
+    // refresh when it goes out of scope
+    class Frame {
+       public:
+        explicit Frame(LCDDisplay& display) : display_(display) { display_.beginFrame(); }
+        ~Frame() { display_.endFrame(); }
+
+        Frame(const Frame&)            = delete;
+        Frame& operator=(const Frame&) = delete;
+
+       private:
+        LCDDisplay& display_;
+    };
+
+    // DSI interrupt handlers, called from the HAL callbacks
+    void onTearingEffect();
+    void onEndOfRefresh();
+    const GlyphCache::Stats& getGlyphCacheStats() const;
+    const TextLayoutCache::Stats& getTextLayoutStats() const;
+    const Dma2dDriver::Stats& getDma2dStats() const;
+    const DrawDispatcher::Stats& getDispatchStats() const;
+    const FillBatcher::Stats& getFillBatchStats() const;
 
     // public constants
     static constexpr uint32_t LCD_COLOR_BLUE  = 0xFF0000FFUL;
     static constexpr uint32_t LCD_COLOR_WHITE = 0xFFFFFFFFUL;
     static constexpr uint32_t LCD_COLOR_BLACK = 0x00000000UL;
+    // ARGB8888 color of the cleared overlay in ALPHA transparency
+    static constexpr uint32_t LCD_COLOR_TRANSPARENT = 0x00000000UL;
+    // static content is drawn on the background layer, changing values on the
+    // overlay layer composed over it by the LTDC
+    static constexpr uint32_t LCD_BACKGROUND_LAYER = 0;
+    static constexpr uint32_t LCD_OVERLAY_LAYER    = 1;
 
    private:
     // private methods
     void mspInit();
     void ltdcInit();
+    void setDrawBuffer(uint32_t layerIndex, uint32_t address);
+    void waitForRefresh();
+    void waitForRefreshOf(const Rect& area);
+    void waitForFrameSlot();
+    void scheduleScanline();
+    bool isClearOfScan(uint32_t scanline) const;
+    uint32_t getScanDelay(uint32_t column, uint32_t scanline) const;
+    void takeDamage();
+    void addRefreshRect(const Rect& area);
+    void refreshNextArea();
+    void setRefreshWindow(const Rect& area);
+    uint32_t getNbrOfLayers() const;
+    bool isInScrollArea(const Rect& area) const;
+    uint32_t getScrollRowAddress(uint32_t row) const;
+    void scrollBy(uint32_t nbrOfLines, const char* text, AlignMode alignMode);
+    void mirrorScrollRows(uint32_t firstRow, uint32_t nbrOfRows);
+    void copyRows(uint32_t destination, uint32_t source, uint32_t nbrOfRows);
+    Dma2dColorMode getFrameBufferMode() const;
+    void updatePalette();
+    void loadPalette(uint32_t layerIndex);
+    uint32_t toDrawColor(uint32_t color);
 
     // draw context related methods
     uint32_t computeDisplayLineNumber(uint32_t line);
@@ -89,10 +232,43 @@ class LCDDisplay {
     void setBackColor(uint32_t color);
     void fillRect(
         uint32_t xPos, uint32_t yPos, uint32_t width, uint32_t height, uint32_t color);
+    void flushFills();
+    void drawFill(const PendingFill& fill);
+    uint32_t submit(const Dma2dJob& job);
+    void fillIndexedRect(uint32_t destination,
+                         uint32_t width,
+                         uint32_t height,
+                         uint8_t index);
     void fillRGBRect(
         uint32_t xPos, uint32_t yPos, uint8_t* pData, uint32_t width, uint32_t height);
-    void displayChar(uint32_t xPos, uint32_t yPos, uint8_t ascii);
-    void drawChar(uint32_t xPos, uint32_t yPos, const uint8_t* pData);
+    uint32_t copyRect(uint32_t xPos,
+                      uint32_t yPos,
+                      const uint8_t* pData,
+                      uint32_t width,
+                      uint32_t height,
+                      uint32_t inputOffset = 0);
+    uint32_t queueCopy(uintptr_t source,
+                       uintptr_t destination,
+                       uint32_t width,
+                       uint32_t height,
+                       uint32_t sourceOffset,
+                       uint32_t destinationOffset);
+    void drawGlyphRun(uint32_t xPos,
+                      uint32_t yPos,
+                      const uint16_t* glyphs,
+                      uint32_t nbrOfGlyphs);
+    bool drawCachedGlyphRun(uint32_t xPos,
+                            uint32_t yPos,
+                            const uint16_t* glyphs,
+                            uint32_t nbrOfGlyphs,
+                            uint32_t textColor,
+                            uint32_t backColor);
+    void displayChar(uint32_t xPos, uint32_t yPos, uint32_t glyphIndex);
+    void drawChar(uint32_t xPos, uint32_t yPos, uint32_t glyphIndex);
+    void blendGlyph(uint32_t xPos, uint32_t yPos, const uint8_t* pData);
+    void invalidateCachedArea(const Rect& area);
+    static void onExternalDraw(
+        void* pContext, uint32_t xPos, uint32_t yPos, uint32_t width, uint32_t height);
     static int32_t getXSize(uint32_t instance, uint32_t* xSize);
     static int32_t getYSize(uint32_t instance, uint32_t* ySize);
 
@@ -114,7 +290,12 @@ class LCDDisplay {
     DSI_PLLInitTypeDef dsiPllInit_                = {0};
     DSI_CmdCfgTypeDef cmdCfg_                     = {0};
     DSI_LPCmdTypeDef lpCmd_                       = {0};
-    DMA2D_HandleTypeDef hdma2d_                   = {0};
+    GlyphCache glyphCache_;
+    TextStrip textStrip_;
+    // job copying the text strip, which is reused once it is done
+    uint32_t stripJobId_ = 0;
+    TextRun textRun_;
+    TextLayoutCache textLayoutCache_;
 
     // lcd related
     static constexpr uint8_t kMaxNbrOfLayers = 2;
@@ -124,16 +305,77 @@ class LCDDisplay {
         // cppcheck-suppress unusedStructMember
         uint32_t backColor; /*!< Specifies the background color below the text */
         // cppcheck-suppress unusedStructMember
-        Font* pFont; /*!< Specifies the font used for the text */
+        const Font* pFont; /*!< Specifies the font used for the text */
     };
     LCDContext drawProp_[kMaxNbrOfLayers] = {
         {.textColor = LCD_COLOR_BLUE, .backColor = LCD_COLOR_WHITE, .pFont = nullptr},
         {.textColor = LCD_COLOR_BLUE, .backColor = LCD_COLOR_WHITE, .pFont = nullptr}};
+    // strings last drawn on each layer
+    TextSlotCache textSlots_[kMaxNbrOfLayers];
     uint32_t currentLCDLayer_   = 0;
     uint32_t lcdDevice_         = 0;
     uint32_t lcdXsize_          = 0;
     uint32_t lcdYsize_          = 0;
     uint32_t lcdPixelFormat_    = 0;
+
+    // colors of the L8 framebuffer, loaded in the LTDC CLUT
+    Palette palette_;
+
+    // overlay layer
+    bool isOverlayEnabled_     = false;
+    uint32_t transparentColor_ = LCD_COLOR_TRANSPARENT;
+
+    // buffering, per layer
+    BufferingMode bufferingMode_           = BufferingMode::SINGLE_BUFFER;
+    uint32_t frontBuffer_[kMaxNbrOfLayers] = {LCD_FRAME_BUFFER, OVERLAY_FRAME_BUFFER};
+    uint32_t backBuffer_[kMaxNbrOfLayers]  = {LCD_BACK_BUFFER, OVERLAY_BACK_BUFFER};
+    volatile bool isFlipPending_           = false;
+    volatile bool isRefreshing_            = false;
+    uint32_t frameDepth_                   = 0;
+
+    // damage, refreshed as partial DSI windows split at the bounds of the scroll
+    // area
+    static constexpr uint32_t kMaxNbrOfRefreshRects = 3 * DirtyRegion::kMaxNbrOfRects;
+    DirtyRegion damage_;
+    Rect refreshRects_[kMaxNbrOfRefreshRects] = {};
+    uint32_t nbrOfRefreshRects_                = 0;
+    volatile uint32_t refreshIndex_            = 0;
+
+    // band of a layer scrolled by moving its start address in a virtual buffer
+    // holding the band twice, so that any scrolled window is contiguous
+    uint32_t scrollLayer_  = 0;
+    uint32_t scrollTop_    = 0;
+    uint32_t scrollHeight_ = 0;
+    uint32_t scrollOffset_ = 0;
+
+    // completion callback and frame pacing
+    RefreshCallback refreshCallback_     = nullptr;
+    FramePacing framePacing_             = FramePacing::NO_PACING;
+    uint32_t framePeriod_                = 0;
+    uint32_t nextFrameSlot_              = 0;
+    volatile uint32_t lastTransferStart_ = 0;
+    FrameStats frameStats_               = {.nbrOfFrames       = 0,
+                                            .lastFrameTime     = 0,
+                                            .maxFrameTime      = 0,
+                                            .lastTransferTime  = 0,
+                                            .nbrOfMissedSlots  = 0,
+                                            .lastScanline      = 0,
+                                            .nbrOfLeadingSwaps = 0,
+                                            .nbrOfTornSwaps    = 0,
+                                            .lastLatency       = 0,
+                                            .maxLatency        = 0};
+
+    // tearing effect scheduling, from the measured transfer time per pixel
+    uint32_t nbrOfRefreshPixels_ = 0;
+    uint32_t pixelTimeNs_        = kInitialPixelTimeNs;
+    uint32_t swapTime_           = 0;
+    uint32_t scanDelayNs_        = 0;
+
+    // drawing operations queued on the DMA2D
+    Dma2dHalBackend dma2dBackend_;
+    Dma2dQueue dma2dQueue_{dma2dBackend_};
+    // fills not queued yet, merged until another operation needs them drawn
+    FillBatcher fillBatcher_;
     LCD_UTILS_Drv_t funcDriver_ = {BSP_LCD_DrawBitmap,
                                    BSP_LCD_FillRGBRect,
                                    BSP_LCD_DrawHLine,
@@ -144,21 +386,43 @@ class LCDDisplay {
                                    getXSize,
                                    getYSize,
                                    BSP_LCD_SetActiveLayer,
-                                   BSP_LCD_GetPixelFormat};
+                                   BSP_LCD_GetPixelFormat,
+                                   BSP_LCD_GetFrameBuffer};
 
     // constant definitions
     static constexpr uint32_t kDisplayWidth  = 800;
     static constexpr uint32_t kDisplayHeight = 480;
     static constexpr uint32_t kTitleHeight   = 112;
 
-    static constexpr uint32_t LCD_FRAME_BUFFER = 0xD0000000;
-    static constexpr uint32_t VSYNC            = 1;
-    static constexpr uint32_t VBP              = 1;
-    static constexpr uint32_t VFP              = 1;
-    static constexpr uint32_t VACT             = 480;
-    static constexpr uint32_t HSYNC            = 1;
-    static constexpr uint32_t HBP              = 1;
-    static constexpr uint32_t HFP              = 1;
+    static constexpr uint32_t LCD_FRAME_BUFFER = LCD_LAYER_0_ADDRESS;
+    // back buffer of the double-buffered mode, in the layer 1 region
+    static constexpr uint32_t LCD_BACK_BUFFER = LCD_LAYER_1_ADDRESS;
+    // SDRAM region reserved for the glyph cache, after the two layer buffers
+    static constexpr uint32_t GLYPH_CACHE_ADDRESS = 0xD0400000;
+    // buffers of the overlay layer, after the glyph cache
+    static constexpr uint32_t OVERLAY_FRAME_BUFFER = 0xD0800000;
+    static constexpr uint32_t OVERLAY_BACK_BUFFER  = 0xD0A00000;
+    // virtual buffer of the scroll area, up to twice the display height
+    static constexpr uint32_t SCROLL_BUFFER = 0xD0C00000;
+    static constexpr uint32_t VSYNC               = 1;
+    static constexpr uint32_t VBP                 = 1;
+    static constexpr uint32_t VFP                 = 1;
+    static constexpr uint32_t VACT                = 480;
+    static constexpr uint32_t HSYNC               = 1;
+    static constexpr uint32_t HBP                 = 1;
+    static constexpr uint32_t HFP                 = 1;
+
+    // the OTM8009A scans its native rows, the display columns in landscape
+    // orientation, at about 60 Hz
+    static constexpr uint32_t kPanelScanLines  = 800;
+    static constexpr uint32_t kPanelLineTimeNs = 20000;
+    // lines between the tearing effect and the transferred areas
+    static constexpr uint32_t kScanlineMargin = 16;
+    // per-area transfer overhead (column/page commands, LTDC window) and first
+    // estimate of the transfer time per pixel, refined on each transfer
+    static constexpr uint32_t kAreaSetupTimeNs    = 50000;
+    static constexpr uint32_t kInitialPixelTimeNs = 60;
+    static constexpr uint32_t kMaxPixelTimeNs     = 1000;
 };
 
 }  // namespace disco
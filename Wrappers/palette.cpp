@@ -0,0 +1,131 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/****************************************************************************
+ * @file palette.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Color palette of the L8 framebuffer, loaded in the LTDC CLUT
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#include "palette.hpp"
+
+namespace disco {
+
+/**
+ * @brief  Builds the default palette: the 216 colors of a 6x6x6 color cube, then
+ *         40 grays. Black, white and the pure primaries are in the cube.
+ */
+Palette::Palette() {
+    static constexpr uint32_t kCubeLevels[6] = {0x00, 0x33, 0x66, 0x99, 0xCC, 0xFF};
+    for (uint32_t r = 0; r < 6; r++) {
+        for (uint32_t g = 0; g < 6; g++) {
+            for (uint32_t b = 0; b < 6; b++) {
+                colors_[nbrOfColors_++] = 0xFF000000U | (kCubeLevels[r] << 16) |
+                                          (kCubeLevels[g] << 8) | kCubeLevels[b];
+            }
+        }
+    }
+    for (uint32_t i = 1; nbrOfColors_ < kMaxNbrOfColors; i++) {
+        uint32_t level          = i * 255 / 41;
+        colors_[nbrOfColors_++] = 0xFF000000U | (level * 0x010101U);
+    }
+}
+
+/**
+ * @brief  Replaces the palette.
+ * @param  pColors      Colors (ARGB8888), the alpha is ignored
+ * @param  nbrOfColors  Number of colors, at most kMaxNbrOfColors
+ */
+void Palette::setColors(const uint32_t* pColors, uint32_t nbrOfColors) {
+    if (nbrOfColors > kMaxNbrOfColors) {
+        nbrOfColors = kMaxNbrOfColors;
+    }
+    for (uint32_t i = 0; i < nbrOfColors; i++) {
+        colors_[i] = pColors[i];
+    }
+    nbrOfColors_ = nbrOfColors;
+    isLastValid_ = false;
+}
+
+/**
+ * @brief  Changes one color, e.g. to animate the pixels using it.
+ * @param  index  Palette index, extends the palette if past its last color
+ * @param  color  New color (ARGB8888), the alpha is ignored
+ */
+void Palette::setColor(uint8_t index, uint32_t color) {
+    colors_[index] = color;
+    if (index >= nbrOfColors_) {
+        nbrOfColors_ = index + 1;
+    }
+    isLastValid_ = false;
+}
+
+/**
+ * @brief  Gets the color of a palette index.
+ * @retval Color (ARGB8888)
+ */
+uint32_t Palette::getColor(uint8_t index) const { return colors_[index]; }
+
+/**
+ * @brief  Gets the number of colors of the palette.
+ * @retval Number of colors
+ */
+uint32_t Palette::getNbrOfColors() const { return nbrOfColors_; }
+
+/**
+ * @brief  Gets the colors, in the layout expected by HAL_LTDC_ConfigCLUT.
+ * @retval Pointer to getNbrOfColors() colors
+ */
+const uint32_t* Palette::getColors() const { return colors_; }
+
+/**
+ * @brief  Finds the palette index drawing a color: the index of the color if it
+ *         is in the palette, the nearest color (RGB distance) otherwise.
+ * @param  color  Color (ARGB8888), the alpha is ignored
+ * @retval Palette index
+ */
+uint8_t Palette::findIndex(uint32_t color) {
+    color &= 0x00FFFFFFU;
+    if (isLastValid_ && color == lastColor_) {
+        return lastIndex_;
+    }
+
+    int32_t red       = (color >> 16) & 0xFF;
+    int32_t green     = (color >> 8) & 0xFF;
+    int32_t blue      = color & 0xFF;
+    uint32_t best     = 0;
+    uint32_t bestDist = UINT32_MAX;
+    for (uint32_t i = 0; i < nbrOfColors_ && bestDist > 0; i++) {
+        int32_t dr    = red - static_cast<int32_t>((colors_[i] >> 16) & 0xFF);
+        int32_t dg    = green - static_cast<int32_t>((colors_[i] >> 8) & 0xFF);
+        int32_t db    = blue - static_cast<int32_t>(colors_[i] & 0xFF);
+        uint32_t dist = dr * dr + dg * dg + db * db;
+        if (dist < bestDist) {
+            best     = i;
+            bestDist = dist;
+        }
+    }
+
+    lastColor_   = color;
+    lastIndex_   = static_cast<uint8_t>(best);
+    isLastValid_ = true;
+    return lastIndex_;
+}
+
+}  // namespace disco
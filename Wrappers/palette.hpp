@@ -0,0 +1,55 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/****************************************************************************
+ * @file palette.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Color palette of the L8 framebuffer, loaded in the LTDC CLUT
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+namespace disco {
+
+class Palette {
+   public:
+    Palette();
+
+    void setColors(const uint32_t* pColors, uint32_t nbrOfColors);
+    void setColor(uint8_t index, uint32_t color);
+    uint32_t getColor(uint8_t index) const;
+    uint32_t getNbrOfColors() const;
+    const uint32_t* getColors() const;
+    uint8_t findIndex(uint32_t color);
+
+    static constexpr uint32_t kMaxNbrOfColors = 256;
+
+   private:
+    uint32_t colors_[kMaxNbrOfColors] = {0};
+    uint32_t nbrOfColors_             = 0;
+
+    // last color looked up, drawing functions reuse the same few colors
+    uint32_t lastColor_ = 0;
+    uint8_t lastIndex_  = 0;
+    bool isLastValid_   = false;
+};
+
+}  // namespace disco
@@ -0,0 +1,252 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file pixel_kernels.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Pixel kernels expanding 1-bpp masks and filling RGB565/ARGB8888 rows
+ *
+ * Masks are expanded one byte (8 pixels) at a time: each group of mask bits is
+ * turned into byte lanes through a lookup table, and the lanes select between
+ * the on and off colors. On cores with the DSP extension (Cortex-M7) the
+ * selection is done with __UADD8/__SEL, elsewhere (e.g. on the host) with the
+ * equivalent and/or, which gives bit-exact results.
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#include "pixel_kernels.hpp"
+
+#include <string.h>
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include "cmsis_compiler.h"
+#define DISCO_PIXEL_KERNELS_SIMD 1
+#endif
+
+namespace disco {
+
+// Byte lanes selecting the on color for 2 mask bits, the first (most significant)
+// bit being the first pixel, which is the low half of a little-endian word
+static constexpr uint32_t kPairLanes[4] = {
+    0x00000000U, 0xFFFF0000U, 0x0000FFFFU, 0xFFFFFFFFU};
+
+// Byte lanes selecting the on color for 1 mask bit
+static constexpr uint32_t kPixelLanes[2] = {0x00000000U, 0xFFFFFFFFU};
+
+// Byte lanes selecting the on index for 4 mask bits of 8-bit pixels
+static constexpr uint32_t kQuadLanes[16] = {0x00000000U,
+                                            0xFF000000U,
+                                            0x00FF0000U,
+                                            0xFFFF0000U,
+                                            0x0000FF00U,
+                                            0xFF00FF00U,
+                                            0x00FFFF00U,
+                                            0xFFFFFF00U,
+                                            0x000000FFU,
+                                            0xFF0000FFU,
+                                            0x00FF00FFU,
+                                            0xFFFF00FFU,
+                                            0x0000FFFFU,
+                                            0xFF00FFFFU,
+                                            0x00FFFFFFU,
+                                            0xFFFFFFFFU};
+
+/**
+ * @brief  Selects the bytes of onValue where lanes are 0xFF, of offValue where
+ *         lanes are 0x00.
+ */
+static inline uint32_t selectLanes(uint32_t lanes, uint32_t onValue, uint32_t offValue) {
+#if defined(DISCO_PIXEL_KERNELS_SIMD)
+    // a 0xFF lane overflows and sets its GE flag, which __SEL then uses
+    (void)__UADD8(lanes, 0x01010101U);
+    return __SEL(onValue, offValue);
+#else
+    return (onValue & lanes) | (offValue & ~lanes);
+#endif
+}
+
+/**
+ * @brief  Reads up to 8 mask bits starting at any bit, without reading past the
+ *         byte holding the last one.
+ * @retval Bits aligned on bit 7, the bits past nbrOfBits are undefined
+ */
+static inline uint32_t loadMaskBits(const uint8_t* pMask,
+                                    uint32_t bit,
+                                    uint32_t nbrOfBits) {
+    const uint8_t* pByte = &pMask[bit / 8];
+    uint32_t shift       = bit % 8;
+    uint32_t value       = static_cast<uint32_t>(pByte[0]) << 8;
+    if (shift + nbrOfBits > 8) {
+        value |= pByte[1];
+    }
+    return ((value << shift) >> 8) & 0xFFU;
+}
+
+/**
+ * @brief  Stores a word at an address that may only be aligned on a pixel.
+ */
+static inline void storeWord(void* pDst, uint32_t value) { memcpy(pDst, &value, 4); }
+
+/**
+ * @brief  Expands a row of a 1-bpp mask (most significant bit first) into RGB565
+ *         pixels.
+ * @param  pDst         Destination of the first pixel
+ * @param  pMask        First byte of the mask row
+ * @param  firstBit     Index of the first mask bit to expand
+ * @param  nbrOfPixels  Number of pixels to write
+ * @param  onColor      Color of the set bits (RGB565)
+ * @param  offColor     Color of the cleared bits (RGB565)
+ */
+void expandMaskRow565(uint16_t* pDst,
+                      const uint8_t* pMask,
+                      uint32_t firstBit,
+                      uint32_t nbrOfPixels,
+                      uint16_t onColor,
+                      uint16_t offColor) {
+    uint32_t onPair  = onColor | (static_cast<uint32_t>(onColor) << 16);
+    uint32_t offPair = offColor | (static_cast<uint32_t>(offColor) << 16);
+
+    while (nbrOfPixels >= 8) {
+        uint32_t bits = loadMaskBits(pMask, firstBit, 8);
+        storeWord(&pDst[0], selectLanes(kPairLanes[bits >> 6], onPair, offPair));
+        storeWord(&pDst[2], selectLanes(kPairLanes[(bits >> 4) & 3], onPair, offPair));
+        storeWord(&pDst[4], selectLanes(kPairLanes[(bits >> 2) & 3], onPair, offPair));
+        storeWord(&pDst[6], selectLanes(kPairLanes[bits & 3], onPair, offPair));
+        pDst        += 8;
+        firstBit    += 8;
+        nbrOfPixels -= 8;
+    }
+
+    if (nbrOfPixels > 0) {
+        uint32_t bits = loadMaskBits(pMask, firstBit, nbrOfPixels);
+        for (uint32_t i = 0; i < nbrOfPixels; i++) {
+            pDst[i] = ((bits & (0x80U >> i)) != 0) ? onColor : offColor;
+        }
+    }
+}
+
+/**
+ * @brief  Expands a row of a 1-bpp mask (most significant bit first) into
+ *         ARGB8888 pixels.
+ * @param  pDst         Destination of the first pixel
+ * @param  pMask        First byte of the mask row
+ * @param  firstBit     Index of the first mask bit to expand
+ * @param  nbrOfPixels  Number of pixels to write
+ * @param  onColor      Color of the set bits (ARGB8888)
+ * @param  offColor     Color of the cleared bits (ARGB8888)
+ */
+void expandMaskRow8888(uint32_t* pDst,
+                       const uint8_t* pMask,
+                       uint32_t firstBit,
+                       uint32_t nbrOfPixels,
+                       uint32_t onColor,
+                       uint32_t offColor) {
+    while (nbrOfPixels >= 8) {
+        uint32_t bits = loadMaskBits(pMask, firstBit, 8);
+        for (uint32_t i = 0; i < 8; i++) {
+            pDst[i] = selectLanes(kPixelLanes[(bits >> (7 - i)) & 1], onColor, offColor);
+        }
+        pDst        += 8;
+        firstBit    += 8;
+        nbrOfPixels -= 8;
+    }
+
+    if (nbrOfPixels > 0) {
+        uint32_t bits = loadMaskBits(pMask, firstBit, nbrOfPixels);
+        for (uint32_t i = 0; i < nbrOfPixels; i++) {
+            pDst[i] = selectLanes(kPixelLanes[(bits >> (7 - i)) & 1], onColor, offColor);
+        }
+    }
+}
+
+/**
+ * @brief  Expands a row of a 1-bpp mask (most significant bit first) into 8-bit
+ *         palette indices.
+ * @param  pDst         Destination of the first pixel
+ * @param  pMask        First byte of the mask row
+ * @param  firstBit     Index of the first mask bit to expand
+ * @param  nbrOfPixels  Number of pixels to write
+ * @param  onIndex      Palette index of the set bits
+ * @param  offIndex     Palette index of the cleared bits
+ */
+void expandMaskRow8(uint8_t* pDst,
+                    const uint8_t* pMask,
+                    uint32_t firstBit,
+                    uint32_t nbrOfPixels,
+                    uint8_t onIndex,
+                    uint8_t offIndex) {
+    uint32_t onQuad  = onIndex * 0x01010101U;
+    uint32_t offQuad = offIndex * 0x01010101U;
+
+    while (nbrOfPixels >= 8) {
+        uint32_t bits = loadMaskBits(pMask, firstBit, 8);
+        storeWord(&pDst[0], selectLanes(kQuadLanes[bits >> 4], onQuad, offQuad));
+        storeWord(&pDst[4], selectLanes(kQuadLanes[bits & 0xF], onQuad, offQuad));
+        pDst        += 8;
+        firstBit    += 8;
+        nbrOfPixels -= 8;
+    }
+
+    if (nbrOfPixels > 0) {
+        uint32_t bits = loadMaskBits(pMask, firstBit, nbrOfPixels);
+        for (uint32_t i = 0; i < nbrOfPixels; i++) {
+            pDst[i] = ((bits & (0x80U >> i)) != 0) ? onIndex : offIndex;
+        }
+    }
+}
+
+/**
+ * @brief  Fills a row of 8-bit palette indices.
+ * @param  pDst         Destination of the first pixel
+ * @param  nbrOfPixels  Number of pixels to write
+ * @param  index        Palette index
+ */
+void fillRow8(uint8_t* pDst, uint32_t nbrOfPixels, uint8_t index) {
+    memset(pDst, index, nbrOfPixels);
+}
+
+/**
+ * @brief  Fills a row of RGB565 pixels, two pixels per store.
+ * @param  pDst         Destination of the first pixel
+ * @param  nbrOfPixels  Number of pixels to write
+ * @param  color        Fill color (RGB565)
+ */
+void fillRow565(uint16_t* pDst, uint32_t nbrOfPixels, uint16_t color) {
+    uint32_t pair = color | (static_cast<uint32_t>(color) << 16);
+    while (nbrOfPixels >= 2) {
+        storeWord(pDst, pair);
+        pDst        += 2;
+        nbrOfPixels -= 2;
+    }
+    if (nbrOfPixels > 0) {
+        *pDst = color;
+    }
+}
+
+/**
+ * @brief  Fills a row of ARGB8888 pixels.
+ * @param  pDst         Destination of the first pixel
+ * @param  nbrOfPixels  Number of pixels to write
+ * @param  color        Fill color (ARGB8888)
+ */
+void fillRow8888(uint32_t* pDst, uint32_t nbrOfPixels, uint32_t color) {
+    for (uint32_t i = 0; i < nbrOfPixels; i++) {
+        pDst[i] = color;
+    }
+}
+
+}  // namespace disco
@@ -0,0 +1,53 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file pixel_kernels.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Pixel kernels expanding 1-bpp masks and filling RGB565/ARGB8888 rows
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+namespace disco {
+
+void expandMaskRow565(uint16_t* pDst,
+                      const uint8_t* pMask,
+                      uint32_t firstBit,
+                      uint32_t nbrOfPixels,
+                      uint16_t onColor,
+                      uint16_t offColor);
+void expandMaskRow8888(uint32_t* pDst,
+                       const uint8_t* pMask,
+                       uint32_t firstBit,
+                       uint32_t nbrOfPixels,
+                       uint32_t onColor,
+                       uint32_t offColor);
+void expandMaskRow8(uint8_t* pDst,
+                    const uint8_t* pMask,
+                    uint32_t firstBit,
+                    uint32_t nbrOfPixels,
+                    uint8_t onIndex,
+                    uint8_t offIndex);
+void fillRow8(uint8_t* pDst, uint32_t nbrOfPixels, uint8_t index);
+void fillRow565(uint16_t* pDst, uint32_t nbrOfPixels, uint16_t color);
+void fillRow8888(uint32_t* pDst, uint32_t nbrOfPixels, uint32_t color);
+
+}  // namespace disco
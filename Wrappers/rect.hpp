@@ -0,0 +1,66 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file rect.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Display rectangle
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+namespace disco {
+
+struct Rect {
+    // cppcheck-suppress unusedStructMember
+    uint32_t x;
+    // cppcheck-suppress unusedStructMember
+    uint32_t y;
+    // cppcheck-suppress unusedStructMember
+    uint32_t width;
+    // cppcheck-suppress unusedStructMember
+    uint32_t height;
+};
+
+inline bool isEmpty(const Rect& rect) { return rect.width == 0 || rect.height == 0; }
+
+inline bool intersects(const Rect& a, const Rect& b) {
+    return !isEmpty(a) && !isEmpty(b) && a.x < b.x + b.width && b.x < a.x + a.width &&
+           a.y < b.y + b.height && b.y < a.y + a.height;
+}
+
+inline bool contains(const Rect& outer, const Rect& inner) {
+    return inner.x >= outer.x && inner.y >= outer.y &&
+           inner.x + inner.width <= outer.x + outer.width &&
+           inner.y + inner.height <= outer.y + outer.height;
+}
+
+inline uint32_t getArea(const Rect& rect) { return rect.width * rect.height; }
+
+// smallest rectangle holding both rectangles
+inline Rect getBoundingRect(const Rect& a, const Rect& b) {
+    uint32_t x0 = (a.x < b.x) ? a.x : b.x;
+    uint32_t y0 = (a.y < b.y) ? a.y : b.y;
+    uint32_t x1 = (a.x + a.width > b.x + b.width) ? a.x + a.width : b.x + b.width;
+    uint32_t y1 = (a.y + a.height > b.y + b.height) ? a.y + a.height : b.y + b.height;
+    return {.x = x0, .y = y0, .width = x1 - x0, .height = y1 - y0};
+}
+
+}  // namespace disco
@@ -0,0 +1,295 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file text_layout.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Word-wrapped text layout in a box, with a cache of layout results
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#include "text_layout.hpp"
+
+#include "font_metrics.hpp"
+#include "text_run.hpp"
+
+namespace disco {
+
+// glyph markers used while laying out, never drawn
+static constexpr uint16_t kLineBreak = 0xFFFF;
+static constexpr uint16_t kSpace     = 0;
+
+/**
+ * @brief  Lays out a UTF-8 paragraph in a box. Lines are broken at spaces (or
+ *         inside a word longer than the box) and at '\n'. If the text needs more
+ *         lines than the box holds, the last line ends with an ellipsis.
+ * @param  pFont  Font used for the text
+ * @param  text   Null-terminated UTF-8 string
+ * @param  box    Box the text is laid out in
+ * @param  align  Horizontal alignment of each line in the box
+ */
+void TextLayout::compute(const Font* pFont,
+                         const char* text,
+                         const TextBox& box,
+                         TextAlign align) {
+    pFont_       = pFont;
+    textHash_    = hashText(text);
+    box_         = box;
+    align_       = align;
+    nbrOfLines_  = 0;
+    isTruncated_ = false;
+
+    uint32_t nbrOfGlyphs = decode(text);
+    uint32_t maxLines    = box.height / pFont->height;
+    if (maxLines > kMaxNbrOfLines) {
+        maxLines = kMaxNbrOfLines;
+    }
+    if (maxLines == 0) {
+        isTruncated_ = (nbrOfGlyphs > 0);
+        return;
+    }
+
+    uint32_t lineStart = 0;
+    while (lineStart < nbrOfGlyphs) {
+        if (nbrOfLines_ == maxLines) {
+            isTruncated_ = true;
+            ellipsizeLastLine();
+            return;
+        }
+
+        // extend the line glyph by glyph, remembering the last space
+        uint32_t lineWidth = 0;
+        uint32_t lastSpace = nbrOfGlyphs;
+        uint32_t i         = lineStart;
+        while (i < nbrOfGlyphs && glyphs_[i] != kLineBreak) {
+            uint32_t advance = getGlyphMetrics(pFont, glyphs_[i]).advance;
+            if (lineWidth + advance > box.width && i > lineStart) {
+                break;
+            }
+            if (glyphs_[i] == kSpace) {
+                lastSpace = i;
+            }
+            lineWidth += advance;
+            i++;
+        }
+
+        if (i == nbrOfGlyphs || glyphs_[i] == kLineBreak) {
+            addLine(lineStart, i);
+            lineStart = i + 1;
+        } else if (lastSpace < nbrOfGlyphs && lastSpace > lineStart) {
+            // wrap at the last space, which is dropped
+            addLine(lineStart, lastSpace);
+            lineStart = lastSpace + 1;
+        } else {
+            // a single word wider than the box is broken where it overflows
+            addLine(lineStart, i);
+            lineStart = i;
+        }
+    }
+}
+
+/**
+ * @brief  Checks whether the layout was computed for the given key.
+ * @retval true if the layout can be reused
+ */
+bool TextLayout::matches(const Font* pFont,
+                         uint32_t textHash,
+                         const TextBox& box,
+                         TextAlign align) const {
+    return pFont_ == pFont && textHash_ == textHash && box_.x == box.x &&
+           box_.y == box.y && box_.width == box.width && box_.height == box.height &&
+           align_ == align;
+}
+
+/**
+ * @brief  Gets the font the layout was computed for.
+ * @retval Font of the glyphs
+ */
+const Font* TextLayout::getFont() const { return pFont_; }
+
+/**
+ * @brief  Gets the glyph indices that the lines refer to.
+ * @retval Pointer to the glyphs
+ */
+const uint16_t* TextLayout::getGlyphs() const { return glyphs_; }
+
+/**
+ * @brief  Gets the number of lines of the layout.
+ * @retval Number of lines
+ */
+uint32_t TextLayout::getNbrOfLines() const { return nbrOfLines_; }
+
+/**
+ * @brief  Gets one line of the layout.
+ * @param  index  Line number, from the top of the box
+ * @retval Position and glyphs of the line
+ */
+const TextLine& TextLayout::getLine(uint32_t index) const { return lines_[index]; }
+
+/**
+ * @brief  Tells whether the text did not fit in the box.
+ * @retval true if the last line was ellipsized
+ */
+bool TextLayout::isTruncated() const { return isTruncated_; }
+
+/**
+ * @brief  Hashes a string (FNV-1a) to detect changes of its content.
+ * @param  text  Null-terminated string
+ * @retval Hash of the string
+ */
+uint32_t TextLayout::hashText(const char* text) {
+    uint32_t hash = 2166136261U;
+    while (*text != 0) {
+        hash = (hash ^ static_cast<uint8_t>(*text++)) * 16777619U;
+    }
+    return hash;
+}
+
+/**
+ * @brief  Decodes the text into glyph indices, '\n' becoming a line break marker.
+ * @retval Number of glyphs, at most kMaxNbrOfGlyphs
+ */
+uint32_t TextLayout::decode(const char* text) {
+    uint32_t nbrOfGlyphs = 0;
+    while (*text != 0 && nbrOfGlyphs < kMaxNbrOfGlyphs) {
+        uint8_t byte = static_cast<uint8_t>(*text);
+        if (byte >= ' ' && byte <= '~') {
+            glyphs_[nbrOfGlyphs++] = byte - ' ';
+            text++;
+            continue;
+        }
+        if (byte == '\n') {
+            glyphs_[nbrOfGlyphs++] = kLineBreak;
+            text++;
+            continue;
+        }
+        uint32_t codePoint     = 0;
+        text                  += decodeUtf8(text, &codePoint);
+        glyphs_[nbrOfGlyphs++] = static_cast<uint16_t>(getGlyphIndex(pFont_, codePoint));
+    }
+    return nbrOfGlyphs;
+}
+
+/**
+ * @brief  Appends the glyphs [first, end) as a new line, aligned in the box.
+ */
+void TextLayout::addLine(uint32_t first, uint32_t end) {
+    uint32_t width = measureGlyphs(pFont_, &glyphs_[first], end - first);
+    uint32_t x     = box_.x;
+    if (width < box_.width) {
+        if (align_ == TextAlign::Center) {
+            x += (box_.width - width) / 2;
+        } else if (align_ == TextAlign::Right) {
+            x += box_.width - width;
+        }
+    }
+
+    TextLine& line   = lines_[nbrOfLines_];
+    line.x           = static_cast<uint16_t>(x);
+    line.y           = static_cast<uint16_t>(box_.y + nbrOfLines_ * pFont_->height);
+    line.firstGlyph  = static_cast<uint16_t>(first);
+    line.nbrOfGlyphs = static_cast<uint16_t>(end - first);
+    nbrOfLines_++;
+}
+
+/**
+ * @brief  Ends the last line with an ellipsis, dropping glyphs until it fits.
+ */
+void TextLayout::ellipsizeLastLine() {
+    // a single ellipsis glyph if the font has one, three dots otherwise
+    uint32_t ellipsis  = getGlyphIndex(pFont_, 0x2026);
+    uint32_t nbrOfDots = 1;
+    if (ellipsis == kReplacementGlyph) {
+        ellipsis  = '.' - ' ';
+        nbrOfDots = 3;
+    }
+    uint32_t ellipsisWidth = nbrOfDots * getGlyphMetrics(pFont_, ellipsis).advance;
+
+    nbrOfLines_--;
+    uint32_t first = lines_[nbrOfLines_].firstGlyph;
+    uint32_t end   = first + lines_[nbrOfLines_].nbrOfGlyphs;
+    while (end > first &&
+           measureGlyphs(pFont_, &glyphs_[first], end - first) + ellipsisWidth >
+               box_.width) {
+        end--;
+    }
+    // no trailing space before the ellipsis
+    while (end > first && glyphs_[end - 1] == kSpace) {
+        end--;
+    }
+    for (uint32_t i = 0; i < nbrOfDots; i++) {
+        glyphs_[end++] = static_cast<uint16_t>(ellipsis);
+    }
+    addLine(first, end);
+}
+
+/**
+ * @brief  Returns the layout of a text, computing it only if the same text, font,
+ *         box and alignment are not cached. The least recently used layout is
+ *         replaced on a miss.
+ * @param  pFont  Font used for the text
+ * @param  text   Null-terminated UTF-8 string
+ * @param  box    Box the text is laid out in
+ * @param  align  Horizontal alignment of each line in the box
+ * @retval Layout, valid until the next call
+ */
+const TextLayout& TextLayoutCache::getLayout(const Font* pFont,
+                                             const char* text,
+                                             const TextBox& box,
+                                             TextAlign align) {
+    uint32_t textHash = TextLayout::hashText(text);
+    useCounter_++;
+
+    uint32_t oldest = 0;
+    for (uint32_t i = 0; i < kNbrOfLayouts; i++) {
+        if (lastUse_[i] != 0 && layouts_[i].matches(pFont, textHash, box, align)) {
+            stats_.hits++;
+            lastUse_[i] = useCounter_;
+            return layouts_[i];
+        }
+        if (lastUse_[i] < lastUse_[oldest]) {
+            oldest = i;
+        }
+    }
+
+    stats_.misses++;
+    layouts_[oldest].compute(pFont, text, box, align);
+    lastUse_[oldest] = useCounter_;
+    return layouts_[oldest];
+}
+
+/**
+ * @brief  Drops all cached layouts.
+ */
+void TextLayoutCache::invalidate() {
+    for (uint32_t i = 0; i < kNbrOfLayouts; i++) {
+        lastUse_[i] = 0;
+    }
+}
+
+/**
+ * @brief  Gets the hit/miss counters.
+ * @retval Cache statistics
+ */
+const TextLayoutCache::Stats& TextLayoutCache::getStats() const { return stats_; }
+
+/**
+ * @brief  Resets the hit/miss counters.
+ */
+void TextLayoutCache::resetStats() { stats_ = {.hits = 0, .misses = 0}; }
+
+}  // namespace disco
@@ -0,0 +1,132 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file text_layout.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Word-wrapped text layout in a box, with a cache of layout results
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+#include "fonts.hpp"
+
+namespace disco {
+
+enum class TextAlign : uint8_t { Left, Center, Right };
+
+struct TextBox {
+    // cppcheck-suppress unusedStructMember
+    uint16_t x;
+    // cppcheck-suppress unusedStructMember
+    uint16_t y;
+    // cppcheck-suppress unusedStructMember
+    uint16_t width;
+    // cppcheck-suppress unusedStructMember
+    uint16_t height;
+};
+
+// a run of glyphs drawn on one line, at its aligned position
+struct TextLine {
+    // cppcheck-suppress unusedStructMember
+    uint16_t x;
+    // cppcheck-suppress unusedStructMember
+    uint16_t y;
+    // cppcheck-suppress unusedStructMember
+    uint16_t firstGlyph;
+    // cppcheck-suppress unusedStructMember
+    uint16_t nbrOfGlyphs;
+};
+
+class TextLayout {
+   public:
+    TextLayout() = default;
+
+    void compute(const Font* pFont,
+                 const char* text,
+                 const TextBox& box,
+                 TextAlign align);
+    bool matches(const Font* pFont,
+                 uint32_t textHash,
+                 const TextBox& box,
+                 TextAlign align) const;
+    const Font* getFont() const;
+    const uint16_t* getGlyphs() const;
+    uint32_t getNbrOfLines() const;
+    const TextLine& getLine(uint32_t index) const;
+    bool isTruncated() const;
+
+    static uint32_t hashText(const char* text);
+
+    // longest paragraph and number of lines kept per layout
+    static constexpr uint32_t kMaxNbrOfGlyphs = 512;
+    static constexpr uint32_t kMaxNbrOfLines  = 24;
+
+   private:
+    uint32_t decode(const char* text);
+    void addLine(uint32_t first, uint32_t end);
+    void ellipsizeLastLine();
+
+    // three more glyphs for the ellipsis of the last line
+    uint16_t glyphs_[kMaxNbrOfGlyphs + 3] = {0};
+    TextLine lines_[kMaxNbrOfLines]       = {};
+    uint32_t nbrOfLines_                  = 0;
+    bool isTruncated_                     = false;
+
+    // layout key
+    const Font* pFont_ = nullptr;
+    uint32_t textHash_ = 0;
+    TextBox box_       = {.x = 0, .y = 0, .width = 0, .height = 0};
+    TextAlign align_   = TextAlign::Left;
+};
+
+class TextLayoutCache {
+   public:
+    TextLayoutCache() = default;
+
+    // layouts hold a copy of the glyphs and cannot be copied
+    TextLayoutCache(const TextLayoutCache&)            = delete;
+    TextLayoutCache& operator=(const TextLayoutCache&) = delete;
+
+    struct Stats {
+        // cppcheck-suppress unusedStructMember
+        uint32_t hits;
+        // cppcheck-suppress unusedStructMember
+        uint32_t misses;
+    };
+
+    const TextLayout& getLayout(const Font* pFont,
+                                const char* text,
+                                const TextBox& box,
+                                TextAlign align);
+    void invalidate();
+    const Stats& getStats() const;
+    void resetStats();
+
+    static constexpr uint32_t kNbrOfLayouts = 4;
+
+   private:
+    TextLayout layouts_[kNbrOfLayouts];
+    uint32_t lastUse_[kNbrOfLayouts] = {0};
+    uint32_t useCounter_             = 0;
+    Stats stats_                     = {.hits = 0, .misses = 0};
+};
+
+}  // namespace disco
@@ -0,0 +1,121 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file text_run.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief UTF-8 text decoded into the glyph indices of a font
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#include "text_run.hpp"
+
+#include "font_metrics.hpp"
+
+namespace disco {
+
+// code point reported for malformed sequences
+static constexpr uint32_t kReplacementCharacter = 0xFFFD;
+
+/**
+ * @brief  Decodes one UTF-8 sequence.
+ * @param  text        Start of the sequence, not at the terminating null
+ * @param  pCodePoint  Decoded code point, U+FFFD for a malformed sequence
+ * @retval Number of bytes consumed (at least 1)
+ */
+uint32_t decodeUtf8(const char* text, uint32_t* pCodePoint) {
+    const uint8_t* pByte = reinterpret_cast<const uint8_t*>(text);  // NOLINT
+    uint32_t lead        = pByte[0];
+
+    uint32_t nbrOfContinuations = 0;
+    uint32_t minCodePoint       = 0;
+    if (lead < 0x80) {
+        *pCodePoint = lead;
+        return 1;
+    } else if ((lead & 0xE0) == 0xC0) {
+        nbrOfContinuations = 1;
+        minCodePoint       = 0x80;
+        lead &= 0x1F;
+    } else if ((lead & 0xF0) == 0xE0) {
+        nbrOfContinuations = 2;
+        minCodePoint       = 0x800;
+        lead &= 0x0F;
+    } else if ((lead & 0xF8) == 0xF0) {
+        nbrOfContinuations = 3;
+        minCodePoint       = 0x10000;
+        lead &= 0x07;
+    } else {
+        *pCodePoint = kReplacementCharacter;
+        return 1;
+    }
+
+    uint32_t codePoint = lead;
+    for (uint32_t i = 1; i <= nbrOfContinuations; i++) {
+        // a missing continuation byte (including the terminating null) ends the
+        // sequence without consuming that byte
+        if ((pByte[i] & 0xC0) != 0x80) {
+            *pCodePoint = kReplacementCharacter;
+            return i;
+        }
+        codePoint = (codePoint << 6) | (pByte[i] & 0x3F);
+    }
+
+    // reject overlong encodings, surrogates and values beyond U+10FFFF
+    if (codePoint < minCodePoint || codePoint > 0x10FFFF ||
+        (codePoint >= 0xD800 && codePoint <= 0xDFFF)) {
+        codePoint = kReplacementCharacter;
+    }
+    *pCodePoint = codePoint;
+    return nbrOfContinuations + 1;
+}
+
+/**
+ * @brief  Decodes a null-terminated UTF-8 string into glyph indices of a font.
+ *         Runs of printable ASCII are mapped without decoding.
+ * @param  pFont  Font used for the text
+ * @param  text   Null-terminated UTF-8 string, truncated after kMaxNbrOfGlyphs
+ *                glyphs
+ */
+void TextRun::assign(const Font* pFont, const char* text) {
+    nbrOfGlyphs_ = 0;
+    while (*text != 0 && nbrOfGlyphs_ < kMaxNbrOfGlyphs) {
+        uint8_t byte = static_cast<uint8_t>(*text);
+        if (byte >= ' ' && byte <= '~') {
+            // fast path: printable ASCII is the first part of every font
+            glyphs_[nbrOfGlyphs_++] = byte - ' ';
+            text++;
+            continue;
+        }
+        uint32_t codePoint      = 0;
+        text                   += decodeUtf8(text, &codePoint);
+        glyphs_[nbrOfGlyphs_++] = static_cast<uint16_t>(getGlyphIndex(pFont, codePoint));
+    }
+}
+
+/**
+ * @brief  Gets the glyph indices of the last assigned string.
+ * @retval Pointer to getNbrOfGlyphs() glyph indices
+ */
+const uint16_t* TextRun::getGlyphs() const { return glyphs_; }
+
+/**
+ * @brief  Gets the number of glyphs of the last assigned string.
+ * @retval Number of glyphs
+ */
+uint32_t TextRun::getNbrOfGlyphs() const { return nbrOfGlyphs_; }
+
+}  // namespace disco
@@ -0,0 +1,51 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file text_run.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief UTF-8 text decoded into the glyph indices of a font
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+#include "fonts.hpp"
+
+namespace disco {
+
+uint32_t decodeUtf8(const char* text, uint32_t* pCodePoint);
+
+class TextRun {
+   public:
+    TextRun() = default;
+
+    void assign(const Font* pFont, const char* text);
+    const uint16_t* getGlyphs() const;
+    uint32_t getNbrOfGlyphs() const;
+
+    // longest run kept, far more than a display line of the narrowest font
+    static constexpr uint32_t kMaxNbrOfGlyphs = 256;
+
+   private:
+    uint16_t glyphs_[kMaxNbrOfGlyphs] = {0};
+    uint32_t nbrOfGlyphs_             = 0;
+};
+
+}  // namespace disco
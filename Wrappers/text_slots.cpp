@@ -0,0 +1,175 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file text_slots.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Last strings drawn at each (x, y, font) slot, for differential redraw
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#include "text_slots.hpp"
+
+namespace disco {
+
+/**
+ * @brief  Compares a run with the one last drawn at the same position and font.
+ * @note   Glyphs of a monospaced font keep their cell, so only the glyphs between
+ *         the first and the last difference are returned. With a proportional or
+ *         kerned font the following glyphs may move: the range extends to the end
+ *         of the run and starts one glyph early, whose box may reach into the
+ *         first changed glyph.
+ * @param  pFont        Font used for the text
+ * @param  xPos         Start column of the run
+ * @param  yPos         Top line of the run
+ * @param  textColor    Foreground color (ARGB8888)
+ * @param  backColor    Background color (ARGB8888)
+ * @param  glyphs       Glyph indices of the run
+ * @param  nbrOfGlyphs  Number of glyphs of the run
+ * @retval Glyphs to redraw, an empty range if the run did not change
+ */
+TextSlotCache::Range TextSlotCache::findChanges(const Font* pFont,
+                                                uint32_t xPos,
+                                                uint32_t yPos,
+                                                uint32_t textColor,
+                                                uint32_t backColor,
+                                                const uint16_t* glyphs,
+                                                uint32_t nbrOfGlyphs) const {
+    int32_t index = findSlot(pFont, xPos, yPos);
+    if (index < 0 || slots_[index].textColor != textColor ||
+        slots_[index].backColor != backColor) {
+        return {.first = 0, .end = nbrOfGlyphs};
+    }
+
+    const Slot& slot = slots_[index];
+    uint32_t common  = (nbrOfGlyphs < slot.nbrOfGlyphs) ? nbrOfGlyphs : slot.nbrOfGlyphs;
+    uint32_t first   = 0;
+    while (first < common && glyphs[first] == slot.glyphs[first]) {
+        first++;
+    }
+    if (first == nbrOfGlyphs) {
+        // same string, or a prefix of the previous one
+        return {.first = nbrOfGlyphs, .end = nbrOfGlyphs};
+    }
+
+    if (pFont->metrics != nullptr || pFont->kerning != nullptr) {
+        return {.first = (first > 0) ? first - 1 : 0, .end = nbrOfGlyphs};
+    }
+
+    uint32_t end = nbrOfGlyphs;
+    if (nbrOfGlyphs <= slot.nbrOfGlyphs) {
+        while (end > first && glyphs[end - 1] == slot.glyphs[end - 1]) {
+            end--;
+        }
+    }
+    return {.first = first, .end = end};
+}
+
+/**
+ * @brief  Remembers the run drawn at a slot. The slots overlapping the run are
+ *         dropped, the least recently used slot is replaced if needed.
+ * @param  pFont        Font used for the text
+ * @param  xPos         Start column of the run
+ * @param  yPos         Top line of the run
+ * @param  textColor    Foreground color (ARGB8888)
+ * @param  backColor    Background color (ARGB8888)
+ * @param  glyphs       Glyph indices of the run
+ * @param  nbrOfGlyphs  Number of glyphs of the run
+ * @param  area         Area covered by the run on the display
+ */
+void TextSlotCache::store(const Font* pFont,
+                          uint32_t xPos,
+                          uint32_t yPos,
+                          uint32_t textColor,
+                          uint32_t backColor,
+                          const uint16_t* glyphs,
+                          uint32_t nbrOfGlyphs,
+                          const Rect& area) {
+    int32_t index = findSlot(pFont, xPos, yPos);
+    if (index >= 0) {
+        slots_[index].isValid = false;
+    }
+    invalidate(area);
+    if (nbrOfGlyphs > kMaxNbrOfGlyphs) {
+        return;
+    }
+
+    if (index < 0) {
+        index = 0;
+        for (uint32_t i = 0; i < kNbrOfSlots; i++) {
+            if (!slots_[i].isValid) {
+                index = i;
+                break;
+            }
+            if (slots_[i].lastUse < slots_[index].lastUse) {
+                index = i;
+            }
+        }
+    }
+
+    Slot& slot       = slots_[index];
+    slot.pFont       = pFont;
+    slot.textColor   = textColor;
+    slot.backColor   = backColor;
+    slot.area        = area;
+    slot.xPos        = static_cast<uint16_t>(xPos);
+    slot.yPos        = static_cast<uint16_t>(yPos);
+    slot.nbrOfGlyphs = static_cast<uint16_t>(nbrOfGlyphs);
+    for (uint32_t i = 0; i < nbrOfGlyphs; i++) {
+        slot.glyphs[i] = glyphs[i];
+    }
+    slot.lastUse = ++useCounter_;
+    slot.isValid = true;
+}
+
+/**
+ * @brief  Drops the slots whose text was (partly) overdrawn.
+ * @param  area  Area drawn on the display
+ */
+void TextSlotCache::invalidate(const Rect& area) {
+    for (uint32_t i = 0; i < kNbrOfSlots; i++) {
+        if (slots_[i].isValid && intersects(slots_[i].area, area)) {
+            slots_[i].isValid = false;
+        }
+    }
+}
+
+/**
+ * @brief  Drops all slots, e.g. after the whole display was redrawn.
+ */
+void TextSlotCache::invalidate() {
+    for (uint32_t i = 0; i < kNbrOfSlots; i++) {
+        slots_[i].isValid = false;
+    }
+}
+
+/**
+ * @brief  Finds the valid slot of a position and font.
+ * @retval Slot index, -1 if there is none
+ */
+int32_t TextSlotCache::findSlot(const Font* pFont, uint32_t xPos, uint32_t yPos) const {
+    for (uint32_t i = 0; i < kNbrOfSlots; i++) {
+        const Slot& slot = slots_[i];
+        if (slot.isValid && slot.pFont == pFont && slot.xPos == xPos &&
+            slot.yPos == yPos) {
+            return static_cast<int32_t>(i);
+        }
+    }
+    return -1;
+}
+
+}  // namespace disco
@@ -0,0 +1,97 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file text_slots.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Last strings drawn at each (x, y, font) slot, for differential redraw
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+#include "fonts.hpp"
+#include "rect.hpp"
+
+namespace disco {
+
+class TextSlotCache {
+   public:
+    TextSlotCache() = default;
+
+    // glyphs [first, end) of a run
+    struct Range {
+        // cppcheck-suppress unusedStructMember
+        uint32_t first;
+        // cppcheck-suppress unusedStructMember
+        uint32_t end;
+    };
+
+    Range findChanges(const Font* pFont,
+                      uint32_t xPos,
+                      uint32_t yPos,
+                      uint32_t textColor,
+                      uint32_t backColor,
+                      const uint16_t* glyphs,
+                      uint32_t nbrOfGlyphs) const;
+    void store(const Font* pFont,
+               uint32_t xPos,
+               uint32_t yPos,
+               uint32_t textColor,
+               uint32_t backColor,
+               const uint16_t* glyphs,
+               uint32_t nbrOfGlyphs,
+               const Rect& area);
+    void invalidate(const Rect& area);
+    void invalidate();
+
+    // number of remembered strings and longest string remembered
+    static constexpr uint32_t kNbrOfSlots     = 8;
+    static constexpr uint32_t kMaxNbrOfGlyphs = 48;
+
+   private:
+    int32_t findSlot(const Font* pFont, uint32_t xPos, uint32_t yPos) const;
+
+    struct Slot {
+        // cppcheck-suppress unusedStructMember
+        const Font* pFont;
+        // cppcheck-suppress unusedStructMember
+        uint32_t textColor;
+        // cppcheck-suppress unusedStructMember
+        uint32_t backColor;
+        // cppcheck-suppress unusedStructMember
+        Rect area;
+        // cppcheck-suppress unusedStructMember
+        uint16_t xPos;
+        // cppcheck-suppress unusedStructMember
+        uint16_t yPos;
+        // cppcheck-suppress unusedStructMember
+        uint16_t nbrOfGlyphs;
+        // cppcheck-suppress unusedStructMember
+        uint16_t glyphs[kMaxNbrOfGlyphs];
+        // cppcheck-suppress unusedStructMember
+        uint32_t lastUse;
+        // cppcheck-suppress unusedStructMember
+        bool isValid;
+    };
+    Slot slots_[kNbrOfSlots] = {};
+    uint32_t useCounter_     = 0;
+};
+
+}  // namespace disco
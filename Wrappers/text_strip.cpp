@@ -0,0 +1,166 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file text_strip.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Rasterization of a whole text run into an internal SRAM strip
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#include "text_strip.hpp"
+
+#include "color.hpp"
+#include "font_metrics.hpp"
+#include "glyph_expander.hpp"
+#include "pixel_kernels.hpp"
+
+namespace disco {
+
+// The strip lives in .bss, which the CM7 linker script maps to AXI SRAM. It is
+// aligned on a cache line so that it can be cleaned before the DMA2D reads it.
+alignas(32) static uint8_t stripBuffer[TextStrip::kMaxWidth * TextStrip::kMaxHeight * 4];
+
+/**
+ * @brief  Sets the size of the strip to a run of glyphs, e.g. for the DMA2D to
+ *         copy cached glyphs into it.
+ * @param  pFont          Font used for the text
+ * @param  glyphs         Glyph indices of the run
+ * @param  nbrOfGlyphs    Number of glyphs of the run
+ * @param  bytesPerPixel  1 for L8, 2 for RGB565, 4 for ARGB8888
+ * @retval false if the run does not fit in the strip or the font is not a 1-bpp
+ *         font, in which case the strip is unchanged
+ */
+bool TextStrip::resize(const Font* pFont,
+                       const uint16_t* glyphs,
+                       uint32_t nbrOfGlyphs,
+                       uint32_t bytesPerPixel) {
+    uint32_t width = measureGlyphs(pFont, glyphs, nbrOfGlyphs);
+    if (isCoverageFont(pFont) || width == 0 || width > kMaxWidth ||
+        pFont->height > kMaxHeight) {
+        return false;
+    }
+
+    width_         = width;
+    height_        = pFont->height;
+    bytesPerPixel_ = bytesPerPixel;
+    return true;
+}
+
+/**
+ * @brief  Expands a run of glyphs side by side into the strip.
+ * @param  pFont          Font used for the text
+ * @param  glyphs         Glyph indices to rasterize
+ * @param  nbrOfGlyphs    Number of glyphs to rasterize
+ * @param  textColor      Foreground color (ARGB8888, palette index for L8)
+ * @param  backColor      Background color (ARGB8888, palette index for L8)
+ * @param  bytesPerPixel  1 for L8, 2 for RGB565, 4 for ARGB8888
+ * @retval false if the run does not fit in the strip or the font is not a 1-bpp
+ *         font, in which case nothing is drawn
+ */
+bool TextStrip::rasterize(const Font* pFont,
+                          const uint16_t* glyphs,
+                          uint32_t nbrOfGlyphs,
+                          uint32_t textColor,
+                          uint32_t backColor,
+                          uint32_t bytesPerPixel) {
+    if (!resize(pFont, glyphs, nbrOfGlyphs, bytesPerPixel)) {
+        return false;
+    }
+
+    if (pFont->metrics == nullptr && pFont->kerning == nullptr) {
+        uint32_t bytesPerGlyph = pFont->width * bytesPerPixel;
+        for (uint32_t i = 0; i < nbrOfGlyphs; i++) {
+            expandGlyph(&stripBuffer[i * bytesPerGlyph],
+                        width_,
+                        pFont,
+                        glyphs[i],
+                        textColor,
+                        backColor,
+                        bytesPerPixel);
+        }
+        return true;
+    }
+
+    // proportional or kerned font: only the inked boxes are expanded over the background
+    fillBackground(backColor);
+    int32_t pen = 0;
+    for (uint32_t i = 0; i < nbrOfGlyphs; i++) {
+        uint32_t glyphIndex = glyphs[i];
+        GlyphMetrics box    = getGlyphMetrics(pFont, glyphIndex);
+        int32_t x           = pen + box.bearingX;
+        if (box.boxWidth > 0 && x >= 0 &&
+            x + box.boxWidth <= static_cast<int32_t>(width_)) {
+            uint8_t* pDst = &stripBuffer[(box.boxY * width_ + x) * bytesPerPixel];
+            expandGlyphBox(pDst,
+                           width_,
+                           pFont,
+                           glyphIndex,
+                           box,
+                           textColor,
+                           backColor,
+                           bytesPerPixel);
+        }
+        pen += getPenAdvance(pFont, glyphs, nbrOfGlyphs, i);
+    }
+
+    return true;
+}
+
+/**
+ * @brief  Fills the current run with the background color.
+ * @param  backColor  Background color (ARGB8888, palette index for L8)
+ */
+void TextStrip::fillBackground(uint32_t backColor) {
+    uint32_t nbrOfPixels = width_ * height_;
+    if (bytesPerPixel_ == 1) {
+        fillRow8(stripBuffer, nbrOfPixels, static_cast<uint8_t>(backColor));
+    } else if (bytesPerPixel_ == 2) {
+        uint16_t back565  = CONVERTARGB88882RGB565(backColor);
+        uint16_t* pPixels = reinterpret_cast<uint16_t*>(stripBuffer);  // NOLINT
+        fillRow565(pPixels, nbrOfPixels, back565);
+    } else {
+        uint32_t* pPixels = reinterpret_cast<uint32_t*>(stripBuffer);  // NOLINT
+        fillRow8888(pPixels, nbrOfPixels, backColor);
+    }
+}
+
+/**
+ * @brief  Gets the rasterized pixels, stored as getHeight() contiguous rows.
+ * @retval Pointer to the strip
+ */
+const uint8_t* TextStrip::getData() const { return stripBuffer; }
+
+/**
+ * @brief  Gets the width of the last rasterized run.
+ * @retval Width in pixels
+ */
+uint32_t TextStrip::getWidth() const { return width_; }
+
+/**
+ * @brief  Gets the height of the last rasterized run.
+ * @retval Height in pixels
+ */
+uint32_t TextStrip::getHeight() const { return height_; }
+
+/**
+ * @brief  Gets the number of bytes used by the last rasterized run.
+ * @retval Size in bytes
+ */
+uint32_t TextStrip::getSizeInBytes() const { return width_ * height_ * bytesPerPixel_; }
+
+}  // namespace disco
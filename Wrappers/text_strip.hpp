@@ -0,0 +1,68 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file text_strip.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Rasterization of a whole text run into an internal SRAM strip
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+#include "fonts.hpp"
+
+namespace disco {
+
+class TextStrip {
+   public:
+    TextStrip() = default;
+
+    // the strip buffer is shared and cannot be copied
+    TextStrip(const TextStrip&)            = delete;
+    TextStrip& operator=(const TextStrip&) = delete;
+
+    bool resize(const Font* pFont,
+                const uint16_t* glyphs,
+                uint32_t nbrOfGlyphs,
+                uint32_t bytesPerPixel);
+    bool rasterize(const Font* pFont,
+                   const uint16_t* glyphs,
+                   uint32_t nbrOfGlyphs,
+                   uint32_t textColor,
+                   uint32_t backColor,
+                   uint32_t bytesPerPixel);
+    const uint8_t* getData() const;
+    uint32_t getWidth() const;
+    uint32_t getHeight() const;
+    uint32_t getSizeInBytes() const;
+
+    // largest run that fits in the strip: a full display line of the tallest font
+    static constexpr uint32_t kMaxWidth  = 800;
+    static constexpr uint32_t kMaxHeight = 48;
+
+   private:
+    void fillBackground(uint32_t backColor);
+
+    uint32_t width_         = 0;
+    uint32_t height_        = 0;
+    uint32_t bytesPerPixel_ = 4;
+};
+
+}  // namespace disco
@@ -0,0 +1,117 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file dirty_region_test.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Tests of the merging of drawn areas into the dirty region
+ *
+ * An area is merged with the rectangles it can join without refreshing more
+ * pixels, again and again as the bounding box grows. Once all rectangles are
+ * used, it is merged with the one whose bounding box grows the least.
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#include "dirty_region.hpp"
+#include "host_test.hpp"
+
+namespace {
+
+using disco::DirtyRegion;
+using disco::Rect;
+
+bool isSameRect(const Rect& a, const Rect& b) {
+    return a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height;
+}
+
+// rectangles are not kept in drawing order
+bool hasRect(const DirtyRegion& region, const Rect& rect) {
+    for (uint32_t i = 0; i < region.getNbrOfRects(); i++) {
+        if (isSameRect(region.getRect(i), rect)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief  An area bridging two rectangles is merged with both of them.
+ */
+void testMergeUntilStable() {
+    DirtyRegion region;
+    region.add({.x = 0, .y = 0, .width = 10, .height = 10});
+    region.add({.x = 20, .y = 0, .width = 10, .height = 10});
+    // disjoint rectangles are kept apart while there is room
+    DISCO_CHECK(region.getNbrOfRects() == 2);
+
+    region.add({.x = 10, .y = 0, .width = 10, .height = 10});
+    DISCO_CHECK(region.getNbrOfRects() == 1);
+    DISCO_CHECK(hasRect(region, {.x = 0, .y = 0, .width = 30, .height = 10}));
+
+    // an area inside the region adds nothing
+    region.add({.x = 5, .y = 2, .width = 3, .height = 3});
+    DISCO_CHECK(region.getNbrOfRects() == 1);
+    DISCO_CHECK(hasRect(region, {.x = 0, .y = 0, .width = 30, .height = 10}));
+
+    // empty areas are ignored
+    region.add({.x = 100, .y = 100, .width = 0, .height = 10});
+    DISCO_CHECK(region.getNbrOfRects() == 1);
+
+    region.clear();
+    DISCO_CHECK(region.getNbrOfRects() == 0);
+}
+
+/**
+ * @brief  With all rectangles used, the area joins the closest rectangle and
+ *         the others are left untouched.
+ */
+void testCheapestMerge() {
+    const Rect corners[] = {{.x = 0, .y = 0, .width = 10, .height = 10},
+                            {.x = 100, .y = 0, .width = 10, .height = 10},
+                            {.x = 0, .y = 100, .width = 10, .height = 10},
+                            {.x = 100, .y = 100, .width = 10, .height = 10}};
+    static_assert(sizeof(corners) / sizeof(corners[0]) == DirtyRegion::kMaxNbrOfRects,
+                  "one rectangle per corner");
+
+    DirtyRegion region;
+    for (const Rect& corner : corners) {
+        region.add(corner);
+    }
+    DISCO_CHECK(region.getNbrOfRects() == DirtyRegion::kMaxNbrOfRects);
+
+    region.add({.x = 120, .y = 120, .width = 10, .height = 10});
+    DISCO_CHECK(region.getNbrOfRects() == DirtyRegion::kMaxNbrOfRects);
+    DISCO_CHECK(hasRect(region, corners[0]));
+    DISCO_CHECK(hasRect(region, corners[1]));
+    DISCO_CHECK(hasRect(region, corners[2]));
+    DISCO_CHECK(hasRect(region, {.x = 100, .y = 100, .width = 30, .height = 30}));
+
+    // an area bridging two rectangles of a full region frees one of them
+    region.add({.x = 0, .y = 10, .width = 10, .height = 90});
+    DISCO_CHECK(region.getNbrOfRects() == 3);
+    DISCO_CHECK(hasRect(region, {.x = 0, .y = 0, .width = 10, .height = 110}));
+    DISCO_CHECK(hasRect(region, corners[1]));
+}
+
+}  // namespace
+
+int main() {
+    testMergeUntilStable();
+    testCheapestMerge();
+
+    return disco::test::getExitCode();
+}
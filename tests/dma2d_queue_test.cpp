@@ -0,0 +1,138 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file dma2d_queue_test.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Tests of the DMA2D job queue on the simulated backend
+ *
+ * Jobs must complete in submission order with their callback called once,
+ * submit() must wait for a free entry when the queue is full, and isDone()
+ * must stay correct when the job identifiers wrap around.
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#include "dma2d_queue.hpp"
+#include "dma2d_sim_backend.hpp"
+#include "host_test.hpp"
+
+namespace {
+
+constexpr uint32_t kNbrOfJobs = 3 * disco::Dma2dQueue::kQueueSize + 5;
+constexpr uint32_t kLatency   = 3;
+
+struct Completion {
+    disco::Dma2dQueue* pQueue;
+    // cppcheck-suppress unusedStructMember
+    uint32_t jobIndex;
+    // cppcheck-suppress unusedStructMember
+    uint32_t jobId;
+};
+
+struct Log {
+    uint32_t jobIndices[kNbrOfJobs];
+    uint32_t nbrOfCalls;
+    bool isDoneInCallback;
+};
+
+Log log;
+
+void onJobDone(void* pContext) {
+    const auto* pCompletion = static_cast<const Completion*>(pContext);
+    if (log.nbrOfCalls < kNbrOfJobs) {
+        log.jobIndices[log.nbrOfCalls] = pCompletion->jobIndex;
+    }
+    log.nbrOfCalls++;
+    // the job is counted as done before its callback is called
+    if (!pCompletion->pQueue->isDone(pCompletion->jobId)) {
+        log.isDoneInCallback = false;
+    }
+}
+
+disco::Dma2dJob makeFill(uint32_t* pPixel, uint32_t color) {
+    return {.operation         = disco::Dma2dOperation::Fill,
+            .sourceMode        = disco::Dma2dColorMode::ARGB8888,
+            .destinationMode   = disco::Dma2dColorMode::ARGB8888,
+            .source            = 0,
+            .background        = 0,
+            .destination       = reinterpret_cast<uintptr_t>(pPixel),
+            .width             = 1,
+            .height            = 1,
+            .sourceOffset      = 0,
+            .backgroundOffset  = 0,
+            .destinationOffset = 0,
+            .color             = color,
+            .pCallback         = nullptr,
+            .pContext          = nullptr};
+}
+
+/**
+ * @brief  Runs kNbrOfJobs fills of one pixel with a callback each, checking the
+ *         order of their completions and the back-pressure of a full queue.
+ */
+void runJobs(uint32_t firstJobId) {
+    disco::Dma2dSimBackend backend;
+    backend.setLatency(kLatency);
+    disco::Dma2dQueue queue(backend, firstJobId);
+
+    log = {.jobIndices = {}, .nbrOfCalls = 0, .isDoneInCallback = true};
+    static Completion completions[kNbrOfJobs];
+    static uint32_t pixels[kNbrOfJobs];
+
+    for (uint32_t i = 0; i < kNbrOfJobs; i++) {
+        pixels[i]           = 0;
+        disco::Dma2dJob job = makeFill(&pixels[i], 0xFF000000U | i);
+        job.pCallback       = &onJobDone;
+        job.pContext        = &completions[i];
+        completions[i]      = {.pQueue = &queue, .jobIndex = i, .jobId = 0};
+
+        uint32_t jobId       = queue.submit(job);
+        completions[i].jobId = jobId;
+        DISCO_CHECK(jobId == firstJobId + i);
+        DISCO_CHECK(queue.getNbrOfPendingJobs() <= disco::Dma2dQueue::kQueueSize);
+        // jobs only complete while polled, so the queue fills up
+        DISCO_CHECK(!queue.isDone(jobId));
+        DISCO_CHECK(queue.isDone(jobId - queue.getNbrOfPendingJobs()));
+    }
+    DISCO_CHECK(queue.getNbrOfPendingJobs() == disco::Dma2dQueue::kQueueSize);
+
+    uint32_t lastJobId = firstJobId + kNbrOfJobs - 1;
+    DISCO_CHECK(!queue.isDone(lastJobId));
+    queue.waitAll();
+    DISCO_CHECK(queue.isDone(lastJobId));
+    DISCO_CHECK(queue.isDone(firstJobId));
+    DISCO_CHECK(queue.getNbrOfPendingJobs() == 0);
+    DISCO_CHECK(!backend.isBusy());
+    DISCO_CHECK(backend.getStats().nbrOfJobs == kNbrOfJobs);
+
+    DISCO_CHECK(log.nbrOfCalls == kNbrOfJobs);
+    DISCO_CHECK(log.isDoneInCallback);
+    for (uint32_t i = 0; i < kNbrOfJobs; i++) {
+        DISCO_CHECK(log.jobIndices[i] == i);
+        DISCO_CHECK(pixels[i] == (0xFF000000U | i));
+    }
+}
+
+}  // namespace
+
+int main() {
+    // identifiers far from the wraparound, then crossing it in the middle of the run
+    runJobs(1);
+    runJobs(UINT32_MAX - disco::Dma2dQueue::kQueueSize - 2);
+
+    return disco::test::getExitCode();
+}
@@ -0,0 +1,128 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file fill_batcher_test.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Tests of the batching of pending fills
+ *
+ * Fills of the same color are only merged when their bounding box covers
+ * exactly the two areas, and a fill never moves before a pending fill of
+ * another color that it overlaps.
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#include "fill_batcher.hpp"
+#include "host_test.hpp"
+
+namespace {
+
+using disco::FillBatcher;
+using disco::Rect;
+
+constexpr uint32_t kRed         = 0xFFFF0000U;
+constexpr uint32_t kBlue        = 0xFF0000FFU;
+constexpr uint32_t kFrameBuffer = 0xD0000000U;
+
+bool isSameRect(const Rect& a, const Rect& b) {
+    return a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height;
+}
+
+/**
+ * @brief  Adjacent rows and contained areas are merged, areas whose bounding
+ *         box would cover other pixels are not.
+ */
+void testExactMerge() {
+    FillBatcher batcher;
+    Rect firstRow  = {.x = 0, .y = 0, .width = 10, .height = 1};
+    Rect secondRow = {.x = 0, .y = 1, .width = 10, .height = 1};
+    DISCO_CHECK(batcher.add(firstRow, kRed, kFrameBuffer));
+    DISCO_CHECK(batcher.add(secondRow, kRed, kFrameBuffer));
+    DISCO_CHECK(batcher.getNbrOfFills() == 1);
+    DISCO_CHECK(isSameRect(batcher.getFill(0).area,
+                           {.x = 0, .y = 0, .width = 10, .height = 2}));
+
+    batcher.add({.x = 2, .y = 0, .width = 3, .height = 2}, kRed, kFrameBuffer);
+    DISCO_CHECK(batcher.getNbrOfFills() == 1);
+    DISCO_CHECK(isSameRect(batcher.getFill(0).area,
+                           {.x = 0, .y = 0, .width = 10, .height = 2}));
+
+    // the bounding box would also fill the pixels between the two areas
+    batcher.add({.x = 20, .y = 5, .width = 10, .height = 1}, kRed, kFrameBuffer);
+    DISCO_CHECK(batcher.getNbrOfFills() == 2);
+
+    // same area in another buffer
+    batcher.add({.x = 0, .y = 2, .width = 10, .height = 1}, kRed, kFrameBuffer + 4);
+    DISCO_CHECK(batcher.getNbrOfFills() == 3);
+
+    DISCO_CHECK(batcher.getStats().nbrOfFills == 5);
+    DISCO_CHECK(batcher.getStats().nbrOfMerges == 2);
+}
+
+/**
+ * @brief  A fill is not merged with an earlier fill across a fill of another
+ *         color that it overlaps, but may be across a disjoint one.
+ */
+void testNoReorderAcrossOverlap() {
+    FillBatcher batcher;
+    batcher.add({.x = 0, .y = 0, .width = 10, .height = 10}, kRed, kFrameBuffer);
+    batcher.add({.x = 5, .y = 0, .width = 10, .height = 10}, kBlue, kFrameBuffer);
+    DISCO_CHECK(batcher.getNbrOfFills() == 2);
+
+    // inside the red fill but drawn over the blue one: queued last
+    batcher.add({.x = 0, .y = 0, .width = 10, .height = 5}, kRed, kFrameBuffer);
+    DISCO_CHECK(batcher.getNbrOfFills() == 3);
+    DISCO_CHECK(batcher.getFill(2).color == kRed);
+    DISCO_CHECK(isSameRect(batcher.getFill(2).area,
+                           {.x = 0, .y = 0, .width = 10, .height = 5}));
+    DISCO_CHECK(isSameRect(batcher.getFill(0).area,
+                           {.x = 0, .y = 0, .width = 10, .height = 10}));
+
+    batcher.clear();
+    batcher.add({.x = 0, .y = 0, .width = 10, .height = 10}, kRed, kFrameBuffer);
+    batcher.add({.x = 20, .y = 0, .width = 10, .height = 10}, kBlue, kFrameBuffer);
+    // below the red fill and away from the blue one: merged with the red fill
+    batcher.add({.x = 0, .y = 10, .width = 10, .height = 10}, kRed, kFrameBuffer);
+    DISCO_CHECK(batcher.getNbrOfFills() == 2);
+    DISCO_CHECK(isSameRect(batcher.getFill(0).area,
+                           {.x = 0, .y = 0, .width = 10, .height = 20}));
+    DISCO_CHECK(batcher.getFill(1).color == kBlue);
+}
+
+/**
+ * @brief  A fill that cannot be merged is refused once all entries are used.
+ */
+void testFull() {
+    FillBatcher batcher;
+    for (uint32_t i = 0; i < FillBatcher::kMaxNbrOfFills; i++) {
+        Rect area = {.x = 0, .y = 2 * i, .width = 10, .height = 1};
+        DISCO_CHECK(batcher.add(area, kRed, kFrameBuffer));
+    }
+    Rect area = {.x = 0, .y = 2 * FillBatcher::kMaxNbrOfFills, .width = 10, .height = 1};
+    DISCO_CHECK(!batcher.add(area, kRed, kFrameBuffer));
+    DISCO_CHECK(batcher.getNbrOfFills() == FillBatcher::kMaxNbrOfFills);
+}
+
+}  // namespace
+
+int main() {
+    testExactMerge();
+    testNoReorderAcrossOverlap();
+    testFull();
+
+    return disco::test::getExitCode();
+}
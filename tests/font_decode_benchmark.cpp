@@ -0,0 +1,157 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file font_decode_benchmark.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Benchmark of the Rle1 glyph decoding against plain Mono1 glyphs
+ *
+ * Every glyph of each font pair is read row by row through GlyphRowReader, as
+ * the text paths do. The decoded Rle1 rows must match the Mono1 rows, and the
+ * flash used by the glyphs of both formats is reported along with the time
+ * needed to read a glyph.
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#include <string.h>
+
+#include "fonts.hpp"
+#include "glyph_row_reader.hpp"
+#include "host_test.hpp"
+
+namespace {
+
+using disco::Font;
+
+constexpr uint32_t kNbrOfPasses = 2000;
+
+struct FontPair {
+    const char* pName;
+    const Font* pMono;
+    const Font* pRle;
+};
+
+/**
+ * @brief  Gets the flash used by the glyph table of a font, with the glyph
+ *         offsets of Rle1 fonts.
+ */
+uint32_t getFlashSize(const Font* pFont) {
+    uint32_t nbrOfGlyphs = disco::getNbrOfGlyphs(pFont);
+    if (pFont->format == disco::FontFormat::Rle1) {
+        return pFont->glyphOffsets[nbrOfGlyphs] + (nbrOfGlyphs + 1) * sizeof(uint16_t);
+    }
+    return nbrOfGlyphs * disco::getBytesPerGlyph(pFont);
+}
+
+/**
+ * @brief  Reads all glyphs of a font, returning a checksum of the rows so that
+ *         the decoding is not optimized away.
+ */
+uint32_t readAllGlyphs(const Font* pFont) {
+    uint32_t checksum    = 0;
+    uint32_t bytesPerRow = disco::getBytesPerRow(pFont);
+    for (uint32_t glyph = 0; glyph < disco::getNbrOfGlyphs(pFont); glyph++) {
+        disco::GlyphRowReader reader(pFont, glyph);
+        for (uint32_t row = 0; row < pFont->height; row++) {
+            const uint8_t* pRow = reader.nextRow();
+            for (uint32_t i = 0; i < bytesPerRow; i++) {
+                checksum = checksum * 31 + pRow[i];
+            }
+        }
+    }
+    return checksum;
+}
+
+/**
+ * @brief  Gets the time needed to read one glyph, in nanoseconds.
+ */
+double measureDecoding(const Font* pFont, uint32_t* pChecksum) {
+    disco::test::Stopwatch stopwatch;
+    for (uint32_t pass = 0; pass < kNbrOfPasses; pass++) {
+        *pChecksum = readAllGlyphs(pFont);
+    }
+    return stopwatch.getElapsedNs() / (kNbrOfPasses * disco::getNbrOfGlyphs(pFont));
+}
+
+/**
+ * @brief  Checks that both fonts of a pair decode to the same rows.
+ */
+void checkRows(const FontPair& pair) {
+    uint32_t bytesPerRow = disco::getBytesPerRow(pair.pMono);
+    for (uint32_t glyph = 0; glyph < disco::getNbrOfGlyphs(pair.pMono); glyph++) {
+        disco::GlyphRowReader monoReader(pair.pMono, glyph);
+        disco::GlyphRowReader rleReader(pair.pRle, glyph);
+        for (uint32_t row = 0; row < pair.pMono->height; row++) {
+            // rows are only valid until the next call, compare them one at a time
+            const uint8_t* pMonoRow = monoReader.nextRow();
+            const uint8_t* pRleRow  = rleReader.nextRow();
+            DISCO_CHECK(memcmp(pMonoRow, pRleRow, bytesPerRow) == 0);
+        }
+    }
+}
+
+}  // namespace
+
+int main() {
+    const FontPair pairs[] = {{"Font18", &disco::kFont18, &disco::kFont18Rle},
+                              {"Font24", &disco::kFont24, &disco::kFont24Rle},
+                              {"Font26b", &disco::kFont26b, &disco::kFont26bRle},
+                              {"Font36", &disco::kFont36, &disco::kFont36Rle},
+                              {"Font36b", &disco::kFont36b, &disco::kFont36bRle}};
+
+    printf("%-8s %10s %10s %7s %12s %12s\n",
+           "font",
+           "Mono1 [B]",
+           "Rle1 [B]",
+           "ratio",
+           "Mono1 [ns]",
+           "Rle1 [ns]");
+    uint32_t totalMono = 0;
+    uint32_t totalRle  = 0;
+    for (const FontPair& pair : pairs) {
+        uint32_t nbrOfGlyphs = disco::getNbrOfGlyphs(pair.pMono);
+        DISCO_CHECK(nbrOfGlyphs == disco::getNbrOfGlyphs(pair.pRle));
+        DISCO_CHECK(pair.pMono->width == pair.pRle->width);
+        DISCO_CHECK(pair.pMono->height == pair.pRle->height);
+        checkRows(pair);
+
+        uint32_t monoChecksum = 0;
+        uint32_t rleChecksum  = 0;
+        double monoNs         = measureDecoding(pair.pMono, &monoChecksum);
+        double rleNs          = measureDecoding(pair.pRle, &rleChecksum);
+        DISCO_CHECK(monoChecksum == rleChecksum);
+
+        uint32_t monoSize = getFlashSize(pair.pMono);
+        uint32_t rleSize  = getFlashSize(pair.pRle);
+        totalMono += monoSize;
+        totalRle += rleSize;
+        printf("%-8s %10u %10u %6.1f%% %12.1f %12.1f\n",
+               pair.pName,
+               monoSize,
+               rleSize,
+               100.0 * rleSize / monoSize,
+               monoNs,
+               rleNs);
+    }
+    printf("%-8s %10u %10u %6.1f%%\n",
+           "total",
+           totalMono,
+           totalRle,
+           100.0 * totalRle / totalMono);
+
+    return disco::test::getExitCode();
+}
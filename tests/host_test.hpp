@@ -0,0 +1,79 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file host_test.hpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Minimal checks and timing for the host tests and benchmarks
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <chrono>
+
+namespace disco {
+namespace test {
+
+// number of failed checks, reported by getExitCode()
+inline uint32_t& getNbrOfFailures() {
+    static uint32_t nbrOfFailures = 0;
+    return nbrOfFailures;
+}
+
+/**
+ * @brief  Reports the result of the checks.
+ * @retval Process exit code: 0 if all checks passed
+ */
+inline int getExitCode() {
+    uint32_t nbrOfFailures = getNbrOfFailures();
+    if (nbrOfFailures != 0) {
+        printf("%u check(s) failed\n", static_cast<unsigned>(nbrOfFailures));
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}
+
+class Stopwatch {
+   public:
+    Stopwatch() : start_(std::chrono::steady_clock::now()) {}
+
+    // elapsed time since construction, in nanoseconds
+    double getElapsedNs() const {
+        std::chrono::duration<double, std::nano> elapsed =
+            std::chrono::steady_clock::now() - start_;
+        return elapsed.count();
+    }
+
+   private:
+    std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace test
+}  // namespace disco
+
+#define DISCO_CHECK(condition)                                               \
+    do {                                                                     \
+        if (!(condition)) {                                                  \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            disco::test::getNbrOfFailures()++;                               \
+        }                                                                    \
+    } while (0)
@@ -0,0 +1,182 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file pixel_kernels_test.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Tests of the pixel kernels against a bit by bit reference
+ *
+ * Random mask rows are expanded from random bit offsets, with random lengths
+ * and destination alignments. Every pixel must match the per-bit reference,
+ * and the pixels around the row must be left untouched.
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#include <string.h>
+
+#include "host_test.hpp"
+#include "pixel_kernels.hpp"
+
+namespace {
+
+constexpr uint32_t kNbrOfRuns    = 20000;
+constexpr uint32_t kMaskSize     = 16;
+constexpr uint32_t kMaxNbrOfBits = 64;
+constexpr uint32_t kGuardSize    = 4;
+constexpr uint32_t kBufferSize   = kGuardSize + kMaxNbrOfBits + kGuardSize;
+constexpr uint8_t kGuardByte     = 0xA5;
+
+// xorshift32, deterministic so that a failure can be reproduced
+uint32_t getRandom() {
+    static uint32_t state = 0x12345678U;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+bool isBitSet(const uint8_t* pMask, uint32_t bit) {
+    return (pMask[bit / 8] & (0x80U >> (bit % 8))) != 0;
+}
+
+struct Case {
+    uint8_t mask[kMaskSize];
+    uint32_t firstBit;
+    uint32_t nbrOfPixels;
+    // first written pixel, past the guard, to test unaligned destinations
+    uint32_t start;
+};
+
+Case makeCase() {
+    Case testCase;
+    for (uint8_t& byte : testCase.mask) {
+        byte = static_cast<uint8_t>(getRandom());
+    }
+    testCase.firstBit    = getRandom() % (kMaskSize * 8 - kMaxNbrOfBits);
+    testCase.nbrOfPixels = getRandom() % (kMaxNbrOfBits + 1);
+    testCase.start       = kGuardSize + getRandom() % kGuardSize;
+    return testCase;
+}
+
+/**
+ * @brief  Checks the expanded pixels against the reference and that the pixels
+ *         outside of the row still hold the guard value.
+ */
+template <typename Pixel>
+bool checkRow(const Pixel* pBuffer, const Case& testCase, Pixel on, Pixel off) {
+    Pixel guard;
+    memset(&guard, kGuardByte, sizeof(guard));
+    for (uint32_t i = 0; i < kBufferSize; i++) {
+        Pixel expected = guard;
+        if (i >= testCase.start && i < testCase.start + testCase.nbrOfPixels) {
+            uint32_t bit = testCase.firstBit + i - testCase.start;
+            expected     = isBitSet(testCase.mask, bit) ? on : off;
+        }
+        if (pBuffer[i] != expected) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void testExpandMaskRow565() {
+    for (uint32_t run = 0; run < kNbrOfRuns; run++) {
+        Case testCase = makeCase();
+        auto on       = static_cast<uint16_t>(getRandom());
+        auto off      = static_cast<uint16_t>(getRandom());
+        uint16_t buffer[kBufferSize];
+        memset(buffer, kGuardByte, sizeof(buffer));
+        disco::expandMaskRow565(&buffer[testCase.start],
+                                testCase.mask,
+                                testCase.firstBit,
+                                testCase.nbrOfPixels,
+                                on,
+                                off);
+        DISCO_CHECK(checkRow(buffer, testCase, on, off));
+    }
+}
+
+void testExpandMaskRow8888() {
+    for (uint32_t run = 0; run < kNbrOfRuns; run++) {
+        Case testCase = makeCase();
+        uint32_t on   = getRandom();
+        uint32_t off  = getRandom();
+        uint32_t buffer[kBufferSize];
+        memset(buffer, kGuardByte, sizeof(buffer));
+        disco::expandMaskRow8888(&buffer[testCase.start],
+                                 testCase.mask,
+                                 testCase.firstBit,
+                                 testCase.nbrOfPixels,
+                                 on,
+                                 off);
+        DISCO_CHECK(checkRow(buffer, testCase, on, off));
+    }
+}
+
+void testExpandMaskRow8() {
+    for (uint32_t run = 0; run < kNbrOfRuns; run++) {
+        Case testCase = makeCase();
+        auto on       = static_cast<uint8_t>(getRandom());
+        auto off      = static_cast<uint8_t>(getRandom());
+        uint8_t buffer[kBufferSize];
+        memset(buffer, kGuardByte, sizeof(buffer));
+        disco::expandMaskRow8(&buffer[testCase.start],
+                              testCase.mask,
+                              testCase.firstBit,
+                              testCase.nbrOfPixels,
+                              on,
+                              off);
+        DISCO_CHECK(checkRow(buffer, testCase, on, off));
+    }
+}
+
+void testFillRows() {
+    for (uint32_t run = 0; run < kNbrOfRuns; run++) {
+        Case testCase = makeCase();
+        // a mask of set bits turns the reference into a fill
+        memset(testCase.mask, 0xFF, sizeof(testCase.mask));
+        uint32_t color = getRandom();
+
+        uint8_t buffer8[kBufferSize];
+        memset(buffer8, kGuardByte, sizeof(buffer8));
+        auto index = static_cast<uint8_t>(color);
+        disco::fillRow8(&buffer8[testCase.start], testCase.nbrOfPixels, index);
+        DISCO_CHECK(checkRow(buffer8, testCase, index, index));
+
+        uint16_t buffer565[kBufferSize];
+        memset(buffer565, kGuardByte, sizeof(buffer565));
+        auto color565 = static_cast<uint16_t>(color);
+        disco::fillRow565(&buffer565[testCase.start], testCase.nbrOfPixels, color565);
+        DISCO_CHECK(checkRow(buffer565, testCase, color565, color565));
+
+        uint32_t buffer8888[kBufferSize];
+        memset(buffer8888, kGuardByte, sizeof(buffer8888));
+        disco::fillRow8888(&buffer8888[testCase.start], testCase.nbrOfPixels, color);
+        DISCO_CHECK(checkRow(buffer8888, testCase, color, color));
+    }
+}
+
+}  // namespace
+
+int main() {
+    testExpandMaskRow565();
+    testExpandMaskRow8888();
+    testExpandMaskRow8();
+    testFillRows();
+
+    return disco::test::getExitCode();
+}
@@ -0,0 +1,277 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file text_benchmark.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Benchmark of the text paths, run against the simulated DMA2D
+ *
+ * Draws the same text into an ARGB8888 frame buffer:
+ * - row by row, each expanded row being copied by its own DMA2D job, as
+ *   drawChar() does for glyphs that cannot be cached,
+ * - line by line through the text strip, with a single DMA2D copy per line, as
+ *   drawGlyphRun() does for glyphs that are expanded,
+ * - line by line through the text strip, each glyph being copied from the glyph
+ *   cache into the strip by its own DMA2D job, as drawCachedGlyphRun() does.
+ * All frame buffers must be identical. The host timings only give the
+ * relative CPU cost, the number of DMA2D jobs per glyph is what matters on the
+ * target, where each job costs its setup and completion interrupt.
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#include <algorithm>
+#include <vector>
+
+#include "dma2d_queue.hpp"
+#include "dma2d_sim_backend.hpp"
+#include "fonts.hpp"
+#include "glyph_cache.hpp"
+#include "glyph_row_reader.hpp"
+#include "host_test.hpp"
+#include "pixel_kernels.hpp"
+#include "text_strip.hpp"
+
+namespace {
+
+using disco::Dma2dColorMode;
+using disco::Dma2dJob;
+using disco::Dma2dOperation;
+using disco::Font;
+
+constexpr uint32_t kXSize       = 800;
+constexpr uint32_t kYSize       = 480;
+constexpr uint32_t kTextColor   = 0xFF000000U;
+constexpr uint32_t kBackColor   = 0xFFFFFFFFU;
+constexpr uint32_t kNbrOfPasses = 20;
+
+struct Result {
+    uint32_t nbrOfGlyphs;
+    uint32_t nbrOfJobs;
+    double elapsedNs;
+};
+
+/**
+ * @brief  Builds a copy job of ARGB8888 pixels into the frame buffer, or into a
+ *         buffer of another width.
+ */
+Dma2dJob makeCopyJob(const uint8_t* pSource,
+                     uint32_t* pDestination,
+                     uint32_t width,
+                     uint32_t height,
+                     uint32_t destinationWidth = kXSize) {
+    return {.operation         = Dma2dOperation::Copy,
+            .sourceMode        = Dma2dColorMode::ARGB8888,
+            .destinationMode   = Dma2dColorMode::ARGB8888,
+            .source            = reinterpret_cast<uintptr_t>(pSource),
+            .background        = 0,
+            .destination       = reinterpret_cast<uintptr_t>(pDestination),
+            .width             = static_cast<uint16_t>(width),
+            .height            = static_cast<uint16_t>(height),
+            .sourceOffset      = 0,
+            .backgroundOffset  = 0,
+            .destinationOffset = static_cast<uint16_t>(destinationWidth - width),
+            .color             = 0,
+            .pCallback         = nullptr,
+            .pContext          = nullptr};
+}
+
+/**
+ * @brief  Gets the glyph drawn at a position of the page: printable ASCII,
+ *         cycling so that a line does not repeat the previous one.
+ */
+uint32_t getGlyphIndex(uint32_t line, uint32_t column) {
+    return (line * 7 + column) % disco::kFontNbrOfGlyphs;
+}
+
+/**
+ * @brief  Fills the frame buffer with lines of text, one job per glyph row.
+ */
+Result drawByRows(disco::Dma2dQueue& queue, const Font* pFont, uint32_t* pFrame) {
+    uint32_t rowBuffer[disco::GlyphCache::kMaxGlyphWidth] = {0};
+    uint32_t nbrOfColumns                                  = kXSize / pFont->width;
+    uint32_t nbrOfLines                                    = kYSize / pFont->height;
+    Result result = {.nbrOfGlyphs = 0, .nbrOfJobs = 0, .elapsedNs = 0};
+
+    disco::test::Stopwatch stopwatch;
+    for (uint32_t pass = 0; pass < kNbrOfPasses; pass++) {
+        for (uint32_t line = 0; line < nbrOfLines; line++) {
+            for (uint32_t column = 0; column < nbrOfColumns; column++) {
+                disco::GlyphRowReader reader(pFont, getGlyphIndex(line, column));
+                uint32_t* pGlyph =
+                    &pFrame[line * pFont->height * kXSize + column * pFont->width];
+                for (uint32_t row = 0; row < pFont->height; row++) {
+                    disco::expandMaskRow8888(rowBuffer,
+                                             reader.nextRow(),
+                                             0,
+                                             pFont->width,
+                                             kTextColor,
+                                             kBackColor);
+                    uint8_t* pRow = reinterpret_cast<uint8_t*>(rowBuffer);
+                    // the row buffer is reused, the copy must be done first
+                    queue.wait(queue.submit(
+                        makeCopyJob(pRow, &pGlyph[row * kXSize], pFont->width, 1)));
+                    result.nbrOfJobs++;
+                }
+                result.nbrOfGlyphs++;
+            }
+        }
+    }
+    result.elapsedNs = stopwatch.getElapsedNs();
+    return result;
+}
+
+/**
+ * @brief  Fills the frame buffer with lines of text, one job per line.
+ */
+Result drawByStrips(disco::Dma2dQueue& queue, const Font* pFont, uint32_t* pFrame) {
+    disco::TextStrip strip;
+    uint16_t glyphs[kXSize] = {0};
+    uint32_t nbrOfColumns   = kXSize / pFont->width;
+    uint32_t nbrOfLines     = kYSize / pFont->height;
+    Result result           = {.nbrOfGlyphs = 0, .nbrOfJobs = 0, .elapsedNs = 0};
+
+    disco::test::Stopwatch stopwatch;
+    for (uint32_t pass = 0; pass < kNbrOfPasses; pass++) {
+        for (uint32_t line = 0; line < nbrOfLines; line++) {
+            for (uint32_t column = 0; column < nbrOfColumns; column++) {
+                glyphs[column] = static_cast<uint16_t>(getGlyphIndex(line, column));
+            }
+            // the previous copy of the strip must be done
+            queue.waitAll();
+            if (!strip.rasterize(
+                    pFont, glyphs, nbrOfColumns, kTextColor, kBackColor, 4)) {
+                DISCO_CHECK(false);
+                return result;
+            }
+            queue.submit(makeCopyJob(strip.getData(),
+                                     &pFrame[line * pFont->height * kXSize],
+                                     strip.getWidth(),
+                                     strip.getHeight()));
+            result.nbrOfJobs++;
+            result.nbrOfGlyphs += nbrOfColumns;
+        }
+    }
+    queue.waitAll();
+    result.elapsedNs = stopwatch.getElapsedNs();
+    return result;
+}
+
+/**
+ * @brief  Fills the frame buffer with lines of text, one job per cached glyph
+ *         copied into the strip and one job per line.
+ */
+Result drawByCachedStrips(disco::Dma2dQueue& queue,
+                          disco::GlyphCache& cache,
+                          const Font* pFont,
+                          uint32_t* pFrame) {
+    disco::TextStrip strip;
+    uint16_t glyphs[kXSize] = {0};
+    uint32_t nbrOfColumns   = kXSize / pFont->width;
+    uint32_t nbrOfLines     = kYSize / pFont->height;
+    Result result           = {.nbrOfGlyphs = 0, .nbrOfJobs = 0, .elapsedNs = 0};
+
+    disco::test::Stopwatch stopwatch;
+    for (uint32_t pass = 0; pass < kNbrOfPasses; pass++) {
+        for (uint32_t line = 0; line < nbrOfLines; line++) {
+            for (uint32_t column = 0; column < nbrOfColumns; column++) {
+                glyphs[column] = static_cast<uint16_t>(getGlyphIndex(line, column));
+            }
+            // the jobs run in order, the previous copy of the strip is done first
+            if (!strip.resize(pFont, glyphs, nbrOfColumns, 4)) {
+                DISCO_CHECK(false);
+                return result;
+            }
+            uint32_t* pStrip = reinterpret_cast<uint32_t*>(  // NOLINT
+                const_cast<uint8_t*>(strip.getData()));
+            for (uint32_t column = 0; column < nbrOfColumns; column++) {
+                uint32_t glyphIndex = glyphs[column];
+                uint32_t slot = cache.getSlot(pFont, glyphIndex, kTextColor, kBackColor);
+                // a miss rewrites the slot, which a queued copy may still read
+                if (!cache.isCached(pFont, glyphIndex, kTextColor, kBackColor)) {
+                    queue.wait(cache.getReaderJobId(slot));
+                }
+                const uint8_t* pGlyph =
+                    cache.getGlyph(pFont, glyphIndex, kTextColor, kBackColor);
+                uint32_t jobId = queue.submit(makeCopyJob(pGlyph,
+                                                          &pStrip[column * pFont->width],
+                                                          pFont->width,
+                                                          pFont->height,
+                                                          strip.getWidth()));
+                cache.setReaderJobId(slot, jobId);
+                result.nbrOfJobs++;
+            }
+            queue.submit(makeCopyJob(strip.getData(),
+                                     &pFrame[line * pFont->height * kXSize],
+                                     strip.getWidth(),
+                                     strip.getHeight()));
+            result.nbrOfJobs++;
+            result.nbrOfGlyphs += nbrOfColumns;
+        }
+    }
+    queue.waitAll();
+    result.elapsedNs = stopwatch.getElapsedNs();
+    return result;
+}
+
+void printResult(const char* pName, const Result& result) {
+    printf("  %-12s %5.2f jobs/glyph %7.1f ns/glyph %6.2f Mglyphs/s\n",
+           pName,
+           static_cast<double>(result.nbrOfJobs) / result.nbrOfGlyphs,
+           result.elapsedNs / result.nbrOfGlyphs,
+           1e3 * result.nbrOfGlyphs / result.elapsedNs);
+}
+
+}  // namespace
+
+int main() {
+    const Font* fonts[] = {&disco::kFont18, &disco::kFont24, &disco::kFont36};
+
+    disco::Dma2dSimBackend backend;
+    disco::Dma2dQueue queue(backend);
+    std::vector<uint8_t> cacheRegion(disco::GlyphCache::kRegionSize);
+    std::vector<uint32_t> referenceFrame(kXSize * kYSize, 0);
+    std::vector<uint32_t> frame(kXSize * kYSize, 0);
+    disco::GlyphCache cache;
+    cache.init(reinterpret_cast<uintptr_t>(cacheRegion.data()), 4);
+
+    printf("text paths (%u passes over a full screen)\n", kNbrOfPasses);
+    for (const Font* pFont : fonts) {
+        printf("font %ux%u\n", pFont->width, pFont->height);
+        std::fill(referenceFrame.begin(), referenceFrame.end(), 0);
+        Result byRows = drawByRows(queue, pFont, referenceFrame.data());
+        printResult("per row", byRows);
+
+        std::fill(frame.begin(), frame.end(), 0);
+        Result expanded = drawByStrips(queue, pFont, frame.data());
+        printResult("strip", expanded);
+        DISCO_CHECK(frame == referenceFrame);
+
+        cache.invalidate();
+        cache.resetStats();
+        std::fill(frame.begin(), frame.end(), 0);
+        Result fromCache = drawByCachedStrips(queue, cache, pFont, frame.data());
+        printResult("strip+cache", fromCache);
+        const disco::GlyphCache::Stats& stats = cache.getStats();
+        printf("  hit rate %.1f %%\n",
+               100.0 * stats.hits / (stats.hits + stats.misses));
+        uint32_t nbrOfLines = kNbrOfPasses * (kYSize / pFont->height);
+        DISCO_CHECK(fromCache.nbrOfJobs == fromCache.nbrOfGlyphs + nbrOfLines);
+        DISCO_CHECK(frame == referenceFrame);
+    }
+
+    return disco::test::getExitCode();
+}
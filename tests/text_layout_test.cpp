@@ -0,0 +1,153 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file text_layout_test.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Tests of the layout of paragraphs in a text box
+ *
+ * Lines must be wrapped at the last space that fits, words wider than the box
+ * broken where they overflow and '\n' must start a new line. Text that needs
+ * more lines than the box holds must end with an ellipsis.
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#include "fonts.hpp"
+#include "host_test.hpp"
+#include "text_layout.hpp"
+
+namespace {
+
+using disco::TextAlign;
+using disco::TextBox;
+using disco::TextLayout;
+
+// monospaced font, every glyph advances by its width
+const disco::Font* const pFont = &disco::kFont18;
+constexpr uint16_t kBoxX       = 5;
+constexpr uint16_t kBoxY       = 7;
+
+TextBox makeBox(uint32_t nbrOfColumns, uint32_t nbrOfLines) {
+    return {.x      = kBoxX,
+            .y      = kBoxY,
+            .width  = static_cast<uint16_t>(nbrOfColumns * pFont->width),
+            .height = static_cast<uint16_t>(nbrOfLines * pFont->height)};
+}
+
+bool hasLine(const TextLayout& layout,
+             uint32_t index,
+             uint32_t firstGlyph,
+             uint32_t nbrOfGlyphs) {
+    const disco::TextLine& line = layout.getLine(index);
+    return index < layout.getNbrOfLines() && line.firstGlyph == firstGlyph &&
+           line.nbrOfGlyphs == nbrOfGlyphs &&
+           line.y == kBoxY + index * pFont->height;
+}
+
+/**
+ * @brief  Lines are wrapped at the last space that fits, which is dropped, and
+ *         aligned in the box.
+ */
+void testWordWrap() {
+    TextLayout layout;
+    layout.compute(pFont, "abc def", makeBox(4, 3), TextAlign::Left);
+    DISCO_CHECK(layout.getNbrOfLines() == 2);
+    DISCO_CHECK(hasLine(layout, 0, 0, 3));
+    DISCO_CHECK(hasLine(layout, 1, 4, 3));
+    DISCO_CHECK(layout.getLine(1).x == kBoxX);
+    DISCO_CHECK(!layout.isTruncated());
+
+    layout.compute(pFont, "ab cd ef", makeBox(5, 3), TextAlign::Left);
+    DISCO_CHECK(layout.getNbrOfLines() == 2);
+    DISCO_CHECK(hasLine(layout, 0, 0, 2));
+    DISCO_CHECK(hasLine(layout, 1, 3, 5));
+
+    layout.compute(pFont, "ab", makeBox(5, 1), TextAlign::Center);
+    DISCO_CHECK(layout.getLine(0).x == kBoxX + 3 * pFont->width / 2);
+    layout.compute(pFont, "ab", makeBox(5, 1), TextAlign::Right);
+    DISCO_CHECK(layout.getLine(0).x == kBoxX + 3 * pFont->width);
+}
+
+/**
+ * @brief  A word wider than the box is broken where it overflows.
+ */
+void testLongWord() {
+    TextLayout layout;
+    layout.compute(pFont, "abcdefgh", makeBox(3, 3), TextAlign::Left);
+    DISCO_CHECK(layout.getNbrOfLines() == 3);
+    DISCO_CHECK(hasLine(layout, 0, 0, 3));
+    DISCO_CHECK(hasLine(layout, 1, 3, 3));
+    DISCO_CHECK(hasLine(layout, 2, 6, 2));
+    DISCO_CHECK(!layout.isTruncated());
+}
+
+/**
+ * @brief  '\n' ends the line, an empty line is kept.
+ */
+void testLineBreak() {
+    TextLayout layout;
+    layout.compute(pFont, "ab\ncd", makeBox(10, 3), TextAlign::Left);
+    DISCO_CHECK(layout.getNbrOfLines() == 2);
+    DISCO_CHECK(hasLine(layout, 0, 0, 2));
+    DISCO_CHECK(hasLine(layout, 1, 3, 2));
+
+    layout.compute(pFont, "ab\n\ncd", makeBox(10, 3), TextAlign::Left);
+    DISCO_CHECK(layout.getNbrOfLines() == 3);
+    DISCO_CHECK(hasLine(layout, 1, 3, 0));
+    DISCO_CHECK(hasLine(layout, 2, 4, 2));
+}
+
+/**
+ * @brief  Text that does not fit ends with an ellipsis on the last line.
+ */
+void testEllipsis() {
+    // the font has no ellipsis glyph, three dots are used
+    const uint16_t kDot = '.' - ' ';
+
+    TextLayout layout;
+    layout.compute(pFont, "abc def ghi", makeBox(4, 2), TextAlign::Left);
+    DISCO_CHECK(layout.isTruncated());
+    DISCO_CHECK(layout.getNbrOfLines() == 2);
+    DISCO_CHECK(hasLine(layout, 0, 0, 3));
+    // "d..." fills the four columns of the last line
+    DISCO_CHECK(hasLine(layout, 1, 4, 4));
+    const uint16_t* glyphs = layout.getGlyphs();
+    DISCO_CHECK(glyphs[4] == 'd' - ' ');
+    DISCO_CHECK(glyphs[5] == kDot && glyphs[6] == kDot && glyphs[7] == kDot);
+
+    // "ab " is short enough for the dots, without its trailing space
+    layout.compute(pFont, "ab cd efgh", makeBox(6, 1), TextAlign::Left);
+    DISCO_CHECK(layout.isTruncated());
+    DISCO_CHECK(hasLine(layout, 0, 0, 5));
+    DISCO_CHECK(layout.getGlyphs()[2] == kDot);
+
+    // not even one line fits
+    layout.compute(pFont, "abc", makeBox(4, 0), TextAlign::Left);
+    DISCO_CHECK(layout.isTruncated());
+    DISCO_CHECK(layout.getNbrOfLines() == 0);
+}
+
+}  // namespace
+
+int main() {
+    testWordWrap();
+    testLongWord();
+    testLineBreak();
+    testEllipsis();
+
+    return disco::test::getExitCode();
+}
@@ -0,0 +1,155 @@
+// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file text_slots_test.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Tests of the detection of the glyphs changed since the last draw
+ *
+ * With a monospaced font, only the glyphs between the first and the last
+ * difference are redrawn. With a proportional or kerned font, the range starts
+ * one glyph early and extends to the end of the run.
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+#include <string.h>
+
+#include "fonts.hpp"
+#include "host_test.hpp"
+#include "text_slots.hpp"
+
+namespace {
+
+using disco::Font;
+using disco::Rect;
+using disco::TextSlotCache;
+
+constexpr uint32_t kXPos      = 10;
+constexpr uint32_t kYPos      = 20;
+constexpr uint32_t kTextColor = 0xFF000000U;
+constexpr uint32_t kBackColor = 0xFFFFFFFFU;
+constexpr uint32_t kMaxLength = 16;
+
+// run of printable ASCII glyphs
+struct Run {
+    uint16_t glyphs[kMaxLength];
+    uint32_t nbrOfGlyphs;
+};
+
+Run makeRun(const char* text) {
+    Run run         = {.glyphs = {0}, .nbrOfGlyphs = 0};
+    run.nbrOfGlyphs = strlen(text);
+    for (uint32_t i = 0; i < run.nbrOfGlyphs; i++) {
+        run.glyphs[i] = static_cast<uint16_t>(text[i] - ' ');
+    }
+    return run;
+}
+
+Rect getArea(const Font* pFont, const Run& run) {
+    return {.x      = kXPos,
+            .y      = kYPos,
+            .width  = run.nbrOfGlyphs * pFont->width,
+            .height = pFont->height};
+}
+
+void store(TextSlotCache& cache, const Font* pFont, const char* text) {
+    Run run = makeRun(text);
+    cache.store(pFont,
+                kXPos,
+                kYPos,
+                kTextColor,
+                kBackColor,
+                run.glyphs,
+                run.nbrOfGlyphs,
+                getArea(pFont, run));
+}
+
+bool hasChanges(const TextSlotCache& cache,
+                const Font* pFont,
+                const char* text,
+                uint32_t first,
+                uint32_t end) {
+    Run run                    = makeRun(text);
+    TextSlotCache::Range range = cache.findChanges(
+        pFont, kXPos, kYPos, kTextColor, kBackColor, run.glyphs, run.nbrOfGlyphs);
+    return range.first == first && range.end == end;
+}
+
+/**
+ * @brief  Monospaced glyphs keep their cell, only the changed ones are redrawn.
+ */
+void testMonospaced() {
+    const Font* pFont = &disco::kFont18;
+    TextSlotCache cache;
+    // nothing remembered yet
+    DISCO_CHECK(hasChanges(cache, pFont, "12:30:45", 0, 8));
+
+    store(cache, pFont, "12:30:45");
+    DISCO_CHECK(hasChanges(cache, pFont, "12:30:45", 8, 8));
+    DISCO_CHECK(hasChanges(cache, pFont, "12:30:46", 7, 8));
+    DISCO_CHECK(hasChanges(cache, pFont, "12:31:45", 4, 5));
+    DISCO_CHECK(hasChanges(cache, pFont, "02:30:45", 0, 1));
+    DISCO_CHECK(hasChanges(cache, pFont, "02:30:46", 0, 8));
+    // a prefix of the previous string, or a longer string
+    DISCO_CHECK(hasChanges(cache, pFont, "12:30", 5, 5));
+    DISCO_CHECK(hasChanges(cache, pFont, "12:30:45.5", 8, 10));
+    DISCO_CHECK(hasChanges(cache, pFont, "12:31:45.5", 4, 10));
+
+    // other colors, or text drawn over the string
+    Run run                    = makeRun("12:30:46");
+    TextSlotCache::Range range = cache.findChanges(
+        pFont, kXPos, kYPos, kBackColor, kTextColor, run.glyphs, run.nbrOfGlyphs);
+    DISCO_CHECK(range.first == 0 && range.end == 8);
+    cache.invalidate({.x = kXPos + 3 * pFont->width, .y = 0, .width = 1, .height = 100});
+    DISCO_CHECK(hasChanges(cache, pFont, "12:30:46", 0, 8));
+}
+
+/**
+ * @brief  Proportional or kerned glyphs after the first change may move.
+ */
+void testProportional() {
+    // only the presence of the tables matters
+    static const disco::GlyphMetrics metrics[disco::kFontNbrOfGlyphs] = {};
+    static const disco::KerningPair kerning[] = {{.left = 0, .right = 0, .offset = 0}};
+
+    Font proportional        = disco::kFont18;
+    proportional.metrics     = metrics;
+    Font kerned              = disco::kFont18;
+    kerned.kerning           = kerning;
+    kerned.nbrOfKerningPairs = 1;
+    const Font* fonts[]      = {&proportional, &kerned};
+
+    for (const Font* pFont : fonts) {
+        TextSlotCache cache;
+        store(cache, pFont, "12:30:45");
+        DISCO_CHECK(hasChanges(cache, pFont, "12:30:45", 8, 8));
+        DISCO_CHECK(hasChanges(cache, pFont, "12:30", 5, 5));
+        DISCO_CHECK(hasChanges(cache, pFont, "12:31:45", 3, 8));
+        DISCO_CHECK(hasChanges(cache, pFont, "12:30:46", 6, 8));
+        DISCO_CHECK(hasChanges(cache, pFont, "02:30:45", 0, 8));
+        DISCO_CHECK(hasChanges(cache, pFont, "12:30:45.5", 7, 10));
+    }
+}
+
+}  // namespace
+
+int main() {
+    testMonospaced();
+    testProportional();
+
+    return disco::test::getExitCode();
+}
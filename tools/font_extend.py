@@ -0,0 +1,234 @@
+#!/usr/bin/env python3
+# Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Appends glyphs beyond printable ASCII to a 1-bpp font table.
+
+Usage:
+    tools/font_extend.py Wrappers/fonts36.cpp
+
+The extra glyphs are composed from the ASCII glyphs of the font itself: accents
+are taken from '`', '^', '.' and ',' and placed over (or under) the base
+letter, the degree sign is a reduced 'o' and the micro sign is a 'u' with a
+descender. The glyphs are appended after '~' in the table and their code points
+are written to the sorted <Name>_CodePoints table used for the glyph lookup.
+The file is updated in place, once: run tools/font_rle.py again afterwards.
+"""
+
+import re
+import sys
+
+NBR_OF_GLYPHS = 95
+
+# (code point, base character, mark, placement)
+EXTRA_GLYPHS = [
+    (0x00B0, "o", None, "degree"),
+    (0x00B5, "u", None, "micro"),
+    (0x00E0, "a", "`", "above"),
+    (0x00E2, "a", "^", "above"),
+    (0x00E4, "a", ":", "above"),
+    (0x00E7, "c", ",", "below"),
+    (0x00E8, "e", "`", "above"),
+    (0x00E9, "e", "'", "above"),
+    (0x00EA, "e", "^", "above"),
+    (0x00EB, "e", ":", "above"),
+    (0x00EE, "i", "^", "above"),
+    (0x00EF, "i", ":", "above"),
+    (0x00F4, "o", "^", "above"),
+    (0x00F6, "o", ":", "above"),
+    (0x00F9, "u", "`", "above"),
+    (0x00FB, "u", "^", "above"),
+    (0x00FC, "u", ":", "above"),
+]
+
+
+def parse_font(path):
+    source = open(path, encoding="utf-8").read()
+    name = re.search(r"const uint8_t (\w+)_Table\[\]", source).group(1)
+    block = re.search(r"_Table\[\] = \{(.*?)\n\};", source, re.S).group(1)
+    table = [int(v, 16) for v in re.findall(r"0x([0-9A-Fa-f]{2})\s*,", block)]
+    width, height = map(
+        int, re.search(r"Font \w+ = \{\s*\w+, (\d+), (\d+)", source).groups()
+    )
+    return source, name, table, width, height
+
+
+def get_glyph(table, char, width, height):
+    bytes_per_row = (width + 7) // 8
+    index = ord(char) - ord(" ")
+    glyph = table[index * height * bytes_per_row : (index + 1) * height * bytes_per_row]
+    return [
+        [
+            (glyph[row * bytes_per_row + col // 8] >> (7 - col % 8)) & 1
+            for col in range(width)
+        ]
+        for row in range(height)
+    ]
+
+
+def get_box(pixels):
+    rows = [y for y, row in enumerate(pixels) if any(row)]
+    cols = [x for row in pixels for x, pixel in enumerate(row) if pixel]
+    return min(cols), min(rows), max(cols), max(rows)
+
+
+def crop(pixels):
+    x0, y0, x1, y1 = get_box(pixels)
+    return [row[x0 : x1 + 1] for row in pixels[y0 : y1 + 1]]
+
+
+def get_mark(table, mark, width, height):
+    if mark == "'":
+        # acute: mirrored grave accent
+        return [row[::-1] for row in crop(get_glyph(table, "`", width, height))]
+    if mark == ":":
+        # diaeresis: two dots side by side
+        dot = crop(get_glyph(table, ".", width, height))
+        gap = [0] * len(dot[0])
+        return [row + gap + row for row in dot]
+    return crop(get_glyph(table, mark, width, height))
+
+
+def scale_rows(mark, nbr_of_rows):
+    if len(mark) <= nbr_of_rows:
+        return mark
+    return [mark[i * len(mark) // nbr_of_rows] for i in range(nbr_of_rows)]
+
+
+def paste(pixels, mark, x, y):
+    for j, row in enumerate(mark):
+        for i, pixel in enumerate(row):
+            if pixel and 0 <= y + j < len(pixels) and 0 <= x + i < len(pixels[0]):
+                pixels[y + j][x + i] = 1
+
+
+def compose(table, base, mark, placement, width, height):
+    pixels = get_glyph(table, base, width, height)
+    x0, y0, x1, y1 = get_box(pixels)
+    x_height = get_box(get_glyph(table, "x", width, height))[1]
+    center = (x0 + x1 + 1) // 2
+
+    if placement == "degree":
+        # 'o' reduced by two, its top aligned on the cap height
+        small = [
+            [
+                row[i] | (row[i + 1] if i + 1 < len(row) else 0)
+                for i in range(0, len(row), 2)
+            ]
+            for row in crop(pixels)[::2]
+        ]
+        top = get_box(get_glyph(table, "A", width, height))[1]
+        result = [[0] * width for _ in range(height)]
+        paste(result, small, (width - len(small[0])) // 2, top)
+        return result
+
+    if placement == "micro":
+        # extend the left stem of 'u' down to the descender of 'p'
+        descender = get_box(get_glyph(table, "p", width, height))[3]
+        middle = pixels[(y0 + y1) // 2]
+        stem = [x for x in range(x0, x1 + 1) if middle[x]]
+        stem = [x for x in stem if x < stem[0] + (len(stem) // 2 or 1)]
+        for y in range(y1 + 1, descender + 1):
+            for x in stem:
+                pixels[y][x] = 1
+        return pixels
+
+    if base == "i":
+        # dotless i
+        for y in range(x_height):
+            pixels[y] = [0] * width
+        x0, y0, x1, y1 = get_box(pixels)
+
+    if placement == "above":
+        # one blank row between the mark and the top of the letter
+        top = min(y0, x_height)
+        mark = scale_rows(mark, top - 2)
+        y = top - 1 - len(mark)
+    else:
+        mark = scale_rows(mark, height - y1 - 1)
+        y = y1 + 1
+    paste(pixels, mark, center - len(mark[0]) // 2, y)
+    return pixels
+
+
+def encode_glyph(pixels, width):
+    bytes_per_row = (width + 7) // 8
+    rows = []
+    for row in pixels:
+        data = [0] * bytes_per_row
+        for x, pixel in enumerate(row):
+            if pixel:
+                data[x // 8] |= 0x80 >> (x % 8)
+        rows.append(data)
+    return rows
+
+
+def extend_font(path):
+    source, name, table, width, height = parse_font(path)
+    if "_CodePoints" in source:
+        sys.exit("%s is already extended" % path)
+
+    bytes_per_glyph = (width + 7) // 8 * height
+    lines = []
+    for index, (code_point, base, mark, placement) in enumerate(EXTRA_GLYPHS):
+        if mark is not None:
+            mark = get_mark(table, mark, width, height)
+        pixels = compose(table, base, mark, placement, width, height)
+        lines.append(
+            "  // @%d '%s' (%d pixels wide)"
+            % ((NBR_OF_GLYPHS + index) * bytes_per_glyph, chr(code_point), width)
+        )
+        for data, row in zip(encode_glyph(pixels, width), pixels):
+            art = "".join("#" if pixel else " " for pixel in row).rstrip()
+            lines.append(
+                ("  " + " ".join("0x%02X," % v for v in data) + "  // " + art).rstrip()
+            )
+
+    code_points = "".join(
+        "\n  0x%04X,  // '%s'" % (code_point, chr(code_point))
+        for code_point, _, _, _ in EXTRA_GLYPHS
+    )
+    source = re.sub(
+        r"(_Table\[\] = \{.*?)\n\};\n",
+        lambda match: match.group(1)
+        + "\n"
+        + "\n".join(lines)
+        + "\n};\n\n"
+        + "const uint16_t %s_CodePoints[] = {" % name
+        + code_points
+        + "\n};\n",
+        source,
+        count=1,
+        flags=re.S,
+    )
+    source = re.sub(
+        r"constexpr Font (\w+) = \{\w+, (\d+), (\d+)\};",
+        lambda match: "constexpr Font %s = {\n"
+        "    %s_Table, %s, %s, FontFormat::Mono1, %s_CodePoints, %d};"
+        % (
+            match.group(1),
+            name,
+            match.group(2),
+            match.group(3),
+            name,
+            len(EXTRA_GLYPHS),
+        ),
+        source,
+    )
+    open(path, "w", encoding="utf-8").write(source)
+
+
+if __name__ == "__main__":
+    for font_path in sys.argv[1:]:
+        extend_font(font_path)
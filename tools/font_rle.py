@@ -0,0 +1,191 @@
+#!/usr/bin/env python3
+# Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Generates run-length compressed variants of the 1-bpp font tables.
+
+Usage:
+    tools/font_rle.py Wrappers/fonts36.cpp > Wrappers/fonts36_rle.cpp
+    tools/font_rle.py --stats Wrappers/fonts*.cpp
+
+Each glyph is stored as a sequence of run lengths (one byte each) over its
+pixels in row-major order. Runs alternate between background and foreground,
+starting with background. A run longer than 255 pixels is split as 255, 0, rest.
+The glyph offset index gives the position of the first run of each glyph,
+followed by the total size of the run table. The code points of the glyphs
+after '~', if any, are copied from the source font.
+"""
+
+import re
+import sys
+
+
+def parse_font(path):
+    source = open(path, encoding="utf-8").read()
+    name = re.search(r"const uint8_t (\w+)_Table\[\]", source).group(1)
+    block = re.search(r"_Table\[\] = \{(.*?)\n\};", source, re.S).group(1)
+    table = [int(v, 16) for v in re.findall(r"0x([0-9A-Fa-f]{2})\s*,", block)]
+    width, height = map(
+        int, re.search(r"Font \w+ = \{\s*\w+, (\d+), (\d+)", source).groups()
+    )
+    # code points of the glyphs after '~' (see tools/font_extend.py)
+    match = re.search(r"_CodePoints\[\] = \{(.*?)\n\};", source, re.S)
+    code_points = re.findall(r"0x[0-9A-Fa-f]{4},.*", match.group(1)) if match else []
+    return name, table, width, height, code_points
+
+
+def encode_glyph(table, index, width, height):
+    bytes_per_row = (width + 7) // 8
+    glyph = table[index * height * bytes_per_row : (index + 1) * height * bytes_per_row]
+    pixels = []
+    for row in range(height):
+        for col in range(width):
+            byte = glyph[row * bytes_per_row + col // 8]
+            pixels.append((byte >> (7 - col % 8)) & 1)
+
+    # run lengths, alternating background and foreground
+    lengths = []
+    color = 0
+    length = 0
+    for pixel in pixels:
+        if pixel != color:
+            lengths.append(length)
+            color = pixel
+            length = 0
+        length += 1
+    lengths.append(length)
+    # trailing background pixels are implicit
+    if len(lengths) % 2 == 1:
+        lengths.pop()
+
+    runs = []
+    for length in lengths:
+        while length > 255:
+            runs += [255, 0]
+            length -= 255
+        runs.append(length)
+    return runs
+
+
+def encode_font(table, width, height):
+    data = []
+    offsets = []
+    for index in range(len(table) // ((width + 7) // 8 * height)):
+        offsets.append(len(data))
+        data += encode_glyph(table, index, width, height)
+    offsets.append(len(data))
+    return data, offsets
+
+
+def emit_font(name, width, height, code_points):
+    fields = [
+        "%sRle_Table" % name,
+        "%d" % width,
+        "%d" % height,
+        "FontFormat::Rle1",
+        "%sRle_CodePoints" % name if code_points else "nullptr",
+        "%d" % len(code_points),
+        "%sRle_Offsets" % name,
+    ]
+    prefix = "constexpr Font kFont%sRle = {" % name[len("Font") :]
+    return prefix + (",\n" + " " * len(prefix)).join(fields) + "};\n\n"
+
+
+def emit_code_points(name, code_points):
+    if not code_points:
+        return ""
+    return (
+        "\nconst uint16_t %sRle_CodePoints[] = {\n" % name
+        + "\n".join("  " + v for v in code_points)
+        + "\n};\n"
+    )
+
+
+def emit_source(path):
+    name, table, width, height, code_points = parse_font(path)
+    data, offsets = encode_font(table, width, height)
+    lines = []
+    for i in range(0, len(data), 12):
+        lines.append("  " + " ".join("0x%02X," % v for v in data[i : i + 12]))
+    offset_lines = []
+    for i in range(0, len(offsets), 8):
+        offset_lines.append(
+            "  " + " ".join("%5d," % v for v in offsets[i : i + 8])
+        )
+    size = name[len("Font"):]
+    print(
+        HEADER.format(size=size, path=path.split("/")[-1])
+        + "namespace disco {\n"
+        + "// clang-format off\n"
+        + "const uint8_t %sRle_Table[] = {\n" % name
+        + "\n".join(lines)
+        + "\n};\n\n"
+        + "const uint16_t %sRle_Offsets[] = {\n" % name
+        + "\n".join(offset_lines)
+        + "\n};\n"
+        + emit_code_points(name, code_points)
+        + "// clang-format on\n\n"
+        + emit_font(name, width, height, code_points)
+        + "}  // namespace disco"
+    )
+
+
+def print_stats(paths):
+    print("%-14s %10s %10s %8s %12s" % ("font", "raw", "rle", "ratio", "bytes/glyph"))
+    for path in paths:
+        name, table, width, height, code_points = parse_font(path)
+        data, offsets = encode_font(table, width, height)
+        raw = len(table)
+        rle = len(data) + 2 * len(offsets)
+        print(
+            "%-14s %10d %10d %7.1f%% %12.1f"
+            % (name, raw, rle, 100.0 * rle / raw, len(data) / (len(offsets) - 1))
+        )
+
+
+HEADER = """// Copyright 2022 Haute école d'ingénierie et d'architecture de Fribourg
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/****************************************************************************
+ * @file fonts{size}_rle.cpp
+ * @author Serge Ayer <serge.ayer@hefr.ch>
+ *
+ * @brief Run-length compressed font (size {size}), generated from {path}
+ *        by tools/font_rle.py
+ *
+ * @date 2026-10-17
+ * @version 0.0.1
+ ***************************************************************************/
+
+/* Includes ------------------------------------------------------------------*/
+#include "fonts.hpp"
+
+"""
+
+if __name__ == "__main__":
+    if len(sys.argv) > 1 and sys.argv[1] == "--stats":
+        print_stats(sys.argv[2:])
+    else:
+        emit_source(sys.argv[1])